@@ -0,0 +1,81 @@
+#
+# Convert binary log file (default.bin) to CSV log file (default.csv)
+#
+# arg[1] : read_file_tag : time tag for default binary output log file. ex. 220627_142946
+#
+
+#
+# Import
+#
+import struct
+import numpy as np
+# local function
+from common import find_latest_log_tag
+from common import add_log_file_arguments
+# arguments
+import argparse
+
+# Arguments
+aparser = argparse.ArgumentParser()
+aparser = add_log_file_arguments(aparser)
+args = aparser.parse_args()
+
+#
+# Read Arguments
+#
+# log file path
+path_to_logs = args.logs_dir
+
+read_file_tag = args.file_tag
+if read_file_tag == None:
+  print("file tag does not found. use latest.")
+  read_file_tag = find_latest_log_tag(path_to_logs)
+
+print("log: " + read_file_tag)
+
+#
+# Binary file read
+#
+read_file_name  = path_to_logs + '/' + 'logs_' + read_file_tag + '/' + read_file_tag + '_default.bin'
+write_file_name = path_to_logs + '/' + 'logs_' + read_file_tag + '/' + read_file_tag + '_default.csv'
+
+with open(read_file_name, 'rb') as f:
+  magic = f.read(8)
+  if magic != b'S2EBLOG\0':
+    raise ValueError(read_file_name + " is not a S2E binary log file.")
+  # Byte order mark written in the byte order of the simulator (version 1 files have no mark and are little endian)
+  byte_order_mark = f.read(4)
+  if struct.unpack('<I', byte_order_mark)[0] == 0x01020304:
+    byte_order = '<'
+    version, number_of_columns = struct.unpack(byte_order + 'II', f.read(8))
+  elif struct.unpack('>I', byte_order_mark)[0] == 0x01020304:
+    byte_order = '>'
+    version, number_of_columns = struct.unpack(byte_order + 'II', f.read(8))
+  else:
+    byte_order = '<'
+    version, = struct.unpack(byte_order + 'I', byte_order_mark)
+    number_of_columns, = struct.unpack(byte_order + 'I', f.read(4))
+  column_names = []
+  for i in range(number_of_columns):
+    name_length, = struct.unpack(byte_order + 'I', f.read(4))
+    column_names.append(f.read(name_length).decode('utf-8'))
+
+  chunks = []
+  while True:
+    row_bytes = f.read(4)
+    if len(row_bytes) < 4:
+      break
+    number_of_rows, = struct.unpack(byte_order + 'I', row_bytes)
+    chunk = np.fromfile(f, dtype=byte_order + 'f8', count=number_of_rows * number_of_columns)
+    chunks.append(chunk.reshape(number_of_columns, number_of_rows).T)
+
+#
+# CSV file write
+#
+with open(write_file_name, 'w') as f:
+  f.write(','.join(column_names) + ',\n')
+  for chunk in chunks:
+    for row in chunk:
+      f.write(','.join(['%.16g' % value for value in row]) + ',\n')
+
+print("converted: " + write_file_name)
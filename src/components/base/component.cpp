@@ -32,7 +32,6 @@ Component::Component(const Component& object) {
 Component::~Component() { clock_generator_->RemoveComponent(this); }
 
 void Component::Tick(const unsigned int count) {
-  if (count % prescaler_ > 0) return;
   if (power_port_->GetIsOn()) {
     MainRoutine(count);
   } else {
@@ -41,10 +40,14 @@ void Component::Tick(const unsigned int count) {
 }
 
 void Component::FastTick(const unsigned int fast_count) {
-  if (fast_count % fast_prescaler_ > 0) return;
+  UNUSED(fast_count);
   if (power_port_->GetIsOn()) {
     FastUpdate();
   } else {
     PowerOffRoutine();
   }
 }
+
+void Component::BeginTick(const unsigned int count) { UNUSED(count); }
+
+void Component::EndTick(const unsigned int count) { UNUSED(count); }
@@ -51,14 +51,34 @@ class Component : public ITickable {
   // Override functions for ITickable
   /**
    * @fn Tick
-   * @brief The methods to input clock. This will be called periodically.
+   * @brief The methods to input clock. This will be called periodically with the prescaler.
    */
   virtual void Tick(const unsigned int count);
   /**
    * @fn FastTick
-   * @brief The methods to input fast clock. This will be called periodically.
+   * @brief The methods to input fast clock. This will be called periodically with the fast prescaler.
    */
   virtual void FastTick(const unsigned int fast_count);
+  /**
+   * @fn GetPrescaler
+   * @brief Return the frequency scale factor for normal update
+   */
+  inline unsigned int GetPrescaler() const override { return prescaler_; }
+  /**
+   * @fn GetFastPrescaler
+   * @brief Return the frequency scale factor for fast update
+   */
+  inline unsigned int GetFastPrescaler() const override { return fast_prescaler_; }
+  /**
+   * @fn BeginTick
+   * @brief The methods called before all components are ticked. Nothing happened in default.
+   */
+  virtual void BeginTick(const unsigned int count);
+  /**
+   * @fn EndTick
+   * @brief The methods called after all components are ticked. Nothing happened in default.
+   */
+  virtual void EndTick(const unsigned int count);
 
  protected:
   unsigned int prescaler_;           //!< Frequency scale factor for normal update
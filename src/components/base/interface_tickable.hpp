@@ -15,14 +15,38 @@ class ITickable {
   /**
    * @fn Tick
    * @brief Pure virtual function to update clock of components
+   * @note It is called only at the counts which are multiples of GetPrescaler.
    */
   virtual void Tick(const unsigned int count) = 0;
   /**
    * @fn FastTick
    * @brief Pure virtual function to update clock faster than the base component update period of components
-   * @note Usec ase: Calculate high-frequency disturbances
+   * @note Usec ase: Calculate high-frequency disturbances. It is called only at the counts which are multiples of GetFastPrescaler when the fast
+   *       update flag is set.
    */
   virtual void FastTick(const unsigned int fast_count) = 0;
+  /**
+   * @fn GetPrescaler
+   * @brief Pure virtual function to return the frequency scale factor for Tick
+   */
+  virtual unsigned int GetPrescaler() const = 0;
+  /**
+   * @fn GetFastPrescaler
+   * @brief Pure virtual function to return the frequency scale factor for FastTick
+   */
+  virtual unsigned int GetFastPrescaler() const = 0;
+  /**
+   * @fn BeginTick
+   * @brief Pure virtual function called before all components are ticked
+   * @note Use case: Wait for the process executed in another thread. It is called only when the tick synchronization flag is set.
+   */
+  virtual void BeginTick(const unsigned int count) = 0;
+  /**
+   * @fn EndTick
+   * @brief Pure virtual function called after all components are ticked
+   * @note Use case: Start the process executed in another thread. It is called only when the tick synchronization flag is set.
+   */
+  virtual void EndTick(const unsigned int count) = 0;
 
   // Whether or not high-frequency disturbances need to be calculated
   /**
@@ -36,8 +60,21 @@ class ITickable {
    */
   inline void SetNeedsFastUpdate(const bool need_fast_update) { needs_fast_update_ = need_fast_update; }
 
+  // Whether or not BeginTick and EndTick need to be called
+  /**
+   * @fn GetNeedsTickSynchronization
+   * @brief Return tick synchronization flag
+   */
+  inline bool GetNeedsTickSynchronization() { return needs_tick_synchronization_; }
+  /**
+   * @fn SetNeedsTickSynchronization
+   * @brief Set tick synchronization flag
+   */
+  inline void SetNeedsTickSynchronization(const bool needs_tick_synchronization) { needs_tick_synchronization_ = needs_tick_synchronization; }
+
  protected:
-  bool needs_fast_update_ = false;  //!< Whether or not high-frequency disturbances need to be calculated
+  bool needs_fast_update_ = false;           //!< Whether or not high-frequency disturbances need to be calculated
+  bool needs_tick_synchronization_ = false;  //!< Whether or not BeginTick and EndTick need to be called
 };
 
 #endif  // S2E_COMPONENTS_BASE_CLASSES_INTERFACE_TICKABLE_HPP_
@@ -0,0 +1,124 @@
+/**
+ * @file test_uart_communication_with_obc.cpp
+ * @brief Test codes for UartCommunicationWithObc class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <library/utilities/macros.hpp>
+#include <vector>
+
+#include "uart_communication_with_obc.hpp"
+
+/**
+ * @class UartCommunicationWithObcForTest
+ * @brief Component which exposes the command functions of UartCommunicationWithObc
+ */
+class UartCommunicationWithObcForTest : public UartCommunicationWithObc {
+ public:
+  UartCommunicationWithObcForTest(const unsigned int sils_port_id, OnBoardComputer* obc) : UartCommunicationWithObc(sils_port_id, obc) {}
+  UartCommunicationWithObcForTest(const unsigned int hils_port_id, HilsPortManager* hils_port_manager)
+      : UartCommunicationWithObc(hils_port_id, 115200, hils_port_manager) {}
+
+  int PeekCommand(RingBufferSpan& span) { return UartCommunicationWithObc::PeekCommand(span); }
+  int CommitCommand(const unsigned int length) { return UartCommunicationWithObc::CommitCommand(length); }
+  int ReceiveCommand(const unsigned int length) { return UartCommunicationWithObc::ReceiveCommand(0, length); }
+  const std::vector<unsigned char>& GetRxBuffer() const { return rx_buffer_; }
+
+ private:
+  int ParseCommand(const int command_size) override { return command_size; }
+  int GenerateTelemetry() override { return 0; }
+};
+
+/**
+ * @class HilsPortManagerForTest
+ * @brief HILS port manager whose received data is set directly without the device
+ */
+class HilsPortManagerForTest : public HilsPortManager {
+ public:
+  int UartConnectComPort(unsigned int port_id, unsigned int baud_rate, unsigned int tx_buffer_size, unsigned int rx_buffer_size) override {
+    UNUSED(port_id);
+    UNUSED(baud_rate);
+    UNUSED(tx_buffer_size);
+    UNUSED(rx_buffer_size);
+    return 0;
+  }
+  int UartCloseComPort(unsigned int port_id) override {
+    UNUSED(port_id);
+    return 0;
+  }
+  int UartPeekReceived(unsigned int port_id, RingBufferSpan& span) override {
+    UNUSED(port_id);
+    span = RingBufferSpan{received_data_.data(), (unsigned int)received_data_.size(), nullptr, 0};
+    return (int)span.GetSize();
+  }
+  int UartCommitReceived(unsigned int port_id, unsigned int length) override {
+    UNUSED(port_id);
+    received_data_.erase(received_data_.begin(), received_data_.begin() + length);
+    return 0;
+  }
+
+  std::vector<unsigned char> received_data_;  //!< Data received from the device
+};
+
+/**
+ * @brief Test for the command data peeked and committed in the SILS mode
+ * @note The SILS mode is available only without the HILS build, and the commands fail with the error otherwise
+ */
+TEST(UartCommunicationWithObc, PeekCommandSils) {
+  ClockGenerator clock_generator;
+  OnBoardComputer obc(&clock_generator);
+  UartCommunicationWithObcForTest component(0, &obc);
+  RingBufferSpan span;
+#ifdef USE_HILS
+  // The SILS mode is not available in the HILS build
+  EXPECT_EQ(-1, component.PeekCommand(span));
+#else
+  ASSERT_TRUE(component.IsConnected());
+
+  unsigned char command[5] = {1, 2, 3, 4, 5};
+  obc.SendFromObc(0, command, 0, 5);
+
+  // The data is kept until it is committed
+  EXPECT_EQ(5, component.PeekCommand(span));
+  EXPECT_EQ(5, component.PeekCommand(span));
+  ASSERT_EQ(5u, span.first_size);
+  EXPECT_EQ(1, span.first_data[0]);
+  EXPECT_EQ(5, span.first_data[4]);
+
+  EXPECT_EQ(0, component.CommitCommand(3));
+  EXPECT_EQ(2, component.PeekCommand(span));
+  EXPECT_EQ(4, span.first_data[0]);
+
+  // The rest is read with ReceiveCommand
+  EXPECT_EQ(2, component.ReceiveCommand(2));
+  EXPECT_EQ(5, component.GetRxBuffer()[1]);
+  EXPECT_EQ(0, component.PeekCommand(span));
+#endif
+}
+
+/**
+ * @brief Test for the command data peeked and committed in the HILS mode
+ * @note The HILS mode is available only in the HILS build, and the commands fail with the error otherwise
+ */
+TEST(UartCommunicationWithObc, PeekCommandHils) {
+  HilsPortManagerForTest hils_port_manager;
+  hils_port_manager.received_data_ = {1, 2, 3, 4, 5};
+  UartCommunicationWithObcForTest component(0, &hils_port_manager);
+
+  RingBufferSpan span;
+#ifdef USE_HILS
+  ASSERT_TRUE(component.IsConnected());
+  EXPECT_EQ(5, component.PeekCommand(span));
+  EXPECT_EQ(5, component.PeekCommand(span));
+  EXPECT_EQ(1, span.first_data[0]);
+  EXPECT_EQ(0, component.CommitCommand(3));
+  EXPECT_EQ(2, component.PeekCommand(span));
+  EXPECT_EQ(4, span.first_data[0]);
+#else
+  EXPECT_FALSE(component.IsConnected());
+  EXPECT_EQ(-1, component.PeekCommand(span));
+  EXPECT_EQ(0u, span.GetSize());
+  EXPECT_EQ(-1, component.CommitCommand(3));
+  EXPECT_EQ(5u, hils_port_manager.received_data_.size());
+#endif
+}
@@ -155,6 +155,32 @@ int UartCommunicationWithObc::ReceiveCommand(const unsigned int offset, const un
       ;
   }
 }
+
+int UartCommunicationWithObc::PeekCommand(RingBufferSpan& span) {
+  span = RingBufferSpan{nullptr, 0, nullptr, 0};
+  switch (simulation_mode_) {
+    case SimulationMode::kSils:
+      span = obc_->PeekReceivedByCompo(sils_port_id_);
+      return (int)span.GetSize();
+    case SimulationMode::kHils:
+      return hils_port_manager_->UartPeekReceived(hils_port_id_, span);
+    default:
+      return -1;
+  }
+}
+
+int UartCommunicationWithObc::CommitCommand(const unsigned int length) {
+  switch (simulation_mode_) {
+    case SimulationMode::kSils:
+      obc_->CommitReceivedByCompo(sils_port_id_, length);
+      return 0;
+    case SimulationMode::kHils:
+      return hils_port_manager_->UartCommitReceived(hils_port_id_, length);
+    default:
+      return -1;
+  }
+}
+
 int UartCommunicationWithObc::SendTelemetry(const unsigned int offset) {
   if (simulation_mode_ == SimulationMode::kError) return -1;
   int tlm_size = GenerateTelemetry();
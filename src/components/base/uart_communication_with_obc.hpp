@@ -92,6 +92,21 @@ class UartCommunicationWithObc {
  protected:
   int ReceiveCommand(const unsigned int offset, const unsigned int rec_size);
   int SendTelemetry(const unsigned int offset);
+  /**
+   * @fn PeekCommand
+   * @brief Return the received command data without copying it to rx_buffer_. The data is kept until CommitCommand is called.
+   * @note The parser can wait for the whole frame without consuming the data. The HILS mode is supported only on Linux.
+   * @param [out] span: Received command data
+   * @return Size of the received data: success, -1: error
+   */
+  int PeekCommand(RingBufferSpan& span);
+  /**
+   * @fn CommitCommand
+   * @brief Release the command data returned by PeekCommand
+   * @param [in] length: Length of the parsed data
+   * @return 0: success, -1: error
+   */
+  int CommitCommand(const unsigned int length);
   std::vector<unsigned char> tx_buffer_;
   std::vector<unsigned char> rx_buffer_;
 
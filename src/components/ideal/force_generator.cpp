@@ -84,6 +84,15 @@ std::string ForceGenerator::GetLogValue() const {
   return str_tmp;
 }
 
+bool ForceGenerator::GetLogValueBinary(std::vector<double>& values) const {
+  AppendVector(values, ordered_force_b_N_);
+  AppendVector(values, generated_force_b_N_);
+  AppendVector(values, generated_force_i_N_);
+  AppendVector(values, generated_force_rtn_N_);
+
+  return true;
+}
+
 libra::Quaternion ForceGenerator::GenerateDirectionNoiseQuaternion(libra::Vector<3> true_direction, const double error_standard_deviation_rad) {
   libra::Vector<3> random_direction;
   random_direction[0] = direction_noise_;
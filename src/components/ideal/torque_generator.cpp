@@ -57,6 +57,13 @@ std::string TorqueGenerator::GetLogValue() const {
   return str_tmp;
 }
 
+bool TorqueGenerator::GetLogValueBinary(std::vector<double>& values) const {
+  AppendVector(values, ordered_torque_b_Nm_);
+  AppendVector(values, generated_torque_b_Nm_);
+
+  return true;
+}
+
 libra::Quaternion TorqueGenerator::GenerateDirectionNoiseQuaternion(libra::Vector<3> true_direction, const double error_standard_deviation_rad) {
   libra::Vector<3> random_direction;
   random_direction[0] = direction_noise_;
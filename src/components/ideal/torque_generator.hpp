@@ -58,6 +58,11 @@ class TorqueGenerator : public Component, public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
   // Getter
   /**
@@ -0,0 +1,125 @@
+/**
+ * @file benchmark_hils_uart_port.cpp
+ * @brief Benchmark of the HILS UART ports on Linux with pseudo terminals as the loopback devices
+ * @note Usage: benchmark_hils_uart_port [number of ports] [number of steps]
+ *       Each port sends a frame and reads the echoed data every 1 ms step. The default is 16 ports and 10000 steps.
+ */
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <components/ports/hils_epoll_service.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <simulation/hils/hils_port_manager.hpp>
+#include <thread>
+#include <vector>
+
+/**
+ * @fn EchoLoop
+ * @brief Echo the data written to the pseudo terminals like a device under test
+ * @param [in] master_file_descriptors: File descriptors of the master side of the pseudo terminals
+ * @param [in] is_stopped: Flag to stop the loop
+ */
+void EchoLoop(const std::vector<int>& master_file_descriptors, const std::atomic<bool>& is_stopped) {
+  std::vector<struct pollfd> poll_file_descriptors;
+  for (const int file_descriptor : master_file_descriptors) {
+    poll_file_descriptors.push_back({file_descriptor, POLLIN, 0});
+  }
+  unsigned char buffer[1024];
+  while (!is_stopped) {
+    if (poll(poll_file_descriptors.data(), poll_file_descriptors.size(), 10) <= 0) continue;
+    for (const auto& poll_file_descriptor : poll_file_descriptors) {
+      if (!(poll_file_descriptor.revents & POLLIN)) continue;
+      const ssize_t read_bytes = read(poll_file_descriptor.fd, buffer, sizeof(buffer));
+      if (read_bytes > 0 && write(poll_file_descriptor.fd, buffer, read_bytes) < 0) continue;
+    }
+  }
+}
+
+/**
+ * @fn main
+ * @brief Measure the time of the UART access of all ports in each step
+ */
+int main(int argc, char* argv[]) {
+  unsigned int number_of_ports = 16;
+  unsigned int number_of_steps = 10000;
+  if (argc > 1) number_of_ports = atoi(argv[1]);
+  if (argc > 2) number_of_steps = atoi(argv[2]);
+  const unsigned int kFrameSize = 32;
+
+  // Pseudo terminals
+  std::vector<int> master_file_descriptors;
+  for (unsigned int port_id = 0; port_id < number_of_ports; port_id++) {
+    const int master_file_descriptor = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (master_file_descriptor < 0 || grantpt(master_file_descriptor) != 0 || unlockpt(master_file_descriptor) != 0) {
+      std::cerr << "Error: pseudo terminal cannot be opened" << std::endl;
+      return 1;
+    }
+    HilsUartPort::SetPortName(port_id, ptsname(master_file_descriptor));
+    master_file_descriptors.push_back(master_file_descriptor);
+  }
+  std::atomic<bool> is_stopped(false);
+  std::thread echo_thread(EchoLoop, std::cref(master_file_descriptors), std::cref(is_stopped));
+
+  HilsPortManager port_manager;
+  for (unsigned int port_id = 0; port_id < number_of_ports; port_id++) {
+    if (port_manager.UartConnectComPort(port_id, 115200, 1024, 1024) != 0) {
+      std::cerr << "Error: port " << port_id << " cannot be connected" << std::endl;
+      return 1;
+    }
+  }
+
+  // 1 kHz simulation steps
+  const unsigned long long initial_number_of_wakes = HilsEpollService::GetInstance().GetNumberOfWakes();
+  std::vector<double> step_times_us;
+  unsigned char tx_frame[kFrameSize];
+  unsigned char rx_buffer[1024];
+  unsigned long long sent_bytes = 0;
+  unsigned long long received_bytes = 0;
+  auto next_step = std::chrono::steady_clock::now();
+  for (unsigned int step = 0; step < number_of_steps; step++) {
+    std::fill(tx_frame, tx_frame + kFrameSize, (unsigned char)step);
+    auto start = std::chrono::steady_clock::now();
+    // Same as the component update in Spacecraft::Update
+    HilsPortManager::HoldUartSend();
+    for (unsigned int port_id = 0; port_id < number_of_ports; port_id++) {
+      if (port_manager.UartSend(port_id, tx_frame, 0, kFrameSize) == 0) sent_bytes += kFrameSize;
+      const int ret = port_manager.UartReceive(port_id, rx_buffer, 0, sizeof(rx_buffer));
+      if (ret > 0) received_bytes += ret;
+    }
+    HilsPortManager::FlushUartSend();
+    step_times_us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+
+    next_step += std::chrono::milliseconds(1);
+    std::this_thread::sleep_until(next_step);
+  }
+  const unsigned long long number_of_wakes = HilsEpollService::GetInstance().GetNumberOfWakes() - initial_number_of_wakes;
+
+  // Remaining echoed data
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  for (unsigned int port_id = 0; port_id < number_of_ports; port_id++) {
+    int ret;
+    while ((ret = port_manager.UartReceive(port_id, rx_buffer, 0, sizeof(rx_buffer))) > 0) received_bytes += ret;
+    port_manager.UartCloseComPort(port_id);
+  }
+  is_stopped = true;
+  echo_thread.join();
+  for (const int master_file_descriptor : master_file_descriptors) close(master_file_descriptor);
+
+  double sum_us = 0.0;
+  for (const double step_time_us : step_times_us) sum_us += step_time_us;
+  std::sort(step_times_us.begin(), step_times_us.end());
+  std::cout << "Number of ports: " << number_of_ports << ", number of steps: " << number_of_steps << std::endl;
+  std::cout << "Step time mean: " << sum_us / step_times_us.size() << " us" << std::endl;
+  std::cout << "Step time p99:  " << step_times_us[(size_t)(step_times_us.size() * 0.99)] << " us" << std::endl;
+  std::cout << "Step time max:  " << step_times_us.back() << " us" << std::endl;
+  std::cout << "Wakeups of the I/O thread per step: " << (double)number_of_wakes / number_of_steps << std::endl;
+  std::cout << "Sent bytes: " << sent_bytes << ", echoed bytes: " << received_bytes << std::endl;
+
+  return 0;
+}
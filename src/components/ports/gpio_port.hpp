@@ -6,6 +6,7 @@
 #ifndef S2E_COMPONENTS_PORTS_GPIO_PORT_HPP_
 #define S2E_COMPONENTS_PORTS_GPIO_PORT_HPP_
 
+#include <atomic>
 #include <components/base/interface_gpio_component.hpp>
 
 #define GPIO_HIGH true
@@ -46,9 +47,9 @@ class GpioPort {
   bool DigitalRead();
 
  private:
-  const unsigned int kPortId;  //!< Port ID
-  IGPIOCompo* component_;      //!< Component which has the GPIO port
-  bool high_low_state_;        //!< GPIO High/Low state
+  const unsigned int kPortId;         //!< Port ID
+  IGPIOCompo* component_;             //!< Component which has the GPIO port
+  std::atomic<bool> high_low_state_;  //!< GPIO High/Low state (The OBC flight software can access it from another thread)
 };
 
 #endif  // S2E_COMPONENTS_PORTS_GPIO_PORT_HPP_
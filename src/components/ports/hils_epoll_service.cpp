@@ -0,0 +1,156 @@
+/**
+ * @file hils_epoll_service.cpp
+ * @brief Class to service the HILS ports on Linux with an epoll loop in an I/O thread
+ */
+
+#include "hils_epoll_service.hpp"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <iostream>
+
+#include "hils_uart_port.hpp"
+
+static std::atomic<bool> is_service_created(false);  //!< True when the service is created
+
+HilsEpollService& HilsEpollService::GetInstance() {
+  static HilsEpollService service;
+  return service;
+}
+
+bool HilsEpollService::IsCreated() { return is_service_created; }
+
+HilsEpollService::HilsEpollService() {
+  is_service_created = true;
+  epoll_file_descriptor_ = epoll_create1(EPOLL_CLOEXEC);
+  event_file_descriptor_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (epoll_file_descriptor_ < 0 || event_file_descriptor_ < 0) {
+    std::cerr << "HilsEpollService: epoll initialization error" << std::endl;
+    return;
+  }
+
+  struct epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.fd = event_file_descriptor_;
+  epoll_ctl(epoll_file_descriptor_, EPOLL_CTL_ADD, event_file_descriptor_, &event);
+
+  io_thread_ = std::thread([this]() { IoLoop(); });
+}
+
+HilsEpollService::~HilsEpollService() {
+  is_stopped_ = true;
+  Wake();
+  if (io_thread_.joinable()) io_thread_.join();
+  if (event_file_descriptor_ >= 0) close(event_file_descriptor_);
+  if (epoll_file_descriptor_ >= 0) close(epoll_file_descriptor_);
+}
+
+int HilsEpollService::AddPort(const int file_descriptor, HilsUartPort* port) {
+  if (epoll_file_descriptor_ < 0) return -1;
+
+  std::lock_guard<std::mutex> lock(ports_mutex_);
+  struct epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.fd = file_descriptor;
+  if (epoll_ctl(epoll_file_descriptor_, EPOLL_CTL_ADD, file_descriptor, &event) != 0) return -1;
+  ports_[file_descriptor] = port;
+  return 0;
+}
+
+void HilsEpollService::RemovePort(const int file_descriptor) {
+  // The lock waits for the I/O thread accessing the port
+  std::lock_guard<std::mutex> lock(ports_mutex_);
+  epoll_ctl(epoll_file_descriptor_, EPOLL_CTL_DEL, file_descriptor, nullptr);
+  ports_.erase(file_descriptor);
+}
+
+void HilsEpollService::RequestSend(const int file_descriptor) {
+  bool is_wake_required;
+  {
+    std::lock_guard<std::mutex> lock(pending_mutex_);
+    pending_file_descriptors_.push_back(file_descriptor);
+    // The I/O thread already woken up takes all requests added before it swaps the list
+    is_wake_required = number_of_holds_ == 0 && !is_wake_requested_;
+    if (is_wake_required) is_wake_requested_ = true;
+  }
+  if (is_wake_required) Wake();
+}
+
+void HilsEpollService::HoldSendRequests() {
+  std::lock_guard<std::mutex> lock(pending_mutex_);
+  number_of_holds_++;
+}
+
+void HilsEpollService::FlushSendRequests() {
+  bool is_wake_required;
+  {
+    std::lock_guard<std::mutex> lock(pending_mutex_);
+    if (number_of_holds_ > 0) number_of_holds_--;
+    is_wake_required = number_of_holds_ == 0 && !is_wake_requested_ && !pending_file_descriptors_.empty();
+    if (is_wake_required) is_wake_requested_ = true;
+  }
+  if (is_wake_required) Wake();
+}
+
+void HilsEpollService::Wake() {
+  number_of_wakes_++;
+  const uint64_t value = 1;
+  // The counter is only used to wake up the I/O thread, so the result is not checked
+  if (write(event_file_descriptor_, &value, sizeof(value)) < 0) return;
+}
+
+void HilsEpollService::SetWriteEvent(const int file_descriptor, const bool is_enabled) {
+  struct epoll_event event = {};
+  event.events = is_enabled ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+  event.data.fd = file_descriptor;
+  epoll_ctl(epoll_file_descriptor_, EPOLL_CTL_MOD, file_descriptor, &event);
+}
+
+void HilsEpollService::IoLoop() {
+  const int kMaxNumberOfEvents = 64;
+  struct epoll_event events[kMaxNumberOfEvents];
+  std::vector<int> pending_file_descriptors;
+
+  while (!is_stopped_) {
+    const int number_of_events = epoll_wait(epoll_file_descriptor_, events, kMaxNumberOfEvents, -1);
+    if (number_of_events < 0) continue;  // Interrupted by a signal
+
+    std::lock_guard<std::mutex> lock(ports_mutex_);
+    for (int i = 0; i < number_of_events; i++) {
+      const int file_descriptor = events[i].data.fd;
+      if (file_descriptor == event_file_descriptor_) {
+        uint64_t value;
+        if (read(event_file_descriptor_, &value, sizeof(value)) < 0) continue;
+        {
+          std::lock_guard<std::mutex> pending_lock(pending_mutex_);
+          pending_file_descriptors.swap(pending_file_descriptors_);
+          is_wake_requested_ = false;
+        }
+        for (const int pending_file_descriptor : pending_file_descriptors) {
+          auto port = ports_.find(pending_file_descriptor);
+          if (port == ports_.end()) continue;
+          if (port->second->SendToDevice()) SetWriteEvent(pending_file_descriptor, true);
+        }
+        pending_file_descriptors.clear();
+        continue;
+      }
+
+      auto port = ports_.find(file_descriptor);
+      if (port == ports_.end()) continue;  // Removed after epoll_wait
+      if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+        if (!port->second->ReceiveFromDevice()) {
+          // The peer is closed. The port keeps the received data until it is closed.
+          epoll_ctl(epoll_file_descriptor_, EPOLL_CTL_DEL, file_descriptor, nullptr);
+          ports_.erase(port);
+          continue;
+        }
+      }
+      if (events[i].events & EPOLLOUT) {
+        if (!port->second->SendToDevice()) SetWriteEvent(file_descriptor, false);
+      }
+    }
+  }
+}
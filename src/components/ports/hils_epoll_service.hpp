@@ -0,0 +1,124 @@
+/**
+ * @file hils_epoll_service.hpp
+ * @brief Class to service the HILS ports on Linux with an epoll loop in an I/O thread
+ */
+
+#ifndef S2E_COMPONENTS_PORTS_HILS_EPOLL_SERVICE_HPP_
+#define S2E_COMPONENTS_PORTS_HILS_EPOLL_SERVICE_HPP_
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class HilsUartPort;
+
+/**
+ * @class HilsEpollService
+ * @brief Class to service the HILS ports on Linux with an epoll loop in an I/O thread
+ * @details All ports are serviced by one thread. The received data is moved to the RX buffer of the port when the device is readable, and
+ *          the data in the TX buffer is written when the port requests the sending. So the access from the simulation does not wait for
+ *          the devices.
+ */
+class HilsEpollService {
+ public:
+  /**
+   * @fn GetInstance
+   * @brief Return the service shared in the process. The I/O thread starts at the first call.
+   */
+  static HilsEpollService& GetInstance();
+  /**
+   * @fn IsCreated
+   * @brief Return true when the service is created by GetInstance
+   */
+  static bool IsCreated();
+  /**
+   * @fn ~HilsEpollService
+   * @brief Destructor to stop the I/O thread
+   */
+  ~HilsEpollService();
+
+  // forbidden copy
+  HilsEpollService(const HilsEpollService&) = delete;
+  HilsEpollService& operator=(const HilsEpollService&) = delete;
+
+  /**
+   * @fn AddPort
+   * @brief Start servicing the port
+   * @param [in] file_descriptor: Non-blocking file descriptor of the device
+   * @param [in] port: Port serviced
+   * @return 0: success, -1: error
+   */
+  int AddPort(const int file_descriptor, HilsUartPort* port);
+  /**
+   * @fn RemovePort
+   * @brief Stop servicing the port. The port is not accessed by the I/O thread after the return.
+   * @param [in] file_descriptor: File descriptor of the device
+   */
+  void RemovePort(const int file_descriptor);
+  /**
+   * @fn RequestSend
+   * @brief Request the I/O thread to write the TX buffer of the port
+   * @note The I/O thread is not woken up while the requests are held by HoldSendRequests
+   * @param [in] file_descriptor: File descriptor of the device
+   */
+  void RequestSend(const int file_descriptor);
+  /**
+   * @fn HoldSendRequests
+   * @brief Hold the requests until FlushSendRequests, so that the data sent by all ports in a step is written with one wakeup
+   * @note The calls can be nested. The requests are flushed when all holds are released.
+   */
+  void HoldSendRequests();
+  /**
+   * @fn FlushSendRequests
+   * @brief Release the hold by HoldSendRequests and wake up the I/O thread once for the held requests
+   */
+  void FlushSendRequests();
+
+  // Getter
+  /**
+   * @fn GetNumberOfWakes
+   * @brief Return the number of the wakeups of the I/O thread
+   */
+  inline unsigned long long GetNumberOfWakes() const { return number_of_wakes_; }
+
+ private:
+  int epoll_file_descriptor_ = -1;       //!< File descriptor of epoll
+  int event_file_descriptor_ = -1;       //!< File descriptor of eventfd to wake up the I/O thread
+  std::thread io_thread_;                //!< I/O thread
+  std::atomic<bool> is_stopped_{false};  //!< Flag to stop the I/O thread
+
+  std::mutex ports_mutex_;                              //!< Mutex held while the I/O thread accesses the ports
+  std::unordered_map<int, HilsUartPort*> ports_;        //!< Serviced ports for each file descriptor
+  std::mutex pending_mutex_;                            //!< Mutex for the pending requests and the hold
+  std::vector<int> pending_file_descriptors_;           //!< File descriptors of the ports requesting the sending
+  bool is_wake_requested_ = false;                      //!< True when the I/O thread is woken up and has not taken the pending requests yet
+  unsigned int number_of_holds_ = 0;                    //!< Number of the holds by HoldSendRequests not released yet
+  std::atomic<unsigned long long> number_of_wakes_{0};  //!< Number of the wakeups of the I/O thread
+
+  /**
+   * @fn HilsEpollService
+   * @brief Constructor
+   */
+  HilsEpollService();
+  /**
+   * @fn IoLoop
+   * @brief Main loop of the I/O thread
+   */
+  void IoLoop();
+  /**
+   * @fn Wake
+   * @brief Wake up the I/O thread
+   */
+  void Wake();
+  /**
+   * @fn SetWriteEvent
+   * @brief Enable or disable the notification of the writable device
+   * @param [in] file_descriptor: File descriptor of the device
+   * @param [in] is_enabled: True to wait for the writable device
+   */
+  void SetWriteEvent(const int file_descriptor, const bool is_enabled);
+};
+
+#endif  // S2E_COMPONENTS_PORTS_HILS_EPOLL_SERVICE_HPP_
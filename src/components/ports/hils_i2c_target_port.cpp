@@ -12,7 +12,7 @@ HilsI2cTargetPort::HilsI2cTargetPort(const unsigned int port_id) : HilsUartPort(
 
 // FIXME: The magic number. This is depending on the converter.
 HilsI2cTargetPort::HilsI2cTargetPort(const unsigned int port_id, const unsigned char max_register_number)
-    : max_register_number_(max_register_number), HilsUartPort(port_id, 115200, 512, 512) {}
+    : HilsUartPort(port_id, 115200, 512, 512), max_register_number_(max_register_number) {}
 
 HilsI2cTargetPort::~HilsI2cTargetPort() {}
 
@@ -60,7 +60,7 @@ int HilsI2cTargetPort::Receive()  // from I2C-USB Target converter
   unsigned char rx_buf[kDefaultCommandSize];
   if (GetBytesToRead() <= 0) return -1;  // No bytes were available to read.
   int received_bytes = ReadRx(rx_buf, 0, kDefaultCommandSize);
-  if (received_bytes > kDefaultCommandSize) return -1;
+  if (received_bytes > (int)kDefaultCommandSize) return -1;
 #ifdef HILS_I2C_TARGET_PORT_SHOW_DEBUG_DATA
   for (int i = 0; i < received_bytes; i++) {
     printf("%02x ", rx_buf[i]);
@@ -1,20 +1,27 @@
 /**
  * @file hils_uart_port.hpp
  * @brief Class to manage PC's COM port
- * @details Currently, this feature supports Windows Visual Studio only.(FIXME)
+ * @details On Windows, the port is accessed with .NET SerialPort.
  * Reference: https://docs.microsoft.com/en-us/dotnet/api/system.io.ports.serialport?view=netframework-4.7.2
+ * On Linux, the serial device or the UNIX domain socket is accessed by HilsEpollService without blocking the simulation.
  * @note TODO :We need to clarify the difference with ComPortInterface
  */
 
 #ifndef S2E_COMPONENTS_PORTS_HILS_UART_PORT_HPP_
 #define S2E_COMPONENTS_PORTS_HILS_UART_PORT_HPP_
 
+#ifdef WIN32
 #include <msclr/gcroot.h>
 #include <msclr/marshal_cppstd.h>
+#else
+#include <library/utilities/ring_buffer.hpp>
+#endif
 
 #include <string>
 
+#ifdef WIN32
 typedef cli::array<System::Byte> bytearray;  //!< System::Byte: an 8-bit unsigned integer
+#endif
 
 /**
  * @class HilsUartPort
@@ -75,17 +82,66 @@ class HilsUartPort {
    */
   int GetBytesToRead();
 
+#ifndef WIN32
+  /**
+   * @fn SetPortName
+   * @brief Set the device of the port ID
+   * @note The default device is "/dev/ttyUSB[port_id]". A name starting with "unix:" like "unix:/tmp/obc.sock" means the UNIX domain socket.
+   *       It has to be set before the port is connected.
+   * @param [in] port_id: Port ID
+   * @param [in] port_name: Path of the serial device or "unix:" and the path of the socket
+   */
+  static void SetPortName(const unsigned int port_id, const std::string port_name);
+  /**
+   * @fn PeekRx
+   * @brief Return the received data without copying. The data is kept until CommitRx is called.
+   */
+  inline RingBufferSpan PeekRx() { return rx_ring_buffer_.PeekRead(); }
+  /**
+   * @fn CommitRx
+   * @brief Release the received data returned by PeekRx
+   * @param [in] data_length: Length of the released data
+   */
+  inline void CommitRx(const unsigned int data_length) { rx_ring_buffer_.CommitRead(data_length); }
+
+  // Functions called by HilsEpollService in the I/O thread
+  /**
+   * @fn ReceiveFromDevice
+   * @brief Move the received data from the device to the RX buffer
+   * @return False when the device is disconnected
+   */
+  bool ReceiveFromDevice();
+  /**
+   * @fn SendToDevice
+   * @brief Move the data in the TX buffer to the device
+   * @return True when the data remains since the device is not writable
+   */
+  bool SendToDevice();
+
+  /**
+   * @fn GetRxDroppedBytes
+   * @brief Return the number of received bytes dropped since the RX buffer is full
+   */
+  inline unsigned long long GetRxDroppedBytes() const { return rx_ring_buffer_.GetDroppedBytes(); }
+#endif
+
  private:
   const unsigned int kTxBufferSize;  //!< TX Buffer size
   const unsigned int kRxBufferSize;  //!< RX Buffer size
   const std::string kPortName;       //!< Port name like "COM4"
   unsigned int baud_rate_;           //!< Baud rate ex. 9600, 115200
 
+#ifdef WIN32
   // gcroot is the type-safe wrapper template to refer to a CLR object from the c++ heap reference:
   // https://docs.microsoft.com/en-us/cpp/dotnet/how-to-declare-handles-in-native-types?view=msvc-160
   msclr::gcroot<System::IO::Ports::SerialPort ^> port_;  //!< Port
   msclr::gcroot<bytearray ^> tx_buffer_;                 //!< TX Buffer
   msclr::gcroot<bytearray ^> rx_buffer_;                 //!< RX Buffer
+#else
+  int file_descriptor_ = -1;   //!< File descriptor of the device
+  RingBuffer tx_ring_buffer_;  //!< TX buffer written by the simulation and read by the I/O thread
+  RingBuffer rx_ring_buffer_;  //!< RX buffer written by the I/O thread and read by the simulation
+#endif
 
   /**
    * @fn GetPortName
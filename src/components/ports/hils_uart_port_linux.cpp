@@ -0,0 +1,236 @@
+/**
+ * @file hils_uart_port_linux.cpp
+ * @brief Class to manage PC's COM port on Linux
+ * @details The serial device is accessed with termios, and the UNIX domain socket can be used as a loopback without hardware.
+ *          The device is read and written by HilsEpollService, so WriteTx and ReadRx only access the ring buffers.
+ *          Each ring buffer is shared by the simulation thread and the I/O thread without locks.
+ */
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+#include "hils_epoll_service.hpp"
+#include "hils_uart_port.hpp"
+
+// # define HILS_UART_PORT_SHOW_DEBUG_DATA
+
+static std::mutex port_name_mutex;                          //!< Mutex for port_name_list
+static std::map<unsigned int, std::string> port_name_list;  //!< Device set for each port ID
+
+HilsUartPort::HilsUartPort(const unsigned int port_id, const unsigned int baud_rate, const unsigned int tx_buffer_size,
+                           const unsigned int rx_buffer_size)
+    : kTxBufferSize(tx_buffer_size),
+      kRxBufferSize(rx_buffer_size),
+      kPortName(GetPortName(port_id)),
+      baud_rate_(baud_rate),
+      tx_ring_buffer_(tx_buffer_size),
+      rx_ring_buffer_(rx_buffer_size) {
+  Initialize();
+}
+
+HilsUartPort::~HilsUartPort() { ClosePort(); }
+
+void HilsUartPort::SetPortName(const unsigned int port_id, const std::string port_name) {
+  std::lock_guard<std::mutex> lock(port_name_mutex);
+  port_name_list[port_id] = port_name;
+}
+
+std::string HilsUartPort::GetPortName(const unsigned int port_id) {
+  std::lock_guard<std::mutex> lock(port_name_mutex);
+  auto port_name = port_name_list.find(port_id);
+  if (port_name != port_name_list.end()) return port_name->second;
+  return "/dev/ttyUSB" + std::to_string(port_id);
+}
+
+int HilsUartPort::Initialize() { return OpenPort(); }
+
+// Baud rate constant of termios
+static speed_t ConvertBaudRate(const unsigned int baud_rate) {
+  switch (baud_rate) {
+    case 9600:
+      return B9600;
+    case 19200:
+      return B19200;
+    case 38400:
+      return B38400;
+    case 57600:
+      return B57600;
+    case 115200:
+      return B115200;
+    case 230400:
+      return B230400;
+    case 460800:
+      return B460800;
+    case 921600:
+      return B921600;
+    default:
+      return B0;
+  }
+}
+
+int HilsUartPort::OpenPort() {
+  if (file_descriptor_ >= 0) return 0;
+
+  const std::string kUnixSocketPrefix = "unix:";
+  if (kPortName.compare(0, kUnixSocketPrefix.size(), kUnixSocketPrefix) == 0) {
+    // Loopback with the UNIX domain socket
+    const std::string socket_path = kPortName.substr(kUnixSocketPrefix.size());
+    struct sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(address.sun_path)) return -4;
+    strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+    file_descriptor_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (file_descriptor_ < 0) return -2;
+    if (connect(file_descriptor_, (struct sockaddr*)&address, sizeof(address)) != 0) {
+#ifdef HILS_UART_PORT_SHOW_DEBUG_DATA
+      printf("%s: %s\n", kPortName.c_str(), strerror(errno));
+#endif
+      close(file_descriptor_);
+      file_descriptor_ = -1;
+      return -4;
+    }
+    fcntl(file_descriptor_, F_SETFL, fcntl(file_descriptor_, F_GETFL) | O_NONBLOCK);
+  } else {
+    // Serial device (pseudo terminal is also available)
+    file_descriptor_ = open(kPortName.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+    if (file_descriptor_ < 0) {
+#ifdef HILS_UART_PORT_SHOW_DEBUG_DATA
+      printf("%s: %s\n", kPortName.c_str(), strerror(errno));
+#endif
+      return -2;
+    }
+
+    const speed_t speed = ConvertBaudRate(baud_rate_);
+    struct termios settings;
+    if (speed == B0 || tcgetattr(file_descriptor_, &settings) != 0) {
+      close(file_descriptor_);
+      file_descriptor_ = -1;
+      return -3;
+    }
+    // Raw 8N1 without flow control
+    // VMIN = 1 makes the non-blocking read return EAGAIN instead of 0, which means the disconnection.
+    cfmakeraw(&settings);
+    settings.c_cflag |= CLOCAL | CREAD;
+    settings.c_cflag &= ~(CSTOPB | CRTSCTS);
+    settings.c_cc[VMIN] = 1;
+    settings.c_cc[VTIME] = 0;
+    cfsetispeed(&settings, speed);
+    cfsetospeed(&settings, speed);
+    if (tcsetattr(file_descriptor_, TCSANOW, &settings) != 0) {
+      close(file_descriptor_);
+      file_descriptor_ = -1;
+      return -3;
+    }
+    tcflush(file_descriptor_, TCIOFLUSH);
+  }
+
+  if (HilsEpollService::GetInstance().AddPort(file_descriptor_, this) != 0) {
+    close(file_descriptor_);
+    file_descriptor_ = -1;
+    return -5;
+  }
+  return 0;  // Success !!
+}
+
+int HilsUartPort::ClosePort() {
+  if (file_descriptor_ < 0) return -1;
+  HilsEpollService::GetInstance().RemovePort(file_descriptor_);
+  close(file_descriptor_);
+  file_descriptor_ = -1;
+  return 0;
+}
+
+int HilsUartPort::WriteTx(const unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
+  if (file_descriptor_ < 0) return -1;
+  // The data is not divided when the buffer does not have enough space
+  if (data_length > tx_ring_buffer_.GetWritableSize()) return -1;
+  tx_ring_buffer_.Write(buffer, offset, data_length);
+  HilsEpollService::GetInstance().RequestSend(file_descriptor_);
+  return 0;
+}
+
+int HilsUartPort::ReadRx(unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
+  if (file_descriptor_ < 0) return -2;
+  int received_bytes = rx_ring_buffer_.Read(buffer, offset, data_length);
+  // No bytes were available to read.
+  if (received_bytes == 0) return -1;
+  return received_bytes;
+}
+
+int HilsUartPort::GetBytesToRead() {
+  if (file_descriptor_ < 0) return -1;
+  return (int)rx_ring_buffer_.GetReadableSize();
+}
+
+int HilsUartPort::DiscardInBuffer() {
+  if (file_descriptor_ < 0) return -1;
+  if (isatty(file_descriptor_)) tcflush(file_descriptor_, TCIFLUSH);
+  rx_ring_buffer_.CommitRead(rx_ring_buffer_.PeekRead().GetSize());
+  return 0;
+}
+
+int HilsUartPort::DiscardOutBuffer() {
+  if (file_descriptor_ < 0) return -1;
+  // The TX buffer is read only by the I/O thread, so only the data in the device is discarded
+  if (isatty(file_descriptor_)) tcflush(file_descriptor_, TCOFLUSH);
+  return 0;
+}
+
+bool HilsUartPort::ReceiveFromDevice() {
+  unsigned char discarded_data[256];
+  while (true) {
+    const RingBufferSpan span = rx_ring_buffer_.PeekWrite();
+    ssize_t received_bytes;
+    if (span.GetSize() > 0) {
+      // Read to the RX buffer directly
+      struct iovec io_vectors[2] = {{span.first_data, span.first_size}, {span.second_data, span.second_size}};
+      received_bytes = readv(file_descriptor_, io_vectors, 2);
+      if (received_bytes > 0) {
+        rx_ring_buffer_.CommitWrite((unsigned int)received_bytes);
+        continue;
+      }
+    } else {
+      // The RX buffer is full. The data is read to be counted as the dropped data.
+      received_bytes = read(file_descriptor_, discarded_data, sizeof(discarded_data));
+      if (received_bytes > 0) {
+        rx_ring_buffer_.Write(discarded_data, 0, (unsigned int)received_bytes);
+        continue;
+      }
+    }
+    if (received_bytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return true;
+    if (received_bytes < 0 && errno == EINTR) continue;
+    // End of file or error like the closed pseudo terminal
+    return false;
+  }
+}
+
+bool HilsUartPort::SendToDevice() {
+  while (true) {
+    const RingBufferSpan span = tx_ring_buffer_.PeekRead();
+    if (span.GetSize() == 0) return false;
+
+    // Write from the TX buffer directly
+    struct iovec io_vectors[2] = {{span.first_data, span.first_size}, {span.second_data, span.second_size}};
+    const ssize_t sent_bytes = writev(file_descriptor_, io_vectors, 2);
+    if (sent_bytes >= 0) {
+      tx_ring_buffer_.CommitRead((unsigned int)sent_bytes);
+      continue;
+    }
+    if (errno == EINTR) continue;
+    if (errno == EAGAIN || errno == EWOULDBLOCK) return true;
+    // The data cannot be sent to the disconnected device
+    tx_ring_buffer_.CommitRead(span.GetSize());
+    return false;
+  }
+}
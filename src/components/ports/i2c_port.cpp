@@ -12,6 +12,7 @@ I2cPort::I2cPort(void) {}
 I2cPort::I2cPort(const unsigned char max_register_number) : max_register_number_(max_register_number) {}
 
 void I2cPort::RegisterDevice(const unsigned char i2c_address) {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
   for (unsigned char i = 0; i < max_register_number_; i++) {
     device_registers_[std::make_pair(i2c_address, i)] = 0x00;
   }
@@ -21,6 +22,7 @@ void I2cPort::RegisterDevice(const unsigned char i2c_address) {
 }
 
 int I2cPort::WriteRegister(const unsigned char i2c_address, const unsigned char register_address) {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
   UNUSED(i2c_address);  // TODO: consider this argument is really needed.
 
   if (register_address >= max_register_number_) return 0;
@@ -29,6 +31,7 @@ int I2cPort::WriteRegister(const unsigned char i2c_address, const unsigned char
 }
 
 int I2cPort::WriteRegister(const unsigned char i2c_address, const unsigned char register_address, const unsigned char value) {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
   if (register_address >= max_register_number_) return 0;
   saved_register_address_ = register_address;
   device_registers_[std::make_pair(i2c_address, register_address)] = value;
@@ -51,6 +54,7 @@ register_address, float value)
 */
 
 unsigned char I2cPort::ReadRegister(const unsigned char i2c_address) {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
   unsigned char ret = device_registers_[std::make_pair(i2c_address, saved_register_address_)];
   saved_register_address_++;
   if (saved_register_address_ >= max_register_number_) saved_register_address_ = 0;
@@ -58,6 +62,7 @@ unsigned char I2cPort::ReadRegister(const unsigned char i2c_address) {
 }
 
 unsigned char I2cPort::ReadRegister(const unsigned char i2c_address, const unsigned char register_address) {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
   if (register_address >= max_register_number_) return 0;
   saved_register_address_ = register_address;
   unsigned char ret = device_registers_[std::make_pair(i2c_address, saved_register_address_)];
@@ -65,6 +70,7 @@ unsigned char I2cPort::ReadRegister(const unsigned char i2c_address, const unsig
 }
 
 unsigned char I2cPort::WriteCommand(const unsigned char i2c_address, const unsigned char* tx_data, const unsigned char length) {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
   if (length > kDefaultCmdBufferSize) {
     return 0;
   }
@@ -85,6 +91,7 @@ unsigned char I2cPort::WriteCommand(const unsigned char i2c_address, const unsig
 }
 
 unsigned char I2cPort::ReadCommand(const unsigned char i2c_address, unsigned char* rx_data, const unsigned char length) {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
   if (length > kDefaultCmdBufferSize) {
     return 0;
   }
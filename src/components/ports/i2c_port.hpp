@@ -7,11 +7,13 @@
 #define S2E_COMPONENTS_PORTS_I2C_PORT_HPP_
 
 #include <map>
+#include <mutex>
 
 /**
  * @class I2cPort
  * @brief Class to emulate I2C(Inter-Integrated Circuit) communication port
  * @details The class has the register to store the parameters
+ *          The register is guarded by the mutex since the OBC flight software can access it from another thread.
  */
 class I2cPort {
  public:
@@ -106,6 +108,8 @@ class I2cPort {
 
   /** @brief Buffer for the command from OnBoardComputer : <pair(i2c_address, cmd_buffer_length), value>  **/
   std::map<std::pair<unsigned char, unsigned char>, unsigned char> command_buffer_;
+
+  std::recursive_mutex mutex_;  //!< Mutex for the registers and the command buffer
 };
 
 #endif  // S2E_COMPONENTS_PORTS_I2C_PORT_HPP_
@@ -0,0 +1,73 @@
+/**
+ * @file port_table.hpp
+ * @brief Table of the ports indexed by the port ID
+ */
+
+#ifndef S2E_COMPONENTS_PORTS_PORT_TABLE_HPP_
+#define S2E_COMPONENTS_PORTS_PORT_TABLE_HPP_
+
+#include <array>
+
+/**
+ * @class PortTable
+ * @brief Fixed capacity table of the ports indexed by the port ID
+ * @details The port ID is directly used as the index, so the access is O(1) without any allocation. The table does not own the ports.
+ *          The IDs out of the range [0, kCapacity) cannot be used.
+ */
+template <typename T>
+class PortTable {
+ public:
+  static const unsigned int kCapacity = 256;  //!< Number of the port IDs
+
+  /**
+   * @fn PortTable
+   * @brief Constructor
+   */
+  PortTable() { ports_.fill(nullptr); }
+
+  /**
+   * @fn IsValid
+   * @brief Return true when the port ID is in the range of the table
+   * @param [in] port_id: Port ID
+   */
+  static inline bool IsValid(const int port_id) { return (unsigned int)port_id < kCapacity; }
+
+  /**
+   * @fn Get
+   * @brief Return the port
+   * @param [in] port_id: Port ID
+   * @return The port, or nullptr when the port is not registered or the ID is invalid
+   */
+  inline T* Get(const int port_id) const {
+    if (!IsValid(port_id)) return nullptr;
+    return ports_[port_id];
+  }
+  /**
+   * @fn Add
+   * @brief Register the port
+   * @param [in] port_id: Port ID
+   * @param [in] port: Port
+   * @return False when the ID is already used or invalid
+   */
+  inline bool Add(const int port_id, T* port) {
+    if (Get(port_id) != nullptr || !IsValid(port_id)) return false;
+    ports_[port_id] = port;
+    return true;
+  }
+  /**
+   * @fn Remove
+   * @brief Unregister the port
+   * @param [in] port_id: Port ID
+   * @return The removed port, or nullptr when the port is not registered or the ID is invalid
+   */
+  inline T* Remove(const int port_id) {
+    T* port = Get(port_id);
+    if (port != nullptr) ports_[port_id] = nullptr;
+    return port;
+  }
+
+ private:
+  std::array<T*, kCapacity> ports_;  //!< Ports indexed by the port ID
+};
+
+#endif  // S2E_COMPONENTS_PORTS_PORT_TABLE_HPP_
@@ -12,6 +12,7 @@
  * @class UartPort
  * @brief Class to emulate UART communication port
  * @details The distinction of the area should be done where the upper port ID is assigned.
+ *          Each buffer is written by one side and read by the other side, so OBC and Component can access the port from different threads.
  */
 class UartPort {
  public:
@@ -71,6 +72,29 @@ class UartPort {
    */
   int ReadRx(unsigned char* buffer, const unsigned int offset, const unsigned int data_length);
 
+  /**
+   * @fn PeekTx
+   * @brief Return the data in the TX buffer without copying by Component. The data is kept until CommitTx is called.
+   */
+  inline RingBufferSpan PeekTx() { return tx_buffer_->PeekRead(); }
+  /**
+   * @fn CommitTx
+   * @brief Release the data in the TX buffer returned by PeekTx
+   * @param [in] data_length: Length of the released data
+   */
+  inline void CommitTx(const unsigned int data_length) { tx_buffer_->CommitRead(data_length); }
+
+  /**
+   * @fn GetTxDroppedBytes
+   * @brief Return the number of bytes dropped since the TX buffer is full
+   */
+  inline unsigned long long GetTxDroppedBytes() const { return tx_buffer_->GetDroppedBytes(); }
+  /**
+   * @fn GetRxDroppedBytes
+   * @brief Return the number of bytes dropped since the RX buffer is full
+   */
+  inline unsigned long long GetRxDroppedBytes() const { return rx_buffer_->GetDroppedBytes(); }
+
  private:
   const static unsigned int kDefaultBufferSize = 1024;  //!< Default buffer size
 
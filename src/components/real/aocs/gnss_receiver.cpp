@@ -26,7 +26,9 @@ GnssReceiver::GnssReceiver(const int prescaler, ClockGenerator* clock_generator,
       antenna_model_(antenna_model),
       dynamics_(dynamics),
       gnss_satellites_(gnss_satellites),
-      simulation_time_(simulation_time) {}
+      simulation_time_(simulation_time) {
+  InitializeVisibilityCheck();
+}
 GnssReceiver::GnssReceiver(const int prescaler, ClockGenerator* clock_generator, PowerPort* power_port, const int component_id,
                            const std::string gnss_id, const int max_channel, const AntennaModel antenna_model,
                            const libra::Vector<3> antenna_position_b_m, const libra::Quaternion quaternion_b2c, const double half_width_rad,
@@ -45,7 +47,23 @@ GnssReceiver::GnssReceiver(const int prescaler, ClockGenerator* clock_generator,
       antenna_model_(antenna_model),
       dynamics_(dynamics),
       gnss_satellites_(gnss_satellites),
-      simulation_time_(simulation_time) {}
+      simulation_time_(simulation_time) {
+  InitializeVisibilityCheck();
+}
+
+void GnssReceiver::InitializeVisibilityCheck() {
+  cos_half_width_ = cos(half_width_rad_ * libra::deg_to_rad);
+
+  constellation_mask_ = 0;
+  for (const char constellation : gnss_id_) {
+    constellation_mask_ |= GetGnssConstellationBit(constellation);
+  }
+
+  int gnss_num = gnss_satellites_->GetNumOfSatellites();
+  visibility_flags_.assign(gnss_num, 0);
+  visible_satellite_indices_.reserve(gnss_num);
+  gnss_information_list_.reserve(gnss_num);
+}
 
 void GnssReceiver::MainRoutine(const int time_count) {
   UNUSED(time_count);
@@ -96,7 +114,7 @@ void GnssReceiver::CheckAntennaSimple(const libra::Vector<3> pos_true_eci_, libr
 
 void GnssReceiver::CheckAntennaCone(const libra::Vector<3> pos_true_eci_, libra::Quaternion quaternion_i2b) {
   // Cone model
-  libra::Vector<3> gnss_sat_pos_i, ant_pos_i, antenna_to_satellite_i_m, ant2gnss_i_n, sat2ant_i;
+  libra::Vector<3> ant_pos_i, sat2ant_i;
   gnss_information_list_.clear();
 
   // antenna normal vector at inertial frame
@@ -108,44 +126,13 @@ void GnssReceiver::CheckAntennaCone(const libra::Vector<3> pos_true_eci_, libra:
   sat2ant_i = quaternion_i2b.InverseFrameConversion(antenna_position_b_m_);
   ant_pos_i = pos_true_eci_ + sat2ant_i;
 
-  // initialize
-  visible_satellite_number_ = 0;
-
-  int gnss_num = gnss_satellites_->GetNumOfSatellites();
+  visible_satellite_number_ = FindVisibleSatellites(ant_pos_i, antenna_direction_i);
 
-  for (int i = 0; i < gnss_num; i++) {
-    // check if gnss ID is compatible with the receiver
-    std::string id_tmp = gnss_satellites_->GetIDFromIndex(i);
-    if (gnss_id_.find(id_tmp[0]) == std::string::npos) continue;
-
-    // compute direction from sat to gnss in body-fixed frame
-    gnss_sat_pos_i = gnss_satellites_->GetSatellitePositionEci(i);
-    antenna_to_satellite_i_m = gnss_sat_pos_i - ant_pos_i;
-    double normalizer = 1 / antenna_to_satellite_i_m.CalcNorm();
-    ant2gnss_i_n = normalizer * antenna_to_satellite_i_m;
-
-    // check gnss sats are visible from antenna
-    double Re = environment::earth_equatorial_radius_m;
-    double inner1 = InnerProduct(ant_pos_i, gnss_sat_pos_i);
-    int is_visible_ant2gnss = 0;
-    if (inner1 > 0)
-      is_visible_ant2gnss = 1;
-    else {
-      Vector<3> tmp = ant_pos_i + InnerProduct(-ant_pos_i, ant2gnss_i_n) * antenna_to_satellite_i_m;
-      if (tmp.CalcNorm() < Re)
-        // There is earth between antenna and gnss
-        is_visible_ant2gnss = 0;
-      else
-        // There is not earth between antenna and gnss
-        is_visible_ant2gnss = 1;
-    }
-
-    double inner2 = InnerProduct(antenna_direction_i, ant2gnss_i_n);
-    if (inner2 > cos(half_width_rad_ * libra::deg_to_rad) && is_visible_ant2gnss) {
-      // is visible
-      visible_satellite_number_++;
-      SetGnssInfo(antenna_to_satellite_i_m, quaternion_i2b, id_tmp);
-    }
+  // GnssInfo is made only for the visible satellites
+  for (int i = 0; i < visible_satellite_number_; i++) {
+    int gnss_satellite_id = visible_satellite_indices_[i];
+    libra::Vector<3> antenna_to_satellite_i_m = gnss_satellites_->GetSatellitePositionEci(gnss_satellite_id) - ant_pos_i;
+    SetGnssInfo(antenna_to_satellite_i_m, quaternion_i2b, gnss_satellites_->GetIDFromIndex(gnss_satellite_id));
   }
 
   if (visible_satellite_number_ > 0)
@@ -154,6 +141,51 @@ void GnssReceiver::CheckAntennaCone(const libra::Vector<3> pos_true_eci_, libra:
     is_gnss_visible_ = 0;
 }
 
+int GnssReceiver::FindVisibleSatellites(const libra::Vector<3>& antenna_position_i_m, const libra::Vector<3>& antenna_direction_i) {
+  visible_satellite_indices_.clear();
+
+  const std::vector<double>& gnss_x_i_m = gnss_satellites_->GetSatellitePositionsEci_m(0);
+  const std::vector<double>& gnss_y_i_m = gnss_satellites_->GetSatellitePositionsEci_m(1);
+  const std::vector<double>& gnss_z_i_m = gnss_satellites_->GetSatellitePositionsEci_m(2);
+  const std::vector<unsigned int>& constellation_bits = gnss_satellites_->GetConstellationBits();
+  const int gnss_num = (int)gnss_x_i_m.size();
+  if (gnss_num == 0) return 0;  // GNSS satellite calculation is disabled
+
+  const double ant_x = antenna_position_i_m[0], ant_y = antenna_position_i_m[1], ant_z = antenna_position_i_m[2];
+  const double dir_x = antenna_direction_i[0], dir_y = antenna_direction_i[1], dir_z = antenna_direction_i[2];
+  const double Re = environment::earth_equatorial_radius_m;
+  unsigned char* visibility_flags = visibility_flags_.data();
+
+  // Branchless loop over all satellites
+  for (int i = 0; i < gnss_num; i++) {
+    double ant2gnss_x = gnss_x_i_m[i] - ant_x;
+    double ant2gnss_y = gnss_y_i_m[i] - ant_y;
+    double ant2gnss_z = gnss_z_i_m[i] - ant_z;
+    double normalizer = 1 / sqrt(ant2gnss_x * ant2gnss_x + ant2gnss_y * ant2gnss_y + ant2gnss_z * ant2gnss_z);
+    double ant2gnss_n_x = normalizer * ant2gnss_x;
+    double ant2gnss_n_y = normalizer * ant2gnss_y;
+    double ant2gnss_n_z = normalizer * ant2gnss_z;
+
+    // Earth occlusion: the closest point of the line of sight to the earth center is compared with the earth radius
+    double inner1 = ant_x * gnss_x_i_m[i] + ant_y * gnss_y_i_m[i] + ant_z * gnss_z_i_m[i];
+    double projection = -ant_x * ant2gnss_n_x - ant_y * ant2gnss_n_y - ant_z * ant2gnss_n_z;
+    double closest_x = ant_x + projection * ant2gnss_n_x;
+    double closest_y = ant_y + projection * ant2gnss_n_y;
+    double closest_z = ant_z + projection * ant2gnss_n_z;
+    bool is_visible_ant2gnss = (inner1 > 0) | (sqrt(closest_x * closest_x + closest_y * closest_y + closest_z * closest_z) >= Re);
+
+    // Antenna cone and constellation
+    double inner2 = dir_x * ant2gnss_n_x + dir_y * ant2gnss_n_y + dir_z * ant2gnss_n_z;
+    bool is_target = (constellation_bits[i] & constellation_mask_) != 0;
+    visibility_flags[i] = (unsigned char)((inner2 > cos_half_width_) & is_visible_ant2gnss & is_target);
+  }
+
+  for (int i = 0; i < gnss_num; i++) {
+    if (visibility_flags[i]) visible_satellite_indices_.push_back(i);
+  }
+  return (int)visible_satellite_indices_.size();
+}
+
 void GnssReceiver::SetGnssInfo(libra::Vector<3> antenna_to_satellite_i_m, libra::Quaternion quaternion_i2b, std::string gnss_id) {
   libra::Vector<3> ant2gnss_b, ant2gnss_c;
 
@@ -235,3 +267,21 @@ std::string GnssReceiver::GetLogValue() const  // For logs
 
   return str_tmp;
 }
+
+bool GnssReceiver::GetLogValueBinary(std::vector<double>& values) const {
+  AppendScalar(values, utc_.year);
+  AppendScalar(values, utc_.month);
+  AppendScalar(values, utc_.day);
+  AppendScalar(values, utc_.hour);
+  AppendScalar(values, utc_.minute);
+  AppendScalar(values, utc_.second);
+  AppendVector(values, position_eci_m_);
+  AppendVector(values, velocity_ecef_m_s_);
+  AppendScalar(values, position_llh_[0]);
+  AppendScalar(values, position_llh_[1]);
+  AppendScalar(values, position_llh_[2]);
+  AppendScalar(values, is_gnss_visible_);
+  AppendScalar(values, visible_satellite_number_);
+
+  return true;
+}
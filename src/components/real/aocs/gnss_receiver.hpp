@@ -139,6 +139,11 @@ class GnssReceiver : public Component, public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
  protected:
   // Parameters for receiver
@@ -166,6 +171,12 @@ class GnssReceiver : public Component, public ILoggable {
   int visible_satellite_number_ = 0;             //!< Number of visible GNSS satellites
   std::vector<GnssInfo> gnss_information_list_;  //!< Information List of visible GNSS satellites
 
+  // Buffers for the visibility check
+  double cos_half_width_ = 1.0;                  //!< Cosine of the half width of the antenna cone model
+  unsigned int constellation_mask_ = 0;          //!< Bit mask of the constellations in gnss_id_ defined by GetGnssConstellationBit
+  std::vector<unsigned char> visibility_flags_;  //!< Visibility flags of all GNSS satellites
+  std::vector<int> visible_satellite_indices_;   //!< Indices of the visible GNSS satellites
+
   // References
   const Dynamics* dynamics_;               //!< Dynamics of spacecraft
   const GnssSatellites* gnss_satellites_;  //!< Information of GNSS satellites
@@ -196,6 +207,15 @@ class GnssReceiver : public Component, public ILoggable {
    * @param [in] quaternion_i2b: True attitude of the spacecraft expressed by quaternion from the inertial frame to the body-fixed frame
    */
   void CheckAntennaCone(libra::Vector<3> position_true_i_m, libra::Quaternion quaternion_i2b);
+  /**
+   * @fn FindVisibleSatellites
+   * @brief Check the Earth occlusion and the antenna cone for all GNSS satellites in one pass
+   * @note The visible satellite indices are stored in visible_satellite_indices_.
+   * @param [in] antenna_position_i_m: Position of the antenna in the ECI frame [m]
+   * @param [in] antenna_direction_i: Unit vector of the antenna direction in the ECI frame
+   * @return Number of the visible GNSS satellites
+   */
+  int FindVisibleSatellites(const libra::Vector<3>& antenna_position_i_m, const libra::Vector<3>& antenna_direction_i);
   /**
    * @fn SetGnssInfo
    * @brief Calculate and set the GnssInfo values of target GNSS satellite
@@ -217,6 +237,11 @@ class GnssReceiver : public Component, public ILoggable {
    * @param [in] julian_day: Julian day
    */
   void ConvertJulianDayToGPSTime(const double julian_day);
+  /**
+   * @fn InitializeVisibilityCheck
+   * @brief Precompute the parameters and allocate the buffers for the visibility check
+   */
+  void InitializeVisibilityCheck();
 };
 
 #endif  // S2E_COMPONENTS_REAL_AOCS_GNSS_RECEIVER_HPP_
@@ -42,3 +42,9 @@ std::string GyroSensor::GetLogValue() const {
 
   return str_tmp;
 }
+
+bool GyroSensor::GetLogValueBinary(std::vector<double>& values) const {
+  AppendVector(values, angular_velocity_c_rad_s_);
+
+  return true;
+}
@@ -70,6 +70,11 @@ class GyroSensor : public Component, public Sensor<kGyroDimension>, public ILogg
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
   /**
    * @fn GetMeasuredAngularVelocity_c_rad_s
@@ -45,3 +45,9 @@ std::string Magnetometer::GetLogValue() const {
 
   return str_tmp;
 }
+
+bool Magnetometer::GetLogValueBinary(std::vector<double>& values) const {
+  AppendVector(values, magnetic_field_c_nT_);
+
+  return true;
+}
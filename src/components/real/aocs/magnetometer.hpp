@@ -70,6 +70,11 @@ class Magnetometer : public Component, public Sensor<kMagnetometerDimension>, pu
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
   /**
    * @fn GetMeasuredMagneticField_c_nT
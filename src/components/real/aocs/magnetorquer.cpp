@@ -109,3 +109,10 @@ std::string Magnetorquer::GetLogValue() const {
 
   return str_tmp;
 }
+
+bool Magnetorquer::GetLogValueBinary(std::vector<double>& values) const {
+  AppendVector(values, output_magnetic_moment_b_Am2_);
+  AppendVector(values, torque_b_Nm_);
+
+  return true;
+}
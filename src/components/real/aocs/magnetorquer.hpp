@@ -95,6 +95,11 @@ class Magnetorquer : public Component, public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
   /**
    * @fn GetOutputTorque_b_Nm
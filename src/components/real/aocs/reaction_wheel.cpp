@@ -220,3 +220,17 @@ std::string ReactionWheel::GetLogValue() const {
 
   return str_tmp;
 }
+
+bool ReactionWheel::GetLogValueBinary(std::vector<double>& values) const {
+  AppendScalar(values, angular_velocity_rad_s_);
+  AppendScalar(values, angular_velocity_rpm_);
+  AppendScalar(values, velocity_limit_rpm_);
+  AppendScalar(values, angular_acceleration_rad_s2_);
+
+  if (is_logged_jitter_) {
+    AppendVector(values, rw_jitter_.GetJitterForce_c_N());
+    AppendVector(values, rw_jitter_.GetJitterTorque_c_Nm());
+  }
+
+  return true;
+}
@@ -85,6 +85,12 @@ void StarSensor::Initialize() {
   first_orthogonal_direction_c[1] = 1.0;   //(0,1,0)@Component coordinates, line-of-sight orthogonal direction
   second_orthogonal_direction_c[2] = 1.0;  //(0,0,1)@Component coordinates, line-of-sight orthogonal direction
 
+  // Resolve IDs of the celestial bodies for the judgement
+  const CelestialInformation& celestial_information = local_environment_->GetCelestialInformation().GetGlobalInformation();
+  sun_id_ = celestial_information.CalcBodyIdFromName("SUN");
+  earth_id_ = celestial_information.CalcBodyIdFromName("EARTH");
+  moon_id_ = celestial_information.CalcBodyIdFromName("MOON");
+
   error_flag_ = true;
 }
 Quaternion StarSensor::Measure(const LocalCelestialInformation* local_celestial_information, const Attitude* attitude) {
@@ -126,9 +132,9 @@ void StarSensor::update(const LocalCelestialInformation* local_celestial_informa
 
 void StarSensor::AllJudgement(const LocalCelestialInformation* local_celestial_information, const Attitude* attitude) {
   int judgement = 0;
-  judgement = SunJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m("SUN"));
-  judgement += EarthJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m("EARTH"));
-  judgement += MoonJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m("MOON"));
+  judgement = SunJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m(sun_id_));
+  judgement += EarthJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m(earth_id_));
+  judgement += MoonJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m(moon_id_));
   judgement += CaptureRateJudgement(attitude->GetAngularVelocity_b_rad_s());
   if (judgement > 0)
     error_flag_ = true;
@@ -197,6 +203,13 @@ std::string StarSensor::GetLogValue() const {
   return str_tmp;
 }
 
+bool StarSensor::GetLogValueBinary(std::vector<double>& values) const {
+  AppendQuaternion(values, measured_quaternion_i2c_);
+  AppendScalar(values, error_flag_);
+
+  return true;
+}
+
 double StarSensor::CalAngleVector_rad(const Vector<3>& vector1, const Vector<3>& vector2) {
   libra::Vector<3> vect1_normal = vector1.CalcNormalizedVector();
   libra::Vector<3> vect2_normal = vector2.CalcNormalizedVector();
@@ -93,6 +93,11 @@ class StarSensor : public Component, public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
   /**
    * @fn GetMeasuredQuaternion_i2c
@@ -134,6 +139,9 @@ class StarSensor : public Component, public ILoggable {
   double earth_forbidden_angle_rad_;  //!< Earth forbidden angle [rad]
   double moon_forbidden_angle_rad_;   //!< Moon forbidden angle [rad]
   double capture_rate_limit_rad_s_;   //!< Angular rate limit to get correct attitude [rad/s]
+  unsigned int sun_id_ = 0;           //!< ID of the sun in CelestialInformation list
+  unsigned int earth_id_ = 0;         //!< ID of the earth in CelestialInformation list
+  unsigned int moon_id_ = 0;          //!< ID of the moon in CelestialInformation list
 
   // Observed variables
   const Dynamics* dynamics_;                   //!< Dynamics information
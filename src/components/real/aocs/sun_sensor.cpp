@@ -50,6 +50,8 @@ void SunSensor::Initialize(const double random_noise_standard_deviation_rad, con
   // Normal Random
   random_noise_alpha_.SetParameters(0.0, random_noise_standard_deviation_rad);  // global_randomization.MakeSeed()
   random_noise_beta_.SetParameters(0.0, random_noise_standard_deviation_rad);   // global_randomization.MakeSeed()
+
+  sun_id_ = local_celestial_information_->GetGlobalInformation().CalcBodyIdFromName("SUN");
 }
 void SunSensor::MainRoutine(const int time_count) {
   UNUSED(time_count);
@@ -58,7 +60,7 @@ void SunSensor::MainRoutine(const int time_count) {
 }
 
 void SunSensor::Measure() {
-  libra::Vector<3> sun_pos_b = local_celestial_information_->GetPositionFromSpacecraft_b_m("SUN");
+  libra::Vector<3> sun_pos_b = local_celestial_information_->GetPositionFromSpacecraft_b_m(sun_id_);
   libra::Vector<3> sun_dir_b = sun_pos_b.CalcNormalizedVector();
 
   sun_direction_true_c_ = quaternion_b2c_.FrameConversion(sun_dir_b);  // Frame conversion from body to component
@@ -149,3 +151,10 @@ string SunSensor::GetLogValue() const {
 
   return str_tmp;
 }
+
+bool SunSensor::GetLogValueBinary(std::vector<double>& values) const {
+  AppendVector(values, measured_sun_direction_c_);
+  AppendScalar(values, sun_detected_flag_);
+
+  return true;
+}
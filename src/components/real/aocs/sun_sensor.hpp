@@ -77,6 +77,11 @@ class SunSensor : public Component, public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
   // Getter
   inline bool GetSunDetectedFlag() const { return sun_detected_flag_; };
@@ -108,6 +113,7 @@ class SunSensor : public Component, public ILoggable {
   // Measured variables
   const SolarRadiationPressureEnvironment* srp_environment_;      //!< Solar Radiation Pressure environment
   const LocalCelestialInformation* local_celestial_information_;  //!< Local celestial information
+  unsigned int sun_id_ = 0;                                       //!< ID of the sun in CelestialInformation list
 
   // functions
   /**
@@ -0,0 +1,191 @@
+/**
+ * @file test_gnss_receiver.cpp
+ * @brief Test codes for GnssReceiver class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <environment/global/physical_constants.hpp>
+#include <library/math/constants.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gnss_receiver.hpp"
+
+/**
+ * @class GnssSatellitesForTest
+ * @brief GnssSatellites whose positions are set directly without the tables
+ */
+class GnssSatellitesForTest : public GnssSatellites {
+ public:
+  GnssSatellitesForTest() : GnssSatellites(true) {
+    for (size_t axis = 0; axis < 3; ++axis) {
+      satellite_positions_eci_m_[axis].assign(GetNumOfSatellites(), 0.0);
+    }
+  }
+  void SetSatellitePositionEci(const int gnss_satellite_id, const libra::Vector<3>& position_i_m) {
+    for (size_t axis = 0; axis < 3; ++axis) {
+      satellite_positions_eci_m_[axis][gnss_satellite_id] = position_i_m[axis];
+    }
+  }
+  libra::Vector<3> GetSatellitePositionEciForTest(const int gnss_satellite_id) const {
+    libra::Vector<3> position_i_m(0.0);
+    for (size_t axis = 0; axis < 3; ++axis) {
+      position_i_m[axis] = satellite_positions_eci_m_[axis][gnss_satellite_id];
+    }
+    return position_i_m;
+  }
+};
+
+/**
+ * @class GnssReceiverForTest
+ * @brief GnssReceiver which exposes the antenna check without the dynamics
+ */
+class GnssReceiverForTest : public GnssReceiver {
+ public:
+  GnssReceiverForTest(ClockGenerator* clock_generator, const GnssSatellites* gnss_satellites, const std::string gnss_id = "GRECJ",
+                      const double half_width_deg = 60.0)
+      : GnssReceiver(1, clock_generator, 0, gnss_id, 12, AntennaModel::kCone, libra::Vector<3>(0.0), libra::Quaternion(0.0, 0.0, 0.0, 1.0),
+                     half_width_deg, libra::Vector<3>(0.0), nullptr, gnss_satellites, nullptr) {}
+
+  void CheckAntennaCone(const libra::Vector<3> position_true_i_m) {
+    GnssReceiver::CheckAntennaCone(position_true_i_m, libra::Quaternion(0.0, 0.0, 0.0, 1.0));
+  }
+  std::vector<int> FindVisibleSatellites(const libra::Vector<3>& antenna_position_i_m, const libra::Vector<3>& antenna_direction_i) {
+    GnssReceiver::FindVisibleSatellites(antenna_position_i_m, antenna_direction_i);
+    return visible_satellite_indices_;
+  }
+  int GetVisibleSatelliteNumber() const { return visible_satellite_number_; }
+  int GetIsGnssVisible() const { return is_gnss_visible_; }
+  size_t GetGnssInfoSize() const { return gnss_information_list_.size(); }
+};
+
+/**
+ * @fn FindVisibleSatellitesPerSatellite
+ * @brief Visibility check of each satellite, which was used in GnssReceiver::CheckAntennaCone before FindVisibleSatellites
+ * @note The closest point of the line of sight is calculated with the unit vector. The previous code used the vector to the satellite,
+ *       so that the satellites behind the Earth were not occluded.
+ */
+std::vector<int> FindVisibleSatellitesPerSatellite(const GnssSatellitesForTest& gnss_satellites, const std::string gnss_id,
+                                                   const double half_width_deg, const libra::Vector<3>& ant_pos_i,
+                                                   const libra::Vector<3>& antenna_direction_i) {
+  std::vector<int> visible_satellite_indices;
+  for (int i = 0; i < gnss_satellites.GetNumOfSatellites(); i++) {
+    std::string id_tmp = gnss_satellites.GetIDFromIndex(i);
+    if (gnss_id.find(id_tmp[0]) == std::string::npos) continue;
+
+    libra::Vector<3> gnss_sat_pos_i = gnss_satellites.GetSatellitePositionEciForTest(i);
+    libra::Vector<3> antenna_to_satellite_i_m = gnss_sat_pos_i - ant_pos_i;
+    double normalizer = 1 / antenna_to_satellite_i_m.CalcNorm();
+    libra::Vector<3> ant2gnss_i_n = normalizer * antenna_to_satellite_i_m;
+
+    double Re = environment::earth_equatorial_radius_m;
+    double inner1 = InnerProduct(ant_pos_i, gnss_sat_pos_i);
+    int is_visible_ant2gnss = 0;
+    if (inner1 > 0) {
+      is_visible_ant2gnss = 1;
+    } else {
+      libra::Vector<3> tmp = ant_pos_i + InnerProduct(-ant_pos_i, ant2gnss_i_n) * ant2gnss_i_n;
+      is_visible_ant2gnss = tmp.CalcNorm() < Re ? 0 : 1;
+    }
+
+    double inner2 = InnerProduct(antenna_direction_i, ant2gnss_i_n);
+    if (inner2 > cos(half_width_deg * libra::deg_to_rad) && is_visible_ant2gnss) visible_satellite_indices.push_back(i);
+  }
+  return visible_satellite_indices;
+}
+
+/**
+ * @brief Test for the visible satellites when the GNSS satellite calculation is disabled
+ */
+TEST(GnssReceiver, VisibleSatellitesWithCalculationDisabled) {
+  ClockGenerator clock_generator;
+  GnssSatellites gnss_satellites(false);
+  GnssReceiverForTest gnss_receiver(&clock_generator, &gnss_satellites);
+
+  libra::Vector<3> position_i_m(0.0);
+  position_i_m[0] = 6928.0e3;
+  gnss_receiver.CheckAntennaCone(position_i_m);
+
+  EXPECT_EQ(0, gnss_receiver.GetVisibleSatelliteNumber());
+  EXPECT_EQ(0, gnss_receiver.GetIsGnssVisible());
+  EXPECT_EQ(0, gnss_receiver.GetGnssInfoSize());
+}
+
+/**
+ * @brief Test for the Earth occlusion, the antenna cone, and the constellation mask of the visibility check
+ */
+TEST(GnssReceiver, FindVisibleSatellitesGeometry) {
+  ClockGenerator clock_generator;
+  GnssSatellitesForTest gnss_satellites;
+  const double kGnssRadius_m = 26560.0e3;
+  libra::Vector<3> position_i_m(0.0);
+  // G01: in front of the antenna
+  position_i_m[0] = kGnssRadius_m;
+  gnss_satellites.SetSatellitePositionEci(0, position_i_m);
+  // G02: behind the Earth, but in the cone of the wide antenna
+  position_i_m[0] = -kGnssRadius_m;
+  position_i_m[1] = 1000.0e3;
+  gnss_satellites.SetSatellitePositionEci(1, position_i_m);
+  // G03: above the Earth horizon, but 105 deg from the antenna direction
+  position_i_m[0] = 0.0;
+  position_i_m[1] = kGnssRadius_m;
+  gnss_satellites.SetSatellitePositionEci(2, position_i_m);
+  // R01: in front of the antenna
+  position_i_m[0] = kGnssRadius_m;
+  position_i_m[1] = 100.0e3;
+  const int kGlonassIndex = 32;
+  ASSERT_EQ("R01", gnss_satellites.GetIDFromIndex(kGlonassIndex));
+  gnss_satellites.SetSatellitePositionEci(kGlonassIndex, position_i_m);
+
+  libra::Vector<3> antenna_position_i_m(0.0), antenna_direction_i(0.0);
+  antenna_position_i_m[0] = 7000.0e3;
+  antenna_direction_i[0] = 1.0;
+
+  GnssReceiverForTest all_receiver(&clock_generator, &gnss_satellites, "GRECJ", 60.0);
+  EXPECT_EQ(std::vector<int>({0, kGlonassIndex}), all_receiver.FindVisibleSatellites(antenna_position_i_m, antenna_direction_i));
+  GnssReceiverForTest gps_receiver(&clock_generator, &gnss_satellites, "G", 60.0);
+  EXPECT_EQ(std::vector<int>({0}), gps_receiver.FindVisibleSatellites(antenna_position_i_m, antenna_direction_i));
+  GnssReceiverForTest wide_receiver(&clock_generator, &gnss_satellites, "G", 179.0);
+  EXPECT_EQ(std::vector<int>({0, 2}), wide_receiver.FindVisibleSatellites(antenna_position_i_m, antenna_direction_i));
+}
+
+/**
+ * @brief Test for the visible satellites compared with the previous per-satellite check on random geometries
+ */
+TEST(GnssReceiver, FindVisibleSatellitesPerSatellite) {
+  ClockGenerator clock_generator;
+  GnssSatellitesForTest gnss_satellites;
+  std::mt19937 generator(1);
+  std::normal_distribution<double> normal(0.0, 1.0);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  auto random_direction = [&]() {
+    libra::Vector<3> direction(0.0);
+    for (size_t axis = 0; axis < 3; ++axis) direction[axis] = normal(generator);
+    return direction.CalcNormalizedVector();
+  };
+
+  const std::string gnss_ids[3] = {"GRECJ", "GE", "J"};
+  const double half_widths_deg[3] = {60.0, 85.0, 150.0};
+  size_t number_of_visible_satellites = 0;
+  for (size_t trial = 0; trial < 100; trial++) {
+    // The invalid satellites are at the origin as GnssSatellites
+    for (int i = 0; i < gnss_satellites.GetNumOfSatellites(); i++) {
+      const double radius_m = uniform(generator) < 0.1 ? 0.0 : 26560.0e3;
+      gnss_satellites.SetSatellitePositionEci(i, radius_m * random_direction());
+    }
+    const libra::Vector<3> antenna_position_i_m = 6928.0e3 * random_direction();
+    const libra::Vector<3> antenna_direction_i = random_direction();
+
+    for (size_t receiver_id = 0; receiver_id < 3; receiver_id++) {
+      GnssReceiverForTest gnss_receiver(&clock_generator, &gnss_satellites, gnss_ids[receiver_id], half_widths_deg[receiver_id]);
+      const std::vector<int> visible_satellite_indices = gnss_receiver.FindVisibleSatellites(antenna_position_i_m, antenna_direction_i);
+      EXPECT_EQ(FindVisibleSatellitesPerSatellite(gnss_satellites, gnss_ids[receiver_id], half_widths_deg[receiver_id], antenna_position_i_m,
+                                                  antenna_direction_i),
+                visible_satellite_indices)
+          << "trial " << trial << ", receiver " << receiver_id;
+      number_of_visible_satellites += visible_satellite_indices.size();
+    }
+  }
+  EXPECT_LT(0, number_of_visible_satellites);
+}
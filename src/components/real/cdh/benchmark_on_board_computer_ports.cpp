@@ -0,0 +1,85 @@
+/**
+ * @file benchmark_on_board_computer_ports.cpp
+ * @brief Benchmark of the message rate through the UART, I2C, and GPIO ports of OnBoardComputer
+ * @note Usage: benchmark_on_board_computer_ports [number of ports] [number of rounds]
+ *       In each round, every UART port carries a command frame from OBC to the component and a telemetry frame back, every I2C port
+ *       carries a register write and read, and every GPIO port is toggled. The default is 32 ports and 100000 rounds.
+ */
+
+#include <chrono>
+#include <components/real/cdh/on_board_computer.hpp>
+#include <cstdlib>
+#include <iostream>
+
+/**
+ * @fn main
+ * @brief Measure the number of frames per second through the ports
+ */
+int main(int argc, char* argv[]) {
+  int number_of_ports = 32;
+  int number_of_rounds = 100000;
+  if (argc > 1) number_of_ports = atoi(argv[1]);
+  if (argc > 2) number_of_rounds = atoi(argv[2]);
+  const int kFrameSize = 16;
+  const unsigned char kI2cAddress = 0x44;
+
+  ClockGenerator clock_generator;
+  OnBoardComputer obc(&clock_generator);
+  for (int port_id = 0; port_id < number_of_ports; port_id++) {
+    obc.ConnectComPort(port_id, 1024, 1024);
+    obc.I2cConnectPort(port_id, kI2cAddress);
+    obc.GpioConnectPort(port_id);
+  }
+
+  unsigned char frame[kFrameSize] = {};
+  unsigned char received_frame[kFrameSize];
+  unsigned long long checksum = 0;
+
+  // UART
+  auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < number_of_rounds; round++) {
+    frame[0] = (unsigned char)round;
+    for (int port_id = 0; port_id < number_of_ports; port_id++) {
+      obc.SendFromObc(port_id, frame, 0, kFrameSize);
+      checksum += obc.ReceivedByCompo(port_id, received_frame, 0, kFrameSize);
+      obc.SendFromCompo(port_id, received_frame, 0, kFrameSize);
+      checksum += obc.ReceivedByObc(port_id, received_frame, 0, kFrameSize);
+    }
+  }
+  const double uart_time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  // I2C
+  start = std::chrono::steady_clock::now();
+  for (int round = 0; round < number_of_rounds; round++) {
+    frame[0] = (unsigned char)round;
+    for (int port_id = 0; port_id < number_of_ports; port_id++) {
+      obc.I2cComponentWriteRegister(port_id, kI2cAddress, 0x01, frame, 1);
+      obc.I2cComponentReadRegister(port_id, kI2cAddress, 0x01, received_frame, 1);
+      checksum += received_frame[0];
+    }
+  }
+  const double i2c_time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  // GPIO
+  start = std::chrono::steady_clock::now();
+  for (int round = 0; round < number_of_rounds; round++) {
+    for (int port_id = 0; port_id < number_of_ports; port_id++) {
+      obc.GpioComponentWrite(port_id, round % 2 == 0);
+      checksum += obc.GpioComponentRead(port_id);
+    }
+  }
+  const double gpio_time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  const double number_of_frames = 2.0 * number_of_ports * number_of_rounds;
+  std::cout << "Number of ports: " << number_of_ports << ", number of rounds: " << number_of_rounds << std::endl;
+  std::cout << "UART: " << number_of_frames / uart_time_s << " frames/s" << std::endl;
+  std::cout << "I2C:  " << number_of_frames / i2c_time_s << " frames/s" << std::endl;
+  std::cout << "GPIO: " << number_of_frames / gpio_time_s << " frames/s" << std::endl;
+  std::cout << "Checksum: " << checksum << std::endl;
+
+  for (int port_id = 0; port_id < number_of_ports; port_id++) {
+    obc.CloseComPort(port_id);
+    obc.I2cCloseComPort(port_id);
+  }
+  return 0;
+}
@@ -26,73 +26,89 @@ void OnBoardComputer::Initialize() {}
 void OnBoardComputer::MainRoutine(const int time_count) { UNUSED(time_count); }
 
 int OnBoardComputer::ConnectComPort(int port_id, int tx_buffer_size, int rx_buffer_size) {
-  if (uart_ports_[port_id] != nullptr) {
-    // Port already used
+  if (!PortTable<UartPort>::IsValid(port_id) || uart_ports_.Get(port_id) != nullptr) {
+    // Port already used or invalid
     return -1;
   }
-  uart_ports_[port_id] = new UartPort(tx_buffer_size, rx_buffer_size);
+  uart_ports_.Add(port_id, new UartPort(tx_buffer_size, rx_buffer_size));
   return 0;
 }
 
 // Close port and free resources
 int OnBoardComputer::CloseComPort(int port_id) {
+  UartPort* port = uart_ports_.Remove(port_id);
   // Port not used
-  if (uart_ports_[port_id] == nullptr) return -1;
+  if (port == nullptr) return -1;
 
-  UartPort* port = uart_ports_.at(port_id);
   delete port;
-  uart_ports_.erase(port_id);
   return 0;
 }
 
 int OnBoardComputer::SendFromObc(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = uart_ports_[port_id];
+  UartPort* port = uart_ports_.Get(port_id);
   if (port == nullptr) return -1;
   return port->WriteTx(buffer, offset, length);
 }
 
 int OnBoardComputer::ReceivedByCompo(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = uart_ports_[port_id];
+  UartPort* port = uart_ports_.Get(port_id);
   if (port == nullptr) return -1;
   return port->ReadTx(buffer, offset, length);
 }
 
+RingBufferSpan OnBoardComputer::PeekReceivedByCompo(int port_id) {
+  UartPort* port = uart_ports_.Get(port_id);
+  if (port == nullptr) return RingBufferSpan{nullptr, 0, nullptr, 0};
+  return port->PeekTx();
+}
+
+void OnBoardComputer::CommitReceivedByCompo(int port_id, int length) {
+  UartPort* port = uart_ports_.Get(port_id);
+  if (port == nullptr) return;
+  port->CommitTx(length);
+}
+
 int OnBoardComputer::SendFromCompo(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = uart_ports_[port_id];
+  UartPort* port = uart_ports_.Get(port_id);
   if (port == nullptr) return -1;
   return port->WriteRx(buffer, offset, length);
 }
 
 int OnBoardComputer::ReceivedByObc(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = uart_ports_[port_id];
+  UartPort* port = uart_ports_.Get(port_id);
   if (port == nullptr) return -1;
   return port->ReadRx(buffer, offset, length);
 }
 
 int OnBoardComputer::I2cConnectPort(int port_id, const unsigned char i2c_address) {
-  if (i2c_ports_[port_id] != nullptr) {
+  // Invalid port
+  if (!PortTable<I2cPort>::IsValid(port_id)) return -1;
+
+  I2cPort* port = i2c_ports_.Get(port_id);
+  if (port != nullptr) {
     // Port already used
   } else {
-    i2c_ports_[port_id] = new I2cPort();
+    port = new I2cPort();
+    i2c_ports_.Add(port_id, port);
   }
-  i2c_ports_[port_id]->RegisterDevice(i2c_address);
+  port->RegisterDevice(i2c_address);
 
   return 0;
 }
 
 int OnBoardComputer::I2cCloseComPort(int port_id) {
+  I2cPort* port = i2c_ports_.Remove(port_id);
   // Port not used
-  if (i2c_ports_[port_id] == nullptr) return -1;
+  if (port == nullptr) return -1;
 
-  I2cPort* port = i2c_ports_.at(port_id);
   delete port;
-  i2c_ports_.erase(port_id);
   return 0;
 }
 
 int OnBoardComputer::I2cComponentWriteRegister(int port_id, const unsigned char i2c_address, const unsigned char register_address,
                                                const unsigned char* data, const unsigned char length) {
-  I2cPort* i2c_port = i2c_ports_[port_id];
+  I2cPort* i2c_port = i2c_ports_.Get(port_id);
+  if (i2c_port == nullptr) return -1;
   for (int i = 0; i < length; i++) {
     i2c_port->WriteRegister(i2c_address, register_address, data[i]);
   }
@@ -100,35 +116,37 @@ int OnBoardComputer::I2cComponentWriteRegister(int port_id, const unsigned char
 }
 int OnBoardComputer::I2cComponentReadRegister(int port_id, const unsigned char i2c_address, const unsigned char register_address, unsigned char* data,
                                               const unsigned char length) {
-  I2cPort* i2c_port = i2c_ports_[port_id];
+  I2cPort* i2c_port = i2c_ports_.Get(port_id);
+  if (i2c_port == nullptr) return -1;
   for (int i = 0; i < length; i++) {
     data[i] = i2c_port->ReadRegister(register_address, i2c_address);
   }
   return 0;
 }
 int OnBoardComputer::I2cComponentReadCommand(int port_id, const unsigned char i2c_address, unsigned char* data, const unsigned char length) {
-  I2cPort* i2c_port = i2c_ports_[port_id];
+  I2cPort* i2c_port = i2c_ports_.Get(port_id);
+  if (i2c_port == nullptr) return -1;
   i2c_port->ReadCommand(i2c_address, data, length);
   return 0;
 }
 
 int OnBoardComputer::GpioConnectPort(int port_id) {
-  if (gpio_ports_[port_id] != nullptr) {
-    // Port already used
+  if (!PortTable<GpioPort>::IsValid(port_id) || gpio_ports_.Get(port_id) != nullptr) {
+    // Port already used or invalid
     return -1;
   }
-  gpio_ports_[port_id] = new GpioPort(port_id);
+  gpio_ports_.Add(port_id, new GpioPort(port_id));
   return 0;
 }
 
 int OnBoardComputer::GpioComponentWrite(int port_id, const bool is_high) {
-  GpioPort* port = gpio_ports_[port_id];
+  GpioPort* port = gpio_ports_.Get(port_id);
   if (port == nullptr) return -1;
   return port->DigitalWrite(is_high);
 }
 
 bool OnBoardComputer::GpioComponentRead(int port_id) {
-  GpioPort* port = gpio_ports_[port_id];
+  GpioPort* port = gpio_ports_.Get(port_id);
   if (port == nullptr) return false;
   return port->DigitalRead();
 }
@@ -8,8 +8,8 @@
 
 #include <components/ports/gpio_port.hpp>
 #include <components/ports/i2c_port.hpp>
+#include <components/ports/port_table.hpp>
 #include <components/ports/uart_port.hpp>
-#include <map>
 
 #include "../../base/component.hpp"
 
@@ -88,6 +88,20 @@ class OnBoardComputer : public Component {
    * @return Number of read byte
    */
   virtual int ReceivedByCompo(int port_id, unsigned char* buffer, int offset, int length);
+  /**
+   * @fn PeekReceivedByCompo
+   * @brief Return data from OBC to Components without copying. The data is kept until CommitReceivedByCompo is called.
+   * @param [in] port_id: Port ID
+   * @return Span of the data. The size is zero when the port is not connected.
+   */
+  virtual RingBufferSpan PeekReceivedByCompo(int port_id);
+  /**
+   * @fn CommitReceivedByCompo
+   * @brief Release data from OBC to Components returned by PeekReceivedByCompo
+   * @param [in] port_id: Port ID
+   * @param [in] length: Length of the released data
+   */
+  virtual void CommitReceivedByCompo(int port_id, int length);
 
   /**
    * @fn SendFromComponent
@@ -202,9 +216,9 @@ class OnBoardComputer : public Component {
   virtual void MainRoutine(const int time_count);
 
  private:
-  std::map<int, UartPort*> uart_ports_;  //!< UART ports
-  std::map<int, I2cPort*> i2c_ports_;    //!< I2C ports
-  std::map<int, GpioPort*> gpio_ports_;  //!< GPIO ports
+  PortTable<UartPort> uart_ports_;  //!< UART ports
+  PortTable<I2cPort> i2c_ports_;    //!< I2C ports
+  PortTable<GpioPort> gpio_ports_;  //!< GPIO ports
 };
 
 #endif  // S2E_COMPONENTS_REAL_CDH_OBC_HPP_
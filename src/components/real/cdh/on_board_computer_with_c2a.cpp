@@ -12,9 +12,7 @@
 #include "src_core/c2a_core_main.h"
 #endif
 
-std::map<int, UartPort*> ObcWithC2a::com_ports_c2a_;
-std::map<int, I2cPort*> ObcWithC2a::i2c_com_ports_c2a_;
-std::map<int, GpioPort*> ObcWithC2a::gpio_ports_c2a_;
+thread_local ObcWithC2a* ObcWithC2a::executing_obc_ = nullptr;
 
 ObcWithC2a::ObcWithC2a(ClockGenerator* clock_generator) : OnBoardComputer(clock_generator), timing_regulator_(1) {
   // Initialize();
@@ -30,9 +28,19 @@ ObcWithC2a::ObcWithC2a(int prescaler, ClockGenerator* clock_generator, int timin
   // Initialize();
 }
 
-ObcWithC2a::~ObcWithC2a() {}
+ObcWithC2a::ObcWithC2a(int prescaler, ClockGenerator* clock_generator, int timing_regulator, PowerPort* power_port, const bool is_threaded,
+                       const unsigned int maximum_skew_steps)
+    : OnBoardComputer(prescaler, clock_generator, power_port),
+      timing_regulator_(timing_regulator),
+      is_threaded_(is_threaded),
+      step_synchronizer_(maximum_skew_steps) {
+  SetNeedsTickSynchronization(is_threaded_);
+}
+
+ObcWithC2a::~ObcWithC2a() { StopFlightSoftware(); }
 
 void ObcWithC2a::Initialize() {
+  ExecutingObcScope executing_obc_scope(this);
 #ifdef USE_C2A
   TMGR_init();  // Time Manager
                 // Initialize at the beginning in order to measure the execution
@@ -48,70 +56,135 @@ void ObcWithC2a::Initialize() {
 void ObcWithC2a::MainRoutine(const int time_count) {
   UNUSED(time_count);
 
-#ifdef USE_C2A
+  if (is_threaded_) {
+    // The flight software is executed in its thread after all components are ticked
+    is_step_requested_ = true;
+    return;
+  }
   if (is_initialized == false) {
     is_initialized = true;
     Initialize();
   }
+  ExecuteFlightSoftware();
+}
+
+void ObcWithC2a::BeginTick(const unsigned int count) {
+  UNUSED(count);
+  step_synchronizer_.WaitForSkew();
+}
+
+void ObcWithC2a::EndTick(const unsigned int count) {
+  UNUSED(count);
+  if (is_step_requested_ == false) return;
+  is_step_requested_ = false;
+  if (!flight_software_thread_.joinable()) {
+    flight_software_thread_ = std::thread(&ObcWithC2a::FlightSoftwareLoop, this);
+  }
+  step_synchronizer_.ReleaseStep();
+}
+
+void ObcWithC2a::ExecuteFlightSoftware() {
+  ExecutingObcScope executing_obc_scope(this);
   for (int i = 0; i < timing_regulator_; i++) {
-    TMGR_count_up_master_clock();  // The update time oc C2A clock should be
-                                   // 1msec
-    TDSP_execute_pl_as_task_list();
+    ExecuteFlightSoftwareCycle();
   }
+}
+
+void ObcWithC2a::ExecuteFlightSoftwareCycle() {
+#ifdef USE_C2A
+  TMGR_count_up_master_clock();  // The update time oc C2A clock should be
+                                 // 1msec
+  TDSP_execute_pl_as_task_list();
 #endif
 }
 
+void ObcWithC2a::FlightSoftwareLoop() {
+  // All C2A functions are called in this thread
+  is_initialized = true;
+  Initialize();
+  while (step_synchronizer_.WaitForReleasedStep()) {
+    ExecuteFlightSoftware();
+    step_synchronizer_.CompleteStep();
+  }
+}
+
+void ObcWithC2a::StopFlightSoftware() {
+  if (flight_software_thread_.joinable()) {
+    step_synchronizer_.Stop();
+    flight_software_thread_.join();
+  }
+}
+
+void ObcWithC2a::WaitForFlightSoftware() {
+  if (is_threaded_) step_synchronizer_.WaitForAllSteps();
+}
+
 // Override functions
 int ObcWithC2a::ConnectComPort(int port_id, int tx_buffer_size, int rx_buffer_size) {
-  if (com_ports_c2a_[port_id] != nullptr) {
-    // Port already used
+  WaitForFlightSoftware();
+  if (!PortTable<UartPort>::IsValid(port_id) || com_ports_c2a_.Get(port_id) != nullptr) {
+    // Port already used or invalid
     return -1;
   }
-  com_ports_c2a_[port_id] = new UartPort(tx_buffer_size, rx_buffer_size);
+  com_ports_c2a_.Add(port_id, new UartPort(tx_buffer_size, rx_buffer_size));
   return 0;
 }
 
 // Close port and free resources
 int ObcWithC2a::CloseComPort(int port_id) {
+  WaitForFlightSoftware();
+  UartPort* port = com_ports_c2a_.Remove(port_id);
   // Port not used
-  if (com_ports_c2a_[port_id] == nullptr) return -1;
+  if (port == nullptr) return -1;
 
-  UartPort* port = com_ports_c2a_.at(port_id);
   delete port;
-  com_ports_c2a_.erase(port_id);
   return 0;
 }
 
 int ObcWithC2a::SendFromObc(int port_id, unsigned char* buffer, int offset, int length) {
-  return ObcWithC2a::SendFromObc_C2A(port_id, buffer, offset, length);
+  UartPort* port = com_ports_c2a_.Get(port_id);
+  if (port == nullptr) return -1;
+  return port->WriteTx(buffer, offset, length);
 }
 
 int ObcWithC2a::ReceivedByCompo(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = com_ports_c2a_[port_id];
+  UartPort* port = com_ports_c2a_.Get(port_id);
   if (port == nullptr) return -1;
   return port->ReadTx(buffer, offset, length);
 }
 
+RingBufferSpan ObcWithC2a::PeekReceivedByCompo(int port_id) {
+  UartPort* port = com_ports_c2a_.Get(port_id);
+  if (port == nullptr) return RingBufferSpan{nullptr, 0, nullptr, 0};
+  return port->PeekTx();
+}
+
+void ObcWithC2a::CommitReceivedByCompo(int port_id, int length) {
+  UartPort* port = com_ports_c2a_.Get(port_id);
+  if (port == nullptr) return;
+  port->CommitTx(length);
+}
+
 int ObcWithC2a::SendFromCompo(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = com_ports_c2a_[port_id];
+  UartPort* port = com_ports_c2a_.Get(port_id);
   if (port == nullptr) return -1;
   return port->WriteRx(buffer, offset, length);
 }
 
 int ObcWithC2a::ReceivedByObc(int port_id, unsigned char* buffer, int offset, int length) {
-  return ObcWithC2a::ReceivedByObc_C2A(port_id, buffer, offset, length);
+  UartPort* port = com_ports_c2a_.Get(port_id);
+  if (port == nullptr) return -1;
+  return port->ReadRx(buffer, offset, length);
 }
 
 // Static functions
 int ObcWithC2a::SendFromObc_C2A(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = com_ports_c2a_[port_id];
-  if (port == nullptr) return -1;
-  return port->WriteTx(buffer, offset, length);
+  if (executing_obc_ == nullptr) return -1;
+  return executing_obc_->SendFromObc(port_id, buffer, offset, length);
 }
 int ObcWithC2a::ReceivedByObc_C2A(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = com_ports_c2a_[port_id];
-  if (port == nullptr) return -1;
-  return port->ReadRx(buffer, offset, length);
+  if (executing_obc_ == nullptr) return -1;
+  return executing_obc_->ReceivedByObc(port_id, buffer, offset, length);
 }
 
 // If the character encoding of C2A is UTF-8, these functions are not necessary,
@@ -124,34 +197,44 @@ int OBC_C2A_ReceivedByObc(int port_id, unsigned char* buffer, int offset, int le
 }
 
 int ObcWithC2a::I2cConnectPort(int port_id, const unsigned char i2c_address) {
-  if (i2c_com_ports_c2a_[port_id] != nullptr) {
+  WaitForFlightSoftware();
+  // Invalid port
+  if (!PortTable<I2cPort>::IsValid(port_id)) return -1;
+
+  I2cPort* port = i2c_com_ports_c2a_.Get(port_id);
+  if (port != nullptr) {
     // Port already used
   } else {
-    i2c_com_ports_c2a_[port_id] = new I2cPort();
+    port = new I2cPort();
+    i2c_com_ports_c2a_.Add(port_id, port);
   }
-  i2c_com_ports_c2a_[port_id]->RegisterDevice(i2c_address);
+  port->RegisterDevice(i2c_address);
 
   return 0;
 }
 
 int ObcWithC2a::I2cCloseComPort(int port_id) {
+  WaitForFlightSoftware();
+  I2cPort* port = i2c_com_ports_c2a_.Remove(port_id);
   // Port not used
-  if (i2c_com_ports_c2a_[port_id] == nullptr) return -1;
+  if (port == nullptr) return -1;
 
-  I2cPort* port = i2c_com_ports_c2a_.at(port_id);
   delete port;
-  i2c_com_ports_c2a_.erase(port_id);
   return 0;
 }
 
 int ObcWithC2a::I2cWriteCommand(int port_id, const unsigned char i2c_address, const unsigned char* data, const unsigned char length) {
-  I2cPort* i2c_port = i2c_com_ports_c2a_[port_id];
+  if (executing_obc_ == nullptr) return -1;
+  I2cPort* i2c_port = executing_obc_->i2c_com_ports_c2a_.Get(port_id);
+  if (i2c_port == nullptr) return -1;
   i2c_port->WriteCommand(i2c_address, data, length);
   return 0;
 }
 
 int ObcWithC2a::I2cWriteRegister(int port_id, const unsigned char i2c_address, const unsigned char* data, const unsigned char length) {
-  I2cPort* i2c_port = i2c_com_ports_c2a_[port_id];
+  if (executing_obc_ == nullptr) return -1;
+  I2cPort* i2c_port = executing_obc_->i2c_com_ports_c2a_.Get(port_id);
+  if (i2c_port == nullptr) return -1;
 
   if (length == 1) {
     i2c_port->WriteRegister(i2c_address, data[0]);
@@ -164,7 +247,9 @@ int ObcWithC2a::I2cWriteRegister(int port_id, const unsigned char i2c_address, c
 }
 
 int ObcWithC2a::I2cReadRegister(int port_id, const unsigned char i2c_address, unsigned char* data, const unsigned char length) {
-  I2cPort* i2c_port = i2c_com_ports_c2a_[port_id];
+  if (executing_obc_ == nullptr) return -1;
+  I2cPort* i2c_port = executing_obc_->i2c_com_ports_c2a_.Get(port_id);
+  if (i2c_port == nullptr) return -1;
   for (int i = 0; i < length; i++) {
     data[i] = i2c_port->ReadRegister(i2c_address);
   }
@@ -173,7 +258,8 @@ int ObcWithC2a::I2cReadRegister(int port_id, const unsigned char i2c_address, un
 
 int ObcWithC2a::I2cComponentWriteRegister(int port_id, const unsigned char i2c_address, const unsigned char register_address,
                                           const unsigned char* data, const unsigned char length) {
-  I2cPort* i2c_port = i2c_com_ports_c2a_[port_id];
+  I2cPort* i2c_port = i2c_com_ports_c2a_.Get(port_id);
+  if (i2c_port == nullptr) return -1;
   for (unsigned char i = 0; i < length; i++) {
     i2c_port->WriteRegister(i2c_address, register_address + i, data[i]);
   }
@@ -181,14 +267,16 @@ int ObcWithC2a::I2cComponentWriteRegister(int port_id, const unsigned char i2c_a
 }
 int ObcWithC2a::I2cComponentReadRegister(int port_id, const unsigned char i2c_address, const unsigned char register_address, unsigned char* data,
                                          const unsigned char length) {
-  I2cPort* i2c_port = i2c_com_ports_c2a_[port_id];
+  I2cPort* i2c_port = i2c_com_ports_c2a_.Get(port_id);
+  if (i2c_port == nullptr) return -1;
   for (unsigned char i = 0; i < length; i++) {
     data[i] = i2c_port->ReadRegister(i2c_address, register_address + i);
   }
   return 0;
 }
 int ObcWithC2a::I2cComponentReadCommand(int port_id, const unsigned char i2c_address, unsigned char* data, const unsigned char length) {
-  I2cPort* i2c_port = i2c_com_ports_c2a_[port_id];
+  I2cPort* i2c_port = i2c_com_ports_c2a_.Get(port_id);
+  if (i2c_port == nullptr) return -1;
   i2c_port->ReadCommand(i2c_address, data, length);
   return 0;
 }
@@ -204,36 +292,35 @@ int OBC_C2A_I2cReadRegister(int port_id, const unsigned char i2c_address, unsign
 }
 
 int ObcWithC2a::GpioConnectPort(int port_id) {
-  if (gpio_ports_c2a_[port_id] != nullptr) {
-    // Port already used
+  WaitForFlightSoftware();
+  if (!PortTable<GpioPort>::IsValid(port_id) || gpio_ports_c2a_.Get(port_id) != nullptr) {
+    // Port already used or invalid
     return -1;
   }
-  gpio_ports_c2a_[port_id] = new GpioPort(port_id);
+  gpio_ports_c2a_.Add(port_id, new GpioPort(port_id));
   return 0;
 }
 
 int ObcWithC2a::GpioComponentWrite(int port_id, const bool is_high) {
-  GpioPort* port = gpio_ports_c2a_[port_id];
+  GpioPort* port = gpio_ports_c2a_.Get(port_id);
   if (port == nullptr) return -1;
   return port->DigitalWrite(is_high);
 }
 
 bool ObcWithC2a::GpioComponentRead(int port_id) {
-  GpioPort* port = gpio_ports_c2a_[port_id];
+  GpioPort* port = gpio_ports_c2a_.Get(port_id);
   if (port == nullptr) return false;
   return port->DigitalRead();
 }
 
 int ObcWithC2a::GpioWrite_C2A(int port_id, const bool is_high) {
-  GpioPort* port = gpio_ports_c2a_[port_id];
-  if (port == nullptr) return -1;
-  return port->DigitalWrite(is_high);
+  if (executing_obc_ == nullptr) return -1;
+  return executing_obc_->GpioComponentWrite(port_id, is_high);
 }
 
 bool ObcWithC2a::GpioRead_C2A(int port_id) {
-  GpioPort* port = gpio_ports_c2a_[port_id];
-  if (port == nullptr) return false;
-  return port->DigitalRead();
+  if (executing_obc_ == nullptr) return false;
+  return executing_obc_->GpioComponentRead(port_id);
 }
 
 int OBC_C2A_GpioWrite(int port_id, const bool is_high) { return ObcWithC2a::GpioWrite_C2A(port_id, is_high); }
@@ -7,12 +7,20 @@
 #define S2E_COMPONENTS_REAL_CDH_OBC_C2A_HPP_
 
 #include <components/ports/gpio_port.hpp>
+#include <library/utilities/step_synchronizer.hpp>
+#include <thread>
 
 #include "on_board_computer.hpp"
 
 /*
  * @class ObcWithC2a
  * @brief Class to emulate on board computer with C2A flight software
+ * @details In the threaded mode, C2A is executed in its own thread in parallel with the other simulation processes like the dynamics.
+ *          The C2A step requested in a tick is released after all components are ticked, and the next tick waits for the step within the
+ *          maximum skew. With the maximum skew 1 (lock-step), the result does not depend on the thread timing, and the C2A output is visible
+ *          to the components from the next tick. The UART ports are shared with the lock-free ring buffers.
+ *          The ports are owned by each instance. The static functions for C2A access the ports of the instance executing C2A in the calling
+ *          thread, so they return the error when they are called out of the C2A execution.
  */
 class ObcWithC2a : public OnBoardComputer {
  public:
@@ -38,12 +46,36 @@ class ObcWithC2a : public OnBoardComputer {
    * @param [in] power_port: Power port
    */
   ObcWithC2a(int prescaler, ClockGenerator* clock_generator, int timing_regulator, PowerPort* power_port);
+  /**
+   * @fn ObcWithC2a
+   * @brief Constructor
+   * @param [in] prescaler: Frequency scale factor for update
+   * @param [in] clock_generator: Clock generator
+   * @param [in] timing_regulator: Timing regulator to update flight software faster than the component update
+   * @param [in] power_port: Power port
+   * @param [in] is_threaded: Execute C2A in its own thread
+   * @param [in] maximum_skew_steps: Maximum number of C2A steps executed behind the simulation in the threaded mode. 1 means the lock-step.
+   */
+  ObcWithC2a(int prescaler, ClockGenerator* clock_generator, int timing_regulator, PowerPort* power_port, const bool is_threaded,
+             const unsigned int maximum_skew_steps = 1);
   /**
    * @fn ~ObcWithC2a
    * @brief Destructor
    */
   ~ObcWithC2a();
 
+  // Override functions for ITickable
+  /**
+   * @fn BeginTick
+   * @brief Wait for the C2A steps in the threaded mode to keep the maximum skew
+   */
+  void BeginTick(const unsigned int count) override;
+  /**
+   * @fn EndTick
+   * @brief Release the C2A step requested in this tick to the flight software thread
+   */
+  void EndTick(const unsigned int count) override;
+
   // UART Communication port functions. TODO:Rename the following functions to UartHogeHoge
   /**
    * @fn ConnectComPort
@@ -81,6 +113,20 @@ class ObcWithC2a : public OnBoardComputer {
    * @return Number of read byte
    */
   int ReceivedByCompo(int port_id, unsigned char* buffer, int offset, int length) override;
+  /**
+   * @fn PeekReceivedByCompo
+   * @brief Return data from OBC to Components without copying. The data is kept until CommitReceivedByCompo is called.
+   * @param [in] port_id: Port ID
+   * @return Span of the data. The size is zero when the port is not connected.
+   */
+  RingBufferSpan PeekReceivedByCompo(int port_id) override;
+  /**
+   * @fn CommitReceivedByCompo
+   * @brief Release data from OBC to Components returned by PeekReceivedByCompo
+   * @param [in] port_id: Port ID
+   * @param [in] length: Length of the released data
+   */
+  void CommitReceivedByCompo(int port_id, int length) override;
 
   /**
    * @fn SendFromComponent
@@ -249,10 +295,51 @@ class ObcWithC2a : public OnBoardComputer {
    */
   static bool GpioRead_C2A(int port_id);
 
+ protected:
+  /**
+   * @class ExecutingObcScope
+   * @brief Set the OBC executing C2A in the current thread during the scope, and restore the previous one at the end of the scope
+   */
+  class ExecutingObcScope {
+   public:
+    /**
+     * @fn ExecutingObcScope
+     * @brief Constructor
+     * @param [in] obc: OBC executing C2A in the scope
+     */
+    explicit ExecutingObcScope(ObcWithC2a* obc) : previous_obc_(executing_obc_) { executing_obc_ = obc; }
+    /**
+     * @fn ~ExecutingObcScope
+     * @brief Destructor
+     */
+    ~ExecutingObcScope() { executing_obc_ = previous_obc_; }
+
+   private:
+    ObcWithC2a* previous_obc_;  //!< OBC executing C2A before the scope
+  };
+
+  /**
+   * @fn ExecuteFlightSoftwareCycle
+   * @brief Execute C2A for 1 msec. It is called timing_regulator times in a component update, in the flight software thread in the threaded mode.
+   * @note The derived class can override it to emulate the flight software with the static functions for C2A. Such a class has to call
+   *       StopFlightSoftware in its destructor, since the flight software thread calls it until the thread is stopped.
+   */
+  virtual void ExecuteFlightSoftwareCycle();
+  /**
+   * @fn StopFlightSoftware
+   * @brief Stop the flight software thread after the released steps are completed
+   */
+  void StopFlightSoftware();
+
  private:
   bool is_initialized = false;  //!< Is initialized flag
   const int timing_regulator_;  //!< Timing regulator to update flight software faster than the component update
 
+  const bool is_threaded_ = false;      //!< Flag to execute C2A in its own thread
+  bool is_step_requested_ = false;      //!< Flag of the C2A step requested in the current tick
+  StepSynchronizer step_synchronizer_;  //!< Synchronizer of the flight software thread
+  std::thread flight_software_thread_;  //!< Flight software thread started at the first step
+
   // Override functions for Component
   /**
    * @fn MainRoutine
@@ -264,10 +351,27 @@ class ObcWithC2a : public OnBoardComputer {
    * @brief Initialize function
    */
   void Initialize();
+  /**
+   * @fn ExecuteFlightSoftware
+   * @brief Execute C2A for one component update
+   */
+  void ExecuteFlightSoftware();
+  /**
+   * @fn FlightSoftwareLoop
+   * @brief Main loop of the flight software thread
+   */
+  void FlightSoftwareLoop();
+  /**
+   * @fn WaitForFlightSoftware
+   * @brief Wait until the flight software thread finishes the released steps before changing the ports
+   */
+  void WaitForFlightSoftware();
+
+  PortTable<UartPort> com_ports_c2a_;     //!< UART ports
+  PortTable<I2cPort> i2c_com_ports_c2a_;  //!< I2C ports
+  PortTable<GpioPort> gpio_ports_c2a_;    //!< GPIO ports
 
-  static std::map<int, UartPort*> com_ports_c2a_;     //!< UART ports
-  static std::map<int, I2cPort*> i2c_com_ports_c2a_;  //!< I2C ports
-  static std::map<int, GpioPort*> gpio_ports_c2a_;    //!< GPIO ports
+  static thread_local ObcWithC2a* executing_obc_;  //!< OBC executing C2A in the current thread, used by the static functions for C2A
 };
 
 // If the character encoding of C2A is UTF-8, the following functions are not necessary,
@@ -0,0 +1,202 @@
+/**
+ * @file test_on_board_computer_with_c2a.cpp
+ * @brief Test codes for ObcWithC2a class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <components/base/component.hpp>
+#include <components/base/uart_communication_with_obc.hpp>
+#include <vector>
+
+#include "on_board_computer_with_c2a.hpp"
+
+/**
+ * @class ObcWithC2aForTest
+ * @brief ObcWithC2a which exposes the scope of the C2A execution, so that the static functions for C2A can be called as C2A
+ */
+class ObcWithC2aForTest : public ObcWithC2a {
+ public:
+  ObcWithC2aForTest(ClockGenerator* clock_generator) : ObcWithC2a(clock_generator) {}
+
+  using ExecutingObcScope = ObcWithC2a::ExecutingObcScope;
+};
+
+/**
+ * @brief Test for the ports owned by each instance and accessed by the static functions for C2A in the execution of the instance
+ */
+TEST(ObcWithC2a, IndependentPortTables) {
+  ClockGenerator clock_generator;
+  ObcWithC2aForTest obc_a(&clock_generator);
+  ObcWithC2aForTest obc_b(&clock_generator);
+  // The same port ID can be used in each instance
+  ASSERT_EQ(0, obc_a.ConnectComPort(0, 64, 64));
+  ASSERT_EQ(0, obc_b.ConnectComPort(0, 64, 64));
+  ASSERT_EQ(0, obc_a.GpioConnectPort(1));
+  ASSERT_EQ(0, obc_b.GpioConnectPort(1));
+
+  unsigned char command[3] = {1, 2, 3};
+  obc_a.SendFromCompo(0, command, 0, 3);
+  unsigned char buffer[8] = {};
+  {
+    ObcWithC2aForTest::ExecutingObcScope scope_a(&obc_a);
+    EXPECT_EQ(3, ObcWithC2a::ReceivedByObc_C2A(0, buffer, 0, 8));
+    EXPECT_EQ(3, buffer[2]);
+    EXPECT_EQ(0, ObcWithC2a::GpioWrite_C2A(1, true));
+    {
+      // The nested execution accesses the ports of the other instance and restores the previous instance
+      ObcWithC2aForTest::ExecutingObcScope scope_b(&obc_b);
+      unsigned char telemetry[2] = {4, 5};
+      EXPECT_EQ(2, ObcWithC2a::SendFromObc_C2A(0, telemetry, 0, 2));
+      EXPECT_FALSE(ObcWithC2a::GpioRead_C2A(1));
+    }
+    EXPECT_TRUE(ObcWithC2a::GpioRead_C2A(1));
+  }
+
+  EXPECT_EQ(0, obc_a.ReceivedByCompo(0, buffer, 0, 8));
+  EXPECT_EQ(2, obc_b.ReceivedByCompo(0, buffer, 0, 8));
+  EXPECT_EQ(5, buffer[1]);
+  EXPECT_TRUE(obc_a.GpioComponentRead(1));
+  EXPECT_FALSE(obc_b.GpioComponentRead(1));
+
+  // Closing the port of an instance does not affect the other instance
+  EXPECT_EQ(0, obc_a.CloseComPort(0));
+  EXPECT_EQ(-1, obc_a.SendFromCompo(0, command, 0, 3));
+  EXPECT_EQ(3, obc_b.SendFromCompo(0, command, 0, 3));
+}
+
+/**
+ * @brief Test for the static functions for C2A called out of the C2A execution
+ */
+TEST(ObcWithC2a, StaticFunctionsOutOfExecution) {
+  ClockGenerator clock_generator;
+  ObcWithC2aForTest obc(&clock_generator);
+  ASSERT_EQ(0, obc.ConnectComPort(0, 64, 64));
+
+  unsigned char telemetry[2] = {4, 5};
+  EXPECT_EQ(-1, ObcWithC2a::SendFromObc_C2A(0, telemetry, 0, 2));
+  // The OBC executing C2A is cleared after the initialization and the execution in the tick
+  for (int i = 0; i < 3; i++) clock_generator.TickToComponents();
+  EXPECT_EQ(-1, ObcWithC2a::SendFromObc_C2A(0, telemetry, 0, 2));
+  EXPECT_EQ(-1, ObcWithC2a::GpioWrite_C2A(1, true));
+  EXPECT_EQ(0, obc.ReceivedByCompo(0, telemetry, 0, 2));
+}
+
+/**
+ * @class EchoObcForTest
+ * @brief ObcWithC2a whose flight software returns the received data with each byte incremented
+ */
+class EchoObcForTest : public ObcWithC2a {
+ public:
+  EchoObcForTest(ClockGenerator* clock_generator, PowerPort* power_port, const bool is_threaded, const unsigned int maximum_skew_steps)
+      : ObcWithC2a(1, clock_generator, 1, power_port, is_threaded, maximum_skew_steps) {}
+  ~EchoObcForTest() { StopFlightSoftware(); }
+
+ private:
+  void ExecuteFlightSoftwareCycle() override {
+    unsigned char buffer[64];
+    int length = ObcWithC2a::ReceivedByObc_C2A(0, buffer, 0, sizeof(buffer));
+    for (int i = 0; i < length; i++) buffer[i]++;
+    if (length > 0) ObcWithC2a::SendFromObc_C2A(0, buffer, 0, length);
+  }
+};
+
+/**
+ * @class UartComponentForTest
+ * @brief Component which sends a telemetry and reads the commands from the OBC in each tick
+ */
+class UartComponentForTest : public Component, public UartCommunicationWithObc {
+ public:
+  UartComponentForTest(ClockGenerator* clock_generator, OnBoardComputer* obc) : Component(1, clock_generator), UartCommunicationWithObc(0, obc) {}
+
+  /**
+   * @fn ReadCommand
+   * @brief Read the commands and return the number of the bytes read in total
+   */
+  size_t ReadCommand() {
+    ReceiveCommand(0, 64);
+    return received_data_.size();
+  }
+
+  std::vector<unsigned char> received_data_;  //!< Data received in total
+  std::vector<size_t> received_sizes_;        //!< Size of the data received in total at each tick
+
+ private:
+  unsigned char telemetry_count_ = 0;  //!< Count of the telemetries
+
+  void MainRoutine(const int time_count) override {
+    UNUSED(time_count);
+    SendTelemetry(0);
+    received_sizes_.push_back(ReadCommand());
+  }
+  int ParseCommand(const int command_size) override {
+    received_data_.insert(received_data_.end(), rx_buffer_.begin(), rx_buffer_.begin() + command_size);
+    return command_size;
+  }
+  int GenerateTelemetry() override {
+    for (size_t i = 0; i < 4; i++) tx_buffer_[i] = (unsigned char)(telemetry_count_ * 4 + i);
+    telemetry_count_++;
+    return 4;
+  }
+};
+
+/**
+ * @fn RunEchoSimulation
+ * @brief Tick the OBC and the component, and return the data received by the component
+ * @param [in] is_threaded: Execute the flight software in its own thread
+ * @param [in] maximum_skew_steps: Maximum skew of the flight software thread
+ * @param [in] number_of_ticks: Number of ticks
+ * @param [out] received_data: Data received by the component in total
+ * @param [out] received_sizes: Size of the data received by the component in total at each tick
+ */
+void RunEchoSimulation(const bool is_threaded, const unsigned int maximum_skew_steps, const size_t number_of_ticks,
+                       std::vector<unsigned char>& received_data, std::vector<size_t>& received_sizes) {
+  ClockGenerator clock_generator;
+  PowerPort power_port;
+  EchoObcForTest obc(&clock_generator, &power_port, is_threaded, maximum_skew_steps);
+  UartComponentForTest component(&clock_generator, &obc);
+  for (size_t i = 0; i < number_of_ticks; i++) clock_generator.TickToComponents();
+
+  received_data = component.received_data_;
+  received_sizes = component.received_sizes_;
+}
+
+/**
+ * @brief Test for the threaded mode compared with the inline mode in the communication with a UART component
+ * @note The component reads the data returned by the flight software for the telemetry of the previous tick in both modes with the lock-step.
+ *       With the larger skew, the data can be delayed by the skew, but the same data is received in the same order.
+ */
+TEST(ObcWithC2a, ThreadedModeEquivalence) {
+  const size_t kNumberOfTicks = 200;
+  std::vector<unsigned char> inline_data;
+  std::vector<size_t> inline_sizes;
+  RunEchoSimulation(false, 1, kNumberOfTicks, inline_data, inline_sizes);
+  ASSERT_EQ((kNumberOfTicks - 1) * 4, inline_data.size());
+  for (size_t i = 0; i < inline_data.size(); i++) EXPECT_EQ((unsigned char)(i + 1), inline_data[i]);
+  for (size_t tick = 0; tick < kNumberOfTicks; tick++) EXPECT_EQ(tick * 4, inline_sizes[tick]);
+
+  // Lock-step
+  for (int trial = 0; trial < 5; trial++) {
+    std::vector<unsigned char> threaded_data;
+    std::vector<size_t> threaded_sizes;
+    RunEchoSimulation(true, 1, kNumberOfTicks, threaded_data, threaded_sizes);
+    EXPECT_EQ(inline_data, threaded_data);
+    EXPECT_EQ(inline_sizes, threaded_sizes);
+  }
+
+  // Larger skew
+  const size_t kMaximumSkewSteps = 3;
+  for (int trial = 0; trial < 5; trial++) {
+    std::vector<unsigned char> threaded_data;
+    std::vector<size_t> threaded_sizes;
+    RunEchoSimulation(true, kMaximumSkewSteps, kNumberOfTicks, threaded_data, threaded_sizes);
+    ASSERT_LE(threaded_data.size(), inline_data.size());
+    EXPECT_TRUE(std::equal(threaded_data.begin(), threaded_data.end(), inline_data.begin()));
+    ASSERT_EQ(kNumberOfTicks, threaded_sizes.size());
+    for (size_t tick = kMaximumSkewSteps; tick < kNumberOfTicks; tick++) {
+      // The flight software completed the steps for the telemetries until (tick - maximum skew)
+      EXPECT_LE((tick - kMaximumSkewSteps + 1) * 4, threaded_sizes[tick]) << "tick " << tick;
+      EXPECT_GE((tick + 1) * 4, threaded_sizes[tick]) << "tick " << tick;
+    }
+  }
+}
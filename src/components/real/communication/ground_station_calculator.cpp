@@ -115,3 +115,10 @@ std::string GroundStationCalculator::GetLogValue() const {
 
   return str_tmp;
 }
+
+bool GroundStationCalculator::GetLogValueBinary(std::vector<double>& values) const {
+  AppendScalar(values, max_bitrate_Mbps_);
+  AppendScalar(values, receive_margin_dB_);
+
+  return true;
+}
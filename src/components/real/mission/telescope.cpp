@@ -40,6 +40,11 @@ Telescope::Telescope(ClockGenerator* clock_generator, const libra::Quaternion& q
   sight_direction_c_ = Vector<3>(0);
   sight_direction_c_[0] = 1;  // (1,0,0) at component frame, Sight direction vector
 
+  // Resolve IDs of the celestial bodies
+  sun_id_ = local_celestial_information_->GetGlobalInformation().CalcBodyIdFromName("SUN");
+  earth_id_ = local_celestial_information_->GetGlobalInformation().CalcBodyIdFromName("EARTH");
+  moon_id_ = local_celestial_information_->GetGlobalInformation().CalcBodyIdFromName("MOON");
+
   // Set 0 when t=0
   for (size_t i = 0; i < number_of_logged_stars_; i++) {
     Star star;
@@ -59,13 +64,16 @@ Telescope::~Telescope() {}
 void Telescope::MainRoutine(const int time_count) {
   UNUSED(time_count);
   // Check forbidden angle
-  is_sun_in_forbidden_angle = JudgeForbiddenAngle(local_celestial_information_->GetPositionFromSpacecraft_b_m("SUN"), sun_forbidden_angle_rad_);
-  is_earth_in_forbidden_angle = JudgeForbiddenAngle(local_celestial_information_->GetPositionFromSpacecraft_b_m("EARTH"), earth_forbidden_angle_rad_);
-  is_moon_in_forbidden_angle = JudgeForbiddenAngle(local_celestial_information_->GetPositionFromSpacecraft_b_m("MOON"), moon_forbidden_angle_rad_);
+  const libra::Vector<3> sun_position_b_m = local_celestial_information_->GetPositionFromSpacecraft_b_m(sun_id_);
+  const libra::Vector<3> earth_position_b_m = local_celestial_information_->GetPositionFromSpacecraft_b_m(earth_id_);
+  const libra::Vector<3> moon_position_b_m = local_celestial_information_->GetPositionFromSpacecraft_b_m(moon_id_);
+  is_sun_in_forbidden_angle = JudgeForbiddenAngle(sun_position_b_m, sun_forbidden_angle_rad_);
+  is_earth_in_forbidden_angle = JudgeForbiddenAngle(earth_position_b_m, earth_forbidden_angle_rad_);
+  is_moon_in_forbidden_angle = JudgeForbiddenAngle(moon_position_b_m, moon_forbidden_angle_rad_);
   // Position calculation of celestial bodies from CelesInfo
-  Observe(sun_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m("SUN"));
-  Observe(earth_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m("EARTH"));
-  Observe(moon_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m("MOON"));
+  Observe(sun_position_image_sensor, sun_position_b_m);
+  Observe(earth_position_image_sensor, earth_position_b_m);
+  Observe(moon_position_image_sensor, moon_position_b_m);
   // Position calculation of stars from Hipparcos Catalogue
   // No update when Hipparocos Catalogue was not readed
   if (hipparcos_->IsCalcEnabled) ObserveStars();
@@ -201,3 +209,22 @@ string Telescope::GetLogValue() const {
   //**********************************************************
   return str_tmp;
 }
+
+bool Telescope::GetLogValueBinary(std::vector<double>& values) const {
+  AppendScalar(values, is_sun_in_forbidden_angle);
+  AppendScalar(values, is_earth_in_forbidden_angle);
+  AppendScalar(values, is_moon_in_forbidden_angle);
+  AppendVector(values, sun_position_image_sensor);
+  AppendVector(values, earth_position_image_sensor);
+  AppendVector(values, moon_position_image_sensor);
+  // When Hipparcos Catalogue was not read, no output of ObserveStars
+  if (hipparcos_->IsCalcEnabled) {
+    for (size_t i = 0; i < number_of_logged_stars_; i++) {
+      AppendScalar(values, star_list_in_sight[i].hipparcos_data.hipparcos_id);
+      AppendScalar(values, star_list_in_sight[i].hipparcos_data.visible_magnitude);
+      AppendVector(values, star_list_in_sight[i].position_image_sensor);
+    }
+  }
+
+  return true;
+}
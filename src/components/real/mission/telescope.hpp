@@ -122,6 +122,9 @@ class Telescope : public Component, public ILoggable {
   const Attitude* attitude_;                                      //!< Attitude information
   const HipparcosCatalogue* hipparcos_;                           //!< Star information
   const LocalCelestialInformation* local_celestial_information_;  //!< Local celestial information
+  unsigned int sun_id_ = 0;                                       //!< ID of the sun in CelestialInformation list
+  unsigned int earth_id_ = 0;                                     //!< ID of the earth in CelestialInformation list
+  unsigned int moon_id_ = 0;                                      //!< ID of the moon in CelestialInformation list
 
   // Override ILoggable
   /**
@@ -134,6 +137,11 @@ class Telescope : public Component, public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
   // For debug **********************************************
   //  libra::Vector<3> sun_pos_c;
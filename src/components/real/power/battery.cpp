@@ -67,6 +67,13 @@ std::string Battery::GetLogValue() const {
   return str_tmp;
 }
 
+bool Battery::GetLogValueBinary(std::vector<double>& values) const {
+  AppendScalar(values, battery_voltage_V_);
+  AppendScalar(values, depth_of_discharge_percent_);
+
+  return true;
+}
+
 void Battery::MainRoutine(const int time_count) {
   UNUSED(time_count);
 
@@ -106,6 +106,11 @@ class Battery : public Component, public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   std::string GetLogValue() const override;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  bool GetLogValueBinary(std::vector<double>& values) const override;
 
  private:
   const int number_of_series_;                                   //!< Number of series connected cells
@@ -49,6 +49,13 @@ std::string PcuInitialStudy::GetLogValue() const {
   return str_tmp;
 }
 
+bool PcuInitialStudy::GetLogValueBinary(std::vector<double>& values) const {
+  AppendScalar(values, power_consumption_W_);
+  AppendScalar(values, bus_voltage_V_);
+
+  return true;
+}
+
 void PcuInitialStudy::MainRoutine(int time_count) {
   double time_query = compo_step_time_s_ * time_count;
   power_consumption_W_ = CalcPowerConsumption(time_query);  // Should use SimulationTime? time_count may over flow since it is int type,
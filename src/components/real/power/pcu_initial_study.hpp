@@ -51,6 +51,11 @@ class PcuInitialStudy : public Component, public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   std::string GetLogValue() const override;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  bool GetLogValueBinary(std::vector<double>& values) const override;
 
  private:
   const std::vector<SolarArrayPanel*> saps_;  //!< Solar Array Panels
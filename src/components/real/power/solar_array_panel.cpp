@@ -25,6 +25,7 @@ SolarArrayPanel::SolarArrayPanel(const int prescaler, ClockGenerator* clock_gene
       compo_step_time_s_(component_step_time_s) {
   voltage_V_ = 0.0;
   power_generation_W_ = 0.0;
+  sun_id_ = local_celestial_information_->GetGlobalInformation().CalcBodyIdFromName("SUN");
 }
 
 SolarArrayPanel::SolarArrayPanel(const int prescaler, ClockGenerator* clock_generator, int component_id, int number_of_series, int number_of_parallel,
@@ -61,6 +62,7 @@ SolarArrayPanel::SolarArrayPanel(ClockGenerator* clock_generator, int component_
       compo_step_time_s_(0.1) {
   voltage_V_ = 0.0;
   power_generation_W_ = 0.0;
+  sun_id_ = local_celestial_information_->GetGlobalInformation().CalcBodyIdFromName("SUN");
 }
 
 SolarArrayPanel::SolarArrayPanel(const SolarArrayPanel& obj)
@@ -74,6 +76,7 @@ SolarArrayPanel::SolarArrayPanel(const SolarArrayPanel& obj)
       transmission_efficiency_(obj.transmission_efficiency_),
       srp_environment_(obj.srp_environment_),
       local_celestial_information_(obj.local_celestial_information_),
+      sun_id_(obj.sun_id_),
       compo_step_time_s_(obj.compo_step_time_s_) {
   voltage_V_ = 0.0;
   power_generation_W_ = 0.0;
@@ -94,6 +97,12 @@ std::string SolarArrayPanel::GetLogValue() const {
   return str_tmp;
 }
 
+bool SolarArrayPanel::GetLogValueBinary(std::vector<double>& values) const {
+  AppendScalar(values, power_generation_W_);
+
+  return true;
+}
+
 void SolarArrayPanel::MainRoutine(const int time_count) {
   if (CsvScenarioInterface::IsCsvScenarioEnabled()) {
     double time_query = compo_step_time_s_ * time_count;
@@ -104,7 +113,7 @@ void SolarArrayPanel::MainRoutine(const int time_count) {
                           cell_area_m2_ * number_of_parallel_ * number_of_series_ * InnerProduct(normal_vector_, normalized_sun_direction_body);
   } else {
     const auto power_density = srp_environment_->GetPowerDensity_W_m2();
-    libra::Vector<3> sun_pos_b = local_celestial_information_->GetPositionFromSpacecraft_b_m("SUN");
+    libra::Vector<3> sun_pos_b = local_celestial_information_->GetPositionFromSpacecraft_b_m(sun_id_);
     libra::Vector<3> sun_dir_b = sun_pos_b.CalcNormalizedVector();
     power_generation_W_ = cell_efficiency_ * transmission_efficiency_ * power_density * cell_area_m2_ * number_of_parallel_ * number_of_series_ *
                           InnerProduct(normal_vector_, sun_dir_b);
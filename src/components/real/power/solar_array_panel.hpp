@@ -105,6 +105,11 @@ class SolarArrayPanel : public Component, public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   std::string GetLogValue() const override;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  bool GetLogValueBinary(std::vector<double>& values) const override;
 
  private:
   const int component_id_;                //!< SolarArrayPanel ID TODO: Use string?
@@ -117,6 +122,7 @@ class SolarArrayPanel : public Component, public ILoggable {
 
   const SolarRadiationPressureEnvironment* const srp_environment_;  //!< Solar Radiation Pressure environment
   const LocalCelestialInformation* local_celestial_information_;    //!< Local celestial information
+  unsigned int sun_id_ = 0;                                         //!< ID of the sun in CelestialInformation list
 
   double voltage_V_;           //!< Voltage [V]
   double power_generation_W_;  //!< Generated power [W]
@@ -92,6 +92,14 @@ std::string SimpleThruster::GetLogValue() const {
   return str_tmp;
 }
 
+bool SimpleThruster::GetLogValueBinary(std::vector<double>& values) const {
+  AppendVector(values, output_thrust_b_N_);
+  AppendVector(values, output_torque_b_Nm_);
+  AppendScalar(values, output_thrust_b_N_.CalcNorm());
+
+  return true;
+}
+
 double SimpleThruster::CalcThrustMagnitude() { return duty_ * thrust_magnitude_max_N_; }
 
 libra::Vector<3> SimpleThruster::CalcThrustDirection() {
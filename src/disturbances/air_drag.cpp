@@ -86,3 +86,10 @@ std::string AirDrag::GetLogValue() const {
 
   return str_tmp;
 }
+
+bool AirDrag::GetLogValueBinary(std::vector<double>& values) const {
+  AppendVector(values, torque_b_Nm_);
+  AppendVector(values, force_b_N_);
+
+  return true;
+}
@@ -52,6 +52,11 @@ class AirDrag : public SurfaceForce {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
  private:
   std::vector<double> cn_;          //!< Coefficients for out-plane force
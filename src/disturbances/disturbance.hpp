@@ -56,6 +56,35 @@ class Disturbance : public ILoggable {
    */
   virtual void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) = 0;
 
+  /**
+   * @fn CalcStageAccelerationIfEnabled
+   * @brief Calculate the acceleration at the stage state of the orbit integration when the calculation flag is true
+   * @param [in] time_from_update_s: Elapsed time of the stage from the last Update [sec]
+   * @param [in] position_i_m: Spacecraft position at the stage in the inertial frame [m]
+   * @return Acceleration in the inertial frame [m/s2]
+   */
+  inline libra::Vector<3> CalcStageAccelerationIfEnabled(const double time_from_update_s, const libra::Vector<3>& position_i_m) {
+    if (is_calculation_enabled_) {
+      return CalcStageAcceleration_i_m_s2(time_from_update_s, position_i_m);
+    }
+    return libra::Vector<3>(0.0);
+  }
+
+  /**
+   * @fn CalcStageAcceleration_i_m_s2
+   * @brief Calculate the acceleration at the stage state of the orbit integration with the environment information of the last Update
+   * @note Override this function with IsStageEvaluationSupported for disturbances that depend only on the position.
+   *       The default implementation returns the acceleration calculated by the last Update.
+   * @param [in] time_from_update_s: Elapsed time of the stage from the last Update [sec]
+   * @param [in] position_i_m: Spacecraft position at the stage in the inertial frame [m]
+   * @return Acceleration in the inertial frame [m/s2]
+   */
+  virtual libra::Vector<3> CalcStageAcceleration_i_m_s2(const double time_from_update_s, const libra::Vector<3>& position_i_m) {
+    (void)time_from_update_s;
+    (void)position_i_m;
+    return acceleration_i_m_s2_;
+  }
+
   /**
    * @fn GetTorque_b_Nm
    * @brief Return the disturbance torque in the body frame [Nm]
@@ -81,10 +110,21 @@ class Disturbance : public ILoggable {
    * @brief Return the attitude dependent flag
    */
   virtual inline bool IsAttitudeDependent() { return is_attitude_dependent_; }
+  /**
+   * @fn IsStageEvaluationSupported
+   * @brief Return true when the acceleration can be evaluated at the stage state by CalcStageAcceleration_i_m_s2
+   */
+  virtual inline bool IsStageEvaluationSupported() { return false; }
+  /**
+   * @fn SetIsStageEvaluationEnabled
+   * @brief Set the flag to show the acceleration is evaluated at the stage states by the orbit propagator
+   */
+  inline void SetIsStageEvaluationEnabled(const bool is_stage_evaluation_enabled) { is_stage_evaluation_enabled_ = is_stage_evaluation_enabled; }
 
  protected:
-  bool is_calculation_enabled_;           //!< Flag to calculate the disturbance
-  bool is_attitude_dependent_;            //!< Flag to show the disturbance depends on attitude information
+  bool is_calculation_enabled_;               //!< Flag to calculate the disturbance
+  bool is_attitude_dependent_;                //!< Flag to show the disturbance depends on attitude information
+  bool is_stage_evaluation_enabled_ = false;  //!< Flag to show the acceleration is evaluated at the stage states by the orbit propagator
   libra::Vector<3> force_b_N_;            //!< Disturbance force in the body frame [N]
   libra::Vector<3> torque_b_Nm_;          //!< Disturbance torque in the body frame [Nm]
   libra::Vector<3> acceleration_b_m_s2_;  //!< Disturbance acceleration in the body frame [m/s2]
@@ -6,6 +6,7 @@
 #include "disturbances.hpp"
 
 #include <library/initialize/initialize_file_access.hpp>
+#include <library/utilities/macros.hpp>
 
 #include "air_drag.hpp"
 #include "geopotential.hpp"
@@ -44,10 +45,33 @@ void Disturbances::Update(const LocalEnvironment& local_environment, const Dynam
     }
     total_torque_b_Nm_ += disturbance->GetTorque_b_Nm();
     total_force_b_N_ += disturbance->GetForce_b_N();
+    // Accelerations evaluated at the orbit integration stages are not included
+    if (is_stage_evaluation_enabled_ && disturbance->IsStageEvaluationSupported()) continue;
     total_acceleration_i_m_s2_ += disturbance->GetAcceleration_i_m_s2();
   }
 }
 
+void Disturbances::SetIsStageEvaluationEnabled(const bool is_stage_evaluation_enabled) {
+  is_stage_evaluation_enabled_ = is_stage_evaluation_enabled;
+  for (auto disturbance : disturbances_list_) {
+    if (disturbance->IsStageEvaluationSupported() == false) continue;
+    disturbance->SetIsStageEvaluationEnabled(is_stage_evaluation_enabled);
+  }
+}
+
+libra::Vector<3> Disturbances::CalcStageAcceleration_i_m_s2(const double time_from_update_s, const libra::Vector<3>& position_i_m,
+                                                            const libra::Vector<3>& velocity_i_m_s) {
+  UNUSED(velocity_i_m_s);
+
+  libra::Vector<3> acceleration_i_m_s2(0.0);
+  if (!is_stage_evaluation_enabled_) return acceleration_i_m_s2;
+  for (auto disturbance : disturbances_list_) {
+    if (disturbance->IsStageEvaluationSupported() == false) continue;
+    acceleration_i_m_s2 += disturbance->CalcStageAccelerationIfEnabled(time_from_update_s, position_i_m);
+  }
+  return acceleration_i_m_s2;
+}
+
 void Disturbances::LogSetup(Logger& logger) {
   for (auto disturbance : disturbances_list_) {
     logger.AddLogList(disturbance);
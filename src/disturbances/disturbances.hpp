@@ -8,6 +8,7 @@
 
 #include <vector>
 
+#include "../dynamics/orbit/interface_orbit_acceleration.hpp"
 #include "../environment/global/simulation_time.hpp"
 #include "../simulation/spacecraft/structure/structure.hpp"
 #include "disturbance.hpp"
@@ -18,7 +19,7 @@ class Logger;
  * @class Disturbances
  * @brief Class to manage all disturbances
  */
-class Disturbances {
+class Disturbances : public IOrbitAcceleration {
  public:
   /**
    * @fn Disturbances
@@ -69,6 +70,26 @@ class Disturbances {
    */
   inline libra::Vector<3> GetAcceleration_i_m_s2() { return total_acceleration_i_m_s2_; }
 
+  /**
+   * @fn SetIsStageEvaluationEnabled
+   * @brief Set the stage evaluation flag
+   * @note When the flag is true, the accelerations of the disturbances which support the stage evaluation are not included in
+   *       GetAcceleration_i_m_s2. The orbit propagator should evaluate them with CalcStageAcceleration_i_m_s2 instead.
+   */
+  void SetIsStageEvaluationEnabled(const bool is_stage_evaluation_enabled);
+
+  // Override IOrbitAcceleration
+  /**
+   * @fn CalcStageAcceleration_i_m_s2
+   * @brief Calculate the total acceleration of the disturbances which support the stage evaluation
+   * @param [in] time_from_update_s: Elapsed time of the stage from the last Update [sec]
+   * @param [in] position_i_m: Spacecraft position at the stage in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Spacecraft velocity at the stage in the inertial frame [m/s]
+   * @return Acceleration in the inertial frame [m/s2]
+   */
+  virtual libra::Vector<3> CalcStageAcceleration_i_m_s2(const double time_from_update_s, const libra::Vector<3>& position_i_m,
+                                                        const libra::Vector<3>& velocity_i_m_s);
+
  private:
   std::string initialize_file_name_;  //!< Initialization file name
 
@@ -76,6 +97,7 @@ class Disturbances {
   Vector<3> total_torque_b_Nm_;                  //!< Total disturbance torque in the body frame [Nm]
   Vector<3> total_force_b_N_;                    //!< Total disturbance force in the body frame [N]
   Vector<3> total_acceleration_i_m_s2_;          //!< Total disturbance acceleration in the inertial frame [m/s2]
+  bool is_stage_evaluation_enabled_ = false;     //!< Flag to evaluate the position dependent disturbances at each orbit integration stage
 
   /**
    * @fn InitializeInstances
@@ -8,6 +8,7 @@
 
 #include <string>
 
+#include "../library/gravity/gravity_potential.hpp"
 #include "../library/logger/loggable.hpp"
 #include "../library/math/matrix.hpp"
 #include "../library/math/matrix_vector.hpp"
@@ -36,6 +37,20 @@ class Geopotential : public Disturbance {
    * @param [in] dynamics: Dynamics information
    */
   virtual void Update(const LocalEnvironment &local_environment, const Dynamics &dynamics);
+  /**
+   * @fn CalcStageAcceleration_i_m_s2
+   * @brief Override CalcStageAcceleration_i_m_s2 function of Disturbance
+   * @note The earth rotation in the stage time is considered as the rotation around the z-axis of the ECEF frame.
+   *       The acceleration of the latest stage is logged when the stage evaluation is enabled.
+   * @param [in] time_from_update_s: Elapsed time of the stage from the last Update [sec]
+   * @param [in] position_i_m: Spacecraft position at the stage in the inertial frame [m]
+   */
+  virtual libra::Vector<3> CalcStageAcceleration_i_m_s2(const double time_from_update_s, const libra::Vector<3> &position_i_m);
+  /**
+   * @fn IsStageEvaluationSupported
+   * @brief Override IsStageEvaluationSupported function of Disturbance
+   */
+  virtual inline bool IsStageEvaluationSupported() { return true; }
 
   // Override ILoggable
   /**
@@ -48,17 +63,19 @@ class Geopotential : public Disturbance {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
- private:
-  int degree_;                          //!< Maximum degree setting to calculate the geo-potential
-  int n_ = 0, m_ = 0;                   //!< Degree and order (FIXME: follow naming rule)
-  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
-  std::vector<std::vector<double>> s_;  //!< Sine coefficients
-  Vector<3> acceleration_ecef_m_s2_;    //!< Calculated acceleration in the ECEF frame [m/s2]
+ protected:
+  libra::Matrix<3, 3> dcm_eci_to_ecef_;  //!< Direction cosine matrix from the ECI frame to the ECEF frame at the last Update
 
-  // calculation
-  double radius_m_ = 0.0;                                    //!< Radius [m]
-  double ecef_x_m_ = 0.0, ecef_y_m_ = 0.0, ecef_z_m_ = 0.0;  //!< Spacecraft position in ECEF frame [m]
+ private:
+  int degree_;                        //!< Maximum degree setting to calculate the geo-potential
+  GravityPotential geopotential_;     //!< Geo-potential calculation engine
+  Vector<3> acceleration_ecef_m_s2_;  //!< Calculated acceleration in the ECEF frame [m/s2]
 
   // debug
   libra::Vector<3> debug_pos_ecef_m_;  //!< Spacecraft position in ECEF frame [m]
@@ -75,22 +92,10 @@ class Geopotential : public Disturbance {
    * @fn ReadCoefficientsEgm96
    * @brief Read the geo-potential coefficients for the EGM96 model
    * @param [in] file_name: Coefficient file name
+   * @param [out] c: Cosine coefficients
+   * @param [out] s: Sine coefficients
    */
-  bool ReadCoefficientsEgm96(std::string file_name);
-
-  /**
-   * @fn v_w_nn_update
-   * @brief Calculate V and W function for n = m
-   * @note FIXME: fix function name
-   */
-  void v_w_nn_update(double *v_nn, double *w_nn, const double v_prev, const double w_prev);
-
-  /**
-   * @fn v_w_nm_update
-   * @brief Calculate V and W function for n not equal m
-   * @note FIXME: fix function name
-   */
-  void v_w_nm_update(double *v_nm, double *w_nm, const double v_prev, const double w_prev, const double v_prev2, const double w_prev2);
+  bool ReadCoefficientsEgm96(std::string file_name, std::vector<std::vector<double>> &c, std::vector<std::vector<double>> &s);
 };
 
 #endif  // S2E_DISTURBANCES_GEOPOTENTIAL_HPP_
@@ -48,3 +48,9 @@ std::string GravityGradient::GetLogValue() const {
 
   return str_tmp;
 }
+
+bool GravityGradient::GetLogValueBinary(std::vector<double>& values) const {
+  AppendVector(values, torque_b_Nm_);
+
+  return true;
+}
@@ -54,6 +54,11 @@ class GravityGradient : public Disturbance {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
  private:
   double gravity_constant_m3_s2_;  //!< Gravitational constant [m3/s2]
@@ -9,11 +9,13 @@
 
 #include "../library/logger/log_utility.hpp"
 #include "../library/randomization/global_randomization.hpp"
-#include "../library/randomization/normal_randomization.hpp"
-#include "../library/randomization/random_walk.hpp"
 
 MagneticDisturbance::MagneticDisturbance(const ResidualMagneticMoment& rmm_params, const bool is_calculation_enabled)
-    : Disturbance(is_calculation_enabled, true), residual_magnetic_moment_(rmm_params) {
+    : Disturbance(is_calculation_enabled, true),
+      residual_magnetic_moment_(rmm_params),
+      random_walk_(0.1, libra::Vector<3>(rmm_params.GetRandomWalkStandardDeviation_Am2()),
+                   libra::Vector<3>(rmm_params.GetRandomWalkLimit_Am2())),  // [FIXME] step width is constant
+      normal_random_(0.0, rmm_params.GetRandomNoiseStandardDeviation_Am2(), global_randomization.MakeSeed()) {
   rmm_b_Am2_ = residual_magnetic_moment_.GetConstantValue_b_Am2();
 }
 
@@ -30,16 +32,11 @@ void MagneticDisturbance::Update(const LocalEnvironment& local_environment, cons
 }
 
 void MagneticDisturbance::CalcRMM() {
-  static libra::Vector<3> random_walk_std_dev(residual_magnetic_moment_.GetRandomWalkStandardDeviation_Am2());
-  static libra::Vector<3> random_walk_limit(residual_magnetic_moment_.GetRandomWalkLimit_Am2());
-  static RandomWalk<3> random_walk(0.1, random_walk_std_dev, random_walk_limit);  // [FIXME] step width is constant
-  static libra::NormalRand normal_random(0.0, residual_magnetic_moment_.GetRandomNoiseStandardDeviation_Am2(), global_randomization.MakeSeed());
-
   rmm_b_Am2_ = residual_magnetic_moment_.GetConstantValue_b_Am2();
   for (int i = 0; i < 3; ++i) {
-    rmm_b_Am2_[i] += random_walk[i] + normal_random;
+    rmm_b_Am2_[i] += random_walk_[i] + normal_random_;
   }
-  ++random_walk;  // Update random walk
+  ++random_walk_;  // Update random walk
 }
 
 std::string MagneticDisturbance::GetLogHeader() const {
@@ -59,3 +56,10 @@ std::string MagneticDisturbance::GetLogValue() const {
 
   return str_tmp;
 }
+
+bool MagneticDisturbance::GetLogValueBinary(std::vector<double>& values) const {
+  AppendVector(values, rmm_b_Am2_);
+  AppendVector(values, torque_b_Nm_);
+
+  return true;
+}
@@ -10,6 +10,8 @@
 
 #include "../library/logger/loggable.hpp"
 #include "../library/math/vector.hpp"
+#include "../library/randomization/normal_randomization.hpp"
+#include "../library/randomization/random_walk.hpp"
 #include "../simulation/spacecraft/structure/residual_magnetic_moment.hpp"
 #include "disturbance.hpp"
 
@@ -46,12 +48,19 @@ class MagneticDisturbance : public Disturbance {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
  private:
   const double kMagUnit_ = 1.0e-9;  //!< Constant value to change the unit [nT] -> [T]
 
   libra::Vector<3> rmm_b_Am2_;                              //!< True RMM of the spacecraft in the body frame [Am2]
   const ResidualMagneticMoment& residual_magnetic_moment_;  //!< RMM parameters
+  RandomWalk<3> random_walk_;                               //!< Random walk of RMM [Am2]
+  libra::NormalRand normal_random_;                         //!< White noise of RMM [Am2]
 
   /**
    * @fn CalcRMM
@@ -50,3 +50,10 @@ std::string SolarRadiationPressureDisturbance::GetLogValue() const {
 
   return str_tmp;
 }
+
+bool SolarRadiationPressureDisturbance::GetLogValueBinary(std::vector<double>& values) const {
+  AppendVector(values, torque_b_Nm_);
+  AppendVector(values, force_b_N_);
+
+  return true;
+}
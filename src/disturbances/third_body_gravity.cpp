@@ -8,6 +8,8 @@
 ThirdBodyGravity::ThirdBodyGravity(std::set<std::string> third_body_list, const bool is_calculation_enabled)
     : Disturbance(is_calculation_enabled, false), third_body_list_(third_body_list) {
   acceleration_i_m_s2_ = libra::Vector<3>(0.0);
+  third_body_position_i_m_.assign(third_body_list_.size(), libra::Vector<3>(0.0));
+  third_body_gravity_constant_m3_s2_.assign(third_body_list_.size(), 0.0);
 }
 
 ThirdBodyGravity::~ThirdBodyGravity() {}
@@ -16,6 +18,7 @@ void ThirdBodyGravity::Update(const LocalEnvironment& local_environment, const D
   acceleration_i_m_s2_ = libra::Vector<3>(0.0);  // initialize
 
   libra::Vector<3> sc_position_i_m = dynamics.GetOrbit().GetPosition_i_m();
+  size_t body_id = 0;
   for (auto third_body : third_body_list_) {
     libra::Vector<3> third_body_position_from_sc_i_m = local_environment.GetCelestialInformation().GetPositionFromSpacecraft_i_m(third_body.c_str());
     libra::Vector<3> third_body_pos_i_m = sc_position_i_m + third_body_position_from_sc_i_m;
@@ -23,9 +26,26 @@ void ThirdBodyGravity::Update(const LocalEnvironment& local_environment, const D
 
     third_body_acceleration_i_m_s2_ = CalcAcceleration_i_m_s2(third_body_pos_i_m, third_body_position_from_sc_i_m, gravity_constant);
     acceleration_i_m_s2_ += third_body_acceleration_i_m_s2_;
+
+    // Keep for the stage evaluation
+    third_body_position_i_m_[body_id] = third_body_pos_i_m;
+    third_body_gravity_constant_m3_s2_[body_id] = gravity_constant;
+    body_id++;
   }
 }
 
+libra::Vector<3> ThirdBodyGravity::CalcStageAcceleration_i_m_s2(const double time_from_update_s, const libra::Vector<3>& position_i_m) {
+  (void)time_from_update_s;
+
+  libra::Vector<3> acceleration_i_m_s2(0.0);
+  for (size_t body_id = 0; body_id < third_body_position_i_m_.size(); body_id++) {
+    libra::Vector<3> third_body_position_from_sc_i_m = third_body_position_i_m_[body_id] - position_i_m;
+    acceleration_i_m_s2 +=
+        CalcAcceleration_i_m_s2(third_body_position_i_m_[body_id], third_body_position_from_sc_i_m, third_body_gravity_constant_m3_s2_[body_id]);
+  }
+  return acceleration_i_m_s2;
+}
+
 libra::Vector<3> ThirdBodyGravity::CalcAcceleration_i_m_s2(const libra::Vector<3> s, const libra::Vector<3> sr, const double gravity_constant_m_s2) {
   libra::Vector<3> acceleration_i_m_s2;
 
@@ -53,3 +73,9 @@ std::string ThirdBodyGravity::GetLogValue() const {
 
   return str_tmp;
 }
+
+bool ThirdBodyGravity::GetLogValueBinary(std::vector<double>& values) const {
+  AppendVector(values, acceleration_i_m_s2_);
+
+  return true;
+}
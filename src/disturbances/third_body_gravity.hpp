@@ -9,6 +9,7 @@
 #include <cassert>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "../library/logger/loggable.hpp"
 #include "../library/math/vector.hpp"
@@ -40,10 +41,25 @@ class ThirdBodyGravity : public Disturbance {
    * @param [in] dynamics: Dynamics information
    */
   virtual void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics);
+  /**
+   * @fn CalcStageAcceleration_i_m_s2
+   * @brief Override CalcStageAcceleration_i_m_s2 function of Disturbance
+   * @note The positions of the third bodies are fixed at the last Update since they move slowly in the stage time
+   * @param [in] time_from_update_s: Elapsed time of the stage from the last Update [sec]
+   * @param [in] position_i_m: Spacecraft position at the stage in the inertial frame [m]
+   */
+  virtual libra::Vector<3> CalcStageAcceleration_i_m_s2(const double time_from_update_s, const libra::Vector<3>& position_i_m);
+  /**
+   * @fn IsStageEvaluationSupported
+   * @brief Override IsStageEvaluationSupported function of Disturbance
+   */
+  virtual inline bool IsStageEvaluationSupported() { return true; }
 
  private:
-  std::set<std::string> third_body_list_;                 //!< List of celestial bodies to calculate the third body disturbances
-  libra::Vector<3> third_body_acceleration_i_m_s2_{0.0};  //!< Calculated third body disturbance acceleration in the inertial frame [m/s2]
+  std::set<std::string> third_body_list_;                  //!< List of celestial bodies to calculate the third body disturbances
+  libra::Vector<3> third_body_acceleration_i_m_s2_{0.0};   //!< Calculated third body disturbance acceleration in the inertial frame [m/s2]
+  std::vector<libra::Vector<3>> third_body_position_i_m_;  //!< Positions of the third bodies from the center body at the last Update [m]
+  std::vector<double> third_body_gravity_constant_m3_s2_;  //!< Gravity constants of the third bodies [m3/s2]
 
   // Override classes for ILoggable
   /**
@@ -56,6 +72,11 @@ class ThirdBodyGravity : public Disturbance {
    * @brief Override function of GetLogValue
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
   /**
    * @fn CalcAcceleration_i_m_s2
@@ -34,15 +34,29 @@ std::string Attitude::GetLogHeader() const {
 std::string Attitude::GetLogValue() const {
   std::string str_tmp = "";
 
-  str_tmp += WriteVector(angular_velocity_b_rad_s_);
-  str_tmp += WriteQuaternion(quaternion_i2b_);
-  str_tmp += WriteVector(torque_b_Nm_);
-  str_tmp += WriteScalar(angular_momentum_total_Nms_);
-  str_tmp += WriteScalar(kinetic_energy_J_);
+  AppendLogValue(str_tmp);
 
   return str_tmp;
 }
 
+void Attitude::AppendLogValue(std::string& buffer) const {
+  AppendVector(buffer, angular_velocity_b_rad_s_);
+  AppendQuaternion(buffer, quaternion_i2b_);
+  AppendVector(buffer, torque_b_Nm_);
+  AppendScalar(buffer, angular_momentum_total_Nms_);
+  AppendScalar(buffer, kinetic_energy_J_);
+}
+
+bool Attitude::GetLogValueBinary(std::vector<double>& values) const {
+  AppendVector(values, angular_velocity_b_rad_s_);
+  AppendQuaternion(values, quaternion_i2b_);
+  AppendVector(values, torque_b_Nm_);
+  AppendScalar(values, angular_momentum_total_Nms_);
+  AppendScalar(values, kinetic_energy_J_);
+
+  return true;
+}
+
 void Attitude::SetParameters(const MonteCarloSimulationExecutor& mc_simulator) {
   GetInitializedMonteCarloParameterQuaternion(mc_simulator, "quaternion_i2b", quaternion_i2b_);
 }
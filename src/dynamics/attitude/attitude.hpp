@@ -109,6 +109,16 @@ class Attitude : public ILoggable, public SimulationObject {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::string& buffer) const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
   // SimulationObject for McSim
   virtual void SetParameters(const MonteCarloSimulationExecutor& mc_simulator);
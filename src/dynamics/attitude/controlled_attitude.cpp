@@ -20,6 +20,8 @@ ControlledAttitude::ControlledAttitude(const AttitudeControlMode main_mode, cons
       local_celestial_information_(local_celestial_information),
       orbit_(orbit) {
   quaternion_i2b_ = quaternion_i2b;
+  sun_id_ = local_celestial_information_->GetGlobalInformation().CalcBodyIdFromName("SUN");
+  earth_id_ = local_celestial_information_->GetGlobalInformation().CalcBodyIdFromName("EARTH");
 
   Initialize();
 }
@@ -76,18 +78,18 @@ void ControlledAttitude::Propagate(const double end_time_s) {
 libra::Vector<3> ControlledAttitude::CalcTargetDirection_i(AttitudeControlMode mode) {
   libra::Vector<3> direction;
   if (mode == AttitudeControlMode::kSunPointing) {
-    direction = local_celestial_information_->GetPositionFromSpacecraft_i_m("SUN");
+    direction = local_celestial_information_->GetPositionFromSpacecraft_i_m(sun_id_);
     // When the local_celestial_information is not initialized. FIXME: This is temporary codes for attitude initialize.
     if (direction.CalcNorm() == 0.0) {
-      libra::Vector<3> sun_position_i_m = local_celestial_information_->GetGlobalInformation().GetPositionFromCenter_i_m("SUN");
+      libra::Vector<3> sun_position_i_m = local_celestial_information_->GetGlobalInformation().GetPositionFromCenter_i_m(sun_id_);
       libra::Vector<3> spacecraft_position_i_m = orbit_->GetPosition_i_m();
       direction = sun_position_i_m - spacecraft_position_i_m;
     }
   } else if (mode == AttitudeControlMode::kEarthCenterPointing) {
-    direction = local_celestial_information_->GetPositionFromSpacecraft_i_m("EARTH");
+    direction = local_celestial_information_->GetPositionFromSpacecraft_i_m(earth_id_);
     // When the local_celestial_information is not initialized. FIXME: This is temporary codes for attitude initialize.
     if (direction.CalcNorm() == 0.0) {
-      libra::Vector<3> earth_position_i_m = local_celestial_information_->GetGlobalInformation().GetPositionFromCenter_i_m("EARTH");
+      libra::Vector<3> earth_position_i_m = local_celestial_information_->GetGlobalInformation().GetPositionFromCenter_i_m(earth_id_);
       libra::Vector<3> spacecraft_position_i_m = orbit_->GetPosition_i_m();
       direction = earth_position_i_m - spacecraft_position_i_m;
     }
@@ -112,6 +112,8 @@ class ControlledAttitude : public Attitude {
   // Inputs
   const LocalCelestialInformation* local_celestial_information_;  //!< Local celestial information
   const Orbit* orbit_;                                            //!< Orbit information
+  unsigned int sun_id_;                                           //!< ID of the sun in CelestialInformation list
+  unsigned int earth_id_;                                         //!< ID of the earth in CelestialInformation list
 
   // Local functions
   /**
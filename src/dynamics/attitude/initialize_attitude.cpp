@@ -45,6 +45,8 @@ Attitude* InitAttitude(std::string file_name, const Orbit* orbit, const LocalCel
                                                      inertia_tensor_kgm2, local_celestial_information, orbit, mc_name_temp);
     attitude_temp->Propagate(step_width_s);
     quaternion_i2b = attitude_temp->GetQuaternion_i2b();
+    // Delete the temporary attitude so that its SimulationObject name can be registered again in the next Monte-Carlo case
+    delete attitude_temp;
     libra::Vector<3> omega_b = libra::Vector<3>(0.0);
     libra::Vector<3> torque_b = libra::Vector<3>(0.0);
 
@@ -23,6 +23,7 @@ void Dynamics::Initialize(const SimulationConfiguration* simulation_configuratio
                           const LocalCelestialInformation* local_celestial_information, const int spacecraft_id, Structure* structure,
                           RelativeInformation* relative_information) {
   structure_ = structure;
+  sun_id_ = local_celestial_information->GetGlobalInformation().CalcBodyIdFromName("SUN");
 
   // Initialize
   orbit_ = InitOrbit(&(local_celestial_information->GetGlobalInformation()), simulation_configuration->spacecraft_file_list_[spacecraft_id],
@@ -50,11 +51,7 @@ void Dynamics::Update(const SimulationTime* simulation_time, const LocalCelestia
 
   // Thermal
   if (simulation_time->GetThermalPropagateFlag()) {
-    std::string sun_str = "SUN";
-    char* c_sun = new char[sun_str.size() + 1];
-    std::char_traits<char>::copy(c_sun, sun_str.c_str(), sun_str.size() + 1);  // string -> char*
-    temperature_->Propagate(local_celestial_information->GetPositionFromSpacecraft_b_m(c_sun), simulation_time->GetElapsedTime_s());
-    delete[] c_sun;
+    temperature_->Propagate(local_celestial_information->GetPositionFromSpacecraft_b_m(sun_id_), simulation_time->GetElapsedTime_s());
   }
 }
 
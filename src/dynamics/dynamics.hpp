@@ -78,6 +78,12 @@ class Dynamics {
    * @param [in] acceleration_i_m_s2: Acceleration in the inertial fixed frame [N]
    */
   inline void AddAcceleration_i_m_s2(libra::Vector<3> acceleration_i_m_s2) { orbit_->AddAcceleration_i_m_s2(acceleration_i_m_s2); }
+  /**
+   * @fn SetOrbitStageAcceleration
+   * @brief Set the acceleration model evaluated at each orbit integration stage
+   * @param [in] stage_acceleration: Acceleration model
+   */
+  inline void SetOrbitStageAcceleration(IOrbitAcceleration* stage_acceleration) { orbit_->SetStageAcceleration(stage_acceleration); }
 
   /**
    * @fn ClearForceTorque
@@ -111,6 +117,7 @@ class Dynamics {
   Orbit* orbit_;                //!< Orbit dynamics
   Temperature* temperature_;    //!< Thermal dynamics
   const Structure* structure_;  //!< Structure information
+  unsigned int sun_id_ = 0;     //!< ID of the sun in CelestialInformation list
 
   /**
    * @fn Initialize
@@ -0,0 +1,250 @@
+/**
+ * @file constellation_orbit_propagation.cpp
+ * @brief Class to propagate orbits of many spacecraft together with Runge-Kutta-4 method
+ */
+#include "constellation_orbit_propagation.hpp"
+
+#include <cmath>
+#include <environment/global/physical_constants.hpp>
+#include <iostream>
+#include <library/utilities/macros.hpp>
+
+ConstellationOrbitEngine::ConstellationOrbitEngine() {}
+
+ConstellationOrbitEngine& ConstellationOrbitEngine::GetInstance() {
+  // Each simulation case runs in a thread, so the spacecraft in the case share the engine
+  static thread_local ConstellationOrbitEngine engine;
+  return engine;
+}
+
+int ConstellationOrbitEngine::AddSpacecraft(ConstellationOrbitPropagation* orbit, const double gravity_constant_m3_s2,
+                                            const double propagation_step_s, const libra::Vector<3> position_i_m,
+                                            const libra::Vector<3> velocity_i_m_s, const double j2_coefficient,
+                                            const double ballistic_coefficient_m2_kg) {
+  if (number_of_spacecraft_ == 0) {
+    Reset();
+    gravity_constant_m3_s2_ = gravity_constant_m3_s2;
+    propagation_step_s_ = propagation_step_s;
+  } else if (gravity_constant_m3_s2 != gravity_constant_m3_s2_ || propagation_step_s != propagation_step_s_) {
+    std::cerr << "ConstellationOrbitEngine: The gravity constant and the step width of the first spacecraft are used." << std::endl;
+  }
+
+  orbits_.push_back(orbit);
+  for (size_t i = 0; i < 3; i++) {
+    state_[i].push_back(position_i_m[i]);
+    state_[i + 3].push_back(velocity_i_m_s[i]);
+    acceleration_i_m_s2_[i].push_back(0.0);
+  }
+  for (size_t i = 0; i < 6; i++) {
+    stage_state_[i].push_back(0.0);
+    for (size_t stage = 0; stage < 4; stage++) {
+      derivatives_[stage][i].push_back(0.0);
+    }
+  }
+  j2_coefficients_.push_back(j2_coefficient);
+  ballistic_coefficients_.push_back(ballistic_coefficient_m2_kg);
+  propagation_flags_.push_back(0.0);
+
+  number_of_spacecraft_++;
+  return (int)orbits_.size() - 1;
+}
+
+void ConstellationOrbitEngine::RemoveSpacecraft(const int index) {
+  if (index < 0 || index >= (int)orbits_.size() || orbits_[index] == nullptr) return;
+  // The slot is kept not to change the indices of the other spacecraft, and its state is kept fixed
+  orbits_[index] = nullptr;
+  propagation_flags_[index] = 0.0;
+  number_of_spacecraft_--;
+  if (number_of_spacecraft_ == 0) Reset();
+}
+
+void ConstellationOrbitEngine::RequestPropagation(const int index, const double end_time_s, const libra::Vector<3> acceleration_i_m_s2,
+                                                  const bool is_calc_enabled) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_t i = 0; i < 3; i++) {
+    acceleration_i_m_s2_[i][index] = acceleration_i_m_s2[i];
+  }
+  propagation_flags_[index] = is_calc_enabled ? 1.0 : 0.0;
+  requested_end_time_s_ = end_time_s;
+
+  number_of_requests_++;
+  if (number_of_requests_ < number_of_spacecraft_) return;
+
+  number_of_requests_ = 0;
+  Propagate(requested_end_time_s_);
+  for (auto orbit : orbits_) {
+    if (orbit != nullptr) orbit->UpdateState();
+  }
+}
+
+void ConstellationOrbitEngine::Propagate(const double end_time_s) {
+  while (end_time_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
+    Step(propagation_step_s_);
+    propagation_time_s_ += propagation_step_s_;
+  }
+  Step(end_time_s - propagation_time_s_);  // Adjust the last propagation Δt
+  propagation_time_s_ = end_time_s;
+}
+
+libra::Vector<3> ConstellationOrbitEngine::GetPosition_i_m(const int index) const {
+  libra::Vector<3> position_i_m;
+  for (size_t i = 0; i < 3; i++) {
+    position_i_m[i] = state_[i][index];
+  }
+  return position_i_m;
+}
+
+libra::Vector<3> ConstellationOrbitEngine::GetVelocity_i_m_s(const int index) const {
+  libra::Vector<3> velocity_i_m_s;
+  for (size_t i = 0; i < 3; i++) {
+    velocity_i_m_s[i] = state_[i + 3][index];
+  }
+  return velocity_i_m_s;
+}
+
+void ConstellationOrbitEngine::SetAtmosphere(const double reference_altitude_m, const double reference_density_kg_m3, const double scale_height_m) {
+  reference_altitude_m_ = reference_altitude_m;
+  reference_density_kg_m3_ = reference_density_kg_m3;
+  scale_height_m_ = scale_height_m;
+}
+
+void ConstellationOrbitEngine::SetCenterBody(const double equatorial_radius_m, const double angular_velocity_rad_s) {
+  center_body_radius_m_ = equatorial_radius_m;
+  center_body_angular_velocity_rad_s_ = angular_velocity_rad_s;
+}
+
+void ConstellationOrbitEngine::CalcDerivatives(const std::vector<double> (&state)[6], std::vector<double> (&derivatives)[6]) {
+  const size_t number_of_slots = orbits_.size();
+  const double radius_m = center_body_radius_m_;
+  const double angular_velocity_rad_s = center_body_angular_velocity_rad_s_;
+
+  const double* x = state[0].data();
+  const double* y = state[1].data();
+  const double* z = state[2].data();
+  const double* vx = state[3].data();
+  const double* vy = state[4].data();
+  const double* vz = state[5].data();
+  double* ax = derivatives[3].data();
+  double* ay = derivatives[4].data();
+  double* az = derivatives[5].data();
+  const double* j2 = j2_coefficients_.data();
+  const double* ballistic = ballistic_coefficients_.data();
+
+  // The loop has no branch so that the compiler can vectorize it
+  for (size_t n = 0; n < number_of_slots; n++) {
+    const double r2 = x[n] * x[n] + y[n] * y[n] + z[n] * z[n];
+    const double r = sqrt(r2);
+    const double mu_r3 = gravity_constant_m3_s2_ / (r2 * r);
+
+    // Central body gravity with J2 term
+    const double j2_factor = 1.5 * j2[n] * radius_m * radius_m / r2;
+    const double z2_r2 = 5.0 * z[n] * z[n] / r2;
+    const double xy_factor = mu_r3 * (1.0 - j2_factor * (z2_r2 - 1.0));
+    const double z_factor = mu_r3 * (1.0 - j2_factor * (z2_r2 - 3.0));
+
+    // Drag with exponential atmosphere relative to the rotating atmosphere
+    const double density_kg_m3 = reference_density_kg_m3_ * exp(-(r - radius_m - reference_altitude_m_) / scale_height_m_);
+    const double relative_vx = vx[n] + angular_velocity_rad_s * y[n];
+    const double relative_vy = vy[n] - angular_velocity_rad_s * x[n];
+    const double relative_v = sqrt(relative_vx * relative_vx + relative_vy * relative_vy + vz[n] * vz[n]);
+    const double drag_factor = 0.5 * density_kg_m3 * ballistic[n] * relative_v;
+
+    ax[n] = acceleration_i_m_s2_[0][n] - xy_factor * x[n] - drag_factor * relative_vx;
+    ay[n] = acceleration_i_m_s2_[1][n] - xy_factor * y[n] - drag_factor * relative_vy;
+    az[n] = acceleration_i_m_s2_[2][n] - z_factor * z[n] - drag_factor * vz[n];
+  }
+  for (size_t i = 0; i < 3; i++) {
+    derivatives[i] = state[i + 3];
+  }
+}
+
+void ConstellationOrbitEngine::Step(const double step_width_s) {
+  const size_t number_of_slots = orbits_.size();
+  const double stage_factors[3] = {0.5 * step_width_s, 0.5 * step_width_s, step_width_s};
+
+  CalcDerivatives(state_, derivatives_[0]);
+  for (size_t stage = 0; stage < 3; stage++) {
+    for (size_t i = 0; i < 6; i++) {
+      const double* state = state_[i].data();
+      const double* derivative = derivatives_[stage][i].data();
+      double* stage_state = stage_state_[i].data();
+      for (size_t n = 0; n < number_of_slots; n++) {
+        stage_state[n] = state[n] + stage_factors[stage] * derivative[n];
+      }
+    }
+    CalcDerivatives(stage_state_, derivatives_[stage + 1]);
+  }
+
+  // The states of the disabled spacecraft are kept by the flags
+  const double* flags = propagation_flags_.data();
+  for (size_t i = 0; i < 6; i++) {
+    double* state = state_[i].data();
+    const double* k1 = derivatives_[0][i].data();
+    const double* k2 = derivatives_[1][i].data();
+    const double* k3 = derivatives_[2][i].data();
+    const double* k4 = derivatives_[3][i].data();
+    for (size_t n = 0; n < number_of_slots; n++) {
+      state[n] += flags[n] * step_width_s / 6.0 * (k1[n] + 2.0 * k2[n] + 2.0 * k3[n] + k4[n]);
+    }
+  }
+}
+
+void ConstellationOrbitEngine::Reset() {
+  orbits_.clear();
+  for (size_t i = 0; i < 6; i++) {
+    state_[i].clear();
+    stage_state_[i].clear();
+    for (size_t stage = 0; stage < 4; stage++) {
+      derivatives_[stage][i].clear();
+    }
+  }
+  for (size_t i = 0; i < 3; i++) {
+    acceleration_i_m_s2_[i].clear();
+  }
+  j2_coefficients_.clear();
+  ballistic_coefficients_.clear();
+  propagation_flags_.clear();
+  number_of_spacecraft_ = 0;
+  number_of_requests_ = 0;
+  propagation_time_s_ = 0.0;
+}
+
+ConstellationOrbitPropagation::ConstellationOrbitPropagation(const CelestialInformation* celestial_information, ConstellationOrbitEngine& engine,
+                                                             const double gravity_constant_m3_s2, const double time_step_s,
+                                                             const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s,
+                                                             const double j2_coefficient, const double ballistic_coefficient_m2_kg)
+    : Orbit(celestial_information), engine_(engine) {
+  propagate_mode_ = OrbitPropagateMode::kConstellation;
+  spacecraft_acceleration_i_m_s2_ *= 0;
+
+  const libra::Vector<3> radii_m = celestial_information->GetRadii_m(celestial_information->GetCenterBodyId());
+  engine_.SetCenterBody(radii_m[0], celestial_information->GetEarthRotation().GetAngularVelocity_rad_s());
+  index_ =
+      engine_.AddSpacecraft(this, gravity_constant_m3_s2, time_step_s, position_i_m, velocity_i_m_s, j2_coefficient, ballistic_coefficient_m2_kg);
+  UpdateState();
+}
+
+ConstellationOrbitPropagation::~ConstellationOrbitPropagation() { engine_.RemoveSpacecraft(index_); }
+
+void ConstellationOrbitPropagation::Propagate(const double end_time_s, const double current_time_jd) {
+  UNUSED(current_time_jd);
+
+  // The request is sent even when the calculation is disabled, since the engine waits for all spacecraft
+  engine_.RequestPropagation(index_, end_time_s, spacecraft_acceleration_i_m_s2_, is_calc_enabled_);
+}
+
+void ConstellationOrbitPropagation::UpdateByAttitude(const libra::Quaternion quaternion_i2b) {
+  // The state can be written by the other spacecraft thread in the parallel update
+  std::lock_guard<std::mutex> lock(engine_.GetMutex());
+  quaternion_i2b_ = quaternion_i2b;
+  Orbit::UpdateByAttitude(quaternion_i2b);
+}
+
+void ConstellationOrbitPropagation::UpdateState() {
+  spacecraft_position_i_m_ = engine_.GetPosition_i_m(index_);
+  spacecraft_velocity_i_m_s_ = engine_.GetVelocity_i_m_s(index_);
+
+  TransformEciToEcef();
+  TransformEcefToGeodetic();
+  spacecraft_velocity_b_m_s_ = quaternion_i2b_.FrameConversion(spacecraft_velocity_i_m_s_);
+}
@@ -0,0 +1,225 @@
+/**
+ * @file constellation_orbit_propagation.hpp
+ * @brief Class to propagate orbits of many spacecraft together with Runge-Kutta-4 method
+ */
+
+#ifndef S2E_DYNAMICS_ORBIT_CONSTELLATION_ORBIT_PROPAGATION_HPP_
+#define S2E_DYNAMICS_ORBIT_CONSTELLATION_ORBIT_PROPAGATION_HPP_
+
+#include <mutex>
+#include <vector>
+
+#include "orbit.hpp"
+
+class ConstellationOrbitPropagation;
+
+/**
+ * @class ConstellationOrbitEngine
+ * @brief Engine to propagate orbits of many spacecraft together with Runge-Kutta-4 method
+ * @details The states of the spacecraft are stored as the structure of arrays and all spacecraft are advanced in the same loops.
+ *          The acceleration model is the central body gravity with the J2 term, the drag with the exponential atmosphere model, and the
+ *          acceleration added through the Orbit interface (disturbances and thrusters), which is constant in a propagation step.
+ *          The J2 term and the drag are not subtracted from the disturbances, so they must be zero when the geopotential or the air drag
+ *          disturbance is enabled.
+ *          The propagation is executed when all registered spacecraft request it, so the spacecraft are updated at the end of the update of
+ *          the last spacecraft in each simulation step.
+ */
+class ConstellationOrbitEngine {
+ public:
+  /**
+   * @fn ConstellationOrbitEngine
+   * @brief Constructor
+   */
+  ConstellationOrbitEngine();
+
+  /**
+   * @fn GetInstance
+   * @brief Return the engine shared by the spacecraft in the simulation case running in this thread
+   */
+  static ConstellationOrbitEngine& GetInstance();
+
+  /**
+   * @fn AddSpacecraft
+   * @brief Register a spacecraft
+   * @note The gravity constant and the step width are set by the first spacecraft.
+   * @param [in] orbit: Orbit of the spacecraft to be updated after the propagation
+   * @param [in] gravity_constant_m3_s2: Gravity constant of the center body [m3/s2]
+   * @param [in] propagation_step_s: Step width for RK4 [sec]
+   * @param [in] position_i_m: Initial value of position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Initial value of velocity in the inertial frame [m/s]
+   * @param [in] j2_coefficient: J2 coefficient of the center body. 0 means no J2 term.
+   * @param [in] ballistic_coefficient_m2_kg: Ballistic coefficient (Cd * A / m) for the drag [m2/kg]. 0 means no drag.
+   * @return Index of the spacecraft in the engine
+   */
+  int AddSpacecraft(ConstellationOrbitPropagation* orbit, const double gravity_constant_m3_s2, const double propagation_step_s,
+                    const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s, const double j2_coefficient,
+                    const double ballistic_coefficient_m2_kg);
+  /**
+   * @fn RemoveSpacecraft
+   * @brief Unregister a spacecraft. The engine is reset when all spacecraft are removed.
+   * @param [in] index: Index of the spacecraft in the engine
+   */
+  void RemoveSpacecraft(const int index);
+  /**
+   * @fn RequestPropagation
+   * @brief Request the propagation of a spacecraft. All spacecraft are propagated when all registered spacecraft request it.
+   * @param [in] index: Index of the spacecraft in the engine
+   * @param [in] end_time_s: End time of simulation [sec]
+   * @param [in] acceleration_i_m_s2: Acceleration added through the Orbit interface in the inertial frame [m/s2]
+   * @param [in] is_calc_enabled: Calculate flag of the spacecraft. The state is not changed when it is false.
+   */
+  void RequestPropagation(const int index, const double end_time_s, const libra::Vector<3> acceleration_i_m_s2, const bool is_calc_enabled);
+  /**
+   * @fn Propagate
+   * @brief Propagate all spacecraft to the end time
+   * @param [in] end_time_s: End time of simulation [sec]
+   */
+  void Propagate(const double end_time_s);
+
+  // Getter
+  /**
+   * @fn GetNumberOfSpacecraft
+   * @brief Return number of registered spacecraft
+   */
+  inline int GetNumberOfSpacecraft() const { return number_of_spacecraft_; }
+  /**
+   * @fn GetMutex
+   * @brief Return mutex to access the states of the spacecraft, which are written by the thread of the last requesting spacecraft
+   */
+  inline std::mutex& GetMutex() { return mutex_; }
+  /**
+   * @fn GetPosition_i_m
+   * @brief Return position of the spacecraft in the inertial frame [m]
+   * @param [in] index: Index of the spacecraft in the engine
+   */
+  libra::Vector<3> GetPosition_i_m(const int index) const;
+  /**
+   * @fn GetVelocity_i_m_s
+   * @brief Return velocity of the spacecraft in the inertial frame [m/s]
+   * @param [in] index: Index of the spacecraft in the engine
+   */
+  libra::Vector<3> GetVelocity_i_m_s(const int index) const;
+
+  // Setter
+  /**
+   * @fn SetAtmosphere
+   * @brief Set parameters of the exponential atmosphere model for the drag
+   * @param [in] reference_altitude_m: Reference altitude [m]
+   * @param [in] reference_density_kg_m3: Air density at the reference altitude [kg/m3]
+   * @param [in] scale_height_m: Scale height [m]
+   */
+  void SetAtmosphere(const double reference_altitude_m, const double reference_density_kg_m3, const double scale_height_m);
+  /**
+   * @fn SetCenterBody
+   * @brief Set parameters of the center body for the J2 term and the drag
+   * @param [in] equatorial_radius_m: Equatorial radius of the center body [m]
+   * @param [in] angular_velocity_rad_s: Angular velocity of the center body and its atmosphere [rad/s]
+   */
+  void SetCenterBody(const double equatorial_radius_m, const double angular_velocity_rad_s);
+
+ private:
+  std::vector<ConstellationOrbitPropagation*> orbits_;  //!< Orbits of the spacecraft. NULL for the removed spacecraft.
+  int number_of_spacecraft_ = 0;                        //!< Number of registered spacecraft
+  int number_of_requests_ = 0;                          //!< Number of propagation requests in the current step
+  double requested_end_time_s_ = 0.0;                   //!< End time of the requested propagation [sec]
+  std::mutex mutex_;                                    //!< Mutex for the requests from the parallel spacecraft update
+
+  double gravity_constant_m3_s2_ = 0.0;  //!< Gravity constant of the center body [m3/s2]
+  double propagation_step_s_ = 0.0;      //!< Step width for RK4 [sec]
+  double propagation_time_s_ = 0.0;      //!< Simulation current time for numerical integration by RK4 [sec]
+
+  // Center body
+  double center_body_radius_m_ = 6378136.6;                  //!< Equatorial radius of the center body [m]
+  double center_body_angular_velocity_rad_s_ = 7.292115e-5;  //!< Angular velocity of the center body and its atmosphere [rad/s]
+
+  // Exponential atmosphere model
+  double reference_altitude_m_ = 400.0e3;       //!< Reference altitude [m]
+  double reference_density_kg_m3_ = 3.725e-12;  //!< Air density at the reference altitude [kg/m3]
+  double scale_height_m_ = 58.515e3;            //!< Scale height [m]
+
+  // Structure of arrays for all spacecraft
+  std::vector<double> state_[6];                //!< Position [m] and velocity [m/s] in the inertial frame
+  std::vector<double> stage_state_[6];          //!< State at the RK4 stage
+  std::vector<double> derivatives_[4][6];       //!< Derivatives of the state at the RK4 stages
+  std::vector<double> acceleration_i_m_s2_[3];  //!< Acceleration added through the Orbit interface [m/s2]
+  std::vector<double> j2_coefficients_;         //!< J2 coefficient of the center body
+  std::vector<double> ballistic_coefficients_;  //!< Ballistic coefficient for the drag [m2/kg]
+  std::vector<double> propagation_flags_;       //!< 1.0 for the spacecraft to be propagated, 0.0 for others
+
+  /**
+   * @fn CalcDerivatives
+   * @brief Calculate the derivatives of the states of all spacecraft
+   * @param [in] state: Position and velocity of all spacecraft
+   * @param [out] derivatives: Derivatives of the states of all spacecraft
+   */
+  void CalcDerivatives(const std::vector<double> (&state)[6], std::vector<double> (&derivatives)[6]);
+  /**
+   * @fn Step
+   * @brief Advance all spacecraft by one RK4 step
+   * @param [in] step_width_s: Step width [sec]
+   */
+  void Step(const double step_width_s);
+  /**
+   * @fn Reset
+   * @brief Clear all spacecraft
+   */
+  void Reset();
+};
+
+/**
+ * @class ConstellationOrbitPropagation
+ * @brief Orbit of a spacecraft propagated by ConstellationOrbitEngine
+ */
+class ConstellationOrbitPropagation : public Orbit {
+ public:
+  /**
+   * @fn ConstellationOrbitPropagation
+   * @brief Constructor
+   * @param [in] celestial_information: Celestial information. The radius and the rotation of the center body are set to the engine.
+   * @param [in] engine: Engine to propagate the orbit
+   * @param [in] gravity_constant_m3_s2: Gravity constant [m3/s2]
+   * @param [in] time_step_s: Step width [sec]
+   * @param [in] position_i_m: Initial value of position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Initial value of velocity in the inertial frame [m/s]
+   * @param [in] j2_coefficient: J2 coefficient of the center body. 0 means no J2 term.
+   * @param [in] ballistic_coefficient_m2_kg: Ballistic coefficient (Cd * A / m) for the drag [m2/kg]. 0 means no drag.
+   */
+  ConstellationOrbitPropagation(const CelestialInformation* celestial_information, ConstellationOrbitEngine& engine,
+                                const double gravity_constant_m3_s2, const double time_step_s, const libra::Vector<3> position_i_m,
+                                const libra::Vector<3> velocity_i_m_s, const double j2_coefficient, const double ballistic_coefficient_m2_kg);
+  /**
+   * @fn ~ConstellationOrbitPropagation
+   * @brief Destructor
+   */
+  ~ConstellationOrbitPropagation();
+
+  // Override Orbit
+  /**
+   * @fn Propagate
+   * @brief Request the propagation to the engine
+   * @note The state is updated when the last spacecraft requests the propagation.
+   * @param [in] end_time_s: End time of simulation [sec]
+   * @param [in] current_time_jd: Current Julian day [day]
+   */
+  virtual void Propagate(const double end_time_s, const double current_time_jd);
+  /**
+   * @fn UpdateByAttitude
+   * @brief Update attitude information
+   * @note The attitude is kept to update the velocity in the body frame after the propagation
+   * @param [in] quaternion_i2b: Quaternion from the inertial frame to the body fixed frame
+   */
+  virtual void UpdateByAttitude(const libra::Quaternion quaternion_i2b);
+
+  /**
+   * @fn UpdateState
+   * @brief Update the states with the propagated state in the engine
+   */
+  void UpdateState();
+
+ private:
+  ConstellationOrbitEngine& engine_;                      //!< Engine to propagate the orbit
+  int index_;                                             //!< Index of the spacecraft in the engine
+  libra::Quaternion quaternion_i2b_{0.0, 0.0, 0.0, 1.0};  //!< Quaternion from the inertial frame to the body fixed frame
+};
+
+#endif  // S2E_DYNAMICS_ORBIT_CONSTELLATION_ORBIT_PROPAGATION_HPP_
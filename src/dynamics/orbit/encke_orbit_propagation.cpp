@@ -40,13 +40,20 @@ void EnckeOrbitPropagation::Propagate(const double end_time_s, const double curr
   reference_velocity_i_m_s_ = reference_kepler_orbit.GetVelocity_i_m_s();
 
   // Propagate difference orbit
-  SetStepWidth(propagation_step_s_);  // Re-set propagation Δt
-  while (end_time_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
-    Update();  // Propagation methods of the OrdinaryDifferentialEquation class
-    propagation_time_s_ += propagation_step_s_;
+  if (GetIntegrationMethod() == libra::NumericalIntegrationMethod::kRk4) {
+    SetStepWidth(propagation_step_s_);  // Re-set propagation Δt
+    while (end_time_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
+      Update();  // Propagation methods of the OrdinaryDifferentialEquation class
+      propagation_time_s_ += propagation_step_s_;
+    }
+    SetStepWidth(end_time_s - propagation_time_s_);  // Adjust the last propagation Δt
+    Update();
+  } else {
+    // The derivative function depends on the reference orbit updated at each call
+    RestartIntegration();
+    // The independent variable is reset by the rectification, so the end value is calculated from the current value
+    Integrate(GetIndependentVariable() + end_time_s - propagation_time_s_);
   }
-  SetStepWidth(end_time_s - propagation_time_s_);  // Adjust the last propagation Δt
-  Update();
   propagation_time_s_ = end_time_s;
 
   difference_position_i_m_[0] = GetState()[0];
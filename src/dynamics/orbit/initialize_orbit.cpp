@@ -6,6 +6,7 @@
 
 #include <library/initialize/initialize_file_access.hpp>
 
+#include "constellation_orbit_propagation.hpp"
 #include "encke_orbit_propagation.hpp"
 #include "kepler_orbit_propagation.hpp"
 #include "relative_orbit.hpp"
@@ -33,7 +34,11 @@ Orbit* InitOrbit(const CelestialInformation* celestial_information, std::string
       position_i_m[i] = pos_vel[i];
       velocity_i_m_s[i] = pos_vel[i + 3];
     }
-    orbit = new Rk4OrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, position_i_m, velocity_i_m_s);
+    const bool is_stage_acceleration_enabled = conf.ReadEnable(section_, "stage_acceleration_evaluation");
+    Rk4OrbitPropagation* rk4_orbit = new Rk4OrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, position_i_m,
+                                                             velocity_i_m_s, 0.0, is_stage_acceleration_enabled);
+    InitIntegrationMethod(rk4_orbit, initialize_file, section);
+    orbit = rk4_orbit;
   } else if (propagate_mode == "SGP4") {
     // Initialize SGP4 orbit propagator
     int wgs_setting = conf.ReadInt(section_, "wgs_setting");
@@ -94,8 +99,24 @@ Orbit* InitOrbit(const CelestialInformation* celestial_information, std::string
     }
 
     double error_tolerance = conf.ReadDouble(section_, "error_tolerance");
-    orbit = new EnckeOrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, current_time_jd, position_i_m, velocity_i_m_s,
-                                      error_tolerance);
+    EnckeOrbitPropagation* encke_orbit = new EnckeOrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, current_time_jd,
+                                                                   position_i_m, velocity_i_m_s, error_tolerance);
+    InitIntegrationMethod(encke_orbit, initialize_file, section);
+    orbit = encke_orbit;
+  } else if (propagate_mode == "CONSTELLATION") {
+    // initialize orbit propagated together with the other spacecraft in the simulation case
+    libra::Vector<3> position_i_m;
+    libra::Vector<3> velocity_i_m_s;
+    libra::Vector<6> pos_vel = InitializePosVel(initialize_file, current_time_jd, gravity_constant_m3_s2);
+    for (size_t i = 0; i < 3; i++) {
+      position_i_m[i] = pos_vel[i];
+      velocity_i_m_s[i] = pos_vel[i + 3];
+    }
+
+    double j2_coefficient = conf.ReadDouble(section_, "j2_coefficient");
+    double ballistic_coefficient_m2_kg = conf.ReadDouble(section_, "ballistic_coefficient_m2_kg");
+    orbit = new ConstellationOrbitPropagation(celestial_information, ConstellationOrbitEngine::GetInstance(), gravity_constant_m3_s2, step_width_s,
+                                              position_i_m, velocity_i_m_s, j2_coefficient, ballistic_coefficient_m2_kg);
   } else {
     std::cerr << "ERROR: orbit propagation mode: " << propagate_mode << " is not defined!" << std::endl;
     std::cerr << "The orbit mode is automatically set as RK4" << std::endl;
@@ -154,3 +175,15 @@ libra::Vector<6> InitializePosVel(std::string initialize_file, double current_ti
 
   return pos_vel;
 }
+
+void InitIntegrationMethod(libra::OrdinaryDifferentialEquation<6>* ode, std::string initialize_file, std::string section) {
+  auto conf = IniAccess(initialize_file);
+  const char* section_ = section.c_str();
+
+  libra::NumericalIntegrationMethod method = libra::SetNumericalIntegrationMethod(conf.ReadString(section_, "integration_method"));
+  if (method == libra::NumericalIntegrationMethod::kRk4) return;
+
+  double relative_tolerance = conf.ReadDouble(section_, "integration_relative_tolerance");
+  double absolute_tolerance = conf.ReadDouble(section_, "integration_absolute_tolerance");
+  ode->SetIntegrationMethod(method, relative_tolerance, absolute_tolerance);
+}
@@ -6,6 +6,7 @@
 #ifndef S2E_DYNAMICS_ORBIT_INITIALIZE_ORBIT_HPP_
 #define S2E_DYNAMICS_ORBIT_INITIALIZE_ORBIT_HPP_
 
+#include <library/math/ordinary_differential_equation.hpp>
 #include <library/orbit/orbital_elements.hpp>
 
 #include "orbit.hpp"
@@ -37,4 +38,13 @@ Orbit* InitOrbit(const CelestialInformation* celestial_information, std::string
  */
 libra::Vector<6> InitializePosVel(std::string initialize_file, double current_time_jd, double gravity_constant_m3_s2, std::string section = "ORBIT");
 
+/**
+ * @fn InitIntegrationMethod
+ * @brief Initialize numerical integration method of the orbit propagation
+ * @param [in] ode: Ordinary differential equation of the orbit propagator
+ * @param [in] initialize_file: Path to initialize file
+ * @param [in] section: Section name
+ */
+void InitIntegrationMethod(libra::OrdinaryDifferentialEquation<6>* ode, std::string initialize_file, std::string section = "ORBIT");
+
 #endif  // S2E_DYNAMICS_ORBIT_INITIALIZE_ORBIT_HPP_
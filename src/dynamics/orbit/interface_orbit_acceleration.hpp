@@ -0,0 +1,36 @@
+/**
+ * @file interface_orbit_acceleration.hpp
+ * @brief Interface class for the acceleration evaluated at each stage of the orbit integration
+ */
+
+#ifndef S2E_DYNAMICS_ORBIT_INTERFACE_ORBIT_ACCELERATION_HPP_
+#define S2E_DYNAMICS_ORBIT_INTERFACE_ORBIT_ACCELERATION_HPP_
+
+#include <library/math/vector.hpp>
+
+/**
+ * @class IOrbitAcceleration
+ * @brief Interface class for the acceleration evaluated at each stage of the orbit integration
+ */
+class IOrbitAcceleration {
+ public:
+  /**
+   * @fn ~IOrbitAcceleration
+   * @brief Destructor
+   */
+  virtual ~IOrbitAcceleration() {}
+
+  /**
+   * @fn CalcStageAcceleration_i_m_s2
+   * @brief Pure virtual function to calculate the acceleration at the stage state of the orbit integration
+   * @note The acceleration model is updated with the environment at the end time of the orbit propagation
+   * @param [in] time_from_update_s: Elapsed time of the stage from the end time of the orbit propagation (negative during the propagation) [sec]
+   * @param [in] position_i_m: Spacecraft position at the stage in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Spacecraft velocity at the stage in the inertial frame [m/s]
+   * @return Acceleration in the inertial frame [m/s2]
+   */
+  virtual libra::Vector<3> CalcStageAcceleration_i_m_s2(const double time_from_update_s, const libra::Vector<3>& position_i_m,
+                                                        const libra::Vector<3>& velocity_i_m_s) = 0;
+};
+
+#endif  // S2E_DYNAMICS_ORBIT_INTERFACE_ORBIT_ACCELERATION_HPP_
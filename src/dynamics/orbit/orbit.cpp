@@ -71,13 +71,29 @@ std::string Orbit::GetLogHeader() const {
 std::string Orbit::GetLogValue() const {
   std::string str_tmp = "";
 
-  str_tmp += WriteVector(spacecraft_position_i_m_, 16);
-  str_tmp += WriteVector(spacecraft_velocity_i_m_s_, 10);
-  str_tmp += WriteVector(spacecraft_velocity_b_m_s_, 10);
-  str_tmp += WriteVector(spacecraft_acceleration_i_m_s2_, 10);
-  str_tmp += WriteScalar(spacecraft_geodetic_position_.GetLatitude_rad());
-  str_tmp += WriteScalar(spacecraft_geodetic_position_.GetLongitude_rad());
-  str_tmp += WriteScalar(spacecraft_geodetic_position_.GetAltitude_m());
+  AppendLogValue(str_tmp);
 
   return str_tmp;
 }
+
+void Orbit::AppendLogValue(std::string& buffer) const {
+  AppendVector(buffer, spacecraft_position_i_m_, 16);
+  AppendVector(buffer, spacecraft_velocity_i_m_s_, 10);
+  AppendVector(buffer, spacecraft_velocity_b_m_s_, 10);
+  AppendVector(buffer, spacecraft_acceleration_i_m_s2_, 10);
+  AppendScalar(buffer, spacecraft_geodetic_position_.GetLatitude_rad());
+  AppendScalar(buffer, spacecraft_geodetic_position_.GetLongitude_rad());
+  AppendScalar(buffer, spacecraft_geodetic_position_.GetAltitude_m());
+}
+
+bool Orbit::GetLogValueBinary(std::vector<double>& values) const {
+  AppendVector(values, spacecraft_position_i_m_);
+  AppendVector(values, spacecraft_velocity_i_m_s_);
+  AppendVector(values, spacecraft_velocity_b_m_s_);
+  AppendVector(values, spacecraft_acceleration_i_m_s2_);
+  AppendScalar(values, spacecraft_geodetic_position_.GetLatitude_rad());
+  AppendScalar(values, spacecraft_geodetic_position_.GetLongitude_rad());
+  AppendScalar(values, spacecraft_geodetic_position_.GetAltitude_m());
+
+  return true;
+}
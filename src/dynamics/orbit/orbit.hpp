@@ -16,6 +16,8 @@
 #include <library/math/quaternion.hpp>
 #include <library/math/vector.hpp>
 
+#include "interface_orbit_acceleration.hpp"
+
 /**
  * @enum OrbitPropagateMode
  * @brief Propagation mode of orbit
@@ -25,7 +27,8 @@ enum class OrbitPropagateMode {
   kSgp4,           //!< SGP4 propagation using TLE without thruster maneuver
   kRelativeOrbit,  //!< Relative dynamics (for formation flying simulation)
   kKepler,         //!< Kepler orbit propagation without disturbances and thruster maneuver
-  kEncke           //!< Encke orbit propagation with disturbances and thruster maneuver
+  kEncke,          //!< Encke orbit propagation with disturbances and thruster maneuver
+  kConstellation   //!< 4th order Runge-Kutta propagation of many spacecraft together with J2, drag, disturbances, and thruster maneuver
 };
 
 /**
@@ -69,7 +72,7 @@ class Orbit : public ILoggable {
    * @brief Update attitude information
    * @param [in] quaternion_i2b: End time of simulation [sec]
    */
-  inline void UpdateByAttitude(const libra::Quaternion quaternion_i2b) {
+  virtual void UpdateByAttitude(const libra::Quaternion quaternion_i2b) {
     spacecraft_velocity_b_m_s_ = quaternion_i2b.FrameConversion(spacecraft_velocity_i_m_s_);
   }
 
@@ -114,6 +117,11 @@ class Orbit : public ILoggable {
    * @brief Return spacecraft position in the geodetic frame [m]
    */
   inline GeodeticPosition GetGeodeticPosition() const { return spacecraft_geodetic_position_; }
+  /**
+   * @fn IsStageAccelerationEnabled
+   * @brief Return true when the propagator evaluates the stage acceleration at each integration stage
+   */
+  inline bool IsStageAccelerationEnabled() const { return is_stage_acceleration_enabled_; }
 
   // TODO delete the following functions
   inline double GetLatitude_rad() const { return spacecraft_geodetic_position_.GetLatitude_rad(); }
@@ -133,6 +141,12 @@ class Orbit : public ILoggable {
    * @brief Set calculate flag
    */
   inline void SetIsCalcEnabled(const bool is_calc_enabled) { is_calc_enabled_ = is_calc_enabled; }
+  /**
+   * @fn SetStageAcceleration
+   * @brief Set the acceleration model evaluated at each integration stage
+   * @note The model is used only when IsStageAccelerationEnabled is true
+   */
+  inline void SetStageAcceleration(IOrbitAcceleration* stage_acceleration) { stage_acceleration_ = stage_acceleration; }
   /**
    * @fn SetAcceleration_i_m_s2
    * @brief Set acceleration in the inertial frame [m/s2]
@@ -183,13 +197,25 @@ class Orbit : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(std::string& buffer) const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
  protected:
   const CelestialInformation* celestial_information_;  //!< Celestial information
 
   // Settings
-  bool is_calc_enabled_ = false;       //!< Calculate flag
-  OrbitPropagateMode propagate_mode_;  //!< Propagation mode
+  bool is_calc_enabled_ = false;                      //!< Calculate flag
+  OrbitPropagateMode propagate_mode_;                 //!< Propagation mode
+  bool is_stage_acceleration_enabled_ = false;        //!< Flag to evaluate the stage acceleration at each integration stage
+  IOrbitAcceleration* stage_acceleration_ = nullptr;  //!< Acceleration model evaluated at each integration stage
 
   libra::Vector<3> spacecraft_position_i_m_;       //!< Spacecraft position in the inertial frame [m]
   libra::Vector<3> spacecraft_position_ecef_m_;    //!< Spacecraft position in the ECEF frame [m]
@@ -9,13 +9,16 @@
 #include <sstream>
 
 Rk4OrbitPropagation::Rk4OrbitPropagation(const CelestialInformation* celestial_information, double gravity_constant_m3_s2, double time_step_s,
-                                         libra::Vector<3> position_i_m, libra::Vector<3> velocity_i_m_s, double initial_time_s)
+                                         libra::Vector<3> position_i_m, libra::Vector<3> velocity_i_m_s, double initial_time_s,
+                                         const bool is_stage_acceleration_enabled)
     : Orbit(celestial_information), OrdinaryDifferentialEquation<6>(time_step_s), gravity_constant_m3_s2_(gravity_constant_m3_s2) {
   propagate_mode_ = OrbitPropagateMode::kRk4;
+  is_stage_acceleration_enabled_ = is_stage_acceleration_enabled;
 
   propagation_time_s_ = 0.0;
   propagation_step_s_ = time_step_s;
   spacecraft_acceleration_i_m_s2_ *= 0;
+  integration_acceleration_i_m_s2_ = libra::Vector<3>(0.0);
 
   Initialize(position_i_m, velocity_i_m_s, initial_time_s);
 }
@@ -28,14 +31,23 @@ void Rk4OrbitPropagation::DerivativeFunction(double t, const libra::Vector<6>& s
 
   double r3 = pow(x * x + y * y + z * z, 1.5);
 
+  // Accelerations evaluated at the stage state are added to the constant acceleration
+  libra::Vector<3> acceleration_i_m_s2 = spacecraft_acceleration_i_m_s2_;
+  if (is_stage_acceleration_enabled_ && stage_acceleration_ != nullptr) {
+    libra::Vector<3> position_i_m, velocity_i_m_s;
+    for (size_t i = 0; i < 3; i++) {
+      position_i_m[i] = state[i];
+      velocity_i_m_s[i] = state[i + 3];
+    }
+    acceleration_i_m_s2 += stage_acceleration_->CalcStageAcceleration_i_m_s2(t - stage_reference_time_s_, position_i_m, velocity_i_m_s);
+  }
+
   rhs[0] = vx;
   rhs[1] = vy;
   rhs[2] = vz;
-  rhs[3] = spacecraft_acceleration_i_m_s2_[0] - gravity_constant_m3_s2_ / r3 * x;
-  rhs[4] = spacecraft_acceleration_i_m_s2_[1] - gravity_constant_m3_s2_ / r3 * y;
-  rhs[5] = spacecraft_acceleration_i_m_s2_[2] - gravity_constant_m3_s2_ / r3 * z;
-
-  (void)t;
+  rhs[3] = acceleration_i_m_s2[0] - gravity_constant_m3_s2_ / r3 * x;
+  rhs[4] = acceleration_i_m_s2[1] - gravity_constant_m3_s2_ / r3 * y;
+  rhs[5] = acceleration_i_m_s2[2] - gravity_constant_m3_s2_ / r3 * z;
 }
 
 void Rk4OrbitPropagation::Initialize(libra::Vector<3> position_i_m, libra::Vector<3> velocity_i_m_s, double initial_time_s) {
@@ -67,13 +79,29 @@ void Rk4OrbitPropagation::Propagate(const double end_time_s, const double curren
 
   if (!is_calc_enabled_) return;
 
-  SetStepWidth(propagation_step_s_);  // Re-set propagation Δt
-  while (end_time_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
-    Update();  // Propagation methods of the OrdinaryDifferentialEquation class
-    propagation_time_s_ += propagation_step_s_;
+  propagation_start_time_s_ = GetIndependentVariable();
+  // The stage accelerations are updated with the environment at the end time before the propagation
+  stage_reference_time_s_ = propagation_start_time_s_ + end_time_s - propagation_time_s_;
+  if (GetIntegrationMethod() == libra::NumericalIntegrationMethod::kRk4) {
+    SetStepWidth(propagation_step_s_);  // Re-set propagation Δt
+    while (end_time_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
+      Update();  // Propagation methods of the OrdinaryDifferentialEquation class
+      propagation_time_s_ += propagation_step_s_;
+    }
+    SetStepWidth(end_time_s - propagation_time_s_);  // Adjust the last propagation Δt
+    Update();
+  } else {
+    // The step width is controlled by the embedded method and kept between the calls.
+    // The steps integrated ahead of the end time are reused while the acceleration is not changed.
+    for (size_t i = 0; i < 3; i++) {
+      if (spacecraft_acceleration_i_m_s2_[i] != integration_acceleration_i_m_s2_[i]) {
+        RestartIntegration();
+        integration_acceleration_i_m_s2_ = spacecraft_acceleration_i_m_s2_;
+        break;
+      }
+    }
+    Integrate(stage_reference_time_s_);
   }
-  SetStepWidth(end_time_s - propagation_time_s_);  // Adjust the last propagation Δt
-  Update();
   propagation_time_s_ = end_time_s;
 
   spacecraft_position_i_m_[0] = GetState()[0];
@@ -26,9 +26,11 @@ class Rk4OrbitPropagation : public Orbit, public libra::OrdinaryDifferentialEqua
    * @param [in] position_i_m: Initial value of position in the inertial frame [m]
    * @param [in] velocity_i_m_s: Initial value of velocity in the inertial frame [m/s]
    * @param [in] initial_time_s: Initial time [sec]
+   * @param [in] is_stage_acceleration_enabled: Flag to evaluate the stage acceleration at each RK4 stage
    */
   Rk4OrbitPropagation(const CelestialInformation* celestial_information, double gravity_constant_m3_s2, double time_step_s,
-                      libra::Vector<3> position_i_m, libra::Vector<3> velocity_i_m_s, double initial_time_s = 0);
+                      libra::Vector<3> position_i_m, libra::Vector<3> velocity_i_m_s, double initial_time_s = 0,
+                      const bool is_stage_acceleration_enabled = false);
   /**
    * @fn ~Rk4OrbitPropagation
    * @brief Destructor
@@ -55,9 +57,12 @@ class Rk4OrbitPropagation : public Orbit, public libra::OrdinaryDifferentialEqua
   virtual void Propagate(const double end_time_s, const double current_time_jd);
 
  private:
-  double gravity_constant_m3_s2_;  //!< Gravity constant [m3/s2]
-  double propagation_time_s_;      //!< Simulation current time for numerical integration by RK4 [sec]
-  double propagation_step_s_;      //!< Step width for RK4 [sec]
+  double gravity_constant_m3_s2_;                     //!< Gravity constant [m3/s2]
+  double propagation_time_s_;                         //!< Simulation current time for numerical integration by RK4 [sec]
+  double propagation_step_s_;                         //!< Step width for RK4 [sec]
+  double propagation_start_time_s_ = 0.0;             //!< Independent variable at the beginning of the Propagate function [sec]
+  double stage_reference_time_s_ = 0.0;               //!< Independent variable at the end time of the Propagate function [sec]
+  libra::Vector<3> integration_acceleration_i_m_s2_;  //!< Acceleration of the steps integrated ahead by the embedded methods [m/s2]
 
   /**
    * @fn Initialize
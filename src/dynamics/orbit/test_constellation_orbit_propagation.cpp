@@ -0,0 +1,163 @@
+/**
+ * @file test_constellation_orbit_propagation.cpp
+ * @brief Test codes for ConstellationOrbitEngine class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "constellation_orbit_propagation.hpp"
+
+/**
+ * @struct ReferenceOrbitModel
+ * @brief Parameters of the acceleration model for the scalar RK4 propagation
+ */
+struct ReferenceOrbitModel {
+  double gravity_constant_m3_s2;  //!< Gravity constant of the center body [m3/s2]
+  double radius_m;                //!< Equatorial radius of the center body [m]
+  double angular_velocity_rad_s;  //!< Angular velocity of the center body [rad/s]
+  double j2_coefficient;          //!< J2 coefficient
+  double ballistic_m2_kg;         //!< Ballistic coefficient [m2/kg]
+  double acceleration_m_s2[3];    //!< Acceleration added through the Orbit interface [m/s2]
+};
+
+/**
+ * @brief Calculate the derivatives of a spacecraft state with the same model as ConstellationOrbitEngine
+ */
+void CalcReferenceDerivatives(const ReferenceOrbitModel& model, const double (&state)[6], double (&derivatives)[6]) {
+  const double kReferenceAltitude_m = 400.0e3;
+  const double kReferenceDensity_kg_m3 = 3.725e-12;
+  const double kScaleHeight_m = 58.515e3;
+
+  const double r2 = state[0] * state[0] + state[1] * state[1] + state[2] * state[2];
+  const double r = sqrt(r2);
+  const double mu_r3 = model.gravity_constant_m3_s2 / (r2 * r);
+  const double j2_factor = 1.5 * model.j2_coefficient * model.radius_m * model.radius_m / r2;
+  const double z2_r2 = 5.0 * state[2] * state[2] / r2;
+  const double gravity_factors[3] = {mu_r3 * (1.0 - j2_factor * (z2_r2 - 1.0)), mu_r3 * (1.0 - j2_factor * (z2_r2 - 1.0)),
+                                     mu_r3 * (1.0 - j2_factor * (z2_r2 - 3.0))};
+
+  const double density_kg_m3 = kReferenceDensity_kg_m3 * exp(-(r - model.radius_m - kReferenceAltitude_m) / kScaleHeight_m);
+  const double relative_velocity_m_s[3] = {state[3] + model.angular_velocity_rad_s * state[1], state[4] - model.angular_velocity_rad_s * state[0],
+                                           state[5]};
+  const double relative_v = sqrt(relative_velocity_m_s[0] * relative_velocity_m_s[0] + relative_velocity_m_s[1] * relative_velocity_m_s[1] +
+                                 relative_velocity_m_s[2] * relative_velocity_m_s[2]);
+  const double drag_factor = 0.5 * density_kg_m3 * model.ballistic_m2_kg * relative_v;
+
+  for (int i = 0; i < 3; i++) {
+    derivatives[i] = state[i + 3];
+    derivatives[i + 3] = model.acceleration_m_s2[i] - gravity_factors[i] * state[i] - drag_factor * relative_velocity_m_s[i];
+  }
+}
+
+/**
+ * @brief Propagate a spacecraft state by one RK4 step
+ */
+void PropagateReferenceStep(const ReferenceOrbitModel& model, const double step_width_s, double (&state)[6]) {
+  double k[4][6], stage_state[6];
+  const double stage_factors[3] = {0.5 * step_width_s, 0.5 * step_width_s, step_width_s};
+  CalcReferenceDerivatives(model, state, k[0]);
+  for (int stage = 0; stage < 3; stage++) {
+    for (int i = 0; i < 6; i++) stage_state[i] = state[i] + stage_factors[stage] * k[stage][i];
+    CalcReferenceDerivatives(model, stage_state, k[stage + 1]);
+  }
+  for (int i = 0; i < 6; i++) {
+    state[i] += step_width_s / 6.0 * (k[0][i] + 2.0 * k[1][i] + 2.0 * k[2][i] + k[3][i]);
+  }
+}
+
+/**
+ * @brief Compare the engine with the scalar RK4 for spacecraft with different models around the center body
+ */
+void CompareWithScalarRk4(const double gravity_constant_m3_s2, const double radius_m, const double angular_velocity_rad_s, const double altitude_m) {
+  const double kStep_s = 0.5;
+  const int kNumberOfSpacecraft = 3;
+  const bool is_calc_enabled[kNumberOfSpacecraft] = {true, true, false};
+  const double j2_coefficients[kNumberOfSpacecraft] = {1.0e-3, 1.0e-3, 1.0e-3};
+  const double ballistic_coefficients_m2_kg[kNumberOfSpacecraft] = {0.01, 0.0, 0.01};
+
+  ConstellationOrbitEngine engine;
+  engine.SetCenterBody(radius_m, angular_velocity_rad_s);
+  ReferenceOrbitModel models[kNumberOfSpacecraft];
+  double states[kNumberOfSpacecraft][6];
+  for (int n = 0; n < kNumberOfSpacecraft; n++) {
+    const double orbit_radius_m = radius_m + altitude_m;
+    const double velocity_m_s = sqrt(gravity_constant_m3_s2 / orbit_radius_m);
+    const double inclination_rad = 0.3 + 0.4 * n;
+    const double initial_state[6] = {orbit_radius_m, 0.0, 0.0, 0.0, velocity_m_s * cos(inclination_rad), velocity_m_s * sin(inclination_rad)};
+    libra::Vector<3> position_i_m, velocity_i_m_s;
+    for (int i = 0; i < 3; i++) {
+      position_i_m[i] = initial_state[i];
+      velocity_i_m_s[i] = initial_state[i + 3];
+    }
+    for (int i = 0; i < 6; i++) states[n][i] = initial_state[i];
+    EXPECT_EQ(n, engine.AddSpacecraft(nullptr, gravity_constant_m3_s2, kStep_s, position_i_m, velocity_i_m_s, j2_coefficients[n],
+                                      ballistic_coefficients_m2_kg[n]));
+    models[n] = {gravity_constant_m3_s2, radius_m, angular_velocity_rad_s, j2_coefficients[n], ballistic_coefficients_m2_kg[n],
+                 {1.0e-6 * n, 0.0, 0.0}};
+  }
+
+  for (int time_s = 1; time_s <= 100; time_s++) {
+    for (int n = 0; n < kNumberOfSpacecraft; n++) {
+      libra::Vector<3> acceleration_i_m_s2(0.0);
+      acceleration_i_m_s2[0] = models[n].acceleration_m_s2[0];
+      engine.RequestPropagation(n, time_s, acceleration_i_m_s2, is_calc_enabled[n]);
+      if (!is_calc_enabled[n]) continue;
+      PropagateReferenceStep(models[n], kStep_s, states[n]);
+      PropagateReferenceStep(models[n], kStep_s, states[n]);
+    }
+  }
+
+  for (int n = 0; n < kNumberOfSpacecraft; n++) {
+    const libra::Vector<3> position_i_m = engine.GetPosition_i_m(n);
+    const libra::Vector<3> velocity_i_m_s = engine.GetVelocity_i_m_s(n);
+    for (int i = 0; i < 3; i++) {
+      EXPECT_NEAR(states[n][i], position_i_m[i], 1.0e-6);
+      EXPECT_NEAR(states[n][i + 3], velocity_i_m_s[i], 1.0e-9);
+    }
+  }
+}
+
+/**
+ * @brief Test for the propagation around the Earth compared with the scalar RK4
+ */
+TEST(ConstellationOrbitEngine, CompareWithScalarRk4Earth) { CompareWithScalarRk4(3.986004418e14, 6378136.6, 7.292115e-5, 400.0e3); }
+
+/**
+ * @brief Test for the propagation with the radius and the rotation of the other center body
+ */
+TEST(ConstellationOrbitEngine, CompareWithScalarRk4OtherCenterBody) { CompareWithScalarRk4(4.9028e12, 1737.4e3, 2.6617e-6, 400.0e3); }
+
+/**
+ * @brief Test for the disabled spacecraft and the drag
+ */
+TEST(ConstellationOrbitEngine, DisabledSpacecraftAndDrag) {
+  const double kGravityConstant_m3_s2 = 3.986004418e14;
+  ConstellationOrbitEngine engine;
+  libra::Vector<3> position_i_m(0.0), velocity_i_m_s(0.0);
+  position_i_m[0] = 6378136.6 + 300.0e3;
+  velocity_i_m_s[1] = sqrt(kGravityConstant_m3_s2 / position_i_m[0]);
+  engine.AddSpacecraft(nullptr, kGravityConstant_m3_s2, 1.0, position_i_m, velocity_i_m_s, 0.0, 0.0);
+  engine.AddSpacecraft(nullptr, kGravityConstant_m3_s2, 1.0, position_i_m, velocity_i_m_s, 0.0, 0.1);
+  engine.AddSpacecraft(nullptr, kGravityConstant_m3_s2, 1.0, position_i_m, velocity_i_m_s, 0.0, 0.1);
+
+  auto calc_energy = [&](const int index) {
+    return 0.5 * engine.GetVelocity_i_m_s(index).CalcNorm() * engine.GetVelocity_i_m_s(index).CalcNorm() -
+           kGravityConstant_m3_s2 / engine.GetPosition_i_m(index).CalcNorm();
+  };
+  const double initial_energy_m2_s2 = calc_energy(0);
+  for (int time_s = 1; time_s <= 600; time_s++) {
+    for (int n = 0; n < 3; n++) {
+      engine.RequestPropagation(n, time_s, libra::Vector<3>(0.0), n != 2);
+    }
+  }
+
+  // The disabled spacecraft is kept fixed
+  for (int i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(position_i_m[i], engine.GetPosition_i_m(2)[i]);
+    EXPECT_DOUBLE_EQ(velocity_i_m_s[i], engine.GetVelocity_i_m_s(2)[i]);
+  }
+  // The drag decreases the orbital energy, and the energy is kept without the drag
+  EXPECT_NEAR(initial_energy_m2_s2, calc_energy(0), 1.0e-6 * fabs(initial_energy_m2_s2));
+  EXPECT_LT(calc_energy(1), calc_energy(0) - 1.0);
+}
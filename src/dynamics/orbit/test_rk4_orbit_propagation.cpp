@@ -0,0 +1,110 @@
+/**
+ * @file test_rk4_orbit_propagation.cpp
+ * @brief Test codes for Rk4OrbitPropagation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <disturbances/geopotential.hpp>
+#include <environment/global/physical_constants.hpp>
+#include <fstream>
+#include <library/utilities/macros.hpp>
+#include <string>
+#include <vector>
+
+#include "rk4_orbit_propagation.hpp"
+
+/**
+ * @class GeopotentialForTest
+ * @brief Geopotential whose direction cosine matrix of the earth rotation is set directly
+ */
+class GeopotentialForTest : public Geopotential {
+ public:
+  GeopotentialForTest(const std::string file_path) : Geopotential(2, file_path) {}
+  void SetDcmEciToEcef(const libra::Matrix<3, 3>& dcm_eci_to_ecef) { dcm_eci_to_ecef_ = dcm_eci_to_ecef; }
+};
+
+/**
+ * @class StageGeopotentialForTest
+ * @brief Stage acceleration which records the geopotential evaluated at each stage
+ */
+class StageGeopotentialForTest : public IOrbitAcceleration {
+ public:
+  StageGeopotentialForTest(GeopotentialForTest& geopotential) : geopotential_(geopotential) {}
+  libra::Vector<3> CalcStageAcceleration_i_m_s2(const double time_from_update_s, const libra::Vector<3>& position_i_m,
+                                                const libra::Vector<3>& velocity_i_m_s) override {
+    UNUSED(velocity_i_m_s);
+    const libra::Vector<3> acceleration_i_m_s2 = geopotential_.CalcStageAcceleration_i_m_s2(time_from_update_s, position_i_m);
+    positions_i_m_.push_back(position_i_m);
+    accelerations_i_m_s2_.push_back(acceleration_i_m_s2);
+    return acceleration_i_m_s2;
+  }
+
+  std::vector<libra::Vector<3>> positions_i_m_;         //!< Positions of the evaluated stages [m]
+  std::vector<libra::Vector<3>> accelerations_i_m_s2_;  //!< Accelerations of the evaluated stages [m/s2]
+
+ private:
+  GeopotentialForTest& geopotential_;  //!< Geopotential evaluated at the stages
+};
+
+/**
+ * @brief Test for the geopotential at each RK4 stage compared with the one calculated with the earth rotation at the time of the stage
+ */
+TEST(Rk4OrbitPropagation, StageGeopotentialEarthRotation) {
+  // EGM96 coefficients up to degree 2. The tesseral terms depend on the earth rotation.
+  const std::string file_path = "test_rk4_orbit_propagation_egm96.txt";
+  {
+    std::ofstream file(file_path);
+    file << "2 0 -0.484165371736E-03 0.000000000000E+00" << std::endl;
+    file << "2 1 -0.186987635955E-09 0.119528012031E-08" << std::endl;
+    file << "2 2 0.243914352398E-05 -0.140016683654E-05" << std::endl;
+  }
+  GeopotentialForTest geopotential(file_path);
+  remove(file_path.c_str());
+
+  std::vector<std::vector<double>> c(3, std::vector<double>(3, 0.0));
+  std::vector<std::vector<double>> s(3, std::vector<double>(3, 0.0));
+  c[2][0] = -0.484165371736E-03;
+  c[2][1] = -0.186987635955E-09;
+  s[2][1] = 0.119528012031E-08;
+  c[2][2] = 0.243914352398E-05;
+  s[2][2] = -0.140016683654E-05;
+  GravityPotential reference_geopotential(2, c, s, environment::earth_gravitational_constant_m3_s2, environment::earth_equatorial_radius_m);
+
+  CelestialInformation celestial_information("J2000", "NONE", "EARTH", RotationMode::kIdle, 0, nullptr);
+  libra::Vector<3> position_i_m(0.0), velocity_i_m_s(0.0);
+  position_i_m[0] = 5.0e6;
+  position_i_m[1] = 4.0e6;
+  position_i_m[2] = 2.0e6;
+  velocity_i_m_s[0] = -4.5e3;
+  velocity_i_m_s[1] = 4.0e3;
+  velocity_i_m_s[2] = 3.0e3;
+  const double kStep_s = 5.0;
+  Rk4OrbitPropagation orbit(&celestial_information, environment::earth_gravitational_constant_m3_s2, kStep_s, position_i_m, velocity_i_m_s, 0.0,
+                            true);
+  StageGeopotentialForTest stage_acceleration(geopotential);
+  orbit.SetIsCalcEnabled(true);
+  orbit.SetStageAcceleration(&stage_acceleration);
+
+  // The disturbances are updated with the earth rotation at the end time before the propagation
+  const double kStartTime_jd = 2460000.5;
+  const double kEndTime_s = 2.0 * kStep_s;
+  CelestialRotation earth_rotation(RotationMode::kFull, "EARTH");
+  earth_rotation.Update(kStartTime_jd + kEndTime_s / 86400.0);
+  geopotential.SetDcmEciToEcef(earth_rotation.GetDcmJ2000ToXcxf());
+  orbit.Propagate(kEndTime_s, kStartTime_jd + kEndTime_s / 86400.0);
+
+  // Stages of the two RK4 steps. The tolerance is for the resolution of the Julian date, while the earth rotation of 10 s makes 1e-8 m/s2 error.
+  const std::vector<double> stage_times_s = {0.0, 2.5, 2.5, 5.0, 5.0, 7.5, 7.5, 10.0};
+  ASSERT_EQ(stage_times_s.size(), stage_acceleration.accelerations_i_m_s2_.size());
+  EXPECT_EQ(position_i_m[0], stage_acceleration.positions_i_m_[0][0]);
+  for (size_t stage = 0; stage < stage_times_s.size(); stage++) {
+    earth_rotation.Update(kStartTime_jd + stage_times_s[stage] / 86400.0);
+    const libra::Matrix<3, 3> dcm_eci_to_ecef = earth_rotation.GetDcmJ2000ToXcxf();
+    const libra::Vector<3> expected_acceleration_i_m_s2 =
+        dcm_eci_to_ecef.Transpose() * reference_geopotential.CalcAcceleration_xcxf_m_s2(dcm_eci_to_ecef * stage_acceleration.positions_i_m_[stage]);
+    for (size_t i = 0; i < 3; i++) {
+      EXPECT_NEAR(expected_acceleration_i_m_s2[i], stage_acceleration.accelerations_i_m_s2_[stage][i], 1.0e-11) << "stage " << stage;
+    }
+  }
+}
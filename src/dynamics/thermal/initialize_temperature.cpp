@@ -92,6 +92,7 @@ Temperature* InitTemperature(const std::string file_name, const double rk_prop_s
   }
 
   bool debug = mainIni.ReadEnable("THERMAL", "debug");
+  ThermalSolver solver = SetThermalSolver(mainIni.ReadString("THERMAL", "solver"));
 
   // Read Heatloads from CSV File
   string filepath_heatload = file_path + "heatload.csv";
@@ -143,6 +144,6 @@ Temperature* InitTemperature(const std::string file_name, const double rk_prop_s
 
   Temperature* temperature;
   temperature = new Temperature(conductance_matrix, radiation_matrix, node_list, heatload_list, heater_list, heater_controller_list, node_num,
-                                rk_prop_step_s, is_calc_enabled, solar_calc_setting, debug);
+                                rk_prop_step_s, is_calc_enabled, solar_calc_setting, debug, solver);
   return temperature;
 }
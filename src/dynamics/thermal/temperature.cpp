@@ -5,6 +5,7 @@
 
 #include "temperature.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <environment/global/physical_constants.hpp>
 #include <iostream>
@@ -13,12 +14,21 @@
 
 using namespace std;
 
+ThermalSolver SetThermalSolver(const std::string solver) {
+  if (solver == "RK4") {
+    return ThermalSolver::kRk4;
+  } else if (solver == "IMPLICIT_EULER") {
+    return ThermalSolver::kImplicitEuler;
+  } else {
+    return ThermalSolver::kRk4;
+  }
+}
+
 Temperature::Temperature(const vector<vector<double>> conductance_matrix_W_K, const vector<vector<double>> radiation_matrix_m2, vector<Node> nodes,
                          vector<Heatload> heatloads, vector<Heater> heaters, vector<HeaterController> heater_controllers, const int node_num,
-                         const double propagation_step_s, const bool is_calc_enabled, const SolarCalcSetting solar_calc_setting, const bool debug)
-    : conductance_matrix_W_K_(conductance_matrix_W_K),
-      radiation_matrix_m2_(radiation_matrix_m2),
-      nodes_(nodes),
+                         const double propagation_step_s, const bool is_calc_enabled, const SolarCalcSetting solar_calc_setting, const bool debug,
+                         const ThermalSolver solver)
+    : nodes_(nodes),
       heatloads_(heatloads),
       heaters_(heaters),
       heater_controllers_(heater_controllers),
@@ -26,8 +36,21 @@ Temperature::Temperature(const vector<vector<double>> conductance_matrix_W_K, co
       propagation_step_s_(propagation_step_s),  // ルンゲクッタ積分時間刻み幅
       is_calc_enabled_(is_calc_enabled),
       solar_calc_setting_(solar_calc_setting),
-      debug_(debug) {
+      debug_(debug),
+      solver_(solver) {
   propagation_time_s_ = 0;
+  SetCouplingMatrices(conductance_matrix_W_K, radiation_matrix_m2);
+
+  temperatures_now_K_.resize(node_num_);
+  stage_temperatures_K_.resize(node_num_);
+  temperatures4_K4_.resize(node_num_);
+  for (auto& differentials_K_s : differentials_K_s_) {
+    differentials_K_s.resize(node_num_);
+  }
+  if (solver_ == ThermalSolver::kImplicitEuler) {
+    jacobian_1_s_.resize(coupling_column_indices_.size());
+    jacobian_diagonal_1_s_.resize(node_num_);
+  }
   if (debug_) {
     PrintParams();
   }
@@ -40,6 +63,28 @@ Temperature::Temperature() {
   solar_calc_setting_ = SolarCalcSetting::kDisable;
   is_calc_enabled_ = false;
   debug_ = false;
+  solver_ = ThermalSolver::kRk4;
+  coupling_row_offsets_.assign(1, 0);
+}
+
+void Temperature::SetCouplingMatrices(const vector<vector<double>>& conductance_matrix_W_K, const vector<vector<double>>& radiation_matrix_m2) {
+  coupling_row_offsets_.assign(1, 0);
+  coupling_column_indices_.clear();
+  conductance_W_K_.clear();
+  radiation_W_K4_.clear();
+  for (int i = 0; i < node_num_; i++) {
+    for (int j = 0; j < node_num_; j++) {
+      // The diagonal elements do not affect the heat input
+      if (i == j) continue;
+      double conductance_W_K = conductance_matrix_W_K[i][j];
+      double radiation_m2 = radiation_matrix_m2[i][j];
+      if (conductance_W_K == 0.0 && radiation_m2 == 0.0) continue;
+      coupling_column_indices_.push_back(j);
+      conductance_W_K_.push_back(conductance_W_K);
+      radiation_W_K4_.push_back(environment::stefan_boltzmann_constant_W_m2K4 * radiation_m2);
+    }
+    coupling_row_offsets_.push_back((int)coupling_column_indices_.size());
+  }
 }
 
 Temperature::~Temperature() {}
@@ -47,10 +92,10 @@ Temperature::~Temperature() {}
 void Temperature::Propagate(libra::Vector<3> sun_direction_b, const double time_end_s) {
   if (!is_calc_enabled_) return;
   while (time_end_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
-    CalcRungeOneStep(propagation_time_s_, propagation_step_s_, sun_direction_b, node_num_);
+    CalcOneStep(propagation_time_s_, propagation_step_s_, sun_direction_b, node_num_);
     propagation_time_s_ += propagation_step_s_;
   }
-  CalcRungeOneStep(propagation_time_s_, time_end_s - propagation_time_s_, sun_direction_b, node_num_);
+  CalcOneStep(propagation_time_s_, time_end_s - propagation_time_s_, sun_direction_b, node_num_);
   propagation_time_s_ = time_end_s;
   UpdateHeaterStatus();
 
@@ -77,47 +122,108 @@ void Temperature::Propagate(libra::Vector<3> sun_direction_b, const double time_
   }
 }
 
+void Temperature::CalcOneStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b, int node_num) {
+  if (solver_ == ThermalSolver::kImplicitEuler) {
+    CalcImplicitEulerOneStep(time_now_s, time_step_s, sun_direction_b, node_num);
+  } else {
+    CalcRungeOneStep(time_now_s, time_step_s, sun_direction_b, node_num);
+  }
+}
+
 void Temperature::CalcRungeOneStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b, int node_num) {
-  vector<double> temperatures_now_K(node_num);
+  vector<double>& temperatures_now_K = temperatures_now_K_;
+  vector<double>& xk = stage_temperatures_K_;
+  vector<double>& k1 = differentials_K_s_[0];
+  vector<double>& k2 = differentials_K_s_[1];
+  vector<double>& k3 = differentials_K_s_[2];
+  vector<double>& k4 = differentials_K_s_[3];
   for (int i = 0; i < node_num; i++) {
     temperatures_now_K[i] = nodes_[i].GetTemperature_K();
   }
 
-  vector<double> k1(node_num), k2(node_num), k3(node_num), k4(node_num);
-  vector<double> xk2(node_num), xk3(node_num), xk4(node_num);
+  CalcTemperatureDifferentials(temperatures_now_K, time_now_s, sun_direction_b, node_num, k1);
+  for (int i = 0; i < node_num; i++) {
+    xk[i] = temperatures_now_K[i] + (time_step_s / 2.0) * k1[i];
+  }
+
+  CalcTemperatureDifferentials(xk, (time_now_s + time_step_s / 2.0), sun_direction_b, node_num, k2);
+  for (int i = 0; i < node_num; i++) {
+    xk[i] = temperatures_now_K[i] + (time_step_s / 2.0) * k2[i];
+  }
 
-  k1 = CalcTemperatureDifferentials(temperatures_now_K, time_now_s, sun_direction_b, node_num);
+  CalcTemperatureDifferentials(xk, (time_now_s + time_step_s / 2.0), sun_direction_b, node_num, k3);
   for (int i = 0; i < node_num; i++) {
-    xk2[i] = temperatures_now_K[i] + (time_step_s / 2.0) * k1[i];
+    xk[i] = temperatures_now_K[i] + time_step_s * k3[i];
   }
 
-  k2 = CalcTemperatureDifferentials(xk2, (time_now_s + time_step_s / 2.0), sun_direction_b, node_num);
+  CalcTemperatureDifferentials(xk, (time_now_s + time_step_s), sun_direction_b, node_num, k4);
+
   for (int i = 0; i < node_num; i++) {
-    xk3[i] = temperatures_now_K[i] + (time_step_s / 2.0) * k2[i];
+    nodes_[i].SetTemperature_K(temperatures_now_K[i] + (time_step_s / 6.0) * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]));
   }
+}
 
-  k3 = CalcTemperatureDifferentials(xk3, (time_now_s + time_step_s / 2.0), sun_direction_b, node_num);
+void Temperature::CalcImplicitEulerOneStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b, int node_num) {
+  vector<double>& temperatures_now_K = temperatures_now_K_;
+  vector<double>& differentials_K_s = differentials_K_s_[0];
+  vector<double>& delta_temperatures_K = stage_temperatures_K_;
   for (int i = 0; i < node_num; i++) {
-    xk4[i] = temperatures_now_K[i] + time_step_s * k3[i];
+    temperatures_now_K[i] = nodes_[i].GetTemperature_K();
   }
+  if (time_step_s <= 0.0) return;
 
-  k4 = CalcTemperatureDifferentials(xk4, (time_now_s + time_step_s), sun_direction_b, node_num);
+  // The heat loads are evaluated at the end of the step
+  CalcTemperatureDifferentials(temperatures_now_K, time_now_s + time_step_s, sun_direction_b, node_num, differentials_K_s);
 
-  vector<double> temperatures_next_K(node_num);
+  // Jacobian of the differentials: d(dT_i/dt)/dT_j = (C_ij + 4 sigma R_ij T_j^3) / capacity_i
   for (int i = 0; i < node_num; i++) {
-    temperatures_next_K[i] = temperatures_now_K[i] + (time_step_s / 6.0) * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
+    jacobian_diagonal_1_s_[i] = 0.0;
+    if (nodes_[i].GetNodeType() != NodeType::kDiffusive) continue;
+    double temperature3_i = temperatures_now_K[i] * temperatures_now_K[i] * temperatures_now_K[i];
+    double inverse_capacity = 1.0 / nodes_[i].GetCapacity_J_K();
+    for (int k = coupling_row_offsets_[i]; k < coupling_row_offsets_[i + 1]; k++) {
+      int j = coupling_column_indices_[k];
+      double temperature3_j = temperatures_now_K[j] * temperatures_now_K[j] * temperatures_now_K[j];
+      jacobian_1_s_[k] = (conductance_W_K_[k] + 4.0 * radiation_W_K4_[k] * temperature3_j) * inverse_capacity;
+      jacobian_diagonal_1_s_[i] += (conductance_W_K_[k] + 4.0 * radiation_W_K4_[k] * temperature3_i) * inverse_capacity;
+    }
   }
 
+  // Solve (I / h - J) dT = f with Gauss-Seidel iterations. The temperatures of the boundary nodes are not changed.
+  const double tolerance_K = 1.0e-9;
   for (int i = 0; i < node_num; i++) {
-    nodes_[i].SetTemperature_K(temperatures_next_K[i]);
+    delta_temperatures_K[i] = time_step_s * differentials_K_s[i];
+  }
+  for (int iteration = 0; iteration < kMaxImplicitIterations; iteration++) {
+    double max_change_K = 0.0;
+    for (int i = 0; i < node_num; i++) {
+      if (nodes_[i].GetNodeType() != NodeType::kDiffusive) {
+        delta_temperatures_K[i] = 0.0;
+        continue;
+      }
+      double right_hand_side_K_s = differentials_K_s[i];
+      for (int k = coupling_row_offsets_[i]; k < coupling_row_offsets_[i + 1]; k++) {
+        right_hand_side_K_s += jacobian_1_s_[k] * delta_temperatures_K[coupling_column_indices_[k]];
+      }
+      double delta_temperature_K = right_hand_side_K_s / (1.0 / time_step_s + jacobian_diagonal_1_s_[i]);
+      max_change_K = std::max(max_change_K, std::abs(delta_temperature_K - delta_temperatures_K[i]));
+      delta_temperatures_K[i] = delta_temperature_K;
+    }
+    if (max_change_K < tolerance_K) break;
+  }
+
+  for (int i = 0; i < node_num; i++) {
+    nodes_[i].SetTemperature_K(temperatures_now_K[i] + delta_temperatures_K[i]);
   }
 }
 
-vector<double> Temperature::CalcTemperatureDifferentials(vector<double> temperatures_K, double t, libra::Vector<3> sun_direction, int node_num) {
-  // TODO: consider the following unused arguments are really needed
-  UNUSED(temperatures_K);
+void Temperature::CalcTemperatureDifferentials(const vector<double>& temperatures_K, double t, libra::Vector<3> sun_direction, int node_num,
+                                               vector<double>& differentials_K_s) {
+  for (int i = 0; i < node_num; i++) {
+    double temperature2_K2 = temperatures_K[i] * temperatures_K[i];
+    temperatures4_K4_[i] = temperature2_K2 * temperature2_K2;
+  }
 
-  vector<double> differentials_K_s(node_num);
   for (int i = 0; i < node_num; i++) {
     heatloads_[i].SetElapsedTime_s(t);
     if (nodes_[i].GetNodeType() == NodeType::kDiffusive) {
@@ -133,10 +239,10 @@ vector<double> Temperature::CalcTemperatureDifferentials(vector<double> temperat
 
       double conductive_heat_input_W = 0;
       double radiative_heat_input_W = 0;
-      for (int j = 0; j < node_num; j++) {
-        conductive_heat_input_W += conductance_matrix_W_K_[i][j] * (nodes_[j].GetTemperature_K() - nodes_[i].GetTemperature_K());
-        radiative_heat_input_W += environment::stefan_boltzmann_constant_W_m2K4 * radiation_matrix_m2_[i][j] *
-                                  (pow(nodes_[j].GetTemperature_K(), 4) - pow(nodes_[i].GetTemperature_K(), 4));
+      for (int k = coupling_row_offsets_[i]; k < coupling_row_offsets_[i + 1]; k++) {
+        int j = coupling_column_indices_[k];
+        conductive_heat_input_W += conductance_W_K_[k] * (temperatures_K[j] - temperatures_K[i]);
+        radiative_heat_input_W += radiation_W_K4_[k] * (temperatures4_K4_[j] - temperatures4_K4_[i]);
       }
       double total_heat_input_W = conductive_heat_input_W + radiative_heat_input_W + total_heatload_W;
       differentials_K_s[i] = total_heat_input_W / nodes_[i].GetCapacity_J_K();
@@ -144,7 +250,6 @@ vector<double> Temperature::CalcTemperatureDifferentials(vector<double> temperat
       differentials_K_s[i] = 0;
     }
   }
-  return differentials_K_s;
 }
 
 double Temperature::GetHeaterPower_W(int node_id) {
@@ -204,6 +309,23 @@ string Temperature::GetLogValue() const {
   return str_tmp;
 }
 
+bool Temperature::GetLogValueBinary(std::vector<double>& values) const {
+  for (int i = 0; i < node_num_; i++) {
+    // Do not retrieve boundary node values
+    if (nodes_[i].GetNodeType() != NodeType::kBoundary) {
+      AppendScalar(values, nodes_[i].GetTemperature_degC());
+    }
+  }
+  for (int i = 0; i < node_num_; i++) {
+    // Do not retrieve boundary node values
+    if (nodes_[i].GetNodeType() != NodeType::kBoundary) {
+      AppendScalar(values, heatloads_[i].GetTotalHeatload_W());
+    }
+  }
+
+  return true;
+}
+
 void Temperature::PrintParams(void) {
   cout << "< Print Thermal Parameters >" << endl;
   cout << "IsCalcEnabled: " << is_calc_enabled_ << endl;
@@ -216,17 +338,27 @@ void Temperature::PrintParams(void) {
     itr->PrintParam();
   }
   cout << std::fixed;
+  // The diagonal elements are not stored and shown as zero
+  vector<double> row(node_num_);
   cout << "Cij:" << endl;
   for (int i = 0; i < (node_num_); i++) {
+    fill(row.begin(), row.end(), 0.0);
+    for (int k = coupling_row_offsets_[i]; k < coupling_row_offsets_[i + 1]; k++) {
+      row[coupling_column_indices_[k]] = conductance_W_K_[k];
+    }
     for (int j = 0; j < (node_num_); j++) {
-      cout << std::setprecision(4) << conductance_matrix_W_K_[i][j] << "  ";
+      cout << std::setprecision(4) << row[j] << "  ";
     }
     cout << endl;
   }
   cout << "Rij:" << endl;
   for (int i = 0; i < (node_num_); i++) {
+    fill(row.begin(), row.end(), 0.0);
+    for (int k = coupling_row_offsets_[i]; k < coupling_row_offsets_[i + 1]; k++) {
+      row[coupling_column_indices_[k]] = radiation_W_K4_[k] / environment::stefan_boltzmann_constant_W_m2K4;
+    }
     for (int j = 0; j < (node_num_); j++) {
-      cout << std::setprecision(4) << radiation_matrix_m2_[i][j] << "  ";
+      cout << std::setprecision(4) << row[j] << "  ";
     }
     cout << endl;
   }
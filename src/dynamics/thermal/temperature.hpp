@@ -24,24 +24,53 @@ enum class SolarCalcSetting {
   kDisable,
 };
 
+/**
+ * @enum ThermalSolver
+ * @brief Numerical method to propagate temperatures
+ */
+enum class ThermalSolver {
+  kRk4,            //!< 4th order Runge-Kutta method
+  kImplicitEuler,  //!< Linearly implicit Euler method (Rosenbrock-Euler) for stiff networks and large steps
+};
+
+/**
+ * @fn SetThermalSolver
+ * @brief Convert string to ThermalSolver
+ * @param [in] solver: Name of the solver (RK4 or IMPLICIT_EULER)
+ */
+ThermalSolver SetThermalSolver(const std::string solver);
+
 /**
  * @class Temperature
  * @brief class to calculate temperature of all nodes
  */
 class Temperature : public ILoggable {
  protected:
-  std::vector<std::vector<double>> conductance_matrix_W_K_;  // Coupling of node i and node j by heat conduction [W/K]
-  std::vector<std::vector<double>> radiation_matrix_m2_;     // Coupling of node i and node j by thermal radiation [m2]
-  std::vector<Node> nodes_;                                  // vector of nodes
-  std::vector<Heatload> heatloads_;                          // vector of heatloads
-  std::vector<Heater> heaters_;                              // vector of heaters
-  std::vector<HeaterController> heater_controllers_;         // vector of heater controllers
-  int node_num_;                                             // number of nodes
-  double propagation_step_s_;                                // propagation step [s]
+  // Coupling of node i and node j in the compressed sparse row format. Only the non-zero off-diagonal elements are stored.
+  std::vector<int> coupling_row_offsets_;             // Elements of node i are in [coupling_row_offsets_[i], coupling_row_offsets_[i + 1])
+  std::vector<int> coupling_column_indices_;          // Node j of the elements
+  std::vector<double> conductance_W_K_;               // Coupling by heat conduction of the elements [W/K]
+  std::vector<double> radiation_W_K4_;                // Coupling by thermal radiation of the elements multiplied by Stefan-Boltzmann constant [W/K4]
+  std::vector<Node> nodes_;                           // vector of nodes
+  std::vector<Heatload> heatloads_;                   // vector of heatloads
+  std::vector<Heater> heaters_;                       // vector of heaters
+  std::vector<HeaterController> heater_controllers_;  // vector of heater controllers
+  int node_num_;                                      // number of nodes
+  double propagation_step_s_;                         // propagation step [s]
   double propagation_time_s_;            // Incremented time inside class Temperature [s], finish propagation when reaching end_time
   bool is_calc_enabled_;                 // Whether temperature calculation is enabled
   SolarCalcSetting solar_calc_setting_;  // setting for solar calculation
   bool debug_;                           // Activate debug output or not
+  ThermalSolver solver_;                 // Numerical method to propagate temperatures
+
+  // Buffers allocated in the constructor to avoid the allocation in each step
+  std::vector<double> temperatures_now_K_;        // Temperatures at the beginning of the step [K]
+  std::vector<double> stage_temperatures_K_;      // Temperatures of the stage [K]
+  std::vector<double> temperatures4_K4_;          // Fourth power of the temperatures of the stage [K4]
+  std::vector<double> differentials_K_s_[4];      // Differentials of the stages [K/s]
+  std::vector<double> jacobian_1_s_;              // Off-diagonal elements of the Jacobian for the implicit method [1/s]
+  std::vector<double> jacobian_diagonal_1_s_;     // Negative diagonal elements of the Jacobian for the implicit method [1/s]
+  static const int kMaxImplicitIterations = 100;  // Maximum number of Gauss-Seidel iterations for the implicit method
 
   /**
    * @fn CalcRungeOneStep
@@ -53,18 +82,44 @@ class Temperature : public ILoggable {
    * @param[in] node_num: Number of nodes
    */
   void CalcRungeOneStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b, int node_num);
+  /**
+   * @fn CalcImplicitEulerOneStep
+   * @brief Calculate one step of the linearly implicit Euler method for thermal equilibrium equation and update temperatures of nodes
+   * @note (I / h - J) dT = f(T) is solved with Gauss-Seidel iterations on the sparse coupling, where J is the Jacobian of f.
+   *
+   * @param[in] time_now_s: Current elapsed time [s]
+   * @param[in] time_step_s: Time step [s]
+   * @param[in] sun_direction_b: Sun direction in body frame
+   * @param[in] node_num: Number of nodes
+   */
+  void CalcImplicitEulerOneStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b, int node_num);
+  /**
+   * @fn CalcOneStep
+   * @brief Calculate one step with the selected solver
+   */
+  void CalcOneStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b, int node_num);
   /**
    * @fn CalcTemperatureDifferentials
    * @brief Calculate differential of thermal equilibrium equation
+   * @note The fourth power of the temperatures is calculated once and stored in temperatures4_K4_.
    *
-   * @param temperatures_K: [UNUSED] Temperatures of each node [K]
+   * @param temperatures_K: Temperatures of each node [K]
    * @param time_now_s: Current elapsed time [s]
    * @param sun_direction_b: Sun direction in body frame
    * @param node_num: Number of nodes
-   * @return std::vector<double>: Differential of thermal equilibrium equation at time now
+   * @param differentials_K_s: Output differential of thermal equilibrium equation at time now [K/s]
    */
-  std::vector<double> CalcTemperatureDifferentials(std::vector<double> temperatures_K, double time_now_s, const libra::Vector<3> sun_direction_b,
-                                                   int node_num);
+  void CalcTemperatureDifferentials(const std::vector<double>& temperatures_K, double time_now_s, const libra::Vector<3> sun_direction_b,
+                                    int node_num, std::vector<double>& differentials_K_s);
+  /**
+   * @fn SetCouplingMatrices
+   * @brief Convert the dense coupling matrices to the compressed sparse row format
+   *
+   * @param conductance_matrix_W_K: (node_num x node_num) matrix with heat conductance values [W/K]
+   * @param radiation_matrix_m2: (node_num x node_num) matrix with radiative connection values [m2]
+   */
+  void SetCouplingMatrices(const std::vector<std::vector<double>>& conductance_matrix_W_K,
+                           const std::vector<std::vector<double>>& radiation_matrix_m2);
 
  public:
   /**
@@ -82,11 +137,12 @@ class Temperature : public ILoggable {
    * @param is_calc_enabled: Whether calculation is enabled
    * @param solar_calc_setting: Solar calculation settings
    * @param debug: Whether debug is enabled
+   * @param solver: Numerical method to propagate temperatures
    */
   Temperature(const std::vector<std::vector<double>> conductance_matrix_W_K, const std::vector<std::vector<double>> radiation_matrix_m2,
               std::vector<Node> nodes, std::vector<Heatload> heatloads, std::vector<Heater> heaters, std::vector<HeaterController> heater_controllers,
               const int node_num, const double propagation_step_s, const bool is_calc_enabled, const SolarCalcSetting solar_calc_setting,
-              const bool debug);
+              const bool debug, const ThermalSolver solver = ThermalSolver::kRk4);
   /**
    * @fn Temperature
    * @brief Construct a new Temperature object, used when thermal calculation is disabled.
@@ -134,6 +190,11 @@ class Temperature : public ILoggable {
    * @return std::string
    */
   std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  bool GetLogValueBinary(std::vector<double>& values) const;
 
   /**
    * @fn UpdateHeaterStatus
@@ -0,0 +1,95 @@
+/**
+ * @file test_temperature.cpp
+ * @brief Test codes for Temperature class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "temperature.hpp"
+
+/**
+ * @brief Make a linear network with a stiff node and a slow node conductively coupled to a boundary node
+ * @note Node 1 relaxes with the rate of 10 1/s and node 2 with 0.01 1/s, so the temperatures are given in closed form.
+ */
+Temperature* MakeStiffLinearNetwork(const double propagation_step_s, const ThermalSolver solver) {
+  const int node_num = 3;
+  const libra::Vector<3> normal_vector_b(0.0);
+  std::vector<Node> nodes;
+  nodes.push_back(Node(0, "boundary", NodeType::kBoundary, 0, 300.0, 1.0, 0.0, 0.0, normal_vector_b));
+  nodes.push_back(Node(1, "stiff", NodeType::kDiffusive, 0, 400.0, 10.0, 0.0, 0.0, normal_vector_b));
+  nodes.push_back(Node(2, "slow", NodeType::kDiffusive, 0, 400.0, 100.0, 0.0, 0.0, normal_vector_b));
+
+  std::vector<std::vector<double>> conductance_matrix_W_K(node_num, std::vector<double>(node_num, 0.0));
+  conductance_matrix_W_K[0][1] = conductance_matrix_W_K[1][0] = 100.0;
+  conductance_matrix_W_K[0][2] = conductance_matrix_W_K[2][0] = 1.0;
+  std::vector<std::vector<double>> radiation_matrix_m2(node_num, std::vector<double>(node_num, 0.0));
+
+  std::vector<Heatload> heatloads;
+  for (int i = 0; i < node_num; i++) {
+    heatloads.push_back(Heatload(i, {0.0, 100.0}, {0.0, 0.0}));
+  }
+  return new Temperature(conductance_matrix_W_K, radiation_matrix_m2, nodes, heatloads, std::vector<Heater>(), std::vector<HeaterController>(),
+                         node_num, propagation_step_s, true, SolarCalcSetting::kDisable, false, solver);
+}
+
+/**
+ * @brief Test for the implicit Euler method with the closed form solution of a stiff linear network
+ */
+TEST(Temperature, ImplicitEulerStiffLinearNetwork) {
+  const double step_s = 1.0;
+  const int step_num = 100;
+  Temperature* temperature = MakeStiffLinearNetwork(step_s, ThermalSolver::kImplicitEuler);
+  temperature->Propagate(libra::Vector<3>(1.0), step_s * step_num);
+  std::vector<Node> nodes = temperature->GetNodes();
+
+  // The boundary node is not changed
+  EXPECT_DOUBLE_EQ(300.0, nodes[0].GetTemperature_K());
+
+  // The implicit Euler method gives T_n = T_b + (T_0 - T_b) / (1 + lambda h)^n for the linear network
+  const double rates_1_s[] = {10.0, 0.01};
+  for (int i = 0; i < 2; i++) {
+    const double discrete_K = 300.0 + 100.0 / pow(1.0 + rates_1_s[i] * step_s, step_num);
+    EXPECT_NEAR(discrete_K, nodes[i + 1].GetTemperature_K(), 1.0e-6);
+  }
+
+  // The stiff node is stable at the step 10 times larger than its time constant, and the slow node follows the exact solution
+  EXPECT_NEAR(300.0, nodes[1].GetTemperature_K(), 1.0e-6);
+  const double exact_K = 300.0 + 100.0 * exp(-rates_1_s[1] * step_s * step_num);
+  EXPECT_NEAR(exact_K, nodes[2].GetTemperature_K(), 0.2);
+
+  delete temperature;
+}
+
+/**
+ * @brief Test for the convergence of the implicit Euler method to the closed form solution with the step width
+ */
+TEST(Temperature, ImplicitEulerConvergence) {
+  const double time_end_s = 0.5;
+  const double exact_K = 300.0 + 100.0 * exp(-10.0 * time_end_s);
+  double previous_error_K = 0.0;
+  for (double step_s = 0.01; step_s > 0.0005; step_s /= 2.0) {
+    Temperature* temperature = MakeStiffLinearNetwork(step_s, ThermalSolver::kImplicitEuler);
+    temperature->Propagate(libra::Vector<3>(1.0), time_end_s);
+    const double error_K = fabs(temperature->GetNodes()[1].GetTemperature_K() - exact_K);
+    // First order method
+    if (previous_error_K > 0.0) {
+      EXPECT_NEAR(2.0, previous_error_K / error_K, 0.1);
+    }
+    previous_error_K = error_K;
+    delete temperature;
+  }
+}
+
+/**
+ * @brief Test for the RK4 method which is unstable for the stiff linear network at the same step width
+ */
+TEST(Temperature, Rk4StiffLinearNetwork) {
+  Temperature* temperature = MakeStiffLinearNetwork(1.0, ThermalSolver::kRk4);
+  temperature->Propagate(libra::Vector<3>(1.0), 5.0);
+  // The amplification factor of RK4 for lambda h = -10 is 291
+  const double amplification = 1.0 - 10.0 + 50.0 - 1000.0 / 6.0 + 10000.0 / 24.0;
+  EXPECT_NEAR(100.0 * pow(amplification, 5), temperature->GetNodes()[1].GetTemperature_K() - 300.0, 1.0e-6 * 100.0 * pow(amplification, 5));
+
+  delete temperature;
+}
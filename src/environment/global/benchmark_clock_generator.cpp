@@ -0,0 +1,74 @@
+/**
+ * @file benchmark_clock_generator.cpp
+ * @brief Benchmark of the component update with ClockGenerator for components with various update rates
+ * @note Usage: benchmark_clock_generator [number of components] [number of ticks] [profiling (0 or 1)]
+ *       The prescalers of the components are 1, 10, 100, and 1000 in turn. The default is 128 components and 1000000 ticks without profiling.
+ *       With profiling, the invocation statistics of the first four components are shown.
+ */
+
+#include <chrono>
+#include <components/base/component.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+/**
+ * @class BenchmarkComponent
+ * @brief Component counting the main routine execution
+ */
+class BenchmarkComponent : public Component {
+ public:
+  BenchmarkComponent(const unsigned int prescaler, ClockGenerator* clock_generator) : Component(prescaler, clock_generator) {}
+  unsigned long long execution_count_ = 0;  //!< Number of the main routine execution
+
+ protected:
+  void MainRoutine(const int time_count) override {
+    UNUSED(time_count);
+    execution_count_++;
+  }
+};
+
+/**
+ * @fn main
+ * @brief Measure the number of ticks per second
+ */
+int main(int argc, char* argv[]) {
+  int number_of_components = 128;
+  int number_of_ticks = 1000000;
+  if (argc > 1) number_of_components = atoi(argv[1]);
+  if (argc > 2) number_of_ticks = atoi(argv[2]);
+  const bool is_profiling_enabled = (argc > 3) && atoi(argv[3]) != 0;
+  const unsigned int kPrescalers[] = {1, 10, 100, 1000};
+
+  ClockGenerator clock_generator;
+  clock_generator.ClearTimerCount();
+  clock_generator.SetIsProfilingEnabled(is_profiling_enabled);
+  std::vector<BenchmarkComponent*> components;
+  for (int i = 0; i < number_of_components; i++) {
+    components.push_back(new BenchmarkComponent(kPrescalers[i % 4], &clock_generator));
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int tick = 0; tick < number_of_ticks; tick++) {
+    clock_generator.TickToComponents();
+  }
+  const double time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::cout << "Number of components: " << number_of_components << ", number of ticks: " << number_of_ticks << std::endl;
+  std::cout << "Ticks per second: " << number_of_ticks / time_s << std::endl;
+  if (is_profiling_enabled) {
+    for (int i = 0; i < number_of_components && i < 4; i++) {
+      const TickStatistics statistics = clock_generator.GetTickStatistics(components[i]);
+      std::cout << "Component " << i << " (prescaler " << kPrescalers[i % 4] << "): " << statistics.tick_count << " ticks, "
+                << statistics.elapsed_time_s << " s" << std::endl;
+    }
+  }
+
+  unsigned long long execution_count = 0;
+  for (auto component : components) {
+    execution_count += component->execution_count_;
+    delete component;
+  }
+  std::cout << "Main routine executions: " << execution_count << std::endl;
+  return 0;
+}
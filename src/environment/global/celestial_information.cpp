@@ -10,12 +10,19 @@
 #include <string.h>
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <locale>
+#include <mutex>
 #include <sstream>
 
 #include "library/logger/log_utility.hpp"
 
+std::mutex& GetSpiceMutex() {
+  static std::mutex spice_mutex;
+  return spice_mutex;
+}
+
 CelestialInformation::CelestialInformation(const std::string inertial_frame_name, const std::string aberration_correction_setting,
                                            const std::string center_body_name, const RotationMode rotation_mode,
                                            const unsigned int number_of_selected_body, int* selected_body_ids)
@@ -38,6 +45,7 @@ CelestialInformation::CelestialInformation(const std::string inertial_frame_name
     SpiceInt planet_id = selected_body_ids_[i];
     SpiceInt dim;
     SpiceDouble gravity_constant_km3_s2;
+    std::lock_guard<std::mutex> spice_lock(GetSpiceMutex());
     bodvcd_c(planet_id, "GM", 1, &dim, &gravity_constant_km3_s2);
     // Convert unit [km^3/s^2] to [m^3/s^2]
     celestial_body_gravity_constant_m3_s2_[i] = gravity_constant_km3_s2 * 1E+9;
@@ -49,7 +57,9 @@ CelestialInformation::CelestialInformation(const std::string inertial_frame_name
     SpiceInt dim;
     SpiceDouble radii_km[3];
 
+    std::unique_lock<std::mutex> spice_lock(GetSpiceMutex());
     bodvcd_c(planet_id, "RADII", 3, &dim, (SpiceDouble*)radii_km);
+    spice_lock.unlock();
     for (int j = 0; j < 3; j++) {
       celestial_body_planetographic_radii_m_[i * 3 + j] = radii_km[j] * 1000.0;
     }
@@ -61,6 +71,29 @@ CelestialInformation::CelestialInformation(const std::string inertial_frame_name
     celestial_body_mean_radius_m_[i] = pow(rx * ry * rz, 1.0 / 3.0);
   }
 
+  // Acquisition of body name and SPICE target name
+  for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
+    SpiceInt planet_id = selected_body_ids_[i];
+    SpiceBoolean found;
+    const int kMaxNameLength = 100;
+    char name_buffer[kMaxNameLength];
+    std::unique_lock<std::mutex> spice_lock(GetSpiceMutex());
+    bodc2n_c(planet_id, kMaxNameLength, name_buffer, (SpiceBoolean*)&found);
+    spice_lock.unlock();
+    body_names_.push_back(name_buffer);
+
+    // Add `BARYCENTER` if needed
+    std::string target_name = name_buffer;
+    if (target_name == "MARS" || target_name == "JUPITER" || target_name == "SATURN" || target_name == "URANUS" || target_name == "NEPTUNE" ||
+        target_name == "PLUTO") {
+      target_name += "_BARYCENTER";
+    }
+    spice_target_names_.push_back(target_name);
+  }
+  center_body_id_ = CalcBodyIdFromName(center_body_name_.c_str());
+  ephemeris_cache_start_state_km_.assign(number_of_selected_bodies_ * 6, 0.0);
+  ephemeris_cache_end_state_km_.assign(number_of_selected_bodies_ * 6, 0.0);
+
   // Initialize rotation
   earth_rotation_ = new CelestialRotation(rotation_mode_, center_body_name_);
 }
@@ -69,8 +102,17 @@ CelestialInformation::CelestialInformation(const CelestialInformation& obj)
     : number_of_selected_bodies_(obj.number_of_selected_bodies_),
       inertial_frame_name_(obj.inertial_frame_name_),
       center_body_name_(obj.center_body_name_),
+      center_body_id_(obj.center_body_id_),
       aberration_correction_setting_(obj.aberration_correction_setting_),
-      rotation_mode_(obj.rotation_mode_) {
+      body_names_(obj.body_names_),
+      spice_target_names_(obj.spice_target_names_),
+      rotation_mode_(obj.rotation_mode_),
+      is_ephemeris_cache_enabled_(obj.is_ephemeris_cache_enabled_),
+      ephemeris_cache_interval_s_(obj.ephemeris_cache_interval_s_),
+      ephemeris_cache_start_et_s_(obj.ephemeris_cache_start_et_s_),
+      ephemeris_cache_end_et_s_(obj.ephemeris_cache_end_et_s_),
+      ephemeris_cache_start_state_km_(obj.ephemeris_cache_start_state_km_),
+      ephemeris_cache_end_state_km_(obj.ephemeris_cache_end_state_km_) {
   unsigned int num_of_state = number_of_selected_bodies_ * 3;
 
   selected_body_ids_ = new int[number_of_selected_bodies_];
@@ -103,23 +145,18 @@ CelestialInformation::~CelestialInformation() {
 
 void CelestialInformation::UpdateAllObjectsInformation(const double current_time_jd) {
   // Convert time
-  SpiceDouble ephemeris_time;
-  std::string julian_date = "jd " + std::to_string(current_time_jd);
-  str2et_c(julian_date.c_str(), &ephemeris_time);
+  SpiceDouble ephemeris_time = ConvertJulianDayToEphemerisTime(current_time_jd);
 
   // Update celestial body orbit
+  if (is_ephemeris_cache_enabled_) UpdateEphemerisCache(ephemeris_time);
   for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
-    SpiceInt planet_id = selected_body_ids_[i];
-
-    // Acquisition of body name from id
-    SpiceBoolean found;
-    const int kMaxNameLength = 100;
-    char name_buffer[kMaxNameLength];
-    bodc2n_c(planet_id, kMaxNameLength, name_buffer, (SpiceBoolean*)&found);
-
     // Acquisition of position and velocity
     SpiceDouble orbit_buffer_km[6];
-    GetPlanetOrbit(name_buffer, ephemeris_time, (SpiceDouble*)orbit_buffer_km);
+    if (is_ephemeris_cache_enabled_) {
+      GetInterpolatedOrbit(i, ephemeris_time, (SpiceDouble*)orbit_buffer_km);
+    } else {
+      GetPlanetOrbit(spice_target_names_[i], ephemeris_time, (SpiceDouble*)orbit_buffer_km);
+    }
     // Convert unit [km], [km/s] to [m], [m/s]
     for (int j = 0; j < 3; j++) {
       celestial_body_position_from_center_i_m_[i * 3 + j] = orbit_buffer_km[j] * 1000.0;
@@ -131,13 +168,88 @@ void CelestialInformation::UpdateAllObjectsInformation(const double current_time
   earth_rotation_->Update(current_time_jd);
 }
 
+void CelestialInformation::SetEphemerisCache(const bool is_enabled, const double node_interval_s) {
+  is_ephemeris_cache_enabled_ = is_enabled;
+  if (node_interval_s > 0.0) ephemeris_cache_interval_s_ = node_interval_s;
+  // Invalidate the nodes
+  ephemeris_cache_start_et_s_ = 0.0;
+  ephemeris_cache_end_et_s_ = -1.0;
+}
+
+double CelestialInformation::ConvertJulianDayToEphemerisTime(const double time_jd) const {
+  const double kJulianDayJ2000 = 2451545.0;
+  const double kSecondsPerDay = 86400.0;
+  // UTC seconds past J2000
+  SpiceDouble utc_s = (time_jd - kJulianDayJ2000) * kSecondsPerDay;
+  // ET - UTC including leap seconds
+  SpiceDouble delta_s;
+  std::lock_guard<std::mutex> spice_lock(GetSpiceMutex());
+  deltet_c(utc_s, "UTC", &delta_s);
+  return utc_s + delta_s;
+}
+
+void CelestialInformation::UpdateEphemerisCache(const double et) {
+  if (ephemeris_cache_start_et_s_ <= et && et <= ephemeris_cache_end_et_s_) return;
+
+  const double start_et_s = floor(et / ephemeris_cache_interval_s_) * ephemeris_cache_interval_s_;
+  const double end_et_s = start_et_s + ephemeris_cache_interval_s_;
+
+  if (start_et_s == ephemeris_cache_end_et_s_) {
+    // Reuse the previous end node as the next start node
+    ephemeris_cache_start_state_km_ = ephemeris_cache_end_state_km_;
+  } else {
+    for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
+      GetPlanetOrbit(spice_target_names_[i], start_et_s, &ephemeris_cache_start_state_km_[i * 6]);
+    }
+  }
+  for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
+    GetPlanetOrbit(spice_target_names_[i], end_et_s, &ephemeris_cache_end_state_km_[i * 6]);
+  }
+
+  ephemeris_cache_start_et_s_ = start_et_s;
+  ephemeris_cache_end_et_s_ = end_et_s;
+}
+
+void CelestialInformation::GetInterpolatedOrbit(const unsigned int body_id, const double et, double orbit[6]) const {
+  // Cubic Hermite interpolation with position and velocity at the nodes
+  const double h = ephemeris_cache_end_et_s_ - ephemeris_cache_start_et_s_;
+  const double s = (et - ephemeris_cache_start_et_s_) / h;
+  const double s2 = s * s;
+  const double s3 = s2 * s;
+
+  const double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+  const double h10 = s3 - 2.0 * s2 + s;
+  const double h01 = -2.0 * s3 + 3.0 * s2;
+  const double h11 = s3 - s2;
+  // Derivatives with respect to s
+  const double dh00 = 6.0 * s2 - 6.0 * s;
+  const double dh10 = 3.0 * s2 - 4.0 * s + 1.0;
+  const double dh01 = -6.0 * s2 + 6.0 * s;
+  const double dh11 = 3.0 * s2 - 2.0 * s;
+
+  const double* start = &ephemeris_cache_start_state_km_[body_id * 6];
+  const double* end = &ephemeris_cache_end_state_km_[body_id * 6];
+  for (int i = 0; i < 3; i++) {
+    orbit[i] = h00 * start[i] + h10 * h * start[i + 3] + h01 * end[i] + h11 * h * end[i + 3];
+    orbit[i + 3] = (dh00 * start[i] + dh01 * end[i]) / h + dh10 * start[i + 3] + dh11 * end[i + 3];
+  }
+}
+
 int CelestialInformation::CalcBodyIdFromName(const char* body_name) const {
+  // Exact match with the names acquired at the construction
+  for (unsigned int i = 0; i < body_names_.size(); i++) {
+    if (body_names_[i] == body_name) return i;
+  }
+
   int index = 0;
   SpiceInt planet_id;
   SpiceBoolean found;
 
   // Acquisition of ID from body name
-  bodn2c_c(body_name, (SpiceInt*)&planet_id, (SpiceBoolean*)&found);
+  {
+    std::lock_guard<std::mutex> spice_lock(GetSpiceMutex());
+    bodn2c_c(body_name, (SpiceInt*)&planet_id, (SpiceBoolean*)&found);
+  }
   for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
     if (selected_body_ids_[i] == planet_id) {
       index = i;
@@ -148,15 +260,9 @@ int CelestialInformation::CalcBodyIdFromName(const char* body_name) const {
 }
 
 std::string CelestialInformation::GetLogHeader() const {
-  SpiceBoolean found;
-  const int kMaxNameLength = 100;
-  char name_buffer[kMaxNameLength];
   std::string str_tmp = "";
   for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
-    SpiceInt planet_id = selected_body_ids_[i];
-    // Acquisition of body name from id
-    bodc2n_c(planet_id, kMaxNameLength, name_buffer, (SpiceBoolean*)&found);
-    std::string name = name_buffer;
+    std::string name = body_names_[i];
 
     std::locale loc = std::locale::classic();
     std::transform(name.begin(), name.end(), name.begin(), [loc](char c) { return std::tolower(c, loc); });
@@ -183,17 +289,24 @@ std::string CelestialInformation::GetLogValue() const {
   return str_tmp;
 }
 
-void CelestialInformation::GetPlanetOrbit(const char* planet_name, const double et, double orbit[6]) {
-  // Add `BARYCENTER` if needed
-  std::string planet_name_string = planet_name;
-  if (strcmp(planet_name, "MARS") == 0 || strcmp(planet_name, "JUPITER") == 0 || strcmp(planet_name, "SATURN") == 0 ||
-      strcmp(planet_name, "URANUS") == 0 || strcmp(planet_name, "NEPTUNE") == 0 || strcmp(planet_name, "PLUTO") == 0) {
-    planet_name_string += "_BARYCENTER";
+bool CelestialInformation::GetLogValueBinary(std::vector<double>& values) const {
+  for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
+    for (int j = 0; j < 3; j++) {
+      AppendScalar(values, celestial_body_position_from_center_i_m_[i * 3 + j]);
+    }
+    for (int j = 0; j < 3; j++) {
+      AppendScalar(values, celestial_body_velocity_from_center_i_m_s_[i * 3 + j]);
+    }
   }
 
+  return true;
+}
+
+void CelestialInformation::GetPlanetOrbit(const std::string& spice_target_name, const double et, double orbit[6]) {
   // Get orbit
   SpiceDouble lt;
-  spkezr_c((ConstSpiceChar*)planet_name_string.c_str(), (SpiceDouble)et, (ConstSpiceChar*)inertial_frame_name_.c_str(),
+  std::lock_guard<std::mutex> spice_lock(GetSpiceMutex());
+  spkezr_c((ConstSpiceChar*)spice_target_name.c_str(), (SpiceDouble)et, (ConstSpiceChar*)inertial_frame_name_.c_str(),
            (ConstSpiceChar*)aberration_correction_setting_.c_str(), (ConstSpiceChar*)center_body_name_.c_str(), (SpiceDouble*)orbit,
            (SpiceDouble*)&lt);
   return;
@@ -7,6 +7,10 @@
 #ifndef S2E_ENVIRONMENT_GLOBAL_CELESTIAL_INFORMATION_HPP_
 #define S2E_ENVIRONMENT_GLOBAL_CELESTIAL_INFORMATION_HPP_
 
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include "celestial_rotation.hpp"
 #include "library/logger/loggable.hpp"
 #include "library/math/vector.hpp"
@@ -52,6 +56,11 @@ class CelestialInformation : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
   /**
    * @fn UpdateAllObjectsInformation
@@ -60,6 +69,16 @@ class CelestialInformation : public ILoggable {
    */
   void UpdateAllObjectsInformation(const double current_time_jd);
 
+  /**
+   * @fn SetEphemerisCache
+   * @brief Set the ephemeris cache setting
+   * @note When the cache is enabled, SPICE is called only at the nodes with the given interval.
+   *       The states between the nodes are interpolated with the cubic Hermite polynomial of the position and the velocity.
+   * @param [in] is_enabled: Enable flag of the ephemeris cache
+   * @param [in] node_interval_s: Time interval of the nodes [sec]
+   */
+  void SetEphemerisCache(const bool is_enabled, const double node_interval_s);
+
   // Getters
   // Orbit information
   /**
@@ -112,13 +131,22 @@ class CelestialInformation : public ILoggable {
    */
   inline double GetGravityConstant_m3_s2(const char* body_name) const {
     int index = CalcBodyIdFromName(body_name);
-    return celestial_body_gravity_constant_m3_s2_[index];
+    return GetGravityConstant_m3_s2(index);
+  }
+  /**
+   * @fn GetGravityConstant_m3_s2
+   * @brief Return gravity constant of the celestial body [m^3/s^2]
+   * @param [in] id: ID of CelestialInformation list
+   */
+  inline double GetGravityConstant_m3_s2(const unsigned int id) const {
+    if (id >= number_of_selected_bodies_) return 0.0;
+    return celestial_body_gravity_constant_m3_s2_[id];
   }
   /**
    * @fn GetCenterBodyGravityConstant_m3_s2
    * @brief Return gravity constant of the center body [m^3/s^2]
    */
-  inline double GetCenterBodyGravityConstant_m3_s2(void) const { return GetGravityConstant_m3_s2(center_body_name_.c_str()); }
+  inline double GetCenterBodyGravityConstant_m3_s2(void) const { return GetGravityConstant_m3_s2(center_body_id_); }
 
   // Shape information
   /**
@@ -148,7 +176,16 @@ class CelestialInformation : public ILoggable {
    */
   inline double GetMeanRadiusFromName_m(const char* body_name) const {
     int index = CalcBodyIdFromName(body_name);
-    return celestial_body_mean_radius_m_[index];
+    return GetMeanRadius_m(index);
+  }
+  /**
+   * @fn GetMeanRadius_m
+   * @brief Return mean radius of a celestial body [m]
+   * @param [in] id: ID of CelestialInformation list
+   */
+  inline double GetMeanRadius_m(const unsigned int id) const {
+    if (id >= number_of_selected_bodies_) return 0.0;
+    return celestial_body_mean_radius_m_[id];
   }
 
   // Parameters
@@ -167,6 +204,17 @@ class CelestialInformation : public ILoggable {
    * @brief Return name of the center body
    */
   inline std::string GetCenterBodyName(void) const { return center_body_name_; }
+  /**
+   * @fn GetCenterBodyId
+   * @brief Return ID of CelestialInformation list for the center body
+   */
+  inline unsigned int GetCenterBodyId(void) const { return center_body_id_; }
+  /**
+   * @fn GetBodyName
+   * @brief Return name of the body defined in the SPICE
+   * @param [in] id: ID of CelestialInformation list
+   */
+  inline const std::string& GetBodyName(const unsigned int id) const { return body_names_[id]; }
 
   // Members
   /**
@@ -179,6 +227,7 @@ class CelestialInformation : public ILoggable {
   /**
    * @fn CalcBodyIdFromName
    * @brief Acquisition of ID of CelestialInformation list from body name
+   * @note The ID is stable during the simulation. Users who access a body at every step should resolve the ID once at the initialization.
    * @param [in] body_name: Celestial body name
    * @return ID of CelestialInformation list
    */
@@ -195,9 +244,13 @@ class CelestialInformation : public ILoggable {
   int* selected_body_ids_;                     //!< SPICE IDs of selected bodies
   std::string inertial_frame_name_;            //!< Definition of inertial frame
   std::string center_body_name_;               //!< Center object name of inertial frame
+  unsigned int center_body_id_ = 0;            //!< ID of CelestialInformation list for the center body
   std::string aberration_correction_setting_;  //!< Stellar aberration correction
                                                //!< Ref：http://fermi.gsfc.nasa.gov/ssc/library/fug/051108/Aberration_Julie.ppt
 
+  std::vector<std::string> body_names_;          //!< Names of selected bodies defined in the SPICE
+  std::vector<std::string> spice_target_names_;  //!< Target names of selected bodies for spkezr_c
+
   // Calculated values
   double* celestial_body_position_from_center_i_m_;    //!< Position vector list at inertial frame [m]
   double* celestial_body_velocity_from_center_i_m_s_;  //!< Velocity vector list at inertial frame [m/s]
@@ -212,15 +265,52 @@ class CelestialInformation : public ILoggable {
   CelestialRotation* earth_rotation_;  //!< Instance of Earth rotation
   RotationMode rotation_mode_;         //!< Designation of rotation model
 
+  // Ephemeris cache
+  bool is_ephemeris_cache_enabled_ = false;             //!< Enable flag of the ephemeris cache
+  double ephemeris_cache_interval_s_ = 3600.0;          //!< Time interval of the cache nodes [sec]
+  double ephemeris_cache_start_et_s_ = 0.0;             //!< Ephemeris time of the start node [sec]
+  double ephemeris_cache_end_et_s_ = -1.0;              //!< Ephemeris time of the end node [sec] (Invalid when smaller than start)
+  std::vector<double> ephemeris_cache_start_state_km_;  //!< Position and velocity list at the start node [km, km/s]
+  std::vector<double> ephemeris_cache_end_state_km_;    //!< Position and velocity list at the end node [km, km/s]
+
+  /**
+   * @fn ConvertJulianDayToEphemerisTime
+   * @brief Convert Julian day in UTC to the SPICE ephemeris time without string parsing
+   * @param [in] time_jd: Julian day in UTC [day]
+   * @return Ephemeris time (TDB seconds past J2000) [sec]
+   */
+  double ConvertJulianDayToEphemerisTime(const double time_jd) const;
+  /**
+   * @fn GetInterpolatedOrbit
+   * @brief Get position/velocity of the selected body with the ephemeris cache
+   * @param [in] body_id: ID of CelestialInformation list
+   * @param [in] et: Ephemeris time
+   * @param [out] orbit: Position [km] and velocity [km/s] relative to the center body
+   */
+  void GetInterpolatedOrbit(const unsigned int body_id, const double et, double orbit[6]) const;
+  /**
+   * @fn UpdateEphemerisCache
+   * @brief Update the cache nodes to include the ephemeris time
+   * @param [in] et: Ephemeris time
+   */
+  void UpdateEphemerisCache(const double et);
+
   /**
    * @fn GetPlanetOrbit
    * @brief Get position/velocity of planet.
    * @note This is an override function of SPICE's spkezr_c (https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/spkezr_c.html)
-   * @param [in] planet_name: Nama of planet defined by SPICE
+   * @param [in] spice_target_name: Target name for spkezr_c (`_BARYCENTER` is added for the outer planets)
    * @param [in] et: Ephemeris time
    * @param [out] orbit: Cartesian state vector representing the position and velocity of the target body relative to the specified observer.
    */
-  void GetPlanetOrbit(const char* planet_name, const double et, double orbit[6]);
+  void GetPlanetOrbit(const std::string& spice_target_name, const double et, double orbit[6]);
 };
 
+/**
+ * @fn GetSpiceMutex
+ * @brief Return the mutex to serialize the CSPICE calls
+ * @note CSPICE is not thread-safe. Lock this mutex during CSPICE calls when simulation cases are executed in multiple threads.
+ */
+std::mutex& GetSpiceMutex();
+
 #endif  // S2E_ENVIRONMENT_GLOBAL_CELESTIAL_INFORMATION_HPP_
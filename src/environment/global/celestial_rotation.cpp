@@ -15,6 +15,7 @@
 #include "library/external/sgp4/sgp4ext.h"   // for jday()
 #include "library/external/sgp4/sgp4unit.h"  // for gstime()
 #include "library/math/constants.hpp"
+#include "physical_constants.hpp"
 
 // Default constructor
 CelestialRotation::CelestialRotation(const RotationMode rotation_mode, const std::string center_body_name) {
@@ -27,6 +28,11 @@ CelestialRotation::CelestialRotation(const RotationMode rotation_mode, const std
   }
 }
 
+double CelestialRotation::GetAngularVelocity_rad_s() const {
+  if (planet_name_ == "EARTH" && rotation_mode_ != RotationMode::kIdle) return environment::earth_mean_angular_velocity_rad_s;
+  return 0.0;
+}
+
 // Initialize the class CelestialRotation instance as Earth
 void CelestialRotation::InitCelestialRotationAsEarth(const RotationMode rotation_mode, const std::string center_body_name) {
   planet_name_ = "EARTH";
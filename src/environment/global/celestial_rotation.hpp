@@ -57,6 +57,11 @@ class CelestialRotation {
    * @brief Return the DCM between TEME (Inertial frame used in SGP4) and the frame of fixed to the target object X (X-Centered X-Fixed)
    */
   inline const libra::Matrix<3, 3> GetDcmTemeToXcxf() const { return dcm_teme_to_xcxf_; };
+  /**
+   * @fn GetAngularVelocity_rad_s
+   * @brief Return the mean angular velocity of the rotation around the Z axis [rad/s]. Zero when the rotation is not calculated.
+   */
+  double GetAngularVelocity_rad_s() const;
 
  private:
   double d_psi_rad_;                       //!< Nutation in obliquity [rad]
@@ -5,30 +5,131 @@
 
 #include "clock_generator.hpp"
 
+#include <algorithm>
+#include <chrono>
+
+// Return the smallest multiple of the prescaler which is equal to or larger than the count
+static unsigned long long NextMultiple(const unsigned long long count, const unsigned int prescaler) {
+  const unsigned long long period = (prescaler > 0) ? prescaler : 1;
+  return (count + period - 1) / period * period;
+}
+
 ClockGenerator::~ClockGenerator() {}
 
-void ClockGenerator::RegisterComponent(ITickable* tickable) { components_.push_back(tickable); }
+void ClockGenerator::RegisterComponent(ITickable* tickable) {
+  if (entry_indices_.count(tickable) > 0) return;
+
+  unsigned int entry_index;
+  if (free_entries_.empty()) {
+    entry_index = (unsigned int)entries_.size();
+    entries_.push_back(ScheduleEntry());
+  } else {
+    entry_index = free_entries_.back();
+    free_entries_.pop_back();
+  }
+  ScheduleEntry& entry = entries_[entry_index];
+  entry = ScheduleEntry();
+  entry.tickable = tickable;
+  entry.sequence = next_sequence_++;
+  // The prescalers and the flags are read at the next tick since the component is still being constructed
+  entry.is_pending = true;
+  entry.position = (unsigned int)pending_entries_.size();
+  entry.main_group = kNoGroup;
+  entry.fast_group = kNoGroup;
+  entry.is_synchronized = false;
+  pending_entries_.push_back(entry_index);
+  entry_indices_[tickable] = entry_index;
+}
 
 void ClockGenerator::RemoveComponent(ITickable* tickable) {
-  for (auto itr = components_.begin(); itr != components_.end();) {
-    if (*itr == tickable) {
-      components_.erase(itr++);
-      break;
-    } else {
-      ++itr;
-    }
+  auto itr = entry_indices_.find(tickable);
+  if (itr == entry_indices_.end()) return;
+  const unsigned int entry_index = itr->second;
+  entry_indices_.erase(itr);
+
+  ScheduleEntry& entry = entries_[entry_index];
+  if (entry.is_pending) {
+    // Move the last entry to the position of the removed entry
+    const unsigned int last_index = pending_entries_.back();
+    pending_entries_[entry.position] = last_index;
+    entries_[last_index].position = entry.position;
+    pending_entries_.pop_back();
+  } else {
+    // The entry is only marked in the groups, since the groups can be ticked now
+    LeaveGroup(entry.main_group, entry.main_position);
+    if (entry.fast_group != kNoGroup) LeaveGroup(entry.fast_group, entry.fast_position);
+  }
+  if (entry.is_synchronized) {
+    synchronized_entries_.erase(std::find(synchronized_entries_.begin(), synchronized_entries_.end(), entry_index));
   }
+  entry.tickable = nullptr;
+  free_entries_.push_back(entry_index);
 }
 
 void ClockGenerator::TickToComponents() {
-  // Update for each component
-  for (auto itr = components_.begin(); itr != components_.end(); ++itr) {
-    // Run MainRoutine
-    (*itr)->Tick(timer_count_);
-    // Run FastUpdate (Processes that are executed more frequently than MainRoutine)
-    if ((*itr)->GetNeedsFastUpdate()) {
-      (*itr)->FastTick(timer_count_);
+  // Schedule the components registered after the previous tick in the registration order
+  if (!pending_entries_.empty()) {
+    std::sort(pending_entries_.begin(), pending_entries_.end(),
+              [this](const unsigned int a, const unsigned int b) { return entries_[a].sequence < entries_[b].sequence; });
+    for (auto entry_index : pending_entries_) {
+      Schedule(entry_index);
+    }
+    pending_entries_.clear();
+  }
+
+  // Synchronize the processes executed in other threads
+  for (size_t i = 0; i < synchronized_entries_.size(); i++) {
+    entries_[synchronized_entries_[i]].tickable->BeginTick((unsigned int)timer_count_);
+  }
+
+  // Take the due groups out of the bucket. The groups for the later rounds of the wheel are kept.
+  std::vector<unsigned int>& bucket = buckets_[timer_count_ % kNumberOfBuckets];
+  for (size_t i = 0; i < bucket.size();) {
+    if (groups_[bucket[i]].next_tick == timer_count_) {
+      due_groups_.push_back(bucket[i]);
+      bucket[i] = bucket.back();
+      bucket.pop_back();
+    } else {
+      i++;
+    }
+  }
+
+  // Update for each component in the registration order by merging the due groups
+  for (auto group_index : due_groups_) {
+    groups_[group_index].cursor = 0;
+  }
+  while (true) {
+    unsigned int next_group_index = kNoGroup;
+    unsigned long long next_sequence = 0;
+    for (auto group_index : due_groups_) {
+      RateGroup& group = groups_[group_index];
+      while (group.cursor < group.members.size() && group.members[group.cursor] == kRemovedEntry) group.cursor++;
+      if (group.cursor == group.members.size()) continue;
+      const unsigned long long sequence = entries_[group.members[group.cursor]].sequence;
+      // Tick is called before FastTick for the same component
+      if (next_group_index == kNoGroup || sequence < next_sequence || (sequence == next_sequence && !group.is_fast)) {
+        next_group_index = group_index;
+        next_sequence = sequence;
+      }
     }
+    if (next_group_index == kNoGroup) break;
+
+    RateGroup& next_group = groups_[next_group_index];
+    const unsigned int entry_index = next_group.members[next_group.cursor++];
+    Invoke(entry_index, next_group.is_fast);
+  }
+
+  // Put the due groups in the buckets of their next due counts
+  for (auto group_index : due_groups_) {
+    CompactGroup(group_index);
+    RateGroup& group = groups_[group_index];
+    group.next_tick += group.prescaler;
+    buckets_[group.next_tick % kNumberOfBuckets].push_back(group_index);
+  }
+  due_groups_.clear();
+
+  for (size_t i = 0; i < synchronized_entries_.size(); i++) {
+    entries_[synchronized_entries_[i]].tickable->EndTick((unsigned int)timer_count_);
   }
   timer_count_++;  // TODO: Consider if "timer_count" is necessary
 }
@@ -38,3 +139,114 @@ void ClockGenerator::UpdateComponents(const SimulationTime* simulation_time) {
     TickToComponents();
   }
 }
+
+void ClockGenerator::ClearTimerCount(void) {
+  timer_count_ = 0;
+  // All groups are due at the count zero
+  for (unsigned int i = 0; i < kNumberOfBuckets; i++) {
+    buckets_[i].clear();
+  }
+  for (unsigned int group_index = 0; group_index < groups_.size(); group_index++) {
+    groups_[group_index].next_tick = 0;
+    buckets_[0].push_back(group_index);
+  }
+}
+
+TickStatistics ClockGenerator::GetTickStatistics(const ITickable* tickable) const {
+  auto itr = entry_indices_.find(tickable);
+  if (itr == entry_indices_.end()) return TickStatistics();
+  return entries_[itr->second].statistics;
+}
+
+void ClockGenerator::Schedule(const unsigned int entry_index) {
+  ITickable* tickable = entries_[entry_index].tickable;
+  unsigned int position;
+  const unsigned int main_group = JoinGroup(entry_index, tickable->GetPrescaler(), false, position);
+
+  ScheduleEntry& entry = entries_[entry_index];
+  entry.is_pending = false;
+  entry.main_group = main_group;
+  entry.main_position = position;
+  if (tickable->GetNeedsFastUpdate()) {
+    entry.fast_group = JoinGroup(entry_index, tickable->GetFastPrescaler(), true, position);
+    entry.fast_position = position;
+  }
+  // The pending entries are the latest registered ones, so the list is kept in the registration order
+  if (tickable->GetNeedsTickSynchronization()) {
+    entry.is_synchronized = true;
+    synchronized_entries_.push_back(entry_index);
+  }
+}
+
+unsigned int ClockGenerator::JoinGroup(const unsigned int entry_index, const unsigned int prescaler, const bool is_fast, unsigned int& position) {
+  const unsigned int period = (prescaler > 0) ? prescaler : 1;
+  unsigned int group_index = 0;
+  while (group_index < groups_.size() && (groups_[group_index].prescaler != period || groups_[group_index].is_fast != is_fast)) {
+    group_index++;
+  }
+  if (group_index == groups_.size()) {
+    RateGroup group;
+    group.prescaler = period;
+    group.is_fast = is_fast;
+    group.next_tick = NextMultiple(timer_count_, period);
+    group.removed_count = 0;
+    group.cursor = 0;
+    groups_.push_back(group);
+    buckets_[group.next_tick % kNumberOfBuckets].push_back(group_index);
+  }
+
+  // The new entry has the latest registration order
+  RateGroup& group = groups_[group_index];
+  position = (unsigned int)group.members.size();
+  group.members.push_back(entry_index);
+  return group_index;
+}
+
+void ClockGenerator::LeaveGroup(const unsigned int group_index, const unsigned int position) {
+  groups_[group_index].members[position] = kRemovedEntry;
+  groups_[group_index].removed_count++;
+}
+
+void ClockGenerator::CompactGroup(const unsigned int group_index) {
+  RateGroup& group = groups_[group_index];
+  if (group.removed_count * 2 <= group.members.size()) return;
+
+  unsigned int position = 0;
+  for (auto entry_index : group.members) {
+    if (entry_index == kRemovedEntry) continue;
+    if (group.is_fast) {
+      entries_[entry_index].fast_position = position;
+    } else {
+      entries_[entry_index].main_position = position;
+    }
+    group.members[position] = entry_index;
+    position++;
+  }
+  group.members.resize(position);
+  group.removed_count = 0;
+}
+
+void ClockGenerator::Invoke(const unsigned int entry_index, const bool is_fast) {
+  ITickable* tickable = entries_[entry_index].tickable;
+  if (is_fast && !tickable->GetNeedsFastUpdate()) return;
+
+  std::chrono::steady_clock::time_point start;
+  if (is_profiling_enabled_) start = std::chrono::steady_clock::now();
+  if (is_fast) {
+    // Run FastUpdate (Processes that are executed more frequently than MainRoutine)
+    tickable->FastTick((unsigned int)timer_count_);
+  } else {
+    // Run MainRoutine
+    tickable->Tick((unsigned int)timer_count_);
+  }
+
+  // The component can be removed in the tick, and the entries can be reallocated by the registration in the tick
+  ScheduleEntry& entry = entries_[entry_index];
+  if (entry.tickable != tickable || entry.is_pending) return;
+  if (is_fast) {
+    entry.statistics.fast_tick_count++;
+  } else {
+    entry.statistics.tick_count++;
+  }
+  if (is_profiling_enabled_) entry.statistics.elapsed_time_s += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
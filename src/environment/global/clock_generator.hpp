@@ -7,13 +7,29 @@
 #define S2E_ENVIRONMENT_GLOBAL_CLOCK_GENERATOR_HPP_
 
 #include <components/base/interface_tickable.hpp>
+#include <unordered_map>
 #include <vector>
 
 #include "simulation_time.hpp"
 
+/**
+ * @struct TickStatistics
+ * @brief Invocation statistics of a component
+ */
+struct TickStatistics {
+  unsigned long long tick_count = 0;       //!< Number of Tick calls
+  unsigned long long fast_tick_count = 0;  //!< Number of FastTick calls
+  double elapsed_time_s = 0.0;             //!< Wall-clock time spent in Tick and FastTick [s] (measured only when the profiling is enabled)
+};
+
 /**
  * @class ClockGenerator
  * @brief Class to generate clock for classes which have ITickable
+ * @details The components with the same prescaler make a rate group, and the rate groups are scheduled on a timing wheel by their next due
+ *          count, so each tick visits only the due components. The components with the fast update flag also join the rate group of the
+ *          fast prescaler. The due components are ticked in the registration order, and FastTick follows Tick for the same component.
+ *          The prescalers and the flags of a component are read at the first tick after the registration. Registration and removal take
+ *          constant time.
  */
 class ClockGenerator {
  public:
@@ -26,6 +42,7 @@ class ClockGenerator {
   /**
    * @fn RegisterComponent
    * @brief Register component which has ITickable
+   * @note The component is scheduled at the next TickToComponents, after the construction of the component is completed.
    * @param [in] tickable: Component class
    */
   void RegisterComponent(ITickable* tickable);
@@ -37,7 +54,7 @@ class ClockGenerator {
   void RemoveComponent(ITickable* tickable);
   /**
    * @fn TickToComponents
-   * @brief Execute tick function of all registered components
+   * @brief Execute tick function of the registered components due at the current timer count
    */
   void TickToComponents();
   /**
@@ -48,13 +65,110 @@ class ClockGenerator {
   void UpdateComponents(const SimulationTime* simulation_time);
   /**
    * @fn ClearTimerCount
-   * @brief Clear time count
+   * @brief Clear time count and reschedule all components
    */
-  inline void ClearTimerCount(void) { timer_count_ = 0; }
+  void ClearTimerCount(void);
+
+  /**
+   * @fn SetIsProfilingEnabled
+   * @brief Enable the measurement of the time spent in each component
+   */
+  inline void SetIsProfilingEnabled(const bool is_profiling_enabled) { is_profiling_enabled_ = is_profiling_enabled; }
+  /**
+   * @fn GetTickStatistics
+   * @brief Return the invocation statistics of the component
+   * @param [in] tickable: Registered component class
+   * @return Statistics. All values are zero when the component is not registered.
+   */
+  TickStatistics GetTickStatistics(const ITickable* tickable) const;
+  /**
+   * @fn GetNumberOfComponents
+   * @brief Return the number of the registered components
+   */
+  inline size_t GetNumberOfComponents() const { return entry_indices_.size(); }
 
  private:
-  std::vector<ITickable*> components_;  //!< Component list fot tick
-  unsigned int timer_count_;            //!< Timer count TODO: change to long?
+  /**
+   * @struct ScheduleEntry
+   * @brief Schedule of a registered component
+   */
+  struct ScheduleEntry {
+    ITickable* tickable;          //!< Component
+    unsigned long long sequence;  //!< Registration order
+    bool is_pending;              //!< Whether or not the entry waits for the first tick after the registration
+    unsigned int position;        //!< Position in the pending list
+    unsigned int main_group;      //!< Rate group to call Tick
+    unsigned int main_position;   //!< Position in the rate group to call Tick
+    unsigned int fast_group;      //!< Rate group to call FastTick, or kNoGroup
+    unsigned int fast_position;   //!< Position in the rate group to call FastTick
+    bool is_synchronized;         //!< Whether or not the entry is in the synchronized list
+    TickStatistics statistics;    //!< Invocation statistics
+  };
+  /**
+   * @struct RateGroup
+   * @brief Components called at the same timer counts
+   */
+  struct RateGroup {
+    unsigned int prescaler;             //!< Frequency scale factor
+    bool is_fast;                       //!< Whether or not the group calls FastTick
+    unsigned long long next_tick;       //!< Next due timer count
+    std::vector<unsigned int> members;  //!< Entry indices in the registration order. Removed entries are kRemovedEntry.
+    unsigned int removed_count;         //!< Number of removed entries in the members
+    unsigned int cursor;                //!< Position of the next member to be ticked in the current tick
+  };
+
+  static const unsigned int kNumberOfBuckets = 256;      //!< Number of the buckets of the timing wheel
+  static const unsigned int kNoGroup = 0xFFFFFFFF;       //!< Group value of the entries without the fast update
+  static const unsigned int kRemovedEntry = 0xFFFFFFFF;  //!< Member value of the removed entries
+
+  unsigned long long timer_count_ = 0;                                //!< Timer count. The components receive the lower 32 bits.
+  bool is_profiling_enabled_ = false;                                 //!< Whether or not the time spent in each component is measured
+  unsigned long long next_sequence_ = 0;                              //!< Registration order of the next component
+  std::vector<ScheduleEntry> entries_;                                //!< Schedule entries
+  std::vector<unsigned int> free_entries_;                            //!< Indices of the unused entries
+  std::unordered_map<const ITickable*, unsigned int> entry_indices_;  //!< Entry index of each component
+  std::vector<RateGroup> groups_;                                     //!< Rate groups
+  std::vector<unsigned int> buckets_[kNumberOfBuckets];               //!< Timing wheel. Groups due at count t are in the bucket t % kNumberOfBuckets
+  std::vector<unsigned int> pending_entries_;                         //!< Entries registered and not scheduled yet
+  std::vector<unsigned int> due_groups_;                              //!< Groups due at the current timer count
+  std::vector<unsigned int> synchronized_entries_;                    //!< Entries which need BeginTick and EndTick in the registration order
+
+  /**
+   * @fn Schedule
+   * @brief Add the pending entry to the rate groups
+   * @param [in] entry_index: Entry index
+   */
+  void Schedule(const unsigned int entry_index);
+  /**
+   * @fn JoinGroup
+   * @brief Add the entry at the end of the rate group. The group is created when it does not exist.
+   * @param [in] entry_index: Entry index
+   * @param [in] prescaler: Frequency scale factor of the group
+   * @param [in] is_fast: Whether or not the group calls FastTick
+   * @param [out] position: Position in the group
+   * @return Group index
+   */
+  unsigned int JoinGroup(const unsigned int entry_index, const unsigned int prescaler, const bool is_fast, unsigned int& position);
+  /**
+   * @fn LeaveGroup
+   * @brief Mark the entry removed in the rate group
+   * @param [in] group_index: Group index
+   * @param [in] position: Position in the group
+   */
+  void LeaveGroup(const unsigned int group_index, const unsigned int position);
+  /**
+   * @fn CompactGroup
+   * @brief Erase the removed entries in the rate group when they are more than half of the members
+   * @param [in] group_index: Group index
+   */
+  void CompactGroup(const unsigned int group_index);
+  /**
+   * @fn Invoke
+   * @brief Call Tick or FastTick of the entry
+   * @param [in] entry_index: Entry index
+   * @param [in] is_fast: Call FastTick when true
+   */
+  void Invoke(const unsigned int entry_index, const bool is_fast);
 };
 
 #endif  // S2E_ENVIRONMENT_GLOBAL_CLOCK_GENERATOR_HPP_
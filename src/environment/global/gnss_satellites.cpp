@@ -6,6 +6,7 @@
 #include "gnss_satellites.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <sstream>
 #include <vector>
@@ -35,6 +36,44 @@ const int all_sat_num_ = gps_sat_num_ + glonass_sat_num_ + galileo_sat_num_ + be
 
 using namespace std;
 
+unsigned int GetGnssConstellationBit(const char constellation) {
+  switch (constellation) {
+    case 'G':
+      return 0x01;
+    case 'R':
+      return 0x02;
+    case 'E':
+      return 0x04;
+    case 'C':
+      return 0x08;
+    case 'J':
+      return 0x10;
+    default:
+      return 0;
+  }
+}
+
+std::vector<double> CalcGnssBinaryFileFingerprint(const std::string& source) {
+  // FNV-1a hash. The 32 bit values are exactly stored in double.
+  uint64_t hash = 14695981039346656037ULL;
+  for (const char c : source) {
+    hash ^= (uint8_t)c;
+    hash *= 1099511628211ULL;
+  }
+  return {(double)(hash >> 32), (double)(hash & 0xFFFFFFFFULL)};
+}
+
+bool IsGnssBinaryFileMatched(const std::string& binary_file_path, const std::string& source) {
+  if (binary_file_path.empty()) return false;
+  TimeSeriesTableFile binary_file;
+  if (!binary_file.Open(binary_file_path)) return false;
+
+  const vector<double>& parameters = binary_file.GetParameters();
+  const vector<double> fingerprint = CalcGnssBinaryFileFingerprint(source);
+  if (parameters.size() < fingerprint.size()) return false;
+  return std::equal(fingerprint.begin(), fingerprint.end(), parameters.end() - fingerprint.size());
+}
+
 /**
  * @fn initilized_tm
  * @brief Initialize time as calendar expression
@@ -81,77 +120,85 @@ double get_unixtime_from_timestamp_line(std::vector<string>& s) {
   return unix_time;
 }
 
-template <size_t N>
-libra::Vector<N> GnssSat_coordinate::TrigonometricInterpolation(const vector<double>& time_vector, const vector<libra::Vector<N>>& values,
-                                                                double time) const {
-  int n = time_vector.size();
-  double w = libra::tau / (24.0 * 60.0 * 60.0) * 1.03;  // coefficient of a day long
-  libra::Vector<N> res(0.0);
+void GnssSat_coordinate::SetInterpolationWindow(const int gnss_satellite_id, const int index) {
+  // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
+  int first_index = std::max(index - interpolation_number_ / 2, 0);
+  int end_index = std::min(index + (interpolation_number_ + 1) / 2, (int)unixtime_vector_.at(gnss_satellite_id).size());
+  window_first_index_.at(gnss_satellite_id) = first_index;
+  window_size_.at(gnss_satellite_id) = std::max(end_index - first_index, 0);
+}
+
+double GnssSat_coordinate::GetInterpolationWindowLength(const int gnss_satellite_id) const {
+  const vector<double>& time_vector = unixtime_vector_.at(gnss_satellite_id);
+  int first_index = window_first_index_.at(gnss_satellite_id);
+  return time_vector.at(first_index + window_size_.at(gnss_satellite_id) - 1) - time_vector.at(first_index);
+}
 
+bool GnssSat_coordinate::IsSameWindowEpochs(const int gnss_satellite_id) const {
+  int n = window_size_.at(gnss_satellite_id);
+  if ((int)weights_epochs_.size() != n) return false;
+  const double* time_vector = &unixtime_vector_.at(gnss_satellite_id).at(window_first_index_.at(gnss_satellite_id));
   for (int i = 0; i < n; ++i) {
-    double t_k = 1.0;
-    for (int j = 0; j < n; ++j) {
-      if (i == j) continue;
-      t_k *= sin(w * (time - time_vector.at(j)) / 2.0) / sin(w * (time_vector.at(i) - time_vector.at(j)) / 2.0);
-    }
-    for (int j = 0; j < (int)N; ++j) {
-      res(j) += t_k * values.at(i)(j);
-    }
+    if (time_vector[i] != weights_epochs_[i]) return false;
   }
-
-  return res;
+  return true;
 }
 
-double GnssSat_coordinate::TrigonometricInterpolation(const vector<double>& time_vector, const vector<double>& values, double time) const {
-  int n = time_vector.size();
-  double w = libra::tau / (24.0 * 60.0 * 60.0) * 1.03;  // coefficient of a day long
-  double res = 0.0;
+const vector<double>& GnssSat_coordinate::CalcTrigonometricWeights(const int gnss_satellite_id, const double time) {
+  int n = window_size_.at(gnss_satellite_id);
+  bool is_same_epochs = is_trigonometric_weights_ && IsSameWindowEpochs(gnss_satellite_id);
+  if (is_same_epochs && time == weights_time_) return weights_;
 
-  for (int i = 0; i < n; ++i) {
-    double t_k = 1.0;
-    for (int j = 0; j < n; ++j) {
-      if (i == j) continue;
-      t_k *= sin(w * (time - time_vector.at(j)) / 2.0) / sin(w * (time_vector.at(i) - time_vector.at(j)) / 2.0);
+  double w = libra::tau / (24.0 * 60.0 * 60.0) * 1.03;  // coefficient of a day long
+  const double* time_vector = &unixtime_vector_.at(gnss_satellite_id).at(window_first_index_.at(gnss_satellite_id));
+  if (!is_same_epochs) {
+    weights_epochs_.assign(time_vector, time_vector + n);
+    sin_epochs_difference_.resize(n * n);
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        sin_epochs_difference_[i * n + j] = sin(w * (time_vector[i] - time_vector[j]) / 2.0);
+      }
     }
-    res += t_k * values.at(i);
+  }
+  sin_time_difference_.resize(n);
+  for (int j = 0; j < n; ++j) {
+    sin_time_difference_[j] = sin(w * (time - time_vector[j]) / 2.0);
   }
 
-  return res;
-}
-
-template <size_t N>
-libra::Vector<N> GnssSat_coordinate::LagrangeInterpolation(const vector<double>& time_vector, const vector<libra::Vector<N>>& values,
-                                                           double time) const {
-  int n = time_vector.size();
-  libra::Vector<N> res(0.0);
-
+  weights_.resize(n);
   for (int i = 0; i < n; ++i) {
-    double l_i = 1.0;
+    double t_k = 1.0;
     for (int j = 0; j < n; ++j) {
       if (i == j) continue;
-      l_i *= (time - time_vector.at(j)) / (time_vector.at(i) - time_vector.at(j));
-    }
-    for (int j = 0; j < N; ++j) {
-      res(j) += l_i * values.at(i)(j);
+      t_k *= sin_time_difference_[j] / sin_epochs_difference_[i * n + j];
     }
+    weights_[i] = t_k;
   }
+  is_trigonometric_weights_ = true;
+  weights_time_ = time;
 
-  return res;
+  return weights_;
 }
 
-double GnssSat_coordinate::LagrangeInterpolation(const vector<double>& time_vector, const vector<double>& values, double time) const {
-  int n = time_vector.size();
-  double res = 0.0;
+const vector<double>& GnssSat_coordinate::CalcLagrangeWeights(const int gnss_satellite_id, const double time) {
+  int n = window_size_.at(gnss_satellite_id);
+  if (!is_trigonometric_weights_ && time == weights_time_ && IsSameWindowEpochs(gnss_satellite_id)) return weights_;
+
+  const double* time_vector = &unixtime_vector_.at(gnss_satellite_id).at(window_first_index_.at(gnss_satellite_id));
+  weights_epochs_.assign(time_vector, time_vector + n);
+  weights_.resize(n);
   for (int i = 0; i < n; ++i) {
     double l_i = 1.0;
     for (int j = 0; j < n; ++j) {
       if (i == j) continue;
-      l_i *= (time - time_vector.at(j)) / (time_vector.at(i) - time_vector.at(j));
+      l_i *= (time - time_vector[j]) / (time_vector[i] - time_vector[j]);
     }
-    res += values.at(i) * l_i;
+    weights_[i] = l_i;
   }
+  is_trigonometric_weights_ = false;
+  weights_time_ = time;
 
-  return res;
+  return weights_;
 }
 
 int GnssSat_coordinate::GetIndexFromID(string sat_num) const {
@@ -357,6 +404,60 @@ pair<double, double> GnssSat_position::Init(vector<vector<string>>& file, int in
   return make_pair(start_unix_time, end_unix_time);
 }
 
+pair<double, double> GnssSat_position::InitWithBinaryFile(const string binary_file_path, int interpolation_number, const string& source) {
+  interpolation_number_ = interpolation_number;
+
+  // Parameters: time interval, start unix time, end unix time, fingerprint of the source
+  if (!IsGnssBinaryFileMatched(binary_file_path, source) || !binary_file_.Open(binary_file_path) ||
+      (int)binary_file_.GetNumberOfObjects() != all_sat_num_ || binary_file_.GetNumberOfArrays() != 6 || binary_file_.GetParameters().size() != 5) {
+    cout << "gnss binary file: " << binary_file_path << " is invalid" << endl;
+    exit(1);
+  }
+  time_interval_ = binary_file_.GetParameters().at(0);
+
+  gnss_sat_table_ecef_.resize(all_sat_num_);
+  gnss_sat_table_eci_.resize(all_sat_num_);
+  unixtime_vector_.resize(all_sat_num_);
+
+  return make_pair(binary_file_.GetParameters().at(1), binary_file_.GetParameters().at(2));
+}
+
+bool GnssSat_position::WriteBinaryFile(const string binary_file_path, const pair<double, double> unix_time_period, const string& source) const {
+  // Arrays: ECEF x, y, z, ECI x, y, z [m]
+  vector<vector<vector<double>>> values(all_sat_num_, vector<vector<double>>(6));
+  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
+    for (size_t i = 0; i < unixtime_vector_.at(gnss_satellite_id).size(); ++i) {
+      for (size_t j = 0; j < 3; ++j) {
+        values[gnss_satellite_id][j].push_back(gnss_sat_table_ecef_.at(gnss_satellite_id).at(i)[j]);
+        values[gnss_satellite_id][j + 3].push_back(gnss_sat_table_eci_.at(gnss_satellite_id).at(i)[j]);
+      }
+    }
+  }
+  vector<double> parameters = {time_interval_, unix_time_period.first, unix_time_period.second};
+  const vector<double> fingerprint = CalcGnssBinaryFileFingerprint(source);
+  parameters.insert(parameters.end(), fingerprint.begin(), fingerprint.end());
+  return TimeSeriesTableFile::Write(binary_file_path, parameters, unixtime_vector_, values);
+}
+
+void GnssSat_position::LoadTimeWindow(const double start_unix_time, const double end_unix_time) {
+  if (!binary_file_.IsOpened()) return;
+
+  vector<vector<double>> values;
+  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
+    binary_file_.ReadWindow(gnss_satellite_id, start_unix_time, end_unix_time, GetNumberOfMarginRecords(), unixtime_vector_.at(gnss_satellite_id),
+                            values);
+    const size_t number_of_records = unixtime_vector_.at(gnss_satellite_id).size();
+    gnss_sat_table_ecef_.at(gnss_satellite_id).assign(number_of_records, libra::Vector<3>(0.0));
+    gnss_sat_table_eci_.at(gnss_satellite_id).assign(number_of_records, libra::Vector<3>(0.0));
+    for (size_t i = 0; i < number_of_records; ++i) {
+      for (size_t j = 0; j < 3; ++j) {
+        gnss_sat_table_ecef_.at(gnss_satellite_id).at(i)[j] = values[j][i];
+        gnss_sat_table_eci_.at(gnss_satellite_id).at(i)[j] = values[j + 3][i];
+      }
+    }
+  }
+}
+
 void GnssSat_position::SetUp(const double start_unix_time, const double step_sec) {
   step_sec_ = step_sec;
 
@@ -365,10 +466,9 @@ void GnssSat_position::SetUp(const double start_unix_time, const double step_sec
   validate_.assign(all_sat_num_, false);
 
   nearest_index_.resize(all_sat_num_);
-  time_period_.resize(all_sat_num_);
-
-  ecef_.resize(all_sat_num_);
-  eci_.resize(all_sat_num_);
+  window_first_index_.assign(all_sat_num_, 0);
+  window_size_.assign(all_sat_num_, 0);
+  weights_epochs_.clear();
 
   for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
     if (unixtime_vector_.at(gnss_satellite_id).empty()) {
@@ -396,21 +496,13 @@ void GnssSat_position::SetUp(const double start_unix_time, const double step_sec
       continue;
     }
 
-    // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
-    for (int j = -interpolation_number_ / 2; j < (interpolation_number_ + 1) / 2; ++j) {
-      int now_index = index + j;
-      if (now_index < 0 || now_index >= (int)unixtime_vector_.at(gnss_satellite_id).size()) continue;
-
-      time_period_.at(gnss_satellite_id).push_back(unixtime_vector_.at(gnss_satellite_id).at(now_index));
-      ecef_.at(gnss_satellite_id).push_back(gnss_sat_table_ecef_.at(gnss_satellite_id).at(now_index));
-      eci_.at(gnss_satellite_id).push_back(gnss_sat_table_eci_.at(gnss_satellite_id).at(now_index));
-    }
-    if ((int)time_period_.at(gnss_satellite_id).size() != interpolation_number_) {
+    SetInterpolationWindow(gnss_satellite_id, index);
+    if (window_size_.at(gnss_satellite_id) != interpolation_number_) {
       validate_.at(gnss_satellite_id) = false;
       continue;
     }
 
-    double time_period_length = time_period_.at(gnss_satellite_id).back() - time_period_.at(gnss_satellite_id).front();
+    double time_period_length = GetInterpolationWindowLength(gnss_satellite_id);
     if (time_period_length > time_interval_ * (interpolation_number_ - 1 + 3) + 1e-4) {  // allow for 3 missing
       validate_.at(gnss_satellite_id) = false;
       continue;
@@ -422,10 +514,7 @@ void GnssSat_position::SetUp(const double start_unix_time, const double step_sec
       gnss_sat_ecef_.at(gnss_satellite_id) = gnss_sat_table_ecef_.at(gnss_satellite_id).at(index);
       gnss_sat_eci_.at(gnss_satellite_id) = gnss_sat_table_eci_.at(gnss_satellite_id).at(index);
     } else {
-      gnss_sat_ecef_.at(gnss_satellite_id) =
-          TrigonometricInterpolation(time_period_.at(gnss_satellite_id), ecef_.at(gnss_satellite_id), start_unix_time);
-      gnss_sat_eci_.at(gnss_satellite_id) =
-          TrigonometricInterpolation(time_period_.at(gnss_satellite_id), eci_.at(gnss_satellite_id), start_unix_time);
+      InterpolatePosition(gnss_satellite_id, start_unix_time);
     }
   }
 }
@@ -451,19 +540,7 @@ void GnssSat_position::Update(const double now_unix_time) {
         ++index;
         nearest_index_.at(gnss_satellite_id) = index;
 
-        time_period_.at(gnss_satellite_id).clear();
-        ecef_.at(gnss_satellite_id).clear();
-        eci_.at(gnss_satellite_id).clear();
-
-        // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
-        for (int j = -interpolation_number_ / 2; j < (interpolation_number_ + 1) / 2; ++j) {
-          int now_index = index + j;
-          if (now_index < 0 || now_index >= (int)unixtime_vector_.at(gnss_satellite_id).size()) continue;
-
-          time_period_.at(gnss_satellite_id).push_back(unixtime_vector_.at(gnss_satellite_id).at(now_index));
-          ecef_.at(gnss_satellite_id).push_back(gnss_sat_table_ecef_.at(gnss_satellite_id).at(now_index));
-          eci_.at(gnss_satellite_id).push_back(gnss_sat_table_eci_.at(gnss_satellite_id).at(now_index));
-        }
+        SetInterpolationWindow(gnss_satellite_id, index);
       }
     }
     double nearest_unix_time = unixtime_vector_.at(gnss_satellite_id).at(index);
@@ -472,12 +549,12 @@ void GnssSat_position::Update(const double now_unix_time) {
       continue;
     }
 
-    if ((int)time_period_.at(gnss_satellite_id).size() != interpolation_number_) {
+    if (window_size_.at(gnss_satellite_id) != interpolation_number_) {
       validate_.at(gnss_satellite_id) = false;
       continue;
     }
 
-    double time_period_length = time_period_.at(gnss_satellite_id).back() - time_period_.at(gnss_satellite_id).front();
+    double time_period_length = GetInterpolationWindowLength(gnss_satellite_id);
     if (time_period_length > time_interval_ * (interpolation_number_ - 1 + 3) + 1e-4) {  // allow for 3 missing
       validate_.at(gnss_satellite_id) = false;
       continue;
@@ -489,13 +566,29 @@ void GnssSat_position::Update(const double now_unix_time) {
       gnss_sat_ecef_.at(gnss_satellite_id) = gnss_sat_table_ecef_.at(gnss_satellite_id).at(index);
       gnss_sat_eci_.at(gnss_satellite_id) = gnss_sat_table_eci_.at(gnss_satellite_id).at(index);
     } else {
-      gnss_sat_ecef_.at(gnss_satellite_id) =
-          TrigonometricInterpolation(time_period_.at(gnss_satellite_id), ecef_.at(gnss_satellite_id), now_unix_time);
-      gnss_sat_eci_.at(gnss_satellite_id) = TrigonometricInterpolation(time_period_.at(gnss_satellite_id), eci_.at(gnss_satellite_id), now_unix_time);
+      InterpolatePosition(gnss_satellite_id, now_unix_time);
     }
   }
 }
 
+void GnssSat_position::InterpolatePosition(const int gnss_satellite_id, const double time) {
+  const vector<double>& weights = CalcTrigonometricWeights(gnss_satellite_id, time);
+  const libra::Vector<3>* ecef = &gnss_sat_table_ecef_.at(gnss_satellite_id).at(window_first_index_.at(gnss_satellite_id));
+  const libra::Vector<3>* eci = &gnss_sat_table_eci_.at(gnss_satellite_id).at(window_first_index_.at(gnss_satellite_id));
+
+  // ECEF and ECI positions are interpolated with the same weights
+  libra::Vector<3> ecef_position(0.0);
+  libra::Vector<3> eci_position(0.0);
+  for (size_t i = 0; i < weights.size(); ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      ecef_position[j] += weights[i] * ecef[i][j];
+      eci_position[j] += weights[i] * eci[i][j];
+    }
+  }
+  gnss_sat_ecef_.at(gnss_satellite_id) = ecef_position;
+  gnss_sat_eci_.at(gnss_satellite_id) = eci_position;
+}
+
 libra::Vector<3> GnssSat_position::GetSatEcef(int gnss_satellite_id) const {
   if (gnss_satellite_id >= all_sat_num_) return libra::Vector<3>(0.0);
   return gnss_sat_ecef_.at(gnss_satellite_id);
@@ -656,6 +749,43 @@ void GnssSat_clock::Init(vector<vector<string>>& file, string file_extension, in
   }
 }
 
+void GnssSat_clock::InitWithBinaryFile(const string binary_file_path, int interpolation_number, const string& source) {
+  interpolation_number_ = interpolation_number;
+
+  // Parameters: time interval, fingerprint of the source
+  if (!IsGnssBinaryFileMatched(binary_file_path, source) || !binary_file_.Open(binary_file_path) ||
+      (int)binary_file_.GetNumberOfObjects() != all_sat_num_ || binary_file_.GetNumberOfArrays() != 1 || binary_file_.GetParameters().size() != 3) {
+    cout << "gnss binary file: " << binary_file_path << " is invalid" << endl;
+    exit(1);
+  }
+  time_interval_ = binary_file_.GetParameters().at(0);
+
+  gnss_sat_clock_table_.resize(all_sat_num_);
+  unixtime_vector_.resize(all_sat_num_);
+}
+
+bool GnssSat_clock::WriteBinaryFile(const string binary_file_path, const string& source) const {
+  vector<vector<vector<double>>> values(all_sat_num_, vector<vector<double>>(1));
+  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
+    values[gnss_satellite_id][0] = gnss_sat_clock_table_.at(gnss_satellite_id);
+  }
+  vector<double> parameters = {time_interval_};
+  const vector<double> fingerprint = CalcGnssBinaryFileFingerprint(source);
+  parameters.insert(parameters.end(), fingerprint.begin(), fingerprint.end());
+  return TimeSeriesTableFile::Write(binary_file_path, parameters, unixtime_vector_, values);
+}
+
+void GnssSat_clock::LoadTimeWindow(const double start_unix_time, const double end_unix_time) {
+  if (!binary_file_.IsOpened()) return;
+
+  vector<vector<double>> values;
+  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
+    binary_file_.ReadWindow(gnss_satellite_id, start_unix_time, end_unix_time, GetNumberOfMarginRecords(), unixtime_vector_.at(gnss_satellite_id),
+                            values);
+    gnss_sat_clock_table_.at(gnss_satellite_id) = values[0];
+  }
+}
+
 void GnssSat_clock::SetUp(const double start_unix_time, const double step_sec) {
   step_sec_ = step_sec;
 
@@ -663,9 +793,9 @@ void GnssSat_clock::SetUp(const double start_unix_time, const double step_sec) {
   validate_.assign(all_sat_num_, false);
 
   nearest_index_.resize(all_sat_num_);
-  time_period_.resize(all_sat_num_);
-
-  clock_bias_.resize(all_sat_num_);
+  window_first_index_.assign(all_sat_num_, 0);
+  window_size_.assign(all_sat_num_, 0);
+  weights_epochs_.clear();
 
   for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
     if (unixtime_vector_.at(gnss_satellite_id).empty()) {
@@ -693,20 +823,12 @@ void GnssSat_clock::SetUp(const double start_unix_time, const double step_sec) {
       continue;
     }
 
-    // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
-    for (int j = -interpolation_number_ / 2; j < (interpolation_number_ + 1) / 2; ++j) {
-      int now_index = index + j;
-      if (now_index < 0 || now_index >= (int)unixtime_vector_.at(gnss_satellite_id).size()) continue;
-
-      time_period_.at(gnss_satellite_id).push_back(unixtime_vector_.at(gnss_satellite_id).at(now_index));
-      clock_bias_.at(gnss_satellite_id).push_back(gnss_sat_clock_table_.at(gnss_satellite_id).at(now_index));
-    }
-
-    if ((int)time_period_.at(gnss_satellite_id).size() != interpolation_number_) {
+    SetInterpolationWindow(gnss_satellite_id, index);
+    if (window_size_.at(gnss_satellite_id) != interpolation_number_) {
       validate_.at(gnss_satellite_id) = false;
       continue;
     }
-    double time_period_length = time_period_.at(gnss_satellite_id).back() - time_period_.at(gnss_satellite_id).front();
+    double time_period_length = GetInterpolationWindowLength(gnss_satellite_id);
     if (time_period_length > time_interval_ * (interpolation_number_ - 1) + 1e-4) {  // more strict for clock_bias
       validate_.at(gnss_satellite_id) = false;
       continue;
@@ -717,8 +839,7 @@ void GnssSat_clock::SetUp(const double start_unix_time, const double step_sec) {
     if (std::abs(start_unix_time - nearest_unixtime) < 1e-4) {  // for the numerical error
       gnss_sat_clock_.at(gnss_satellite_id) = gnss_sat_clock_table_.at(gnss_satellite_id).at(index);
     } else {
-      gnss_sat_clock_.at(gnss_satellite_id) =
-          LagrangeInterpolation(time_period_.at(gnss_satellite_id), clock_bias_.at(gnss_satellite_id), start_unix_time);
+      InterpolateClock(gnss_satellite_id, start_unix_time);
     }
   }
 }
@@ -744,20 +865,10 @@ void GnssSat_clock::Update(const double now_unix_time) {
         ++index;
         nearest_index_.at(gnss_satellite_id) = index;
 
-        time_period_.at(gnss_satellite_id).clear();
-        clock_bias_.at(gnss_satellite_id).clear();
-
-        // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
-        for (int j = -interpolation_number_ / 2; j < (interpolation_number_ + 1) / 2; ++j) {
-          int now_index = index + j;
-          if (now_index < 0 || now_index >= (int)unixtime_vector_.at(gnss_satellite_id).size()) continue;
-
-          time_period_.at(gnss_satellite_id).push_back(unixtime_vector_.at(gnss_satellite_id).at(now_index));
-          clock_bias_.at(gnss_satellite_id).push_back(gnss_sat_clock_table_.at(gnss_satellite_id).at(now_index));
-        }
+        SetInterpolationWindow(gnss_satellite_id, index);
       }
     }
-    if ((int)time_period_.at(gnss_satellite_id).size() != interpolation_number_) {
+    if (window_size_.at(gnss_satellite_id) != interpolation_number_) {
       validate_.at(gnss_satellite_id) = false;
       continue;
     }
@@ -769,7 +880,7 @@ void GnssSat_clock::Update(const double now_unix_time) {
     }
 
     // in clock_bias, more strict.
-    double time_period_length = time_period_.at(gnss_satellite_id).back() - time_period_.at(gnss_satellite_id).front();
+    double time_period_length = GetInterpolationWindowLength(gnss_satellite_id);
     if (time_period_length > time_interval_ * (interpolation_number_ - 1) + 1e-4) {  // more strict for clock_bias
       validate_.at(gnss_satellite_id) = false;
       continue;
@@ -780,12 +891,22 @@ void GnssSat_clock::Update(const double now_unix_time) {
     if (std::abs(now_unix_time - nearest_unix_time) < 1e-4) {
       gnss_sat_clock_.at(gnss_satellite_id) = gnss_sat_clock_table_.at(gnss_satellite_id).at(index);
     } else {
-      gnss_sat_clock_.at(gnss_satellite_id) =
-          LagrangeInterpolation(time_period_.at(gnss_satellite_id), clock_bias_.at(gnss_satellite_id), now_unix_time);
+      InterpolateClock(gnss_satellite_id, now_unix_time);
     }
   }
 }
 
+void GnssSat_clock::InterpolateClock(const int gnss_satellite_id, const double time) {
+  const vector<double>& weights = CalcLagrangeWeights(gnss_satellite_id, time);
+  const double* clock_bias = &gnss_sat_clock_table_.at(gnss_satellite_id).at(window_first_index_.at(gnss_satellite_id));
+
+  double res = 0.0;
+  for (size_t i = 0; i < weights.size(); ++i) {
+    res += clock_bias[i] * weights[i];
+  }
+  gnss_sat_clock_.at(gnss_satellite_id) = res;
+}
+
 double GnssSat_clock::GetSatClock(int gnss_satellite_id) const {
   if (gnss_satellite_id >= all_sat_num_) return 0.0;
   return gnss_sat_clock_.at(gnss_satellite_id);
@@ -794,9 +915,31 @@ double GnssSat_clock::GetSatClock(int gnss_satellite_id) const {
 GnssSat_Info::GnssSat_Info() {}
 void GnssSat_Info::Init(vector<vector<string>>& position_file, int position_interpolation_method, int position_interpolation_number,
                         UltraRapidMode position_ur_flag, vector<vector<string>>& clock_file, string clock_file_extension,
-                        int clock_interpolation_number, UltraRapidMode clock_ur_flag) {
-  auto unix_time_period = position_.Init(position_file, position_interpolation_method, position_interpolation_number, position_ur_flag);
-  clock_.Init(clock_file, clock_file_extension, clock_interpolation_number, clock_ur_flag, unix_time_period);
+                        int clock_interpolation_number, UltraRapidMode clock_ur_flag, const string position_binary_file,
+                        const string clock_binary_file, const string position_binary_source, const string clock_binary_source) {
+  pair<double, double> unix_time_period;
+  if (position_file.empty() && !position_binary_file.empty()) {
+    unix_time_period = position_.InitWithBinaryFile(position_binary_file, position_interpolation_number, position_binary_source);
+  } else {
+    unix_time_period = position_.Init(position_file, position_interpolation_method, position_interpolation_number, position_ur_flag);
+    if (!position_binary_file.empty() && !position_.WriteBinaryFile(position_binary_file, unix_time_period, position_binary_source)) {
+      cout << "gnss binary file: " << position_binary_file << " cannot be written" << endl;
+    }
+  }
+
+  if (clock_file.empty() && !clock_binary_file.empty()) {
+    clock_.InitWithBinaryFile(clock_binary_file, clock_interpolation_number, clock_binary_source);
+  } else {
+    clock_.Init(clock_file, clock_file_extension, clock_interpolation_number, clock_ur_flag, unix_time_period);
+    if (!clock_binary_file.empty() && !clock_.WriteBinaryFile(clock_binary_file, clock_binary_source)) {
+      cout << "gnss binary file: " << clock_binary_file << " cannot be written" << endl;
+    }
+  }
+}
+
+void GnssSat_Info::LoadTimeWindow(const double start_unix_time, const double end_unix_time) {
+  position_.LoadTimeWindow(start_unix_time, end_unix_time);
+  clock_.LoadTimeWindow(start_unix_time, end_unix_time);
 }
 
 void GnssSat_Info::SetUp(const double start_unix_time, const double step_sec) {
@@ -841,6 +984,11 @@ GnssSatellites::GnssSatellites(bool is_calc_enabled)
 #endif
 {
   is_calc_enabled_ = is_calc_enabled;
+
+  constellation_bits_.resize(GetNumOfSatellites());
+  for (int gnss_satellite_id = 0; gnss_satellite_id < GetNumOfSatellites(); ++gnss_satellite_id) {
+    constellation_bits_[gnss_satellite_id] = GetGnssConstellationBit(GetIDFromIndex(gnss_satellite_id)[0]);
+  }
 }
 
 bool GnssSatellites::IsCalcEnabled() const { return is_calc_enabled_; }
@@ -855,15 +1003,23 @@ void GnssSatellites::Init(vector<vector<string>>& true_position_file, int true_p
                           int estimate_position_interpolation_number, UltraRapidMode estimate_position_ur_flag,
 
                           vector<vector<string>>& estimate_clock_file, string estimate_clock_file_extension, int estimate_clock_interpolation_number,
-                          UltraRapidMode estimate_clock_ur_flag) {
+                          UltraRapidMode estimate_clock_ur_flag,
+
+                          const string true_position_binary_file, const string true_clock_binary_file, const string estimate_position_binary_file,
+                          const string estimate_clock_binary_file, const string true_position_binary_source, const string true_clock_binary_source,
+                          const string estimate_position_binary_source, const string estimate_clock_binary_source) {
   true_info_.Init(true_position_file, true_position_interpolation_method, true_position_interpolation_number, true_position_ur_flag,
 
-                  true_clock_file, true_clock_file_extension, true_clock_interpolation_number, true_clock_ur_flag);
+                  true_clock_file, true_clock_file_extension, true_clock_interpolation_number, true_clock_ur_flag,
+
+                  true_position_binary_file, true_clock_binary_file, true_position_binary_source, true_clock_binary_source);
 
   estimate_info_.Init(estimate_position_file, estimate_position_interpolation_method, estimate_position_interpolation_number,
                       estimate_position_ur_flag,
 
-                      estimate_clock_file, estimate_clock_file_extension, estimate_clock_interpolation_number, estimate_clock_ur_flag);
+                      estimate_clock_file, estimate_clock_file_extension, estimate_clock_interpolation_number, estimate_clock_ur_flag,
+
+                      estimate_position_binary_file, estimate_clock_binary_file, estimate_position_binary_source, estimate_clock_binary_source);
 
   return;
 }
@@ -881,8 +1037,15 @@ void GnssSatellites::SetUp(const SimulationTime* simulation_time) {
   start_tm->tm_sec = (int)start_sec;
   double unix_time = (double)mktime(start_tm) + start_sec - floor(start_sec);
   std::free(start_tm);
+
+  // Tables in the simulation time window are read when the binary files are used
+  const double end_unix_time = unix_time + simulation_time->GetEndTime_s();
+  true_info_.LoadTimeWindow(unix_time, end_unix_time);
+  estimate_info_.LoadTimeWindow(unix_time, end_unix_time);
+
   true_info_.SetUp(unix_time, simulation_time->GetSimulationStep_s());
   estimate_info_.SetUp(unix_time, simulation_time->GetSimulationStep_s());
+  UpdateSatellitePositionsEci();
 
   start_unix_time_ = unix_time;
 
@@ -896,6 +1059,7 @@ void GnssSatellites::Update(const SimulationTime* simulation_time) {
 
   true_info_.Update(elapsed_sec + start_unix_time_);
   estimate_info_.Update(elapsed_sec + start_unix_time_);
+  UpdateSatellitePositionsEci();
 
 #ifdef GNSS_SATELLITES_DEBUG_OUTPUT
   DebugOutput();
@@ -945,6 +1109,19 @@ libra::Vector<3> GnssSatellites::GetSatellitePositionEci(const int gnss_satellit
   return estimate_info_.GetSatellitePositionEci(gnss_satellite_id);
 }
 
+void GnssSatellites::UpdateSatellitePositionsEci() {
+  const int gnss_num = GetNumOfSatellites();
+  for (size_t axis = 0; axis < 3; ++axis) {
+    satellite_positions_eci_m_[axis].resize(gnss_num);
+  }
+  for (int gnss_satellite_id = 0; gnss_satellite_id < gnss_num; ++gnss_satellite_id) {
+    libra::Vector<3> position_eci_m = GetSatellitePositionEci(gnss_satellite_id);
+    for (size_t axis = 0; axis < 3; ++axis) {
+      satellite_positions_eci_m_[axis][gnss_satellite_id] = position_eci_m[axis];
+    }
+  }
+}
+
 double GnssSatellites::GetSatelliteClock(const int gnss_satellite_id) const {
   if (gnss_satellite_id >= GetNumOfSatellites() || !GetWhetherValid(gnss_satellite_id)) {
     return 0.0;
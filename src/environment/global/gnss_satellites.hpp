@@ -15,6 +15,7 @@
 
 #include "library/logger/loggable.hpp"
 #include "library/math/vector.hpp"
+#include "library/utilities/time_series_table_file.hpp"
 #include "simulation_time.hpp"
 
 extern const double nan99;  //!< Not at Number TODO: Should be moved to another place
@@ -26,6 +27,28 @@ enum class GnssFrameDefinition {
 
 // #define GNSS_SATELLITES_DEBUG_OUTPUT //!< For debug output, uncomment this
 
+/**
+ * @fn GetGnssConstellationBit
+ * @brief Return bit of the GNSS constellation used for the constellation masks
+ * @param [in] constellation: First character of the GNSS satellite number (G, R, E, C, or J)
+ * @return Bit of the constellation. 0 for the unknown constellation.
+ */
+unsigned int GetGnssConstellationBit(const char constellation);
+/**
+ * @fn CalcGnssBinaryFileFingerprint
+ * @brief Calculate the fingerprint of the text files converted into the binary file of the GNSS tables
+ * @param [in] source: Settings to select the text files (directory, file sort, first and last files, ultra rapid mode, etc.)
+ * @return 64 bit hash of the source split into two 32 bit values, which are stored at the end of the parameters of the binary file
+ */
+std::vector<double> CalcGnssBinaryFileFingerprint(const std::string& source);
+/**
+ * @fn IsGnssBinaryFileMatched
+ * @brief Return true when the binary file exists and is converted from the text files selected by the source
+ * @param [in] binary_file_path: Path to the binary file
+ * @param [in] source: Settings to select the text files. Same as CalcGnssBinaryFileFingerprint.
+ */
+bool IsGnssBinaryFileMatched(const std::string& binary_file_path, const std::string& source);
+
 /**
  * @enum UltraRapidMode
  * @brief Ultra Rapid mode
@@ -80,39 +103,75 @@ class GnssSat_coordinate {
 
  protected:
   /**
-   * @fn TrigonometricInterpolation
-   * @brief Interpolate with Trigonometric method
+   * @fn SetInterpolationWindow
+   * @brief Set the interpolation window of the satellite around the nearest index
+   * @note The window refers to the records in the tables, so the records are not copied.
+   * @param [in] gnss_satellite_id: Index of GNSS satellite
+   * @param [in] index: Nearest index in the tables
+   */
+  void SetInterpolationWindow(const int gnss_satellite_id, const int index);
+  /**
+   * @fn GetInterpolationWindowLength
+   * @brief Return time length of the interpolation window of the satellite [sec]
+   * @param [in] gnss_satellite_id: Index of GNSS satellite
+   */
+  double GetInterpolationWindowLength(const int gnss_satellite_id) const;
+
+  /**
+   * @fn CalcTrigonometricWeights
+   * @brief Calculate weights of the records in the interpolation window with Trigonometric method
    * @note Ref: http://acc.igs.org/orbits/orbit-interp_gpssoln03.pdf
    *            https://en.wikipedia.org/wiki/Trigonometric_interpolation#
-   * @param [in] time_vector: List of given time
-   * @param [in] values: List of given value
+   *       The weights are reused while the time and the epochs of the window are the same as the previous call,
+   *       so the satellites with the same epochs share them.
+   * @param [in] gnss_satellite_id: Index of GNSS satellite
    * @param [in] time: Time to calculate the interpolated value
-   * @return Interpolated value
+   * @return Weights of the records in the window
    */
-  template <size_t N>
-  libra::Vector<N> TrigonometricInterpolation(const std::vector<double>& time_vector, const std::vector<libra::Vector<N>>& values, double time) const;
-  double TrigonometricInterpolation(const std::vector<double>& time_vector, const std::vector<double>& values, double time) const;
-
+  const std::vector<double>& CalcTrigonometricWeights(const int gnss_satellite_id, const double time);
   /**
-   * @fn LagrangeInterpolation
-   * @brief Interpolate with Lagrange method
-   * @param [in] time_vector: List of given time
-   * @param [in] values: List of given value
+   * @fn CalcLagrangeWeights
+   * @brief Calculate weights of the records in the interpolation window with Lagrange method
+   * @note The weights are reused in the same way as CalcTrigonometricWeights.
+   * @param [in] gnss_satellite_id: Index of GNSS satellite
    * @param [in] time: Time to calculate the interpolated value
-   * @return Interpolated value
+   * @return Weights of the records in the window
    */
-  template <size_t N>
-  libra::Vector<N> LagrangeInterpolation(const std::vector<double>& time_vector, const std::vector<libra::Vector<N>>& values, double time) const;
-  double LagrangeInterpolation(const std::vector<double>& time_vector, const std::vector<double>& values, double time) const;
+  const std::vector<double>& CalcLagrangeWeights(const int gnss_satellite_id, const double time);
 
   std::vector<std::vector<double>> unixtime_vector_;  //!< List of unixtime for all sat
-  std::vector<std::vector<double>> time_period_;      //!< List of time period for interpolation
   std::vector<bool> validate_;                        //!< List of whether the satellite is available at the time
   std::vector<int> nearest_index_;                    //!< Index list for update(in position, time_and_index_list_. in clock_bias, time_table_)
+  std::vector<int> window_first_index_;               //!< List of first index of the interpolation window in the tables
+  std::vector<int> window_size_;                      //!< List of number of records in the interpolation window
 
   double step_sec_ = 0.0;         //!< Step width [sec]
   double time_interval_ = 0.0;    //!< Time interval
   int interpolation_number_ = 0;  //!< Interpolation number
+
+  TimeSeriesTableFile binary_file_;  //!< Binary file of the tables. The tables in the simulation time window are read from it.
+
+  // Cache of the interpolation weights
+  bool is_trigonometric_weights_ = false;      //!< Whether the cached weights are calculated with Trigonometric method
+  double weights_time_ = 0.0;                  //!< Time of the cached weights
+  std::vector<double> weights_epochs_;         //!< Epochs of the interpolation window of the cached weights
+  std::vector<double> weights_;                //!< Cached weights
+  std::vector<double> sin_epochs_difference_;  //!< sin(w(t_i - t_j) / 2) of the epochs for Trigonometric method. [i * n + j]
+  std::vector<double> sin_time_difference_;    //!< sin(w(t - t_j) / 2) of the time for Trigonometric method
+
+  /**
+   * @fn IsSameWindowEpochs
+   * @brief Return true when the epochs of the interpolation window are the same as the epochs of the cached weights
+   * @param [in] gnss_satellite_id: Index of GNSS satellite
+   */
+  bool IsSameWindowEpochs(const int gnss_satellite_id) const;
+
+  /**
+   * @fn GetNumberOfMarginRecords
+   * @brief Return number of records read before and after the simulation time window from the binary file
+   * @note The interpolation points and 3 missing records are allowed.
+   */
+  inline size_t GetNumberOfMarginRecords() const { return interpolation_number_ + 4; }
 };
 
 /**
@@ -137,6 +196,32 @@ class GnssSat_position : public GnssSat_coordinate {
    */
   std::pair<double, double> Init(std::vector<std::vector<std::string>>& file, int interpolation_method, int interpolation_number,
                                  UltraRapidMode ur_flag);
+  /**
+   * @fn InitWithBinaryFile
+   * @brief Initialize GNSS satellite position with the binary file made by WriteBinaryFile
+   * @note Only the time index is read here. The positions are read in LoadTimeWindow.
+   * @param[in] binary_file_path: Path to the binary file
+   * @param[in] interpolation_number: Interpolation number for position calculation
+   * @param[in] source: Settings to select the text files. The binary file should be converted from the same text files.
+   * @return Start unix time and end unix time
+   */
+  std::pair<double, double> InitWithBinaryFile(const std::string binary_file_path, int interpolation_number, const std::string& source);
+  /**
+   * @fn WriteBinaryFile
+   * @brief Write the position tables read by Init into the binary file
+   * @param[in] binary_file_path: Path to the binary file
+   * @param[in] unix_time_period: Start unix time and end unix time returned by Init
+   * @param[in] source: Settings to select the text files read by Init
+   * @return True when the file is written
+   */
+  bool WriteBinaryFile(const std::string binary_file_path, const std::pair<double, double> unix_time_period, const std::string& source) const;
+  /**
+   * @fn LoadTimeWindow
+   * @brief Read the position tables in the simulation time window from the binary file. Nothing is done without the binary file.
+   * @param [in] start_unix_time: Start unix time
+   * @param [in] end_unix_time: End unix time
+   */
+  void LoadTimeWindow(const double start_unix_time, const double end_unix_time);
 
   /**
    * @fn Setup
@@ -172,8 +257,13 @@ class GnssSat_position : public GnssSat_coordinate {
   std::vector<std::vector<libra::Vector<3>>> gnss_sat_table_ecef_;  //!< Time series of position of all GNSS satellites in the ECEF frame [m]
   std::vector<std::vector<libra::Vector<3>>> gnss_sat_table_eci_;   //!< Time series of position of all GNSS satellites in the ECEF frame [m]
 
-  std::vector<std::vector<libra::Vector<3>>> ecef_;  //!< Time series of position of all GNSS satellites in the ECEF frame before interpolation [m]
-  std::vector<std::vector<libra::Vector<3>>> eci_;   //!< Time series of position of all GNSS satellites in the ECEF frame before interpolation [m]
+  /**
+   * @fn InterpolatePosition
+   * @brief Interpolate the positions in the ECEF and ECI frames with the same weights
+   * @param [in] gnss_satellite_id: GNSS satellite ID defined in this class
+   * @param [in] time: Time to calculate the interpolated value
+   */
+  void InterpolatePosition(const int gnss_satellite_id, const double time);
 };
 
 /**
@@ -197,6 +287,30 @@ class GnssSat_clock : public GnssSat_coordinate {
    */
   void Init(std::vector<std::vector<std::string>>& file, std::string file_extension, int interpolation_number, UltraRapidMode ur_flag,
             std::pair<double, double> unix_time_period);
+  /**
+   * @fn InitWithBinaryFile
+   * @brief Initialize GNSS satellite clock with the binary file made by WriteBinaryFile
+   * @note Only the time index is read here. The clock biases are read in LoadTimeWindow.
+   * @param[in] binary_file_path: Path to the binary file
+   * @param[in] interpolation_number: Interpolation number for clock calculation
+   * @param[in] source: Settings to select the text files. The binary file should be converted from the same text files.
+   */
+  void InitWithBinaryFile(const std::string binary_file_path, int interpolation_number, const std::string& source);
+  /**
+   * @fn WriteBinaryFile
+   * @brief Write the clock tables read by Init into the binary file
+   * @param[in] binary_file_path: Path to the binary file
+   * @param[in] source: Settings to select the text files read by Init
+   * @return True when the file is written
+   */
+  bool WriteBinaryFile(const std::string binary_file_path, const std::string& source) const;
+  /**
+   * @fn LoadTimeWindow
+   * @brief Read the clock tables in the simulation time window from the binary file. Nothing is done without the binary file.
+   * @param [in] start_unix_time: Start unix time
+   * @param [in] end_unix_time: End unix time
+   */
+  void LoadTimeWindow(const double start_unix_time, const double end_unix_time);
   /**
    * @fn SetUp
    * @brief Setup GNSS satellite clock information
@@ -220,7 +334,14 @@ class GnssSat_clock : public GnssSat_coordinate {
  private:
   std::vector<double> gnss_sat_clock_;                     //!< List of clock bias of all GNSS satellites at specific time expressed in distance [m]
   std::vector<std::vector<double>> gnss_sat_clock_table_;  //!< Time series of clock bias of all GNSS satellites expressed in distance [m]
-  std::vector<std::vector<double>> clock_bias_;  //!< Time series of clock bias of all GNSS satellites expressed in distance before interpolation [m]
+
+  /**
+   * @fn InterpolateClock
+   * @brief Interpolate the clock bias
+   * @param [in] gnss_satellite_id: GNSS satellite ID defined in this class
+   * @param [in] time: Time to calculate the interpolated value
+   */
+  void InterpolateClock(const int gnss_satellite_id, const double time);
 };
 
 /**
@@ -245,10 +366,23 @@ class GnssSat_Info {
    * @param[in] clock_file_extension: Extension of the clock file (ex. .sp3, .clk30s)
    * @param[in] clock_interpolation_number: Interpolation number for clock calculation
    * @param[in] clock_ur_flag: Ultra Rapid flag for clock calculation
+   * @param[in] position_binary_file: Path to the binary file of the position. The file is read when position_file is empty, and written
+   *                                  after reading position_file otherwise. Not used when it is empty.
+   * @param[in] clock_binary_file: Path to the binary file of the clock. Same usage as position_binary_file.
+   * @param[in] position_binary_source: Settings to select the text files of the position. It is stored as the fingerprint in the binary file.
+   * @param[in] clock_binary_source: Settings to select the text files of the clock. Same usage as position_binary_source.
    */
   void Init(std::vector<std::vector<std::string>>& position_file, int position_interpolation_method, int position_interpolation_number,
             UltraRapidMode position_ur_flag, std::vector<std::vector<std::string>>& clock_file, std::string clock_file_extension,
-            int clock_interpolation_number, UltraRapidMode clock_ur_flag);
+            int clock_interpolation_number, UltraRapidMode clock_ur_flag, const std::string position_binary_file = "",
+            const std::string clock_binary_file = "", const std::string position_binary_source = "", const std::string clock_binary_source = "");
+  /**
+   * @fn LoadTimeWindow
+   * @brief Read the position and clock tables in the simulation time window from the binary files
+   * @param [in] start_unix_time: Start unix time
+   * @param [in] end_unix_time: End unix time
+   */
+  void LoadTimeWindow(const double start_unix_time, const double end_unix_time);
   /**
    * @fn SetUp
    * @brief Setup GNSS satellite position and clock information
@@ -337,7 +471,11 @@ class GnssSatellites : public ILoggable {
             int true_clock_interpolation_number, UltraRapidMode true_clock_ur_flag, std::vector<std::vector<std::string>>& estimate_position_file,
             int estimate_position_interpolation_method, int estimate_position_interpolation_number, UltraRapidMode estimate_position_ur_flag,
             std::vector<std::vector<std::string>>& estimate_clock_file, std::string estimate_clock_file_extension,
-            int estimate_clock_interpolation_number, UltraRapidMode estimate_clock_ur_flag);
+            int estimate_clock_interpolation_number, UltraRapidMode estimate_clock_ur_flag, const std::string true_position_binary_file = "",
+            const std::string true_clock_binary_file = "", const std::string estimate_position_binary_file = "",
+            const std::string estimate_clock_binary_file = "", const std::string true_position_binary_source = "",
+            const std::string true_clock_binary_source = "", const std::string estimate_position_binary_source = "",
+            const std::string estimate_clock_binary_source = "");
   /**
    * @fn IsCalcEnabled
    * @brief Return calculated enabled flag
@@ -411,6 +549,19 @@ class GnssSatellites : public ILoggable {
    * @param [in] gnss_satellite_id: GNSS satellite ID
    */
   libra::Vector<3> GetSatellitePositionEci(const int gnss_satellite_id) const;
+  /**
+   * @fn GetSatellitePositionsEci_m
+   * @brief Return positions of all GNSS satellites in the ECI frame as the structure of arrays [m]
+   * @note The values are same as GetSatellitePositionEci, so the positions of the invalid satellites are zero.
+   *       The arrays are empty when the calculation is disabled.
+   * @param [in] axis: Axis of the position (0: X, 1: Y, 2: Z)
+   */
+  inline const std::vector<double>& GetSatellitePositionsEci_m(const size_t axis) const { return satellite_positions_eci_m_[axis]; }
+  /**
+   * @fn GetConstellationBits
+   * @brief Return constellation bits of all GNSS satellites defined by GetGnssConstellationBit
+   */
+  inline const std::vector<unsigned int>& GetConstellationBits() const { return constellation_bits_; }
   /**
    * @fn GetSatelliteClock
    * @brief Return GNSS satellite clock
@@ -498,12 +649,22 @@ class GnssSatellites : public ILoggable {
    */
   double AddIonosphericDelay(const int gnss_satellite_id, const libra::Vector<3> rec_position, const double frequency,
                              const GnssFrameDefinition flag) const;
+  /**
+   * @fn UpdateSatellitePositionsEci
+   * @brief Update the structure of arrays of the GNSS satellite positions in the ECI frame
+   */
+  void UpdateSatellitePositionsEci();
 
   bool is_calc_enabled_ = true;  //!< Flag to manage the GNSS satellite position calculation
   GnssSat_Info true_info_;       //!< True information of GNSS satellites
   GnssSat_Info estimate_info_;   //!< Estimated information of GNSS satellites TODO: should be move out from GlobalEnvironment
   double start_unix_time_;       //!< Start unix time
 
+ protected:
+  std::vector<double> satellite_positions_eci_m_[3];  //!< Positions of all GNSS satellites in the ECI frame for each axis [m]
+  std::vector<unsigned int> constellation_bits_;      //!< Constellation bits of all GNSS satellites
+
+ private:
 #ifdef GNSS_SATELLITES_DEBUG_OUTPUT
   ofstream ofs_true;  //!< Debug output for true value
   ofstream ofs_esti;  //!< Debug output for estimated value
@@ -7,6 +7,7 @@
 #include <SpiceUsr.h>
 
 #include <cassert>
+#include <mutex>
 #include <environment/global/simulation_time.hpp>
 #include <library/initialize/initialize_file_access.hpp>
 
@@ -75,6 +76,7 @@ CelestialInformation* InitCelestialInformation(std::string file_name) {
   std::vector<std::string> keywords = {"tls", "tpc1", "tpc2", "tpc3", "bsp"};
   for (size_t i = 0; i < keywords.size(); i++) {
     std::string fname = ini_file.ReadString(furnsh_section, keywords[i].c_str());
+    std::lock_guard<std::mutex> spice_lock(GetSpiceMutex());
     furnsh_c(fname.c_str());
   }
 
@@ -88,7 +90,10 @@ CelestialInformation* InitCelestialInformation(std::string file_name) {
     ini_file.ReadChar(section, selected_body_i.c_str(), 30, selected_body_temp);
     SpiceInt planet_id;
     SpiceBoolean found;
-    bodn2c_c(selected_body_temp, (SpiceInt*)&planet_id, (SpiceBoolean*)&found);
+    {
+      std::lock_guard<std::mutex> spice_lock(GetSpiceMutex());
+      bodn2c_c(selected_body_temp, (SpiceInt*)&planet_id, (SpiceBoolean*)&found);
+    }
 
     // If the object specified in the ini file is not found, exit the program.
     assert(found == SPICETRUE);
@@ -113,6 +118,9 @@ CelestialInformation* InitCelestialInformation(std::string file_name) {
   CelestialInformation* celestial_info;
   celestial_info = new CelestialInformation(inertial_frame, aber_cor, center_obj, rotation_mode, num_of_selected_body, selected_body);
 
+  // Ephemeris cache setting
+  celestial_info->SetEphemerisCache(ini_file.ReadEnable(section, "ephemeris_cache"), ini_file.ReadDouble(section, "ephemeris_cache_node_interval_s"));
+
   // log setting
   celestial_info->is_log_enabled_ = ini_file.ReadEnable(section, LOG_LABEL);
 
@@ -64,6 +64,12 @@ void get_raw_contents(std::string directory_path, std::string file_name, std::ve
   return;
 }
 
+/**
+ * @fn is_ultra_rapid_file_sort
+ * @brief Return true when the file sort is the ultra rapid products
+ */
+bool is_ultra_rapid_file_sort(const std::string file_sort) { return file_sort.substr(0, 3) == "IGU" || file_sort.find("Ultra") != std::string::npos; }
+
 void get_sp3_file_contents(std::string directory_path, std::string file_sort, std::string first, std::string last,
                            std::vector<std::vector<std::string>>& file_contents, UltraRapidMode& ur_flag) {
   std::string all_directory_path = directory_path + return_dirctory_path(file_sort);
@@ -99,7 +105,7 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
       if (file_name == last) break;
       ++day;
     }
-  } else if (file_sort.substr(0, 3) == "IGU" || file_sort.find("Ultra") != std::string::npos) {  // In case of UR
+  } else if (is_ultra_rapid_file_sort(file_sort)) {  // In case of UR
     ur_flag = kUnknown;
     std::string file_header, file_footer;
     int gps_week = 0, day = 0;
@@ -254,6 +260,32 @@ void get_clk_file_contents(std::string directory_path, std::string extension, st
   return;
 }
 
+/**
+ * @fn read_binary_file_path
+ * @brief Read the path to the binary file of the GNSS tables
+ * @return Path to the binary file. Empty when it is not set.
+ */
+std::string read_binary_file_path(IniAccess& ini_file, const char* section, const char* key) {
+  std::string binary_file_path = ini_file.ReadString(section, key);
+  if (binary_file_path == "NULL") return "";
+  return binary_file_path;
+}
+
+/**
+ * @fn make_binary_file_source
+ * @brief Make the settings to select the text files. Its fingerprint is stored in the binary file to detect the change of the settings.
+ * @param [in] prefix: Prefix of the keys of the table (ex. true_position)
+ * @return Directory path, file sort, first file, and last file
+ */
+std::string make_binary_file_source(IniAccess& ini_file, const char* section, const std::string directory_path, const std::string prefix) {
+  std::string source = directory_path;
+  const std::string keys[3] = {"_file_sort", "_first", "_last"};
+  for (const std::string& key : keys) {
+    source += "\n" + ini_file.ReadString(section, (prefix + key).c_str());
+  }
+  return source;
+}
+
 GnssSatellites* InitGnssSatellites(std::string file_name) {
   IniAccess ini_file(file_name);
   char section[] = "GNSS_SATELLIES";
@@ -264,30 +296,58 @@ GnssSatellites* InitGnssSatellites(std::string file_name) {
 
   std::string directory_path = ini_file.ReadString(section, "directory_path");
 
+  // Binary files converted from the text files. They are made at the first execution.
+  const std::string true_position_binary_file = read_binary_file_path(ini_file, section, "true_position_binary_file");
+  const std::string true_clock_binary_file = read_binary_file_path(ini_file, section, "true_clock_binary_file");
+  const std::string estimate_position_binary_file = read_binary_file_path(ini_file, section, "estimate_position_binary_file");
+  const std::string estimate_clock_binary_file = read_binary_file_path(ini_file, section, "estimate_clock_binary_file");
+
+  // Settings to select the text files. The binary files are made again when they are changed.
+  // The clock tables depend on the position settings, since the time period and the ultra rapid mode of the clock follow the position.
+  std::string true_clock_file_extension = ini_file.ReadString(section, "true_clock_file_extension");
+  std::string estimate_clock_file_extension = ini_file.ReadString(section, "estimate_clock_file_extension");
+  const bool is_estimate_ultra_rapid = is_ultra_rapid_file_sort(ini_file.ReadString(section, "estimate_position_file_sort"));
+  const std::string true_position_binary_source = make_binary_file_source(ini_file, section, directory_path, "true_position");
+  const std::string true_clock_binary_source = make_binary_file_source(ini_file, section, directory_path, "true_clock") + "\n" +
+                                               true_clock_file_extension + "\n" + true_position_binary_source;
+  std::string estimate_position_binary_source = make_binary_file_source(ini_file, section, directory_path, "estimate_position");
+  if (is_estimate_ultra_rapid) estimate_position_binary_source += "\n" + ini_file.ReadString(section, "estimate_ur_observe_or_predict");
+  const std::string estimate_clock_binary_source = make_binary_file_source(ini_file, section, directory_path, "estimate_clock") + "\n" +
+                                                   estimate_clock_file_extension + "\n" + estimate_position_binary_source;
+
   std::vector<std::vector<std::string>> true_position_file;
   UltraRapidMode true_position_ur_flag = kNotUse;
-  get_sp3_file_contents(directory_path, ini_file.ReadString(section, "true_position_file_sort"), ini_file.ReadString(section, "true_position_first"),
-                        ini_file.ReadString(section, "true_position_last"), true_position_file, true_position_ur_flag);
+  if (!IsGnssBinaryFileMatched(true_position_binary_file, true_position_binary_source)) {
+    get_sp3_file_contents(directory_path, ini_file.ReadString(section, "true_position_file_sort"),
+                          ini_file.ReadString(section, "true_position_first"), ini_file.ReadString(section, "true_position_last"), true_position_file,
+                          true_position_ur_flag);
+  }
   int true_position_interpolation_method = ini_file.ReadInt(section, "true_position_interpolation_method");
   int true_position_interpolation_number = ini_file.ReadInt(section, "true_position_interpolation_number");
 
   std::vector<std::vector<std::string>> true_clock_file;
   UltraRapidMode true_clock_ur_flag = kNotUse;
-  std::string true_clock_file_extension = ini_file.ReadString(section, "true_clock_file_extension");
-  if (true_clock_file_extension == ".sp3") {
-    get_sp3_file_contents(directory_path, ini_file.ReadString(section, "true_clock_file_sort"), ini_file.ReadString(section, "true_clock_first"),
-                          ini_file.ReadString(section, "true_clock_last"), true_clock_file, true_clock_ur_flag);
-  } else {
-    get_clk_file_contents(directory_path, true_clock_file_extension, ini_file.ReadString(section, "true_clock_file_sort"),
-                          ini_file.ReadString(section, "true_clock_first"), ini_file.ReadString(section, "true_clock_last"), true_clock_file);
+  if (!IsGnssBinaryFileMatched(true_clock_binary_file, true_clock_binary_source)) {
+    if (true_clock_file_extension == ".sp3") {
+      get_sp3_file_contents(directory_path, ini_file.ReadString(section, "true_clock_file_sort"), ini_file.ReadString(section, "true_clock_first"),
+                            ini_file.ReadString(section, "true_clock_last"), true_clock_file, true_clock_ur_flag);
+    } else {
+      get_clk_file_contents(directory_path, true_clock_file_extension, ini_file.ReadString(section, "true_clock_file_sort"),
+                            ini_file.ReadString(section, "true_clock_first"), ini_file.ReadString(section, "true_clock_last"), true_clock_file);
+    }
   }
   int true_clock_interpolation_number = ini_file.ReadInt(section, "true_clock_interpolation_number");
 
   std::vector<std::vector<std::string>> estimate_position_file;
   UltraRapidMode estimate_position_ur_flag = kNotUse;
-  get_sp3_file_contents(directory_path, ini_file.ReadString(section, "estimate_position_file_sort"),
-                        ini_file.ReadString(section, "estimate_position_first"), ini_file.ReadString(section, "estimate_position_last"),
-                        estimate_position_file, estimate_position_ur_flag);
+  if (!IsGnssBinaryFileMatched(estimate_position_binary_file, estimate_position_binary_source)) {
+    get_sp3_file_contents(directory_path, ini_file.ReadString(section, "estimate_position_file_sort"),
+                          ini_file.ReadString(section, "estimate_position_first"), ini_file.ReadString(section, "estimate_position_last"),
+                          estimate_position_file, estimate_position_ur_flag);
+  } else {
+    // The ultra rapid mode is still needed for the clock
+    if (is_estimate_ultra_rapid) estimate_position_ur_flag = kUnknown;
+  }
   int estimate_position_interpolation_method = ini_file.ReadInt(section, "estimate_position_interpolation_method");
   int estimate_position_interpolation_number = ini_file.ReadInt(section, "estimate_position_interpolation_number");
   if (estimate_position_ur_flag != kNotUse) {
@@ -301,15 +361,16 @@ GnssSatellites* InitGnssSatellites(std::string file_name) {
 
   std::vector<std::vector<std::string>> estimate_clock_file;
   UltraRapidMode estimate_clock_ur_flag = estimate_position_ur_flag;
-  std::string estimate_clock_file_extension = ini_file.ReadString(section, "estimate_clock_file_extension");
-  if (estimate_clock_file_extension == ".sp3") {
-    get_sp3_file_contents(directory_path, ini_file.ReadString(section, "estimate_clock_file_sort"),
-                          ini_file.ReadString(section, "estimate_clock_first"), ini_file.ReadString(section, "estimate_clock_last"),
-                          estimate_clock_file, estimate_clock_ur_flag);
-  } else {
-    get_clk_file_contents(directory_path, estimate_clock_file_extension, ini_file.ReadString(section, "estimate_clock_file_sort"),
-                          ini_file.ReadString(section, "estimate_clock_first"), ini_file.ReadString(section, "estimate_clock_last"),
-                          estimate_clock_file);
+  if (!IsGnssBinaryFileMatched(estimate_clock_binary_file, estimate_clock_binary_source)) {
+    if (estimate_clock_file_extension == ".sp3") {
+      get_sp3_file_contents(directory_path, ini_file.ReadString(section, "estimate_clock_file_sort"),
+                            ini_file.ReadString(section, "estimate_clock_first"), ini_file.ReadString(section, "estimate_clock_last"),
+                            estimate_clock_file, estimate_clock_ur_flag);
+    } else {
+      get_clk_file_contents(directory_path, estimate_clock_file_extension, ini_file.ReadString(section, "estimate_clock_file_sort"),
+                            ini_file.ReadString(section, "estimate_clock_first"), ini_file.ReadString(section, "estimate_clock_last"),
+                            estimate_clock_file);
+    }
   }
   int estimate_clock_interpolation_number = ini_file.ReadInt(section, "estimate_clock_interpolation_number");
 
@@ -320,7 +381,10 @@ GnssSatellites* InitGnssSatellites(std::string file_name) {
                         estimate_position_file, estimate_position_interpolation_method, estimate_position_interpolation_number,
                         estimate_position_ur_flag,
 
-                        estimate_clock_file, estimate_clock_file_extension, estimate_clock_interpolation_number, estimate_clock_ur_flag);
+                        estimate_clock_file, estimate_clock_file_extension, estimate_clock_interpolation_number, estimate_clock_ur_flag,
+
+                        true_position_binary_file, true_clock_binary_file, estimate_position_binary_file, estimate_clock_binary_file,
+                        true_position_binary_source, true_clock_binary_source, estimate_position_binary_source, estimate_clock_binary_source);
 
   return gnss_satellites;
 }
@@ -0,0 +1,134 @@
+/**
+ * @file test_clock_generator.cpp
+ * @brief Test codes for ClockGenerator class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "clock_generator.hpp"
+
+/**
+ * @class TickableForTest
+ * @brief Tickable class recording the calls in a shared list
+ */
+class TickableForTest : public ITickable {
+ public:
+  TickableForTest(const std::string name, const unsigned int prescaler, const unsigned int fast_prescaler, std::vector<std::string>& calls)
+      : name_(name), prescaler_(prescaler), fast_prescaler_(fast_prescaler), calls_(calls) {}
+
+  void Tick(const unsigned int count) override {
+    calls_.push_back(name_ + ".Tick(" + std::to_string(count) + ")");
+    if (on_tick_) on_tick_();
+  }
+  void FastTick(const unsigned int fast_count) override { calls_.push_back(name_ + ".FastTick(" + std::to_string(fast_count) + ")"); }
+  unsigned int GetPrescaler() const override { return prescaler_; }
+  unsigned int GetFastPrescaler() const override { return fast_prescaler_; }
+  void BeginTick(const unsigned int count) override { calls_.push_back(name_ + ".BeginTick(" + std::to_string(count) + ")"); }
+  void EndTick(const unsigned int count) override { calls_.push_back(name_ + ".EndTick(" + std::to_string(count) + ")"); }
+
+  std::function<void()> on_tick_;  //!< Function executed in Tick
+
+ private:
+  std::string name_;
+  unsigned int prescaler_;
+  unsigned int fast_prescaler_;
+  std::vector<std::string>& calls_;
+};
+
+/**
+ * @brief Test for the components with mixed prescalers called in the registration order
+ */
+TEST(ClockGenerator, MixedPrescalers) {
+  std::vector<std::string> calls;
+  ClockGenerator clock_generator;
+  TickableForTest a("A", 3, 1, calls), b("B", 1, 1, calls), c("C", 2, 1, calls);
+  clock_generator.RegisterComponent(&a);
+  clock_generator.RegisterComponent(&b);
+  clock_generator.RegisterComponent(&c);
+  EXPECT_EQ(3, clock_generator.GetNumberOfComponents());
+
+  for (int i = 0; i < 7; i++) clock_generator.TickToComponents();
+
+  const std::vector<std::string> expected = {"A.Tick(0)", "B.Tick(0)", "C.Tick(0)", "B.Tick(1)", "B.Tick(2)", "C.Tick(2)", "A.Tick(3)",
+                                             "B.Tick(3)", "B.Tick(4)", "C.Tick(4)", "B.Tick(5)", "A.Tick(6)", "B.Tick(6)", "C.Tick(6)"};
+  EXPECT_EQ(expected, calls);
+  EXPECT_EQ(3, clock_generator.GetTickStatistics(&a).tick_count);
+  EXPECT_EQ(7, clock_generator.GetTickStatistics(&b).tick_count);
+}
+
+/**
+ * @brief Test for Tick before FastTick of the same component, and BeginTick and EndTick around them
+ */
+TEST(ClockGenerator, TickBeforeFastTick) {
+  std::vector<std::string> calls;
+  ClockGenerator clock_generator;
+  TickableForTest a("A", 2, 1, calls), b("B", 1, 1, calls);
+  a.SetNeedsFastUpdate(true);
+  b.SetNeedsTickSynchronization(true);
+  clock_generator.RegisterComponent(&a);
+  clock_generator.RegisterComponent(&b);
+
+  for (int i = 0; i < 3; i++) clock_generator.TickToComponents();
+
+  const std::vector<std::string> expected = {"B.BeginTick(0)", "A.Tick(0)",     "A.FastTick(0)", "B.Tick(0)",   "B.EndTick(0)",
+                                             "B.BeginTick(1)", "A.FastTick(1)", "B.Tick(1)",     "B.EndTick(1)", "B.BeginTick(2)",
+                                             "A.Tick(2)",      "A.FastTick(2)", "B.Tick(2)",     "B.EndTick(2)"};
+  EXPECT_EQ(expected, calls);
+  EXPECT_EQ(2, clock_generator.GetTickStatistics(&a).tick_count);
+  EXPECT_EQ(3, clock_generator.GetTickStatistics(&a).fast_tick_count);
+}
+
+/**
+ * @brief Test for the removal of components in the tick
+ */
+TEST(ClockGenerator, RemoveComponentDuringTick) {
+  std::vector<std::string> calls;
+  ClockGenerator clock_generator;
+  TickableForTest a("A", 1, 1, calls), b("B", 1, 1, calls), c("C", 2, 1, calls);
+  clock_generator.RegisterComponent(&a);
+  clock_generator.RegisterComponent(&b);
+  clock_generator.RegisterComponent(&c);
+
+  // A removes the later components at the count 2, and then removes itself at the count 3
+  a.on_tick_ = [&]() {
+    if (calls.back() == "A.Tick(2)") {
+      clock_generator.RemoveComponent(&b);
+      clock_generator.RemoveComponent(&c);
+    } else if (calls.back() == "A.Tick(3)") {
+      clock_generator.RemoveComponent(&a);
+    }
+  };
+  for (int i = 0; i < 5; i++) clock_generator.TickToComponents();
+
+  const std::vector<std::string> expected = {"A.Tick(0)", "B.Tick(0)", "C.Tick(0)", "A.Tick(1)", "B.Tick(1)", "A.Tick(2)", "A.Tick(3)"};
+  EXPECT_EQ(expected, calls);
+  EXPECT_EQ(0, clock_generator.GetNumberOfComponents());
+
+  // The removed component can be registered again
+  calls.clear();
+  clock_generator.RegisterComponent(&b);
+  clock_generator.TickToComponents();
+  EXPECT_EQ(std::vector<std::string>{"B.Tick(5)"}, calls);
+}
+
+/**
+ * @brief Test for ClearTimerCount which reschedules all components from the count zero
+ */
+TEST(ClockGenerator, ClearTimerCount) {
+  std::vector<std::string> calls;
+  ClockGenerator clock_generator;
+  TickableForTest a("A", 3, 1, calls), b("B", 2, 1, calls);
+  clock_generator.RegisterComponent(&a);
+  clock_generator.RegisterComponent(&b);
+  for (int i = 0; i < 5; i++) clock_generator.TickToComponents();
+
+  calls.clear();
+  clock_generator.ClearTimerCount();
+  for (int i = 0; i < 4; i++) clock_generator.TickToComponents();
+
+  const std::vector<std::string> expected = {"A.Tick(0)", "B.Tick(0)", "B.Tick(2)", "A.Tick(3)"};
+  EXPECT_EQ(expected, calls);
+}
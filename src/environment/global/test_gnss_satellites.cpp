@@ -0,0 +1,359 @@
+/**
+ * @file test_gnss_satellites.cpp
+ * @brief Test codes for GnssSatellites class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iomanip>
+#include <library/math/constants.hpp>
+#include <library/utilities/time_series_table_file.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gnss_satellites.hpp"
+
+/**
+ * @fn GetFirstEpochUnixTime
+ * @brief Return the unix time of the first epoch in the SP3 file made by MakeSp3Page
+ */
+double GetFirstEpochUnixTime() {
+  tm time_tm = {};
+  time_tm.tm_year = 2016 - 1900;
+  time_tm.tm_mon = 6 - 1;
+  time_tm.tm_mday = 26;
+  return (double)mktime(&time_tm);
+}
+
+const int kNumberOfEpochs = 48;           //!< Number of epochs in the SP3 file for the test
+const double kEpochInterval_s = 900.0;    //!< Interval of the epochs [sec]
+const int kGapSatelliteNumber = 2;        //!< Satellite number of GPS whose records are missing in the gap
+const int kGapFirstEpoch = 20;            //!< First epoch of the gap
+const int kGapLastEpoch = 23;             //!< Last epoch of the gap. The interpolation allows 3 missing records.
+const std::string kShortGapSatellite = "E05";  //!< Satellite whose records are missing in the short gap
+const int kShortGapFirstEpoch = 30;       //!< First epoch of the short gap, which is allowed for the position but not for the clock
+const int kShortGapLastEpoch = 31;        //!< Last epoch of the short gap
+const std::string kSatellites[3] = {"G01", "G02", "E05"};  //!< Satellites in the SP3 file
+
+/**
+ * @fn MakeSp3Page
+ * @brief Make the lines of an SP3 file with the circular orbits and the linear clocks of the satellites
+ * @note Records of G02 are missing in the gap, and records of E05 are missing in the short gap
+ */
+std::vector<std::string> MakeSp3Page() {
+  std::vector<std::string> page;
+  page.push_back("#cP2016  6 26  0  0  0.00000000      " + std::to_string(kNumberOfEpochs) + " ORBIT IGS14 HLM  IGS");
+  page.push_back("## 1903      0.00000000   900.00000000 57565 0.0000000000000");
+  page.push_back("+    3   G01G02E05  0  0  0  0  0  0  0  0  0  0  0  0  0  0");
+  page.push_back("/* TEST FILE");
+  for (int epoch = 0; epoch < kNumberOfEpochs; ++epoch) {
+    const int seconds = (int)(epoch * kEpochInterval_s);
+    std::ostringstream epoch_line;
+    epoch_line << "*  2016  6 26 " << std::setw(2) << seconds / 3600 << " " << std::setw(2) << seconds / 60 % 60 << "  0.00000000";
+    page.push_back(epoch_line.str());
+
+    for (int satellite = 0; satellite < 3; ++satellite) {
+      std::ostringstream line;
+      line << "P" << kSatellites[satellite] << std::fixed << std::setprecision(6);
+      const bool is_gap = satellite == kGapSatelliteNumber - 1 && kGapFirstEpoch <= epoch && epoch <= kGapLastEpoch;
+      const bool is_short_gap = kSatellites[satellite] == kShortGapSatellite && kShortGapFirstEpoch <= epoch && epoch <= kShortGapLastEpoch;
+      if (is_gap || is_short_gap) {
+        line << " 999999.999999 999999.999999 999999.999999 999999.999999";
+      } else {
+        const double angle_rad = 2.0 * M_PI * seconds / 43080.0 + satellite;
+        const double radius_km = 26560.0;
+        const double inclination_rad = 0.96 + 0.1 * satellite;
+        line << " " << radius_km * cos(angle_rad) << " " << radius_km * sin(angle_rad) * cos(inclination_rad) << " "
+             << radius_km * sin(angle_rad) * sin(inclination_rad) << " " << 100.0 * (satellite + 1) + 1.0e-3 * seconds;
+      }
+      page.push_back(line.str());
+    }
+  }
+  page.push_back("EOF");
+  return page;
+}
+
+/**
+ * @class PerCallInterpolationForTest
+ * @brief Interpolation of a satellite which makes the window and the weights in each call as GnssSat_position and GnssSat_clock did
+ *        before the interpolation window and the weights were kept in the tables
+ */
+class PerCallInterpolationForTest {
+ public:
+  /**
+   * @fn PerCallInterpolationForTest
+   * @brief Constructor
+   * @param [in] times: Unix times of the records
+   * @param [in] values: Values of the records [array][record]
+   * @param [in] interpolation_number: Interpolation number
+   * @param [in] time_interval_s: Time interval of the records [sec]
+   * @param [in] number_of_allowed_missing_records: Number of missing records allowed in the window
+   * @param [in] is_trigonometric: Use the trigonometric interpolation when true, and the Lagrange interpolation when false
+   */
+  PerCallInterpolationForTest(const std::vector<double>& times, const std::vector<std::vector<double>>& values, const int interpolation_number,
+                              const double time_interval_s, const int number_of_allowed_missing_records, const bool is_trigonometric)
+      : times_(times),
+        values_(values),
+        interpolation_number_(interpolation_number),
+        time_interval_s_(time_interval_s),
+        number_of_allowed_missing_records_(number_of_allowed_missing_records),
+        is_trigonometric_(is_trigonometric),
+        interpolated_values_(values.size(), 0.0) {}
+
+  void SetUp(const double time) {
+    is_valid_ = false;
+    window_.clear();
+    nearest_index_ = (int)(std::lower_bound(times_.begin(), times_.end(), time) - times_.begin());
+    if (nearest_index_ == (int)times_.size()) return;
+    if (interpolation_number_ % 2 && nearest_index_ != 0) {
+      if (std::abs(time - times_[nearest_index_ - 1]) < std::abs(time - times_[nearest_index_])) --nearest_index_;
+    }
+    if (std::abs(time - times_[nearest_index_]) > time_interval_s_) return;
+    MakeWindow();
+    Interpolate(time);
+  }
+  void Update(const double time) {
+    is_valid_ = false;
+    if (nearest_index_ == (int)times_.size()) return;
+    if (nearest_index_ + 1 < (int)times_.size() && std::abs(time - times_[nearest_index_ + 1]) < std::abs(time - times_[nearest_index_])) {
+      ++nearest_index_;
+      MakeWindow();
+    }
+    Interpolate(time);
+  }
+  bool IsValid() const { return is_valid_; }
+  double GetValue(const size_t array_id) const { return interpolated_values_[array_id]; }
+
+ private:
+  const std::vector<double>& times_;                //!< Unix times of the records
+  const std::vector<std::vector<double>>& values_;  //!< Values of the records [array][record]
+  const int interpolation_number_;                  //!< Interpolation number
+  const double time_interval_s_;                    //!< Time interval of the records [sec]
+  const int number_of_allowed_missing_records_;     //!< Number of missing records allowed in the window
+  const bool is_trigonometric_;                     //!< Use the trigonometric interpolation when true
+  int nearest_index_ = 0;                           //!< Index of the nearest record
+  std::vector<int> window_;                         //!< Indices of the records in the interpolation window
+  bool is_valid_ = false;                           //!< Whether the interpolated values are valid
+  std::vector<double> interpolated_values_;         //!< Interpolated values [array]
+
+  void MakeWindow() {
+    window_.clear();
+    // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
+    for (int j = -interpolation_number_ / 2; j < (interpolation_number_ + 1) / 2; ++j) {
+      int index = nearest_index_ + j;
+      if (index < 0 || index >= (int)times_.size()) continue;
+      window_.push_back(index);
+    }
+  }
+  void Interpolate(const double time) {
+    if (std::abs(time - times_[nearest_index_]) > time_interval_s_) return;
+    if ((int)window_.size() != interpolation_number_) return;
+    const double window_length_s = times_[window_.back()] - times_[window_.front()];
+    if (window_length_s > time_interval_s_ * (interpolation_number_ - 1 + number_of_allowed_missing_records_) + 1e-4) return;
+    is_valid_ = true;
+
+    if (std::abs(time - times_[nearest_index_]) < 1e-4) {
+      for (size_t array_id = 0; array_id < values_.size(); ++array_id) interpolated_values_[array_id] = values_[array_id][nearest_index_];
+      return;
+    }
+    const double w = libra::tau / (24.0 * 60.0 * 60.0) * 1.03;  // coefficient of a day long
+    interpolated_values_.assign(values_.size(), 0.0);
+    for (int i : window_) {
+      double weight = 1.0;
+      for (int j : window_) {
+        if (i == j) continue;
+        if (is_trigonometric_) {
+          weight *= sin(w * (time - times_[j]) / 2.0) / sin(w * (times_[i] - times_[j]) / 2.0);
+        } else {
+          weight *= (time - times_[j]) / (times_[i] - times_[j]);
+        }
+      }
+      for (size_t array_id = 0; array_id < values_.size(); ++array_id) interpolated_values_[array_id] += weight * values_[array_id][i];
+    }
+  }
+};
+
+/**
+ * @fn ReadAllRecords
+ * @brief Read all records of the satellites from the binary file written by WriteBinaryFile
+ * @param [in] binary_file_path: Path to the binary file
+ * @param [out] times: Unix times of the records [satellite][record]
+ * @param [out] values: Values of the records [satellite][array][record]
+ */
+void ReadAllRecords(const std::string& binary_file_path, std::vector<std::vector<double>>& times,
+                    std::vector<std::vector<std::vector<double>>>& values) {
+  TimeSeriesTableFile binary_file;
+  ASSERT_TRUE(binary_file.Open(binary_file_path));
+  times.resize(binary_file.GetNumberOfObjects());
+  values.resize(binary_file.GetNumberOfObjects());
+  for (size_t object_id = 0; object_id < binary_file.GetNumberOfObjects(); ++object_id) {
+    binary_file.ReadWindow(object_id, -1.0e300, 1.0e300, 0, times[object_id], values[object_id]);
+  }
+}
+
+/**
+ * @brief Test for the positions and the clocks read from the binary file compared with the ones read from the text file
+ */
+TEST(GnssSatellites, BinaryFileEquality) {
+  const std::string position_binary_file = "test_gnss_satellites_position.bin";
+  const std::string clock_binary_file = "test_gnss_satellites_clock.bin";
+  const std::string position_source = "sp3/\nIGS\nigs19030.sp3\nigs19030.sp3";
+  const std::string clock_source = "sp3/\nIGS\nigs19030.sp3\nigs19030.sp3\n.sp3\n" + position_source;
+
+  std::vector<std::vector<std::string>> position_file = {MakeSp3Page()};
+  std::vector<std::vector<std::string>> clock_file = {MakeSp3Page()};
+  GnssSat_Info text_info;
+  text_info.Init(position_file, 1, 9, kNotUse, clock_file, ".sp3", 3, kNotUse, position_binary_file, clock_binary_file, position_source,
+                 clock_source);
+
+  // The binary files are matched only with the same source
+  EXPECT_TRUE(IsGnssBinaryFileMatched(position_binary_file, position_source));
+  EXPECT_TRUE(IsGnssBinaryFileMatched(clock_binary_file, clock_source));
+  EXPECT_FALSE(IsGnssBinaryFileMatched(position_binary_file, "sp3/\nIGS\nigs19030.sp3\nigs19031.sp3"));
+  EXPECT_FALSE(IsGnssBinaryFileMatched(clock_binary_file, position_source));
+  EXPECT_FALSE(IsGnssBinaryFileMatched("test_gnss_satellites_missing.bin", position_source));
+
+  std::vector<std::vector<std::string>> empty_file;
+  GnssSat_Info binary_info;
+  binary_info.Init(empty_file, 1, 9, kNotUse, empty_file, ".sp3", 3, kNotUse, position_binary_file, clock_binary_file, position_source,
+                   clock_source);
+
+  // Simulation from 1 hour to 9 hours after the first epoch, which includes the gap from 5 hours to 5.75 hours
+  const double start_unix_time = GetFirstEpochUnixTime() + 3600.0;
+  const double end_unix_time = start_unix_time + 8.0 * 3600.0;
+  const double step_s = 10.0;
+  binary_info.LoadTimeWindow(start_unix_time, end_unix_time);
+  text_info.SetUp(start_unix_time, step_s);
+  binary_info.SetUp(start_unix_time, step_s);
+
+  size_t number_of_valid_updates = 0;
+  size_t number_of_invalid_updates = 0;
+  for (double unix_time = start_unix_time; unix_time <= end_unix_time; unix_time += step_s) {
+    text_info.Update(unix_time);
+    binary_info.Update(unix_time);
+    for (int gnss_satellite_id = 0; gnss_satellite_id < text_info.GetNumOfSatellites(); ++gnss_satellite_id) {
+      ASSERT_EQ(text_info.GetWhetherValid(gnss_satellite_id), binary_info.GetWhetherValid(gnss_satellite_id));
+      if (!text_info.GetWhetherValid(gnss_satellite_id)) continue;
+      for (size_t i = 0; i < 3; ++i) {
+        EXPECT_DOUBLE_EQ(text_info.GetSatellitePositionEcef(gnss_satellite_id)[i], binary_info.GetSatellitePositionEcef(gnss_satellite_id)[i]);
+        EXPECT_DOUBLE_EQ(text_info.GetSatellitePositionEci(gnss_satellite_id)[i], binary_info.GetSatellitePositionEci(gnss_satellite_id)[i]);
+      }
+      EXPECT_DOUBLE_EQ(text_info.GetSatelliteClock(gnss_satellite_id), binary_info.GetSatelliteClock(gnss_satellite_id));
+    }
+    // G01 is always valid, while G02 is invalid around the gap
+    EXPECT_TRUE(text_info.GetWhetherValid(0));
+    if (text_info.GetWhetherValid(kGapSatelliteNumber - 1)) {
+      number_of_valid_updates++;
+    } else {
+      number_of_invalid_updates++;
+    }
+  }
+  EXPECT_LT(0, number_of_valid_updates);
+  EXPECT_LT(0, number_of_invalid_updates);
+
+  remove(position_binary_file.c_str());
+  remove(clock_binary_file.c_str());
+}
+
+/**
+ * @brief Test for the interpolated positions and clocks compared with the interpolation which makes the window and the weights in each call
+ * @note The simulation runs from before the first epoch to after the last epoch over the gaps, so that the windows at the edges of the
+ *       tables and the windows over the missing records are checked.
+ */
+TEST(GnssSatellites, InterpolationPerCall) {
+  const std::string position_binary_file = "test_gnss_satellites_per_call_position.bin";
+  const std::string clock_binary_file = "test_gnss_satellites_per_call_clock.bin";
+  const int kPositionInterpolationNumber = 9;
+  const int kClockInterpolationNumber = 3;
+
+  std::vector<std::vector<std::string>> position_file = {MakeSp3Page()};
+  std::vector<std::vector<std::string>> clock_file = {MakeSp3Page()};
+  GnssSat_position position;
+  const std::pair<double, double> unix_time_period = position.Init(position_file, 1, kPositionInterpolationNumber, kNotUse);
+  GnssSat_clock clock;
+  clock.Init(clock_file, ".sp3", kClockInterpolationNumber, kNotUse, unix_time_period);
+
+  // The tables are read from the binary files since they are not exposed
+  std::vector<std::vector<double>> position_times, clock_times;
+  std::vector<std::vector<std::vector<double>>> position_values, clock_values;
+  ASSERT_TRUE(position.WriteBinaryFile(position_binary_file, unix_time_period, ""));
+  ASSERT_TRUE(clock.WriteBinaryFile(clock_binary_file, ""));
+  ReadAllRecords(position_binary_file, position_times, position_values);
+  ReadAllRecords(clock_binary_file, clock_times, clock_values);
+  remove(position_binary_file.c_str());
+  remove(clock_binary_file.c_str());
+  ASSERT_EQ((size_t)position.GetNumOfSatellites(), position_times.size());
+  ASSERT_EQ((size_t)clock.GetNumOfSatellites(), clock_times.size());
+
+  std::vector<PerCallInterpolationForTest> position_references, clock_references;
+  for (int gnss_satellite_id = 0; gnss_satellite_id < position.GetNumOfSatellites(); ++gnss_satellite_id) {
+    position_references.emplace_back(position_times[gnss_satellite_id], position_values[gnss_satellite_id], kPositionInterpolationNumber,
+                                     kEpochInterval_s, 3, true);
+    clock_references.emplace_back(clock_times[gnss_satellite_id], clock_values[gnss_satellite_id], kClockInterpolationNumber, kEpochInterval_s,
+                                  0, false);
+  }
+
+  // Simulation from 300 sec before the first epoch to 300 sec after the last epoch
+  const double start_unix_time = GetFirstEpochUnixTime() - 300.0;
+  const double end_unix_time = GetFirstEpochUnixTime() + (kNumberOfEpochs - 1) * kEpochInterval_s + 300.0;
+  const double step_s = 30.0;
+  position.SetUp(start_unix_time, step_s);
+  clock.SetUp(start_unix_time, step_s);
+  for (int gnss_satellite_id = 0; gnss_satellite_id < position.GetNumOfSatellites(); ++gnss_satellite_id) {
+    position_references[gnss_satellite_id].SetUp(start_unix_time);
+    clock_references[gnss_satellite_id].SetUp(start_unix_time);
+  }
+
+  const int short_gap_satellite_id = position.GetIndexFromID("P" + kShortGapSatellite);
+  std::vector<size_t> number_of_valid_positions(position.GetNumOfSatellites(), 0);
+  std::vector<size_t> number_of_valid_clocks(position.GetNumOfSatellites(), 0);
+  size_t number_of_valid_positions_without_clock = 0;
+  for (double unix_time = start_unix_time; unix_time <= end_unix_time; unix_time += step_s) {
+    if (unix_time != start_unix_time) {
+      position.Update(unix_time);
+      clock.Update(unix_time);
+      for (int gnss_satellite_id = 0; gnss_satellite_id < position.GetNumOfSatellites(); ++gnss_satellite_id) {
+        position_references[gnss_satellite_id].Update(unix_time);
+        clock_references[gnss_satellite_id].Update(unix_time);
+      }
+    }
+
+    for (int gnss_satellite_id = 0; gnss_satellite_id < position.GetNumOfSatellites(); ++gnss_satellite_id) {
+      const PerCallInterpolationForTest& position_reference = position_references[gnss_satellite_id];
+      const PerCallInterpolationForTest& clock_reference = clock_references[gnss_satellite_id];
+      ASSERT_EQ(position_reference.IsValid(), position.GetWhetherValid(gnss_satellite_id))
+          << position.GetIDFromIndex(gnss_satellite_id) << " at " << unix_time - start_unix_time << " sec";
+      ASSERT_EQ(clock_reference.IsValid(), clock.GetWhetherValid(gnss_satellite_id))
+          << clock.GetIDFromIndex(gnss_satellite_id) << " at " << unix_time - start_unix_time << " sec";
+      if (position_reference.IsValid()) {
+        number_of_valid_positions[gnss_satellite_id]++;
+        for (size_t i = 0; i < 3; ++i) {
+          EXPECT_DOUBLE_EQ(position_reference.GetValue(i), position.GetSatEcef(gnss_satellite_id)[i]);
+          EXPECT_DOUBLE_EQ(position_reference.GetValue(i + 3), position.GetSatEci(gnss_satellite_id)[i]);
+        }
+      }
+      if (clock_reference.IsValid()) {
+        number_of_valid_clocks[gnss_satellite_id]++;
+        EXPECT_DOUBLE_EQ(clock_reference.GetValue(0), clock.GetSatClock(gnss_satellite_id));
+      }
+    }
+    if (position.GetWhetherValid(short_gap_satellite_id) && !clock.GetWhetherValid(short_gap_satellite_id)) {
+      number_of_valid_positions_without_clock++;
+    }
+  }
+
+  // All satellites in the file are valid in the middle of the tables and invalid at the edges
+  const size_t number_of_steps = (size_t)((end_unix_time - start_unix_time) / step_s) + 1;
+  for (const std::string& satellite : kSatellites) {
+    const int gnss_satellite_id = position.GetIndexFromID("P" + satellite);
+    EXPECT_LT(0, number_of_valid_positions[gnss_satellite_id]) << satellite;
+    EXPECT_GT(number_of_steps, number_of_valid_positions[gnss_satellite_id]) << satellite;
+    EXPECT_LT(0, number_of_valid_clocks[gnss_satellite_id]) << satellite;
+    EXPECT_GT(number_of_steps, number_of_valid_clocks[gnss_satellite_id]) << satellite;
+  }
+  // The short gap is allowed for the position but not for the clock
+  EXPECT_LT(0, number_of_valid_positions_without_clock);
+}
@@ -10,10 +10,12 @@
 #include <string>
 #include <vector>
 
+#include "atmosphere_density_cache.hpp"
 #include "library/external/nrlmsise00/wrapper_nrlmsise00.hpp"
 #include "library/geodesy/geodetic_position.hpp"
 #include "library/logger/loggable.hpp"
 #include "library/math/vector.hpp"
+#include "library/randomization/normal_randomization.hpp"
 
 /**
  * @class Atmosphere
@@ -33,9 +35,10 @@ class Atmosphere : public ILoggable {
    * @param [in] manual_f107: Manual value of daily F10.7
    * @param [in] manual_f107a: Manual value of averaged F10.7 (3-month averaged value)
    * @param [in] manual_ap: Manual value of ap value
+   * @param [in] is_density_cache_used: Flag to interpolate the NRLMSISE00 density tabulated on a grid for each day
    */
   Atmosphere(const std::string model, const std::string initialize_file_name, const double gauss_standard_deviation_rate, const bool is_manual_param,
-             const double manual_f107, const double manual_f107a, const double manual_ap);
+             const double manual_f107, const double manual_f107a, const double manual_ap, const bool is_density_cache_used);
   /**
    * @fn ~Atmosphere
    * @brief Destructor
@@ -67,21 +70,31 @@ class Atmosphere : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
  private:
-  std::string model_;                                //!< Atmospheric density model name
-  std::string initialize_file_name_;                 //!< Path and name of initialize file
-  double air_density_kg_m3_;                         //!< Atmospheric density [kg/m^3]
-  double gauss_standard_deviation_rate_;             //!< Standard deviation of density noise (defined as percentage)
-  std::vector<nrlmsise_table> space_weather_table_;  //!< Space weather table
-  bool is_space_weather_table_imported_;             //!< Flag of the space weather table is imported or not
-  bool is_manual_param_used_;                        //!< Flag to use manual parameters
+  std::string model_;                                 //!< Atmospheric density model name
+  std::string initialize_file_name_;                  //!< Path and name of initialize file
+  double air_density_kg_m3_;                          //!< Atmospheric density [kg/m^3]
+  double gauss_standard_deviation_rate_;              //!< Standard deviation of density noise (defined as percentage)
+  libra::NormalRand noise_;                           //!< Density noise generator
+  std::vector<nrlmsise_table> space_weather_table_;   //!< Space weather table
+  SpaceWeatherTableIndex space_weather_table_index_;  //!< Index of the space weather table
+  bool is_space_weather_table_imported_;              //!< Flag of the space weather table is imported or not
+  bool is_manual_param_used_;                         //!< Flag to use manual parameters
 
   // Reference of the following setting parameters https://www.swpc.noaa.gov/phenomena/f107-cm-radio-emissions
   double manual_daily_f107_;    //!< Manual daily f10.7 value
   double manual_average_f107_;  //!< Manual 3-month averaged f10.7 value
   double manual_ap_;            //!< Manual ap value Ref: http://wdc.kugi.kyoto-u.ac.jp/kp/kpexp-j.html
 
+  bool is_density_cache_used_;            //!< Flag to use the density cache for NRLMSISE00
+  AtmosphereDensityCache density_cache_;  //!< Density cache for NRLMSISE00
+
   // TODO: Add random walk noise
   //  double rw_stepwidth_;
   //  double rw_stddev_;
@@ -0,0 +1,88 @@
+/**
+ * @file atmosphere_density_cache.cpp
+ * @brief Class to interpolate NRLMSISE-00 density tabulated on a grid for each day
+ */
+
+#include "atmosphere_density_cache.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include "library/external/nrlmsise00/wrapper_nrlmsise00.hpp"
+#include "library/math/constants.hpp"
+
+AtmosphereDensityCache::AtmosphereDensityCache() {}
+
+double AtmosphereDensityCache::CalcAirDensity_kg_m3(const double decimal_year, const double latitude_rad, const double longitude_rad,
+                                                    const double altitude_m, const double f107, const double f107a, const double ap) {
+  int day_of_year;
+  double time_of_day_s;
+  ConvertDecyearToNrlmsiseTime(decimal_year, day_of_year, time_of_day_s);
+
+  if (altitude_m < kMinAltitude_m || altitude_m > kMaxAltitude_m) {
+    return CalcNRLMSISE00Density(day_of_year, time_of_day_s, latitude_rad, longitude_rad, altitude_m, f107, f107a, ap);
+  }
+
+  if (day_of_year != day_of_year_ || f107 != f107_ || f107a != f107a_ || ap != ap_) {
+    log_density_nodes_.clear();
+    day_of_year_ = day_of_year;
+    f107_ = f107;
+    f107a_ = f107a;
+    ap_ = ap;
+  }
+
+  // Position in the grid
+  const double longitude_deg = longitude_rad * libra::rad_to_deg;
+  double wrapped_longitude_deg = fmod(longitude_deg + 180.0, 360.0);
+  if (wrapped_longitude_deg < 0.0) wrapped_longitude_deg += 360.0;
+  double local_time_h = fmod(time_of_day_s / 3600.0 + longitude_deg / 15.0, 24.0);
+  if (local_time_h < 0.0) local_time_h += 24.0;
+
+  const double grid_position[4] = {(latitude_rad * libra::rad_to_deg + 90.0) / kLatitudeStep_deg, wrapped_longitude_deg / kLongitudeStep_deg,
+                                   (altitude_m - kMinAltitude_m) / kAltitudeStep_m, local_time_h / kLocalTimeStep_h};
+  const int number_of_nodes[4] = {kNumberOfLatitudeNodes, kNumberOfLongitudeNodes, kNumberOfAltitudeNodes, kNumberOfLocalTimeNodes};
+  int base_index[4];
+  double fraction[4];
+  for (size_t axis = 0; axis < 4; axis++) {
+    base_index[axis] = std::min(std::max((int)floor(grid_position[axis]), 0), number_of_nodes[axis] - 2);
+    fraction[axis] = std::min(std::max(grid_position[axis] - base_index[axis], 0.0), 1.0);
+  }
+
+  // Multilinear interpolation of the logarithm with the 16 nodes around the position
+  double log_density = 0.0;
+  for (int corner = 0; corner < 16; corner++) {
+    int index[4];
+    double weight = 1.0;
+    for (size_t axis = 0; axis < 4; axis++) {
+      const int offset = (corner >> axis) & 1;
+      index[axis] = base_index[axis] + offset;
+      weight *= offset ? fraction[axis] : 1.0 - fraction[axis];
+    }
+    if (weight == 0.0) continue;
+    log_density += weight * GetLogDensity(index[0], index[1], index[2], index[3]);
+  }
+  return exp(log_density);
+}
+
+double AtmosphereDensityCache::GetLogDensity(const int latitude_index, const int longitude_index, const int altitude_index,
+                                             const int local_time_index) {
+  const uint32_t key =
+      ((latitude_index * kNumberOfLongitudeNodes + longitude_index) * kNumberOfAltitudeNodes + altitude_index) * kNumberOfLocalTimeNodes +
+      local_time_index;
+  const auto node = log_density_nodes_.find(key);
+  if (node != log_density_nodes_.end()) return node->second;
+
+  const double latitude_deg = latitude_index * kLatitudeStep_deg - 90.0;
+  const double longitude_deg = longitude_index * kLongitudeStep_deg - 180.0;
+  const double altitude_m = kMinAltitude_m + altitude_index * kAltitudeStep_m;
+  // The time of day is selected so that NRLMSISE-00 calculates the local solar time of the node
+  double time_of_day_s = fmod((local_time_index * kLocalTimeStep_h - longitude_deg / 15.0) * 3600.0, 86400.0);
+  if (time_of_day_s < 0.0) time_of_day_s += 86400.0;
+
+  const double density_kg_m3 = CalcNRLMSISE00Density(day_of_year_, time_of_day_s, latitude_deg * libra::deg_to_rad, longitude_deg * libra::deg_to_rad,
+                                                     altitude_m, f107_, f107a_, ap_);
+  const double log_density = log(std::max(density_kg_m3, DBL_MIN));
+  log_density_nodes_[key] = log_density;
+  return log_density;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file atmosphere_density_cache.hpp
+ * @brief Class to interpolate NRLMSISE-00 density tabulated on a grid for each day
+ */
+
+#ifndef S2E_ENVIRONMENT_LOCAL_ATMOSPHERE_DENSITY_CACHE_HPP_
+#define S2E_ENVIRONMENT_LOCAL_ATMOSPHERE_DENSITY_CACHE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+/**
+ * @class AtmosphereDensityCache
+ * @brief Class to interpolate NRLMSISE-00 density tabulated on a grid for each day
+ * @details The logarithm of the density is tabulated on a latitude, longitude, altitude, and local solar time grid and interpolated
+ *          multilinearly. The grid nodes are calculated with NRLMSISE-00 when they are used at first, so only the nodes around the orbit are
+ *          calculated. The table is cleared when the day of year or the space weather parameters change.
+ *          The density out of the altitude range of the grid is calculated with NRLMSISE-00 directly.
+ */
+class AtmosphereDensityCache {
+ public:
+  /**
+   * @fn AtmosphereDensityCache
+   * @brief Constructor
+   */
+  AtmosphereDensityCache();
+
+  /**
+   * @fn CalcAirDensity_kg_m3
+   * @brief Calculate the atmospheric density by interpolating the grid
+   * @param [in] decimal_year: Decimal year
+   * @param [in] latitude_rad: Latitude [rad]
+   * @param [in] longitude_rad: Longitude [rad]
+   * @param [in] altitude_m: Altitude [m]
+   * @param [in] f107: Daily F10.7
+   * @param [in] f107a: 81 day averaged F10.7
+   * @param [in] ap: Ap-index
+   * @return Atmospheric density [kg/m3]
+   */
+  double CalcAirDensity_kg_m3(const double decimal_year, const double latitude_rad, const double longitude_rad, const double altitude_m,
+                              const double f107, const double f107a, const double ap);
+
+  // Getter
+  /**
+   * @fn GetNumberOfCalculatedNodes
+   * @brief Return number of the grid nodes calculated in the current day
+   */
+  inline size_t GetNumberOfCalculatedNodes() const { return log_density_nodes_.size(); }
+
+ private:
+  // Grid settings
+  static constexpr double kLatitudeStep_deg = 5.0;    //!< Latitude step of the grid [deg]
+  static constexpr double kLongitudeStep_deg = 15.0;  //!< Longitude step of the grid [deg]
+  static constexpr double kAltitudeStep_m = 10.0e3;   //!< Altitude step of the grid [m]
+  static constexpr double kMinAltitude_m = 100.0e3;   //!< Minimum altitude of the grid [m]
+  static constexpr double kMaxAltitude_m = 1000.0e3;  //!< Maximum altitude of the grid [m]
+  static constexpr double kLocalTimeStep_h = 1.0;     //!< Local solar time step of the grid [hour]
+  static constexpr int kNumberOfLatitudeNodes = 37;   //!< Number of nodes in latitude direction
+  static constexpr int kNumberOfLongitudeNodes = 25;  //!< Number of nodes in longitude direction
+  static constexpr int kNumberOfAltitudeNodes = 91;   //!< Number of nodes in altitude direction
+  static constexpr int kNumberOfLocalTimeNodes = 25;  //!< Number of nodes in local solar time direction
+
+  int day_of_year_ = -1;                                    //!< Day of year of the grid
+  double f107_ = 0.0;                                       //!< Daily F10.7 of the grid
+  double f107a_ = 0.0;                                      //!< 81 day averaged F10.7 of the grid
+  double ap_ = 0.0;                                         //!< Ap-index of the grid
+  std::unordered_map<uint32_t, double> log_density_nodes_;  //!< Logarithm of the density at the calculated nodes
+
+  /**
+   * @fn GetLogDensity
+   * @brief Return logarithm of the density at the grid node. The node is calculated when it is not calculated yet.
+   * @param [in] latitude_index: Index of the node in latitude direction
+   * @param [in] longitude_index: Index of the node in longitude direction
+   * @param [in] altitude_index: Index of the node in altitude direction
+   * @param [in] local_time_index: Index of the node in local solar time direction
+   */
+  double GetLogDensity(const int latitude_index, const int longitude_index, const int altitude_index, const int local_time_index);
+};
+
+#endif  // S2E_ENVIRONMENT_LOCAL_ATMOSPHERE_DENSITY_CACHE_HPP_
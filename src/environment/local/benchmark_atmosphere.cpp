@@ -0,0 +1,164 @@
+/**
+ * @file benchmark_atmosphere.cpp
+ * @brief Benchmark and accuracy report of the NRLMSISE00 density cache against the direct calculation
+ * @note Usage: benchmark_atmosphere [altitude km] [inclination deg] [duration day]
+ *       The density is calculated along circular orbits with the manual space weather parameters. Without the arguments, the orbits of 200 to
+ *       800 km altitude and 51.6 and 97.8 deg inclination are calculated for 1 day.
+ *       The linked NRLMSISE00 library is checked with the first case of the test program of the library (nrlmsise-00_test.c) at first, since
+ *       the accuracy report is meaningless with a different model.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <environment/global/physical_constants.hpp>
+#include <environment/local/atmosphere.hpp>
+#include <iostream>
+#include <library/math/constants.hpp>
+#include <vector>
+
+extern "C" {
+#include <nrlmsise-00.h>
+}
+
+/**
+ * @fn IsReferenceDensityReproduced
+ * @brief Return true when the linked NRLMSISE00 library reproduces the total mass density of the first case of nrlmsise-00_test.c
+ */
+bool IsReferenceDensityReproduced() {
+  struct nrlmsise_output output;
+  struct nrlmsise_input input;
+  struct nrlmsise_flags flags;
+  struct ap_array aph;
+  flags.switches[0] = 0;
+  for (size_t i = 1; i < 24; i++) flags.switches[i] = 1;
+  for (size_t i = 0; i < 7; i++) aph.a[i] = 100.0;
+  input.doy = 172;
+  input.year = 0;
+  input.sec = 29000.0;
+  input.alt = 400.0;
+  input.g_lat = 60.0;
+  input.g_long = -70.0;
+  input.lst = 16.0;
+  input.f107A = 150.0;
+  input.f107 = 150.0;
+  input.ap = 4.0;
+  input.ap_a = &aph;
+  gtd7(&input, &flags, &output);
+
+  const double reference_density_g_cm3 = 4.074714e-15;
+  std::cout << "Reference density: " << output.d[5] << " g/cm3 (expected " << reference_density_g_cm3 << " g/cm3)" << std::endl;
+  return fabs(output.d[5] / reference_density_g_cm3 - 1.0) < 1.0e-5;
+}
+
+/**
+ * @fn CalcDensityAlongOrbit
+ * @brief Calculate the density along the orbit and return the calculation time [sec]
+ * @param [in] atmosphere: Atmosphere model
+ * @param [in] positions: Positions on the orbit
+ * @param [in] decimal_years: Decimal year of each position
+ * @param [out] densities_kg_m3: Calculated densities [kg/m3]
+ */
+double CalcDensityAlongOrbit(Atmosphere& atmosphere, const std::vector<GeodeticPosition>& positions, const std::vector<double>& decimal_years,
+                             std::vector<double>& densities_kg_m3) {
+  densities_kg_m3.resize(positions.size());
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < positions.size(); i++) {
+    densities_kg_m3[i] = atmosphere.CalcAirDensity_kg_m3(decimal_years[i], 0.0, positions[i]);
+  }
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @fn ReportOrbit
+ * @brief Compare the density cache with the direct NRLMSISE00 calculation along a circular orbit and print the result
+ * @param [in] altitude_km: Altitude of the orbit [km]
+ * @param [in] inclination_deg: Inclination of the orbit [deg]
+ * @param [in] duration_day: Duration [day]
+ * @param [out] relative_errors: Relative errors of the cached densities are appended
+ */
+void ReportOrbit(const double altitude_km, const double inclination_deg, const double duration_day, std::vector<double>& relative_errors) {
+  // Circular orbit sampled every 10 sec
+  const double start_decimal_year = 2023.0;
+  const double step_s = 10.0;
+  const double radius_m = environment::earth_equatorial_radius_m + altitude_km * 1000.0;
+  const double mean_motion_rad_s = sqrt(environment::earth_gravitational_constant_m3_s2 / (radius_m * radius_m * radius_m));
+  const double inclination_rad = inclination_deg * libra::deg_to_rad;
+  std::vector<GeodeticPosition> positions;
+  std::vector<double> decimal_years;
+  for (double time_s = 0.0; time_s < duration_day * 86400.0; time_s += step_s) {
+    const double argument_of_latitude_rad = mean_motion_rad_s * time_s;
+    const double latitude_rad = asin(sin(inclination_rad) * sin(argument_of_latitude_rad));
+    const double longitude_rad = atan2(cos(inclination_rad) * sin(argument_of_latitude_rad), cos(argument_of_latitude_rad)) -
+                                 environment::earth_mean_angular_velocity_rad_s * time_s;
+    positions.push_back(GeodeticPosition(latitude_rad, atan2(sin(longitude_rad), cos(longitude_rad)), altitude_km * 1000.0));
+    decimal_years.push_back(start_decimal_year + time_s / 86400.0 / 365.0);
+  }
+
+  Atmosphere direct_atmosphere("NRLMSISE00", "", 0.0, true, 150.0, 150.0, 3.0, false);
+  Atmosphere cached_atmosphere("NRLMSISE00", "", 0.0, true, 150.0, 150.0, 3.0, true);
+  std::vector<double> direct_densities_kg_m3;
+  std::vector<double> cached_densities_kg_m3;
+  const double direct_time_s = CalcDensityAlongOrbit(direct_atmosphere, positions, decimal_years, direct_densities_kg_m3);
+  const double cached_time_s = CalcDensityAlongOrbit(cached_atmosphere, positions, decimal_years, cached_densities_kg_m3);
+  // The second pass uses the nodes calculated in the first pass
+  const double warm_cached_time_s = CalcDensityAlongOrbit(cached_atmosphere, positions, decimal_years, cached_densities_kg_m3);
+
+  double max_relative_error = 0.0;
+  double sum_squared_relative_error = 0.0;
+  for (size_t i = 0; i < positions.size(); i++) {
+    const double relative_error = cached_densities_kg_m3[i] / direct_densities_kg_m3[i] - 1.0;
+    if (fabs(relative_error) > max_relative_error) max_relative_error = fabs(relative_error);
+    sum_squared_relative_error += relative_error * relative_error;
+    relative_errors.push_back(relative_error);
+  }
+
+  std::cout << altitude_km << " km, " << inclination_deg << " deg, " << positions.size() << " samples" << std::endl;
+  std::cout << "  Direct: " << positions.size() / direct_time_s << " calculations/s" << std::endl;
+  std::cout << "  Cached: " << positions.size() / cached_time_s << " calculations/s including the node calculation (speedup "
+            << direct_time_s / cached_time_s << ")" << std::endl;
+  std::cout << "  Cached: " << positions.size() / warm_cached_time_s << " calculations/s with the calculated nodes (speedup "
+            << direct_time_s / warm_cached_time_s << ")" << std::endl;
+  std::cout << "  Max relative error: " << max_relative_error << ", RMS relative error: " << sqrt(sum_squared_relative_error / positions.size())
+            << std::endl;
+}
+
+/**
+ * @fn main
+ * @brief Compare the density cache with the direct NRLMSISE00 calculation along circular orbits
+ */
+int main(int argc, char* argv[]) {
+  const bool is_reference_reproduced = IsReferenceDensityReproduced();
+  if (!is_reference_reproduced) {
+    std::cout << "WARNING: The linked NRLMSISE00 library does not reproduce the reference case. The errors below are not the ones of NRLMSISE-00."
+              << std::endl;
+  }
+  std::cout << "Grid: 5 deg latitude, 15 deg longitude, 10 km altitude, 1 hour local time" << std::endl;
+
+  std::vector<double> relative_errors;
+  if (argc > 1) {
+    const double altitude_km = atof(argv[1]);
+    const double inclination_deg = argc > 2 ? atof(argv[2]) : 51.6;
+    const double duration_day = argc > 3 ? atof(argv[3]) : 1.0;
+    ReportOrbit(altitude_km, inclination_deg, duration_day, relative_errors);
+  } else {
+    const double altitudes_km[4] = {200.0, 400.0, 600.0, 800.0};
+    const double inclinations_deg[2] = {51.6, 97.8};
+    for (double altitude_km : altitudes_km) {
+      for (double inclination_deg : inclinations_deg) {
+        ReportOrbit(altitude_km, inclination_deg, 1.0, relative_errors);
+      }
+    }
+  }
+
+  double max_relative_error = 0.0;
+  double sum_squared_relative_error = 0.0;
+  for (double relative_error : relative_errors) {
+    if (fabs(relative_error) > max_relative_error) max_relative_error = fabs(relative_error);
+    sum_squared_relative_error += relative_error * relative_error;
+  }
+  std::cout << "All orbits: Max relative error: " << max_relative_error
+            << ", RMS relative error: " << sqrt(sum_squared_relative_error / relative_errors.size()) << std::endl;
+
+  return is_reference_reproduced ? 0 : 1;
+}
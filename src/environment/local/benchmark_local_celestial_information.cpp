@@ -0,0 +1,115 @@
+/**
+ * @file benchmark_local_celestial_information.cpp
+ * @brief Benchmark of the celestial body position access with the body name and the ID
+ * @note The single sun access and the accesses of a simulation step of the components and the environments which resolve the IDs are measured.
+ *       Usage: benchmark_local_celestial_information [simulation base ini file path]
+ *       The CSPICE kernels written in the ini file are loaded. The default path is the sample simulation base file.
+ */
+
+#include <chrono>
+#include <environment/global/initialize_global_environment.hpp>
+#include <environment/local/local_celestial_information.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @fn MeasureAccessPerSecond
+ * @brief Measure number of accesses per second for the access function
+ * @param [in] access: Function to access a position and return a value for the checksum
+ * @param [in] unit: Unit of a call of the access function
+ */
+template <typename Access>
+void MeasureAccessPerSecond(const std::string name, Access access, const std::string unit = "accesses") {
+  // Run at least 0.5 sec
+  size_t number_of_accesses = 0;
+  double sum = 0.0;
+  double elapsed_time_s = 0.0;
+  auto start = std::chrono::steady_clock::now();
+  while (elapsed_time_s < 0.5) {
+    for (size_t i = 0; i < 1000; i++) {
+      sum += access();
+    }
+    number_of_accesses += 1000;
+    elapsed_time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+  std::cout << name << ": " << number_of_accesses / elapsed_time_s << " " << unit << "/s (checksum " << sum << ")" << std::endl;
+}
+
+/**
+ * @struct CelestialAccess
+ * @brief Position access of a celestial body in a simulation step
+ */
+struct CelestialAccess {
+  std::string user;     //!< Component or environment which accesses the position
+  std::string body;     //!< Name of the body
+  bool is_body_frame;   //!< Position in the body frame or the inertial frame
+  unsigned int id = 0;  //!< ID of the body resolved at the initialization
+};
+
+/**
+ * @fn main
+ * @brief Compare the position access with the SPICE name lookup, the selected body name, and the resolved ID
+ */
+int main(int argc, char *argv[]) {
+  std::string ini_file_name = "../../data/sample/initialize_files/sample_simulation_base.ini";
+  if (argc > 1) ini_file_name = argv[1];
+
+  CelestialInformation *celestial_information = InitCelestialInformation(ini_file_name);
+  celestial_information->UpdateAllObjectsInformation(2459945.5);  // 2023/01/01 00:00:00 UTC
+  LocalCelestialInformation local_celestial_information(celestial_information);
+
+  libra::Vector<3> spacecraft_position_i_m(0.0);
+  spacecraft_position_i_m[0] = 7000.0e3;
+  libra::Vector<3> spacecraft_velocity_i_m_s(0.0);
+  spacecraft_velocity_i_m_s[1] = 7.5e3;
+  local_celestial_information.UpdateAllObjectsInformation(spacecraft_position_i_m, spacecraft_velocity_i_m_s, libra::Quaternion(0.0, 0.0, 0.0, 1.0),
+                                                          libra::Vector<3>(0.0));
+
+  // The lower case name does not match the selected body names, so the SPICE lookup is used as before.
+  MeasureAccessPerSecond("SPICE name lookup", [&]() { return local_celestial_information.GetPositionFromSpacecraft_b_m("sun")[0]; });
+  MeasureAccessPerSecond("Selected body name", [&]() { return local_celestial_information.GetPositionFromSpacecraft_b_m("SUN")[0]; });
+  const unsigned int sun_id = celestial_information->CalcBodyIdFromName("SUN");
+  MeasureAccessPerSecond("Resolved ID", [&]() { return local_celestial_information.GetPositionFromSpacecraft_b_m(sun_id)[0]; });
+
+  // Accesses in a simulation step of the components and the environments which resolve the IDs at the initialization
+  std::vector<CelestialAccess> step_accesses = {
+      {"StarSensor", "SUN", true},
+      {"StarSensor", "EARTH", true},
+      {"StarSensor", "MOON", true},
+      {"Telescope", "SUN", true},
+      {"Telescope", "EARTH", true},
+      {"Telescope", "MOON", true},
+      {"SunSensor", "SUN", true},
+      {"SolarArrayPanel", "SUN", true},
+      {"Dynamics", "SUN", true},
+      {"SrpEnvironment", "SUN", false},
+      {"SrpEnvironment", "EARTH", false},
+      {"ControlledAttitude", "SUN", false},
+  };
+  for (auto &access : step_accesses) access.id = celestial_information->CalcBodyIdFromName(access.body.c_str());
+  auto access_position = [&](const CelestialAccess &access, const bool use_id) {
+    if (access.is_body_frame) {
+      return use_id ? local_celestial_information.GetPositionFromSpacecraft_b_m(access.id)[0]
+                    : local_celestial_information.GetPositionFromSpacecraft_b_m(access.body.c_str())[0];
+    }
+    return use_id ? local_celestial_information.GetPositionFromSpacecraft_i_m(access.id)[0]
+                  : local_celestial_information.GetPositionFromSpacecraft_i_m(access.body.c_str())[0];
+  };
+  std::cout << std::endl << "Simulation step with " << step_accesses.size() << " accesses of the sensor suite and the environments" << std::endl;
+  auto step_with_names = [&]() {
+    double sum = 0.0;
+    for (const auto &access : step_accesses) sum += access_position(access, false);
+    return sum;
+  };
+  auto step_with_ids = [&]() {
+    double sum = 0.0;
+    for (const auto &access : step_accesses) sum += access_position(access, true);
+    return sum;
+  };
+  MeasureAccessPerSecond("Step with body names", step_with_names, "steps");
+  MeasureAccessPerSecond("Step with resolved IDs", step_with_ids, "steps");
+
+  delete celestial_information;
+  return 0;
+}
@@ -5,11 +5,10 @@
 
 #include "geomagnetic_field.hpp"
 
-#include "library/external/igrf/igrf.h"
+#include <iostream>
+
 #include "library/initialize/initialize_file_access.hpp"
 #include "library/randomization/global_randomization.hpp"
-#include "library/randomization/normal_randomization.hpp"
-#include "library/randomization/random_walk.hpp"
 
 GeomagneticField::GeomagneticField(const std::string igrf_file_name, const double random_walk_srandard_deviation_nT,
                                    const double random_walk_limit_nT, const double white_noise_standard_deviation_nT)
@@ -18,8 +17,15 @@ GeomagneticField::GeomagneticField(const std::string igrf_file_name, const doubl
       random_walk_standard_deviation_nT_(random_walk_srandard_deviation_nT),
       random_walk_limit_nT_(random_walk_limit_nT),
       white_noise_standard_deviation_nT_(white_noise_standard_deviation_nT),
-      igrf_file_name_(igrf_file_name) {
-  set_file_path(igrf_file_name_.c_str());
+      igrf_file_name_(igrf_file_name),
+      random_walk_(0.1, libra::Vector<3>(random_walk_srandard_deviation_nT), libra::Vector<3>(random_walk_limit_nT)),
+      white_noise_(0.0, white_noise_standard_deviation_nT, global_randomization.MakeSeed()) {
+  const IgrfCoefficients* coefficients = LoadIgrfCoefficients(igrf_file_name_);
+  if (coefficients == nullptr) {
+    std::cerr << "GeomagneticField: the calculation is disabled." << std::endl;
+    IsCalcEnabled = false;
+  }
+  igrf_model_ = IgrfModel(coefficients);
 }
 
 void GeomagneticField::CalcMagneticField(const double decimal_year, const double sidereal_day, const GeodeticPosition position,
@@ -31,7 +37,10 @@ void GeomagneticField::CalcMagneticField(const double decimal_year, const double
   const double alt_m = position.GetAltitude_m();
 
   double magnetic_field_array_i_nT[3];
-  IgrfCalc(decimal_year, lat_rad, lon_rad, alt_m, sidereal_day, magnetic_field_array_i_nT);
+  const libra::Vector<3> igrf_magnetic_field_i_nT = igrf_model_.CalcMagneticField_i_nT(decimal_year, lat_rad, lon_rad, alt_m, sidereal_day);
+  for (int i = 0; i < 3; ++i) {
+    magnetic_field_array_i_nT[i] = igrf_magnetic_field_i_nT[i];
+  }
   AddNoise(magnetic_field_array_i_nT);
   for (int i = 0; i < 3; ++i) {
     magnetic_field_i_nT_[i] = magnetic_field_array_i_nT[i];
@@ -40,16 +49,10 @@ void GeomagneticField::CalcMagneticField(const double decimal_year, const double
 }
 
 void GeomagneticField::AddNoise(double* magnetic_field_array_i_nT) {
-  static libra::Vector<3> standard_deviation(random_walk_standard_deviation_nT_);
-  static libra::Vector<3> limit(random_walk_limit_nT_);
-  static RandomWalk<3> random_walk(0.1, standard_deviation, limit);
-
-  static libra::NormalRand white_noise(0.0, white_noise_standard_deviation_nT_, global_randomization.MakeSeed());
-
   for (int i = 0; i < 3; ++i) {
-    magnetic_field_array_i_nT[i] += random_walk[i] + white_noise;
+    magnetic_field_array_i_nT[i] += random_walk_[i] + white_noise_;
   }
-  ++random_walk;  // Update random walk
+  ++random_walk_;  // Update random walk
 }
 
 std::string GeomagneticField::GetLogHeader() const {
@@ -69,3 +72,10 @@ std::string GeomagneticField::GetLogValue() const {
 
   return str_tmp;
 }
+
+bool GeomagneticField::GetLogValueBinary(std::vector<double>& values) const {
+  AppendVector(values, magnetic_field_i_nT_);
+  AppendVector(values, magnetic_field_b_nT_);
+
+  return true;
+}
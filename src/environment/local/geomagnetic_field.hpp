@@ -7,9 +7,12 @@
 #define S2E_ENVIRONMENT_LOCAL_GEOMAGNETIC_FIELD_HPP_
 
 #include "library/geodesy/geodetic_position.hpp"
+#include "library/geomagnetic/igrf_model.hpp"
 #include "library/logger/loggable.hpp"
 #include "library/math/quaternion.hpp"
 #include "library/math/vector.hpp"
+#include "library/randomization/normal_randomization.hpp"
+#include "library/randomization/random_walk.hpp"
 
 /**
  * @class GeomagneticField
@@ -68,6 +71,11 @@ class GeomagneticField : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
  private:
   libra::Vector<3> magnetic_field_i_nT_;      //!< Magnetic field vector at the inertial frame [nT]
@@ -77,6 +85,10 @@ class GeomagneticField : public ILoggable {
   double white_noise_standard_deviation_nT_;  //!< Standard deviation of white noise [nT]
   std::string igrf_file_name_;                //!< Path to the initialize file
 
+  IgrfModel igrf_model_;           //!< IGRF model with the coefficients shared by all instances
+  RandomWalk<3> random_walk_;      //!< Random walk noise
+  libra::NormalRand white_noise_;  //!< White noise
+
   /**
    * @fn AddNoise
    * @brief Add magnetic field noise
@@ -64,8 +64,10 @@ Atmosphere InitAtmosphere(std::string initialize_file_path) {
     manual_average_f107 = f107_default;
   }
   double manual_ap = conf.ReadDouble(section, "manual_ap");
+  bool is_density_cache_used = conf.ReadEnable(section, "is_density_cache_used");
 
-  Atmosphere atmosphere(model, table_path, rho_stddev, is_manual_param_used, manual_daily_f107, manual_average_f107, manual_ap);
+  Atmosphere atmosphere(model, table_path, rho_stddev, is_manual_param_used, manual_daily_f107, manual_average_f107, manual_ap,
+                        is_density_cache_used);
   atmosphere.IsCalcEnabled = conf.ReadEnable(section, CALC_LABEL);
   atmosphere.is_log_enabled_ = conf.ReadEnable(section, LOG_LABEL);
 
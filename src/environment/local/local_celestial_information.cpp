@@ -5,8 +5,6 @@
 
 #include "local_celestial_information.hpp"
 
-#include <SpiceUsr.h>
-
 #include <algorithm>
 #include <iostream>
 #include <locale>
@@ -131,48 +129,44 @@ void LocalCelestialInformation::ConvertVelocityInertialToBody(const double* posi
   }
 }
 
-libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_i_m(const char* body_name) const {
-  libra::Vector<3> position;
-  int index = 0;
-  index = global_celestial_information_->CalcBodyIdFromName(body_name);
+libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_i_m(const unsigned int id) const {
+  libra::Vector<3> position(0.0);
+  if (id >= (unsigned int)global_celestial_information_->GetNumberOfSelectedBodies()) return position;
   for (int i = 0; i < 3; i++) {
-    position[i] = celestial_body_position_from_spacecraft_i_m_[index * 3 + i];
+    position[i] = celestial_body_position_from_spacecraft_i_m_[id * 3 + i];
   }
   return position;
 }
 
+libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_i_m(const char* body_name) const {
+  return GetPositionFromSpacecraft_i_m(global_celestial_information_->CalcBodyIdFromName(body_name));
+}
+
 libra::Vector<3> LocalCelestialInformation::GetCenterBodyPositionFromSpacecraft_i_m() const {
-  std::string body_name = global_celestial_information_->GetCenterBodyName();
-  libra::Vector<3> position = GetPositionFromSpacecraft_i_m(body_name.c_str());
-  return position;
+  return GetPositionFromSpacecraft_i_m(global_celestial_information_->GetCenterBodyId());
 }
 
-libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_b_m(const char* body_name) const {
-  libra::Vector<3> position;
-  int index = 0;
-  index = global_celestial_information_->CalcBodyIdFromName(body_name);
+libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_b_m(const unsigned int id) const {
+  libra::Vector<3> position(0.0);
+  if (id >= (unsigned int)global_celestial_information_->GetNumberOfSelectedBodies()) return position;
   for (int i = 0; i < 3; i++) {
-    position[i] = celestial_body_position_from_spacecraft_b_m_[index * 3 + i];
+    position[i] = celestial_body_position_from_spacecraft_b_m_[id * 3 + i];
   }
   return position;
 }
 
+libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_b_m(const char* body_name) const {
+  return GetPositionFromSpacecraft_b_m(global_celestial_information_->CalcBodyIdFromName(body_name));
+}
+
 libra::Vector<3> LocalCelestialInformation::GetCenterBodyPositionFromSpacecraft_b_m(void) const {
-  std::string body_name = global_celestial_information_->GetCenterBodyName();
-  libra::Vector<3> position = GetPositionFromSpacecraft_b_m(body_name.c_str());
-  return position;
+  return GetPositionFromSpacecraft_b_m(global_celestial_information_->GetCenterBodyId());
 }
 
 std::string LocalCelestialInformation::GetLogHeader() const {
-  SpiceBoolean found;
-  const int maxlen = 100;
-  char namebuf[maxlen];
   std::string str_tmp = "";
   for (int i = 0; i < global_celestial_information_->GetNumberOfSelectedBodies(); i++) {
-    SpiceInt planet_id = global_celestial_information_->GetSelectedBodyIds()[i];
-    // Acquisition of body name from id
-    bodc2n_c(planet_id, maxlen, namebuf, (SpiceBoolean*)&found);
-    std::string name = namebuf;
+    std::string name = global_celestial_information_->GetBodyName(i);
 
     std::locale loc = std::locale::classic();
     std::transform(name.begin(), name.end(), name.begin(), [loc](char c) { return std::tolower(c, loc); });
@@ -197,3 +191,16 @@ std::string LocalCelestialInformation::GetLogValue() const {
   }
   return str_tmp;
 }
+
+bool LocalCelestialInformation::GetLogValueBinary(std::vector<double>& values) const {
+  for (int i = 0; i < global_celestial_information_->GetNumberOfSelectedBodies(); i++) {
+    for (int j = 0; j < 3; j++) {
+      AppendScalar(values, celestial_body_position_from_spacecraft_b_m_[i * 3 + j]);
+    }
+    for (int j = 0; j < 3; j++) {
+      AppendScalar(values, celestial_body_velocity_from_spacecraft_b_m_s_[i * 3 + j]);
+    }
+  }
+
+  return true;
+}
@@ -41,6 +41,13 @@ class LocalCelestialInformation : public ILoggable {
   /**
    * @fn GetPositionFromSpacecraft_i_m
    * @brief Return position of a selected body (Origin: Spacecraft, Frame: Inertial frame)
+   * @param [in] id: ID of CelestialInformation list
+   */
+  libra::Vector<3> GetPositionFromSpacecraft_i_m(const unsigned int id) const;
+  /**
+   * @fn GetPositionFromSpacecraft_i_m
+   * @brief Return position of a selected body (Origin: Spacecraft, Frame: Inertial frame)
+   * @note Use the ID version with the ID resolved by CelestialInformation::CalcBodyIdFromName for the access at every step
    * @param [in] body_name Celestial body name
    */
   libra::Vector<3> GetPositionFromSpacecraft_i_m(const char* body_name) const;
@@ -53,6 +60,13 @@ class LocalCelestialInformation : public ILoggable {
   /**
    * @fn GetPositionFromSpacecraft_b_m
    * @brief Return position of a selected body (Origin: Spacecraft, Frame: Body fixed frame)
+   * @param [in] id: ID of CelestialInformation list
+   */
+  libra::Vector<3> GetPositionFromSpacecraft_b_m(const unsigned int id) const;
+  /**
+   * @fn GetPositionFromSpacecraft_b_m
+   * @brief Return position of a selected body (Origin: Spacecraft, Frame: Body fixed frame)
+   * @note Use the ID version with the ID resolved by CelestialInformation::CalcBodyIdFromName for the access at every step
    * @param [in] body_name Celestial body name
    */
   libra::Vector<3> GetPositionFromSpacecraft_b_m(const char* body_name) const;
@@ -79,6 +93,11 @@ class LocalCelestialInformation : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
  private:
   const CelestialInformation* global_celestial_information_;  //!< Global celestial information
@@ -15,19 +15,20 @@
 SolarRadiationPressureEnvironment::SolarRadiationPressureEnvironment(LocalCelestialInformation* local_celestial_information)
     : local_celestial_information_(local_celestial_information) {
   solar_radiation_pressure_N_m2_ = solar_constant_W_m2_ / environment::speed_of_light_m_s;
-  shadow_source_name_ = local_celestial_information_->GetGlobalInformation().GetCenterBodyName();
-  sun_radius_m_ = local_celestial_information_->GetGlobalInformation().GetMeanRadiusFromName_m("SUN");
+  sun_id_ = local_celestial_information_->GetGlobalInformation().CalcBodyIdFromName("SUN");
+  shadow_source_id_ = local_celestial_information_->GetGlobalInformation().GetCenterBodyId();
+  sun_radius_m_ = local_celestial_information_->GetGlobalInformation().GetMeanRadius_m(sun_id_);
 }
 
 void SolarRadiationPressureEnvironment::UpdateAllStates() {
   if (!IsCalcEnabled) return;
 
   UpdatePressure();
-  CalcShadowCoefficient(shadow_source_name_);
+  CalcShadowCoefficient(shadow_source_id_);
 }
 
 void SolarRadiationPressureEnvironment::UpdatePressure() {
-  const libra::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m("SUN");
+  const libra::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(sun_id_);
   const double distance_sat_to_sun = r_sc2sun_eci.CalcNorm();
   solar_radiation_pressure_N_m2_ =
       solar_constant_W_m2_ / environment::speed_of_light_m_s / pow(distance_sat_to_sun / environment::astronomical_unit_m, 2.0);
@@ -51,16 +52,23 @@ std::string SolarRadiationPressureEnvironment::GetLogValue() const {
   return str_tmp;
 }
 
-void SolarRadiationPressureEnvironment::CalcShadowCoefficient(std::string shadow_source_name) {
-  if (shadow_source_name == "SUN") {
+bool SolarRadiationPressureEnvironment::GetLogValueBinary(std::vector<double>& values) const {
+  AppendScalar(values, solar_radiation_pressure_N_m2_ * shadow_coefficient_);
+  AppendScalar(values, shadow_coefficient_);
+
+  return true;
+}
+
+void SolarRadiationPressureEnvironment::CalcShadowCoefficient(const unsigned int shadow_source_id) {
+  if (shadow_source_id == sun_id_) {
     shadow_coefficient_ = 1.0;
     return;
   }
 
-  const libra::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m("SUN");
-  const libra::Vector<3> r_sc2source_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(shadow_source_name.c_str());
+  const libra::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(sun_id_);
+  const libra::Vector<3> r_sc2source_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(shadow_source_id);
 
-  const double shadow_source_radius_m = local_celestial_information_->GetGlobalInformation().GetMeanRadiusFromName_m(shadow_source_name.c_str());
+  const double shadow_source_radius_m = local_celestial_information_->GetGlobalInformation().GetMeanRadius_m(shadow_source_id);
 
   const double distance_sat_to_sun = r_sc2sun_eci.CalcNorm();
   const double sd_sun = asin(sun_radius_m_ / distance_sat_to_sun);                     // Apparent radius of the sun
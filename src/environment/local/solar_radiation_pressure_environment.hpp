@@ -78,13 +78,19 @@ class SolarRadiationPressureEnvironment : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
  private:
   double solar_radiation_pressure_N_m2_;  //!< Solar radiation pressure [N/m^2]
   double solar_constant_W_m2_ = 1366.0;   //!< Solar constant [W/m^2] TODO: We need to change the value depends on sun activity.
   double shadow_coefficient_ = 1.0;       //!< Shadow function
   double sun_radius_m_;                   //!< Sun radius [m]
-  std::string shadow_source_name_;        //!< Shadow source name
+  unsigned int sun_id_;                   //!< ID of the sun in CelestialInformation list
+  unsigned int shadow_source_id_;         //!< ID of the shadow source in CelestialInformation list
 
   LocalCelestialInformation* local_celestial_information_;  //!< Local celestial information
 
@@ -97,9 +103,9 @@ class SolarRadiationPressureEnvironment : public ILoggable {
   /**
    * @fn CalcShadowCoefficient
    * @brief Calculate shadow coefficient
-   * @param [in] shadow_source_name_: Shadow source name
+   * @param [in] shadow_source_id: ID of the shadow source in CelestialInformation list
    */
-  void CalcShadowCoefficient(std::string shadow_source_name);
+  void CalcShadowCoefficient(const unsigned int shadow_source_id);
 };
 
 #endif  // S2E_ENVIRONMENT_LOCAL_SOLAR_RADIATION_PRESSURE_ENVIRONMENT_HPP_
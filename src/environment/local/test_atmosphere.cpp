@@ -0,0 +1,143 @@
+/**
+ * @file test_atmosphere.cpp
+ * @brief Test codes for Atmosphere class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "atmosphere.hpp"
+
+// Layers of the exponential atmosphere model
+static const int kNumberOfLayers = 28;
+static const double kBaseHeight_km[kNumberOfLayers] = {0.0,   25.0,  30.0,  40.0,  50.0,  60.0,  70.0,  80.0,  90.0,  100.0,
+                                                       110.0, 120.0, 130.0, 140.0, 150.0, 180.0, 200.0, 250.0, 300.0, 350.0,
+                                                       400.0, 450.0, 500.0, 600.0, 700.0, 800.0, 900.0, 1000.0};
+static const double kScaleHeight_km[kNumberOfLayers] = {7.249,  6.349,  6.682,  7.554,  8.382,  7.714,  6.549,  5.799,  5.382,  5.877,
+                                                        7.263,  9.473,  12.636, 16.149, 22.523, 29.740, 37.105, 45.546, 53.628, 53.298,
+                                                        58.515, 60.828, 63.822, 71.835, 88.667, 124.64, 181.05, 268.0};
+static const double kBaseRho_kg_m3[kNumberOfLayers] = {1.225,     3.899E-2,  1.774E-2,  3.972E-3,  1.057E-3,  3.206E-4,  8.770E-5,
+                                                       1.905E-5,  3.396E-6,  5.297E-7,  9.661E-8,  2.438E-8,  8.484E-9,  3.845E-9,
+                                                       2.070E-9,  5.464E-10, 2.789E-10, 7.248E-11, 2.418E-11, 9.158E-12, 3.725E-12,
+                                                       1.585E-12, 6.967E-13, 1.454E-13, 3.614E-14, 1.170E-14, 5.245E-15, 3.019E-15};
+
+/**
+ * @brief Calculate the standard atmosphere density by the linear scan of the layers from the top as the previous if-else ladder
+ */
+double CalcStandardByLinearScan(const double altitude_m) {
+  const double altitude_km = altitude_m / 1000.0;
+  if (altitude_km > kBaseHeight_km[kNumberOfLayers - 1]) {
+    const int layer = kNumberOfLayers - 1;
+    return kBaseRho_kg_m3[layer] * exp(-(altitude_km - kBaseHeight_km[layer]) / kScaleHeight_km[layer]);
+  }
+  for (int layer = kNumberOfLayers - 2; layer >= 0; layer--) {
+    if (altitude_km >= kBaseHeight_km[layer] && altitude_km < kBaseHeight_km[layer + 1]) {
+      return kBaseRho_kg_m3[layer] * exp(-(altitude_km - kBaseHeight_km[layer]) / kScaleHeight_km[layer]);
+    }
+  }
+  return 0.0;
+}
+
+/**
+ * @brief Find the space weather table entry by the linear scan as the previous CalcNRLMSISE00
+ */
+size_t FindSpaceWeatherByLinearScan(const std::vector<nrlmsise_table>& table, const double decyear, const double decyear_monthly) {
+  int date[6];
+  ConvertDecyearToDate(decyear, date);
+  for (size_t i = 0; i < table.size(); i++) {
+    if (decyear < decyear_monthly) {
+      if ((date[0] == table[i].year) && (date[1] == table[i].month) && (date[2] == table[i].day)) return i;
+    } else {
+      if ((date[0] == table[i].year) && (date[1] == table[i].month)) return i;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief Make a line of the space weather file
+ */
+std::string MakeSpaceWeatherLine(const int year, const int month, const int day, const double f107) {
+  std::string line(132, ' ');
+  char field[16];
+  snprintf(field, sizeof(field), "%04d %02d %02d", year, month, day);
+  line.replace(0, 10, field);
+  line.replace(80, 3, " 10");
+  snprintf(field, sizeof(field), "%5.1f", f107);
+  line.replace(93, 5, field);
+  line.replace(101, 5, "100.0");
+  return line;
+}
+
+/**
+ * @brief Test for the binary search of the layer compared with the linear scan at and between the layer boundaries
+ */
+TEST(Atmosphere, CalcStandardCompareWithLinearScan) {
+  Atmosphere atmosphere("STANDARD", "", 0.0, false, 0.0, 0.0, 0.0, false);
+  std::vector<double> altitudes_km = {-1.0, 1500.0, 2000.0};
+  for (int layer = 0; layer < kNumberOfLayers; layer++) {
+    const double base_height_km = kBaseHeight_km[layer];
+    altitudes_km.push_back(base_height_km);
+    altitudes_km.push_back(base_height_km + 1.0e-6);
+    if (base_height_km > 0.0) altitudes_km.push_back(base_height_km - 1.0e-6);
+    if (layer < kNumberOfLayers - 1) altitudes_km.push_back(0.5 * (base_height_km + kBaseHeight_km[layer + 1]));
+  }
+
+  for (const double altitude_km : altitudes_km) {
+    const GeodeticPosition position(0.0, 0.0, altitude_km * 1000.0);
+    const double density_kg_m3 = atmosphere.CalcAirDensity_kg_m3(2020.0, 0.0, position);
+    if (altitude_km == 1000.0) {
+      // The previous if-else ladder returned 0 at 1000 km exactly, while the top layer is continuous from above
+      EXPECT_DOUBLE_EQ(kBaseRho_kg_m3[kNumberOfLayers - 1], density_kg_m3);
+    } else {
+      EXPECT_DOUBLE_EQ(CalcStandardByLinearScan(altitude_km * 1000.0), density_kg_m3) << "altitude " << altitude_km << " km";
+    }
+  }
+}
+
+/**
+ * @brief Test for SpaceWeatherTableIndex compared with the linear scan on the daily and monthly entries
+ */
+TEST(Atmosphere, SpaceWeatherTableIndexCompareWithLinearScan) {
+  // Daily entries from 2019/12/05 to 2020/03/31 without 2020/01/10 and with two entries of 2020/01/20, and monthly entries after that
+  const std::string file_path = "test_atmosphere_space_weather.txt";
+  {
+    std::ofstream file(file_path);
+    file << "UPDATED 2020 Jan 15 00:00:00" << std::endl;
+    const int days_in_month[4] = {31, 31, 29, 31};
+    const int months[4] = {12, 1, 2, 3};
+    int entry_number = 0;
+    for (int m = 0; m < 4; m++) {
+      const int year = (months[m] == 12) ? 2019 : 2020;
+      for (int day = (months[m] == 12) ? 5 : 1; day <= days_in_month[m]; day++) {
+        if (months[m] == 1 && day == 10) continue;
+        file << MakeSpaceWeatherLine(year, months[m], day, 100.0 + entry_number++) << std::endl;
+        if (months[m] == 1 && day == 20) file << MakeSpaceWeatherLine(year, months[m], day, 100.0 + entry_number++) << std::endl;
+      }
+    }
+    for (int month = 4; month <= 8; month++) {
+      file << MakeSpaceWeatherLine(2020, month, 1, 100.0 + entry_number++) << std::endl;
+    }
+  }
+
+  std::vector<nrlmsise_table> table;
+  GetSpaceWeatherTable_(2020.0, 200.0 * 86400.0, file_path, table);
+  remove(file_path.c_str());
+  ASSERT_GT(table.size(), 100);
+  SpaceWeatherTableIndex index;
+  index.Build(table);
+
+  // The monthly prediction starts 1.5 months after the update date
+  const double decyear_monthly = 2020.0 + 15.0 / 366.0 + (28 + 14) / 365.0;
+  std::vector<double> decyears = {2019.5, 2019.9, 2020.9, decyear_monthly, decyear_monthly - 1.0e-9, decyear_monthly + 1.0e-9};
+  for (double decyear = 2019.92; decyear < 2020.6; decyear += 0.01 / 366.0) {
+    decyears.push_back(decyear);
+  }
+  for (const double decyear : decyears) {
+    EXPECT_EQ(FindSpaceWeatherByLinearScan(table, decyear, decyear_monthly), index.Find(decyear)) << "decyear " << decyear;
+  }
+}
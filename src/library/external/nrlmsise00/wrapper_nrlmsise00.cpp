@@ -17,6 +17,7 @@ extern "C" {
 #include <cmath> /* maths functions */
 #include <environment/global/physical_constants.hpp>
 #include <library/math/constants.hpp>
+#include <mutex>
 #include <numeric>
 
 #include "wrapper_nrlmsise00.hpp" /* header for nrlmsise-00.h */
@@ -29,6 +30,9 @@ using namespace std;
 
 static double decyear_monthly;
 
+// NRLMSISE-00 library holds the intermediate values in the global variables, so the calculation is executed exclusively
+static std::mutex nrlmsise00_mutex;
+
 int LeapYear(int year) { return ((year % 4 == 0) && (year % 100 != 0)) || (year % 400 == 0); }
 
 void ConvertDaysToMonthDay(int days, int is_leap_year, int* month_day) {
@@ -162,77 +166,120 @@ int ConvertMonthStrToMonthNum(string month_str) {
   }
 }
 
+// Number of days from 1970/01/01 in the proleptic Gregorian calendar
+int ConvertDateToDayNumber(int year, int month, int day) {
+  year -= month <= 2;
+  const int era = (year >= 0 ? year : year - 399) / 400;
+  const int year_of_era = year - era * 400;
+  const int day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  const int day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
+}
+
+/* ------------------------------------------------------------------- */
+/* ----------------------SpaceWeatherTableIndex----------------------- */
+/* ------------------------------------------------------------------- */
+void SpaceWeatherTableIndex::Build(const vector<nrlmsise_table>& table) {
+  {
+    std::lock_guard<std::mutex> lock(nrlmsise00_mutex);
+    decyear_monthly_ = decyear_monthly;
+  }
+  daily_entry_indices_.clear();
+  monthly_entry_indices_.clear();
+  if (table.size() == 0) return;
+
+  int last_day_number = first_day_number_ = ConvertDateToDayNumber(table[0].year, table[0].month, table[0].day);
+  int last_month_number = first_month_number_ = table[0].year * 12 + table[0].month - 1;
+  for (const auto& entry : table) {
+    const int day_number = ConvertDateToDayNumber(entry.year, entry.month, entry.day);
+    const int month_number = entry.year * 12 + entry.month - 1;
+    first_day_number_ = min(first_day_number_, day_number);
+    last_day_number = max(last_day_number, day_number);
+    first_month_number_ = min(first_month_number_, month_number);
+    last_month_number = max(last_month_number, month_number);
+  }
+
+  // The first matched entry is used as the linear search
+  daily_entry_indices_.assign(last_day_number - first_day_number_ + 1, -1);
+  monthly_entry_indices_.assign(last_month_number - first_month_number_ + 1, -1);
+  for (size_t i = 0; i < table.size(); i++) {
+    int& daily_entry_index = daily_entry_indices_[ConvertDateToDayNumber(table[i].year, table[i].month, table[i].day) - first_day_number_];
+    if (daily_entry_index < 0) daily_entry_index = (int)i;
+    int& monthly_entry_index = monthly_entry_indices_[table[i].year * 12 + table[i].month - 1 - first_month_number_];
+    if (monthly_entry_index < 0) monthly_entry_index = (int)i;
+  }
+}
+
+size_t SpaceWeatherTableIndex::Find(const double decyear) const {
+  int date[6];
+  ConvertDecyearToDate(decyear, date);
+
+  int index = -1;
+  if (decyear < decyear_monthly_) {
+    // Match year, month, date
+    const int offset = ConvertDateToDayNumber(date[0], date[1], date[2]) - first_day_number_;
+    if (offset >= 0 && offset < (int)daily_entry_indices_.size()) index = daily_entry_indices_[offset];
+  } else {
+    // Match year, month
+    const int offset = date[0] * 12 + date[1] - 1 - first_month_number_;
+    if (offset >= 0 && offset < (int)monthly_entry_indices_.size()) index = monthly_entry_indices_[offset];
+  }
+  return index < 0 ? 0 : (size_t)index;
+}
+
 /* ------------------------------------------------------------------- */
 /* --------------------------CalcNRLMSISE00--------------------------- */
 /* ------------------------------------------------------------------- */
-double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const vector<nrlmsise_table>& table, bool is_manual_param,
-                      double manual_f107, double manual_f107a, double manual_ap) {
+void ConvertDecyearToNrlmsiseTime(const double decyear, int& day_of_year, double& time_of_day_s) {
+  int date[6];
+  ConvertDecyearToDate(decyear, date);
+
+  day_of_year = (int)((decyear - (int)decyear) * 365.25);
+  time_of_day_s = date[3] * 60.0 * 60.0 + date[4] * 60.0 + date[5];
+}
+
+double CalcNRLMSISE00Density(int day_of_year, double time_of_day_s, double latrad, double lonrad, double alt, double f107, double f107a, double ap) {
   struct nrlmsise_output output;
   struct nrlmsise_input input;
   struct nrlmsise_flags flags;
   struct ap_array aph;
 
   size_t i;
-  int date[6];
-  int idx = 0;
 
   /* input values */
   for (i = 0; i < 24; i++) {
     flags.switches[i] = 1;
   }
 
-  ConvertDecyearToDate(decyear, date);
-
-  input.doy = (int)((decyear - (int)decyear) * 365.25);
+  input.doy = day_of_year;
   input.year = 0; /* without effect */
-  input.sec = date[3] * 60.0 * 60.0 + date[4] * 60.0 + date[5];
+  input.sec = time_of_day_s;
   input.alt = alt / 1000.0;
   input.g_lat = latrad * libra::rad_to_deg;
   input.g_long = lonrad * libra::rad_to_deg;
   input.lst = input.sec / 3600.0 + lonrad * libra::rad_to_deg / 15.0;
-
-  if (is_manual_param) {
-    input.f107 = manual_f107;
-    input.f107A = manual_f107a;
-    input.ap = manual_ap;
-  } else {
-    // f10.7 and ap from table
-    // If the table size is zero, return 0
-    if (table.size() == 0) {
-      return 0.0;
-    }
-
-    // search table index
-    for (i = 0; i < table.size(); i++) {
-      if (decyear < decyear_monthly) {
-        // Match year, month, date
-        if ((date[0] == table[i].year) && (date[1] == table[i].month) && (date[2] == table[i].day)) {
-          idx = i;
-          break;
-        }
-      } else {
-        // Match year, month
-        if ((date[0] == table[i].year) && (date[1] == table[i].month)) {
-          idx = i;
-          break;
-        }
-      }
-    }
-
-    input.f107A = table[idx].Ctr81_adj;
-    input.f107 = table[idx].F107_adj;
-    input.ap = table[idx].Ap_avg;
-  }
+  input.f107 = f107;
+  input.f107A = f107a;
+  input.ap = ap;
 
   for (i = 0; i < 7; i++) {
     aph.a[i] = input.ap;
   }
   input.ap_a = &aph;
 
+  std::lock_guard<std::mutex> lock(nrlmsise00_mutex);
   gtd7(&input, &flags, &output);
   return output.d[5];
 }
 
+double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, double f107, double f107a, double ap) {
+  int day_of_year;
+  double time_of_day_s;
+  ConvertDecyearToNrlmsiseTime(decyear, day_of_year, time_of_day_s);
+
+  return CalcNRLMSISE00Density(day_of_year, time_of_day_s, latrad, lonrad, alt, f107, f107a, ap);
+}
+
 /* ------------------------------------------------------------------- */
 /* -----------------------ReadSpaceWeatherTable----------------------- */
 /* ------------------------------------------------------------------- */
@@ -273,6 +320,7 @@ int GetSpaceWeatherTable_(double decyear, double endsec, const string& filename,
 
         // After 1.5 month from the update date, the data is updated once per month. So calculate the decimal year of the date
         int days_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        std::lock_guard<std::mutex> lock(nrlmsise00_mutex);
         decyear_monthly = decyear_updated + (days_month[month_updated] + 14) / 365.0;
       }
       continue;
@@ -30,22 +30,79 @@ struct nrlmsise_table {
   double Lst81_obs;  //!< Last 81-day arithmetic average of F10.7 (observed).
 };
 
+/**
+ * @class SpaceWeatherTableIndex
+ * @brief Index to find the entry of the space weather table for a date in constant time
+ * @note The entry of the date is selected before the monthly prediction starts, and the first entry of the month is selected after that.
+ */
+class SpaceWeatherTableIndex {
+ public:
+  /**
+   * @fn Build
+   * @brief Build the index for the table read by GetSpaceWeatherTable_
+   * @param [in] table: Space weather table
+   */
+  void Build(const std::vector<nrlmsise_table>& table);
+  /**
+   * @fn Find
+   * @brief Return index of the table entry for the date. 0 is returned when no entry matches.
+   * @param [in] decyear: Decimal year
+   */
+  size_t Find(const double decyear) const;
+
+ private:
+  int first_day_number_ = 0;                //!< Day number of the first element of daily_entry_indices_
+  std::vector<int> daily_entry_indices_;    //!< Table index for each day. -1 means no entry.
+  int first_month_number_ = 0;              //!< Month number of the first element of monthly_entry_indices_
+  std::vector<int> monthly_entry_indices_;  //!< Table index for each month. -1 means no entry.
+  double decyear_monthly_ = 0.0;            //!< Decimal year when the monthly prediction starts
+};
+
+/**
+ * @fn ConvertDecyearToDate
+ * @brief Convert the decimal year to the date
+ * @param [in] decyear: Decimal year
+ * @param [out] date: Year, month, day, hour, minute, and second
+ */
+void ConvertDecyearToDate(double decyear, int* date);
+
+/**
+ * @fn ConvertDecyearToNrlmsiseTime
+ * @brief Convert the decimal year to the time inputs of NRLMSISE-00
+ * @param [in] decyear: Decimal year
+ * @param [out] day_of_year: Day of year
+ * @param [out] time_of_day_s: Seconds in the day [sec]
+ */
+void ConvertDecyearToNrlmsiseTime(const double decyear, int& day_of_year, double& time_of_day_s);
+
+/**
+ * @fn CalcNRLMSISE00Density
+ * @brief Calculate the atmospheric density with NRLMSISE-00 model
+ * @param [in] day_of_year: Day of year
+ * @param [in] time_of_day_s: Seconds in the day [sec]
+ * @param [in] latrad: Latitude [rad]
+ * @param [in] lonrad: Longitude [rad]
+ * @param [in] alt: Altitude [m]
+ * @param [in] f107: Daily F10.7
+ * @param [in] f107a: 81 day averaged F10.7
+ * @param [in] ap: Ap-index
+ * @return Atmospheric density [kg/m3]
+ */
+double CalcNRLMSISE00Density(int day_of_year, double time_of_day_s, double latrad, double lonrad, double alt, double f107, double f107a, double ap);
+
 /**
  * @fn CalcNRLMSISE00
- * @brief Read the space weather table file
- * @param [in] decyear: Decimal year of the simulation start time
+ * @brief Calculate the atmospheric density with NRLMSISE-00 model
+ * @param [in] decyear: Decimal year
  * @param [in] latrad: Latitude [rad]
  * @param [in] lonrad: Longitude [rad]
  * @param [in] alt: Altitude [m]
- * @param [in] table: Space Weather table
- * @param [in] is_manual_param: Flag to use manual parameters
- * @param [in] manual_f107: Manual setting F10.7
- * @param [in] manual_f107a: Manual setting averaged F10.7
- * @param [in] manual_ap: Manual setting Ap-index
+ * @param [in] f107: Daily F10.7
+ * @param [in] f107a: 81 day averaged F10.7
+ * @param [in] ap: Ap-index
  * @return Atmospheric density [kg/m3]
  */
-double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const std::vector<nrlmsise_table>& table, bool is_manual_param,
-                      double manual_f107, double manual_f107a, double manual_ap);
+double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, double f107, double f107a, double ap);
 
 /**
  * @fn GetSpaceWeatherTable_
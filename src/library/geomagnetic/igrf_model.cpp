@@ -0,0 +1,247 @@
+/**
+ * @file igrf_model.cpp
+ * @brief Reentrant IGRF (International Geomagnetic Reference Field) model
+ */
+
+#include "igrf_model.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+#include "../external/sgp4/sgp4ext.h"
+
+// Constants of the original code
+static const double kEquatorialRadius_km = 6378.137;  //!< Equatorial radius of WGS84 [km]
+static const double kFlatteningInverse = 298.25722;   //!< Inverse flattening of WGS84
+static const double kReferenceRadius_km = 6371.2;     //!< Reference radius of IGRF [km]
+static const double kRadToDeg = 180 / 3.14159265358979323846;
+static const double kDegToRad = 0.017453292519943295769236907684886;
+static const double kUrad = 180. / 3.14159265359;
+
+bool IgrfCoefficients::ReadFile(const std::string file_path) {
+  std::ifstream coefficient_file(file_path);
+  if (!coefficient_file.is_open()) {
+    std::cerr << "file open error: IGRF coefficients " << file_path << std::endl;
+    return false;
+  }
+
+  // Line 1: Maximum degree, number of columns, valid period
+  std::string line;
+  size_t degree, number_of_columns;
+  double valid_start_year, valid_end_year;
+  getline(coefficient_file, line);
+  std::istringstream header(line);
+  header >> degree >> number_of_columns >> valid_start_year >> valid_end_year;
+  if (header.fail() || degree < 8 || degree > kMaxDegree || number_of_columns < 2) {
+    std::cerr << "IGRF coefficients: Line-1 invalid" << std::endl;
+    return false;
+  }
+
+  // Line 2: Epochs. The last column is the secular variation.
+  std::vector<double> epochs(number_of_columns - 1);
+  getline(coefficient_file, line);
+  std::istringstream epoch_line(line);
+  std::string label;
+  int dummy_n, dummy_m;
+  epoch_line >> label >> dummy_n >> dummy_m;
+  for (size_t i = 0; i < epochs.size(); i++) epoch_line >> epochs[i];
+  if (epoch_line.fail()) {
+    std::cerr << "IGRF coefficients: Line-2 invalid" << std::endl;
+    return false;
+  }
+
+  // Coefficients: g(1, 0), g(1, 1), h(1, 1), g(2, 0), ...
+  const size_t number_of_lines = (degree + 1) * (degree + 1) - 1;
+  std::vector<std::vector<double>> values(number_of_lines, std::vector<double>(number_of_columns));
+  for (size_t i = 0; i < number_of_lines; i++) {
+    getline(coefficient_file, line);
+    std::istringstream coefficient_line(line);
+    coefficient_line >> label >> dummy_n >> dummy_m;
+    for (size_t j = 0; j < number_of_columns; j++) coefficient_line >> values[i][j];
+    if (coefficient_line.fail()) {
+      std::cerr << "IGRF coefficients: Line-" << i + 3 << " invalid" << std::endl;
+      return false;
+    }
+  }
+
+  // Epoch intervals
+  epoch_intervals_.clear();
+  epoch_intervals_.resize(number_of_columns - 1);
+  for (size_t interval_id = 0; interval_id < epoch_intervals_.size(); interval_id++) {
+    EpochInterval& interval = epoch_intervals_[interval_id];
+    const bool is_last = (interval_id + 1 == epoch_intervals_.size());
+    interval.reference_year = epochs[interval_id];
+    interval.end_year = is_last ? std::numeric_limits<double>::infinity() : epochs[interval_id + 1];
+
+    std::vector<double> base(number_of_lines), variation(number_of_lines);
+    interval.degree = 0;
+    for (size_t i = 0; i < number_of_lines; i++) {
+      base[i] = values[i][interval_id];
+      if (is_last) {
+        variation[i] = values[i][interval_id + 1];
+      } else {
+        variation[i] = (values[i][interval_id + 1] - base[i]) / (interval.end_year - interval.reference_year);
+      }
+    }
+
+    // Schmidt normalization
+    for (size_t n = 0; n <= kMaxDegree; n++) {
+      for (size_t m = 0; m <= kMaxDegree; m++) {
+        interval.gh[m][n] = 0.0;
+        interval.secular_variation[m][n] = 0.0;
+      }
+    }
+    size_t i = 0;
+    for (size_t n = 1; n <= degree; n++) {
+      interval.gh[0][n] = base[i];
+      interval.secular_variation[0][n] = variation[i];
+      if (base[i] != 0.0 || variation[i] != 0.0) interval.degree = n;
+      i++;
+      double factor = sqrt(2.);
+      for (size_t m = 1; m <= n; m++) {
+        factor /= sqrt((double)((n + m) * (n - m + 1)));
+        interval.gh[m][n] = base[i] * factor;
+        interval.secular_variation[m][n] = variation[i] * factor;
+        if (base[i] != 0.0 || variation[i] != 0.0) interval.degree = n;
+        i++;
+        interval.gh[n][m - 1] = base[i] * factor;
+        interval.secular_variation[n][m - 1] = variation[i] * factor;
+        if (base[i] != 0.0 || variation[i] != 0.0) interval.degree = n;
+        i++;
+      }
+    }
+  }
+
+  return true;
+}
+
+const IgrfCoefficients::EpochInterval& IgrfCoefficients::GetEpochInterval(const double decimal_year) const {
+  for (size_t i = 0; i < epoch_intervals_.size() - 1; i++) {
+    if (decimal_year < epoch_intervals_[i].end_year) return epoch_intervals_[i];
+  }
+  return epoch_intervals_.back();
+}
+
+const IgrfCoefficients* LoadIgrfCoefficients(const std::string file_path) {
+  static std::mutex mutex;
+  static std::map<std::string, IgrfCoefficients> loaded_coefficients;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto found = loaded_coefficients.find(file_path);
+  if (found != loaded_coefficients.end()) return &(found->second);
+
+  IgrfCoefficients coefficients;
+  if (!coefficients.ReadFile(file_path)) return nullptr;
+  return &(loaded_coefficients[file_path] = coefficients);
+}
+
+IgrfModel::IgrfModel(const IgrfCoefficients* coefficients) : coefficients_(coefficients) {}
+
+void IgrfModel::SetYear(const double decimal_year) {
+  const IgrfCoefficients::EpochInterval& interval = coefficients_->GetEpochInterval(decimal_year);
+  const double delta_year = decimal_year - interval.reference_year;
+  degree_ = interval.degree;
+  for (size_t n = 0; n <= degree_; n++) {
+    for (size_t m = 0; m <= degree_; m++) {
+      g_[m][n] = interval.gh[m][n] + interval.secular_variation[m][n] * delta_year;
+    }
+  }
+  year_ = decimal_year;
+}
+
+libra::Vector<3> IgrfModel::CalcMagneticField_i_nT(const double decimal_year, const double latitude_rad, const double longitude_rad,
+                                                   const double altitude_m, const double greenwich_sidereal_time_rad) {
+  libra::Vector<3> magnetic_field_i_nT(0.0);
+  if (coefficients_ == nullptr || !coefficients_->IsLoaded()) return magnetic_field_i_nT;
+  if (decimal_year != year_) SetYear(decimal_year);
+  const int degree = (int)degree_;
+
+  // Geocentric position
+  const double re2 = kEquatorialRadius_km * kEquatorialRadius_km;
+  const double re4 = re2 * re2;
+  const double rp = kEquatorialRadius_km * (1. - 1. / kFlatteningInverse);
+  const double rp2 = rp * rp;
+  const double rp4 = rp2 * rp2;
+
+  const double altitude_km = altitude_m / 1000.;
+  const double latitude = latitude_rad * kRadToDeg / kUrad;
+  const double sin_latitude = sin(latitude);
+  const double sin_latitude2 = sin_latitude * sin_latitude;
+  const double cos_latitude2 = 1. - sin_latitude2;
+  const double rm2 = re2 * cos_latitude2 + rp2 * sin_latitude2;
+  const double rm = sqrt(rm2);
+  const double rrm = (re4 * cos_latitude2 + rp4 * sin_latitude2) / rm2;
+  const double r = sqrt(rrm + 2. * altitude_km * rm + altitude_km * altitude_km);
+  const double cth = sin_latitude * (altitude_km + rp2 / rm) / r;
+  const double sth = sqrt(1. - cth * cth);
+
+  const double longitude = longitude_rad * kRadToDeg / kUrad;
+  const double cph = cos(longitude);
+  const double sph = sin(longitude);
+
+  // Radius
+  double t = kReferenceRadius_km / r;
+  rar_[0] = t * t;
+  for (int n = 0; n < degree; n++) rar_[n + 1] = rar_[n] * t;
+
+  // Legendre functions
+  p_[0][0] = 1.;
+  p_[1][0] = 0.;
+  p_[0][1] = cth;
+  p_[1][1] = sth;
+  p_[2][0] = -sth;
+  p_[2][1] = cth;
+  for (int n = 1; n < degree; n++) {
+    p_[0][n + 1] = (p_[0][n] * cth * (n + n + 1) - p_[0][n - 1] * n) / (n + 1);
+    p_[n + 2][0] = (p_[0][n + 1] * cth - p_[0][n]) * (n + 1) / sth;
+    for (int m = 0; m <= n; m++) {
+      const double pn1m = p_[m][n + 1];
+      p_[m + 1][n + 1] = (p_[m][n] * (n + m + 1) - pn1m * cth * (n - m + 1)) / sth;
+      p_[n + 2][m + 1] = pn1m * (n + m + 2) * (n - m + 1) - p_[m + 1][n + 1] * cth * (m + 1) / sth;
+    }
+  }
+
+  // Longitude
+  cos_m_longitude_[0] = 1.;
+  sin_m_longitude_[0] = 0.;
+  for (int m = 0; m < degree; m++) {
+    cos_m_longitude_[m + 1] = cos_m_longitude_[m] * cph - sin_m_longitude_[m] * sph;
+    sin_m_longitude_[m + 1] = sin_m_longitude_[m] * cph + cos_m_longitude_[m] * sph;
+  }
+
+  // Magnetic field in the local North-East-Down frame
+  double x = 0.;
+  double y = 0.;
+  double z = 0.;
+  for (int n = 0; n < degree; n++) {
+    double tx = g_[0][n + 1] * p_[n + 2][0];
+    double ty = 0.;
+    double tz = g_[0][n + 1] * p_[0][n + 1];
+    for (int m = 0; m <= n; m++) {
+      const double c = cos_m_longitude_[m + 1];
+      const double s = sin_m_longitude_[m + 1];
+      tx += (g_[m + 1][n + 1] * c + g_[n + 1][m] * s) * p_[n + 2][m + 1];
+      ty += (g_[m + 1][n + 1] * s - g_[n + 1][m] * c) * p_[m + 1][n + 1] * (m + 1);
+      tz += (g_[m + 1][n + 1] * c + g_[n + 1][m] * s) * p_[m + 1][n + 1];
+    }
+    x += rar_[n + 1] * tx;
+    y += rar_[n + 1] * ty;
+    z -= rar_[n + 1] * tz * (n + 2);
+  }
+  y /= sth;
+
+  // Conversion to the inertial frame
+  double magnetic_field_nT[3] = {x, y, z};
+  const double theta_rad = acos(cth);
+  RotationY(magnetic_field_nT, magnetic_field_nT, 180 * kDegToRad - theta_rad);
+  RotationZ(magnetic_field_nT, magnetic_field_nT, -longitude_rad);
+  RotationZ(magnetic_field_nT, magnetic_field_nT, -greenwich_sidereal_time_rad);
+
+  for (int i = 0; i < 3; i++) magnetic_field_i_nT[i] = magnetic_field_nT[i];
+  return magnetic_field_i_nT;
+}
@@ -0,0 +1,120 @@
+/**
+ * @file igrf_model.hpp
+ * @brief Reentrant IGRF (International Geomagnetic Reference Field) model
+ * @note The calculation follows src/library/external/igrf/igrf.cpp, but all states are held in the instances.
+ */
+
+#ifndef S2E_LIBRARY_GEOMAGNETIC_IGRF_MODEL_HPP_
+#define S2E_LIBRARY_GEOMAGNETIC_IGRF_MODEL_HPP_
+
+#include <string>
+#include <vector>
+
+#include "../math/vector.hpp"
+
+/**
+ * @class IgrfCoefficients
+ * @brief Coefficients table of the IGRF model read from the coefficient file
+ * @note The table is not changed after ReadFile, so an instance can be shared by IgrfModel instances in multiple threads.
+ */
+class IgrfCoefficients {
+ public:
+  static const size_t kMaxDegree = 19;  //!< Maximum degree supported by the model
+
+  /**
+   * @struct EpochInterval
+   * @brief Schmidt normalized coefficients for an epoch interval of the coefficient file
+   * @note The array index follows the original code. [m][n] is g(n, m) and [n][m-1] is h(n, m).
+   */
+  struct EpochInterval {
+    double end_year;                                           //!< Year of the end of the interval [year] (Infinity for the last interval)
+    double reference_year;                                     //!< Reference year of the coefficients [year]
+    size_t degree;                                             //!< Maximum degree with non-zero coefficients
+    double gh[kMaxDegree + 1][kMaxDegree + 1];                 //!< Normalized coefficients at the reference year [nT]
+    double secular_variation[kMaxDegree + 1][kMaxDegree + 1];  //!< Normalized secular variations [nT/year]
+  };
+
+  /**
+   * @fn ReadFile
+   * @brief Read the coefficient file (igrfXX.coef)
+   * @param [in] file_path: Path to the coefficient file
+   * @return true: success, false: fail
+   */
+  bool ReadFile(const std::string file_path);
+
+  /**
+   * @fn GetEpochInterval
+   * @brief Return the epoch interval including the decimal year
+   * @param [in] decimal_year: Decimal year [year]
+   */
+  const EpochInterval& GetEpochInterval(const double decimal_year) const;
+
+  /**
+   * @fn IsLoaded
+   * @brief Return true when the coefficients are read
+   */
+  inline bool IsLoaded() const { return !epoch_intervals_.empty(); }
+
+ private:
+  std::vector<EpochInterval> epoch_intervals_;  //!< Coefficients of all epoch intervals
+};
+
+/**
+ * @fn LoadIgrfCoefficients
+ * @brief Read the coefficient file once and return the shared table
+ * @note The table is kept until the end of the program and shared with all callers of the same file path. This function is thread-safe.
+ * @param [in] file_path: Path to the coefficient file
+ * @return The shared table. nullptr when the file cannot be read.
+ */
+const IgrfCoefficients* LoadIgrfCoefficients(const std::string file_path);
+
+/**
+ * @class IgrfModel
+ * @brief Reentrant IGRF model calculation
+ * @note Each instance has its own working arrays, so instances can be evaluated concurrently. An instance itself is not thread-safe.
+ */
+class IgrfModel {
+ public:
+  /**
+   * @fn IgrfModel
+   * @brief Constructor
+   * @param [in] coefficients: Coefficients table. The table should be kept during the lifetime of this instance.
+   */
+  explicit IgrfModel(const IgrfCoefficients* coefficients = nullptr);
+
+  /**
+   * @fn CalcMagneticField_i_nT
+   * @brief Calculate the magnetic field vector in the inertial frame
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] latitude_rad: Geodetic latitude [rad]
+   * @param [in] longitude_rad: Longitude [rad]
+   * @param [in] altitude_m: Altitude from the WGS84 ellipsoid [m]
+   * @param [in] greenwich_sidereal_time_rad: Greenwich sidereal time [rad]
+   * @return Magnetic field vector in the inertial frame [nT]. Zero vector when the coefficients are not set.
+   */
+  libra::Vector<3> CalcMagneticField_i_nT(const double decimal_year, const double latitude_rad, const double longitude_rad, const double altitude_m,
+                                          const double greenwich_sidereal_time_rad);
+
+ private:
+  static const size_t kMaxDegree = IgrfCoefficients::kMaxDegree;  //!< Maximum degree supported by the model
+
+  const IgrfCoefficients* coefficients_;  //!< Coefficients table
+  double year_ = -1.0;                    //!< Decimal year of g_ [year]
+  size_t degree_ = 0;                     //!< Maximum degree of the calculation
+
+  // Working arrays
+  double g_[kMaxDegree + 1][kMaxDegree + 1];  //!< Coefficients at year_ [nT]
+  double p_[kMaxDegree + 2][kMaxDegree + 1];  //!< Associated Legendre functions and the derivatives
+  double rar_[kMaxDegree + 1];                //!< Powers of the ratio of the reference radius and the radius
+  double cos_m_longitude_[kMaxDegree + 1];    //!< cos(m * longitude)
+  double sin_m_longitude_[kMaxDegree + 1];    //!< sin(m * longitude)
+
+  /**
+   * @fn SetYear
+   * @brief Calculate the coefficients at the decimal year
+   * @param [in] decimal_year: Decimal year [year]
+   */
+  void SetYear(const double decimal_year);
+};
+
+#endif  // S2E_LIBRARY_GEOMAGNETIC_IGRF_MODEL_HPP_
@@ -0,0 +1,117 @@
+/**
+ * @file test_igrf_model.cpp
+ * @brief Test codes for IgrfModel class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../external/igrf/igrf.h"
+#include "igrf_model.hpp"
+
+/**
+ * @brief Return path to the coefficient file in the source tree
+ */
+std::string GetIgrfCoefficientFilePath() {
+  std::string directory = __FILE__;
+  directory = directory.substr(0, directory.find_last_of("/\\") + 1);
+  return directory + "../external/igrf/igrf13.coef";
+}
+
+/**
+ * @struct IgrfTestPoint
+ * @brief Input of the IGRF calculation for test
+ */
+struct IgrfTestPoint {
+  double decimal_year;
+  double latitude_rad;
+  double longitude_rad;
+  double altitude_m;
+  double greenwich_sidereal_time_rad;
+};
+
+/**
+ * @brief Make test points along a low earth orbit like trajectory in 2023
+ */
+std::vector<IgrfTestPoint> MakeTestPoints(const size_t number_of_points) {
+  std::vector<IgrfTestPoint> points(number_of_points);
+  for (size_t i = 0; i < number_of_points; i++) {
+    const double t = (double)i;
+    points[i].decimal_year = 2023.0 + 1.0e-4 * t;
+    points[i].latitude_rad = 1.5 * sin(0.011 * t);
+    points[i].longitude_rad = -3.1 + fmod(0.023 * t, 6.2);
+    points[i].altitude_m = 400.0e3 + 1.0e3 * cos(0.007 * t);
+    points[i].greenwich_sidereal_time_rad = fmod(0.0073 * t, 6.28);
+  }
+  return points;
+}
+
+/**
+ * @brief Test for the same result as the original code
+ */
+TEST(IgrfModel, CompareWithOriginal) {
+  const IgrfCoefficients* coefficients = LoadIgrfCoefficients(GetIgrfCoefficientFilePath());
+  if (coefficients == nullptr) GTEST_SKIP() << "Coefficient file is not found";
+
+  // The coefficients of the original code are selected at the first call, so all points are in the same epoch interval.
+  set_file_path(GetIgrfCoefficientFilePath().c_str());
+  IgrfModel igrf(coefficients);
+  for (const auto& point : MakeTestPoints(100)) {
+    double expected_nT[3];
+    IgrfCalc(point.decimal_year, point.latitude_rad, point.longitude_rad, point.altitude_m, point.greenwich_sidereal_time_rad, expected_nT);
+    const libra::Vector<3> result_nT = igrf.CalcMagneticField_i_nT(point.decimal_year, point.latitude_rad, point.longitude_rad, point.altitude_m,
+                                                                   point.greenwich_sidereal_time_rad);
+    for (size_t i = 0; i < 3; i++) {
+      EXPECT_EQ(expected_nT[i], result_nT[i]);
+    }
+  }
+}
+
+/**
+ * @brief Test for the multi-threaded calculation with the shared coefficients
+ */
+TEST(IgrfModel, MultiThread) {
+  const IgrfCoefficients* coefficients = LoadIgrfCoefficients(GetIgrfCoefficientFilePath());
+  if (coefficients == nullptr) GTEST_SKIP() << "Coefficient file is not found";
+  // The table is loaded only once for the same file
+  EXPECT_EQ(coefficients, LoadIgrfCoefficients(GetIgrfCoefficientFilePath()));
+
+  const size_t number_of_threads = 4;
+  const size_t strides[number_of_threads] = {1, 3, 7, 13};
+  const std::vector<IgrfTestPoint> points = MakeTestPoints(1000);
+
+  // Serial
+  std::vector<libra::Vector<3>> serial_results;
+  IgrfModel serial_igrf(coefficients);
+  for (const auto& point : points) {
+    serial_results.push_back(serial_igrf.CalcMagneticField_i_nT(point.decimal_year, point.latitude_rad, point.longitude_rad, point.altitude_m,
+                                                                point.greenwich_sidereal_time_rad));
+  }
+
+  // Each thread evaluates all points in a different order
+  std::vector<std::vector<libra::Vector<3>>> thread_results(number_of_threads, std::vector<libra::Vector<3>>(points.size()));
+  std::vector<std::thread> threads;
+  for (size_t thread_id = 0; thread_id < number_of_threads; thread_id++) {
+    threads.emplace_back([&, thread_id]() {
+      IgrfModel igrf(LoadIgrfCoefficients(GetIgrfCoefficientFilePath()));
+      for (size_t i = 0; i < points.size(); i++) {
+        const size_t index = (i * strides[thread_id]) % points.size();
+        const IgrfTestPoint& point = points[index];
+        thread_results[thread_id][index] = igrf.CalcMagneticField_i_nT(point.decimal_year, point.latitude_rad, point.longitude_rad,
+                                                                       point.altitude_m, point.greenwich_sidereal_time_rad);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  for (size_t thread_id = 0; thread_id < number_of_threads; thread_id++) {
+    for (size_t i = 0; i < points.size(); i++) {
+      for (size_t j = 0; j < 3; j++) {
+        EXPECT_EQ(serial_results[i][j], thread_results[thread_id][i][j]);
+      }
+    }
+  }
+}
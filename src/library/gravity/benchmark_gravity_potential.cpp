@@ -0,0 +1,72 @@
+/**
+ * @file benchmark_gravity_potential.cpp
+ * @brief Benchmark of the gravity potential calculation
+ * @note Usage: benchmark_gravity_potential [EGM96 coefficients file path]
+ *       When the file is not given, dummy coefficients are used. The calculation cost does not depend on the values.
+ */
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <library/gravity/gravity_potential.hpp>
+#include <sstream>
+#include <string>
+
+/**
+ * @fn main
+ * @brief Measure evaluations/second at degrees 10, 70 and 360
+ */
+int main(int argc, char *argv[]) {
+  const size_t kMaxDegree = 360;
+  std::vector<std::vector<double>> c(kMaxDegree + 1, std::vector<double>(kMaxDegree + 1, 0.0));
+  std::vector<std::vector<double>> s(kMaxDegree + 1, std::vector<double>(kMaxDegree + 1, 0.0));
+
+  std::ifstream coefficients_file;
+  if (argc > 1) coefficients_file.open(argv[1]);
+  if (coefficients_file.is_open()) {
+    std::string line;
+    while (getline(coefficients_file, line)) {
+      std::istringstream stream_line(line);
+      size_t n, m;
+      double c_nm, s_nm;
+      stream_line >> n >> m >> c_nm >> s_nm;
+      if (n > kMaxDegree || m > n) continue;
+      c[n][m] = c_nm;
+      s[n][m] = s_nm;
+    }
+  } else {
+    std::cout << "EGM96 coefficients file is not given. Use dummy coefficients." << std::endl;
+    for (size_t n = 2; n <= kMaxDegree; n++) {
+      for (size_t m = 0; m <= n; m++) {
+        c[n][m] = 1.0e-6 / (double)(n * n);
+        if (m > 0) s[n][m] = -1.0e-6 / (double)(n * n);
+      }
+    }
+  }
+
+  const size_t degrees[] = {10, 70, 360};
+  for (const size_t degree : degrees) {
+    GravityPotential gravity(degree, c, s, 3.986004415e14, 6378136.3);
+    libra::Vector<3> position_m;
+    position_m[0] = 4000.0e3;
+    position_m[1] = -3000.0e3;
+    position_m[2] = 4500.0e3;
+
+    // Run at least 0.5 sec
+    size_t number_of_evaluations = 0;
+    double sum = 0.0;
+    double elapsed_time_s = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    while (elapsed_time_s < 0.5) {
+      for (size_t i = 0; i < 100; i++) {
+        position_m[0] += 1.0;
+        sum += gravity.CalcAcceleration_xcxf_m_s2(position_m)[0];
+      }
+      number_of_evaluations += 100;
+      elapsed_time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    std::cout << "degree " << degree << ": " << number_of_evaluations / elapsed_time_s << " evaluations/s (checksum " << sum << ")" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,166 @@
+/**
+ * @file gravity_potential.cpp
+ * @brief Class to calculate the high-order gravity acceleration with spherical harmonics
+ */
+
+#include "gravity_potential.hpp"
+
+#include <cmath>
+
+GravityPotential::GravityPotential(const size_t degree, const std::vector<std::vector<double>>& cosine_coefficients,
+                                   const std::vector<std::vector<double>>& sine_coefficients, const double gravity_constant_m3_s2,
+                                   const double center_body_radius_m)
+    : degree_(degree), gravity_constant_m3_s2_(gravity_constant_m3_s2), center_body_radius_m_(center_body_radius_m) {
+  // Coefficients
+  const size_t number_of_coefficients = GetIndex(degree_ + 1, 0);
+  c_.assign(number_of_coefficients, 0.0);
+  s_.assign(number_of_coefficients, 0.0);
+  for (size_t n = 0; n <= degree_ && n < cosine_coefficients.size(); n++) {
+    for (size_t m = 0; m <= n && m < cosine_coefficients[n].size(); m++) {
+      c_[GetIndex(n, m)] = cosine_coefficients[n][m];
+    }
+  }
+  for (size_t n = 0; n <= degree_ && n < sine_coefficients.size(); n++) {
+    for (size_t m = 0; m <= n && m < sine_coefficients[n].size(); m++) {
+      s_[GetIndex(n, m)] = sine_coefficients[n][m];
+    }
+  }
+
+  // Recursion tables
+  const size_t number_of_vw = GetIndex(degree_ + 2, 0);
+  v_.assign(number_of_vw, 0.0);
+  w_.assign(number_of_vw, 0.0);
+
+  CalcNormalizationFactors();
+}
+
+void GravityPotential::CalcNormalizationFactors() {
+  const size_t degree_vw = degree_ + 1;
+
+  // V and W recursion
+  vw_nn_factor_.assign(degree_vw + 1, 0.0);
+  vw_nm_factor1_.assign(GetIndex(degree_vw + 1, 0), 0.0);
+  vw_nm_factor2_.assign(GetIndex(degree_vw + 1, 0), 0.0);
+  for (size_t n = 1; n <= degree_vw; n++) {
+    const double n_d = (double)n;
+    if (n == 1) {
+      vw_nn_factor_[n] = (2.0 * n_d - 1.0) * sqrt(2.0 * n_d + 1.0);
+    } else {
+      vw_nn_factor_[n] = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d));
+    }
+
+    for (size_t m = 0; m < n; m++) {
+      const double m_d = (double)m;
+      const double c1 = (2.0 * n_d - 1.0) / (n_d - m_d);
+      const double c2 = (n_d + m_d - 1.0) / (n_d - m_d);
+      const double c_normalize = sqrt(((2.0 * n_d + 1.0) * (n_d - m_d)) / ((2.0 * n_d - 1.0) * (n_d + m_d)));
+      double c2_normalize = 1.0;
+      if (n > 1) c2_normalize = sqrt(((2.0 * n_d - 1.0) * (n_d - m_d - 1.0)) / ((2.0 * n_d - 3.0) * (n_d + m_d - 1.0)));
+
+      vw_nm_factor1_[GetIndex(n, m)] = c_normalize * c1;
+      vw_nm_factor2_[GetIndex(n, m)] = c_normalize * c2 * c2_normalize;
+    }
+  }
+
+  // Acceleration
+  // m = 0 elements have the factors for the zonal terms.
+  // 0.5 of the tesseral terms for x and y are included in the factors.
+  acceleration_xy1_factor_.assign(GetIndex(degree_ + 1, 0), 0.0);
+  acceleration_xy2_factor_.assign(GetIndex(degree_ + 1, 0), 0.0);
+  acceleration_z_factor_.assign(GetIndex(degree_ + 1, 0), 0.0);
+  for (size_t n = 0; n <= degree_; n++) {
+    const double n_d = (double)n;
+    const double normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 3.0));
+    acceleration_xy1_factor_[GetIndex(n, 0)] = normalize * sqrt((n_d + 2.0) * (n_d + 1.0) / 2.0);
+    acceleration_z_factor_[GetIndex(n, 0)] = (n_d + 1.0) * normalize;
+
+    for (size_t m = 1; m <= n; m++) {
+      const double m_d = (double)m;
+      const double factorial = (n_d - m_d + 1.0) * (n_d - m_d + 2.0);
+      double normalize_xy2 = normalize * sqrt(factorial);
+      if (m == 1) normalize_xy2 *= sqrt(2.0);
+
+      acceleration_xy1_factor_[GetIndex(n, m)] = 0.5 * normalize * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0));
+      acceleration_xy2_factor_[GetIndex(n, m)] = 0.5 * normalize_xy2;
+      acceleration_z_factor_[GetIndex(n, m)] = (n_d - m_d + 1.0) * normalize * sqrt((n_d + m_d + 1.0) / (n_d - m_d + 1.0));
+    }
+  }
+}
+
+libra::Vector<3> GravityPotential::CalcAcceleration_xcxf_m_s2(const libra::Vector<3>& position_xcxf_m) {
+  const double x_m = position_xcxf_m[0];
+  const double y_m = position_xcxf_m[1];
+  const double z_m = position_xcxf_m[2];
+  const double radius_m = sqrt(x_m * x_m + y_m * y_m + z_m * z_m);
+
+  const double tmp = center_body_radius_m_ / (radius_m * radius_m);
+  const double x_tmp = x_m * tmp;
+  const double y_tmp = y_m * tmp;
+  const double z_tmp = z_m * tmp;
+  const double re_tmp = center_body_radius_m_ * tmp;
+
+  // Calc V and W
+  const size_t degree_vw = degree_ + 1;
+  // n = m = 0
+  v_[0] = center_body_radius_m_ / radius_m;
+  w_[0] = 0.0;
+  for (size_t m = 0; m < degree_vw; m++) {
+    // n = m + 1
+    size_t n = m + 1;
+    size_t index = GetIndex(n, m);
+    size_t index_prev = GetIndex(n - 1, m);
+    v_[index] = vw_nm_factor1_[index] * z_tmp * v_[index_prev];
+    w_[index] = vw_nm_factor1_[index] * z_tmp * w_[index_prev];
+    // n > m + 1
+    for (n = m + 2; n <= degree_vw; n++) {
+      index = GetIndex(n, m);
+      index_prev = GetIndex(n - 1, m);
+      const size_t index_prev2 = GetIndex(n - 2, m);
+      v_[index] = vw_nm_factor1_[index] * z_tmp * v_[index_prev] - vw_nm_factor2_[index] * re_tmp * v_[index_prev2];
+      w_[index] = vw_nm_factor1_[index] * z_tmp * w_[index_prev] - vw_nm_factor2_[index] * re_tmp * w_[index_prev2];
+    }
+    // n = m + 1, m = m + 1
+    n = m + 1;
+    index = GetIndex(n, n);
+    index_prev = GetIndex(n - 1, n - 1);
+    v_[index] = vw_nn_factor_[n] * (x_tmp * v_[index_prev] - y_tmp * w_[index_prev]);
+    w_[index] = vw_nn_factor_[n] * (x_tmp * w_[index_prev] + y_tmp * v_[index_prev]);
+  }
+
+  // Calc Acceleration
+  double acceleration_x = 0.0;
+  double acceleration_y = 0.0;
+  double acceleration_z = 0.0;
+  for (size_t n = 0; n <= degree_; n++) {
+    const size_t index_n = GetIndex(n, 0);
+    const size_t index_n1 = GetIndex(n + 1, 0);
+    // m = 0
+    double c = c_[index_n];
+    double s = s_[index_n];
+    acceleration_x += -c * v_[index_n1 + 1] * acceleration_xy1_factor_[index_n];
+    acceleration_y += -c * w_[index_n1 + 1] * acceleration_xy1_factor_[index_n];
+    acceleration_z += (-c * v_[index_n1] - s * w_[index_n1]) * acceleration_z_factor_[index_n];
+    // m > 0
+    for (size_t m = 1; m <= n; m++) {
+      const size_t index = index_n + m;
+      const size_t index_vw = index_n1 + m;
+      c = c_[index];
+      s = s_[index];
+      const double v_plus = v_[index_vw + 1];
+      const double w_plus = w_[index_vw + 1];
+      const double v_minus = v_[index_vw - 1];
+      const double w_minus = w_[index_vw - 1];
+
+      acceleration_x += acceleration_xy1_factor_[index] * (-c * v_plus - s * w_plus) + acceleration_xy2_factor_[index] * (c * v_minus + s * w_minus);
+      acceleration_y += acceleration_xy1_factor_[index] * (-c * w_plus + s * v_plus) + acceleration_xy2_factor_[index] * (-c * w_minus + s * v_minus);
+      acceleration_z += (-c * v_[index_vw] - s * w_[index_vw]) * acceleration_z_factor_[index];
+    }
+  }
+
+  const double scale = gravity_constant_m3_s2_ / (center_body_radius_m_ * center_body_radius_m_);
+  libra::Vector<3> acceleration_xcxf_m_s2;
+  acceleration_xcxf_m_s2[0] = acceleration_x * scale;
+  acceleration_xcxf_m_s2[1] = acceleration_y * scale;
+  acceleration_xcxf_m_s2[2] = acceleration_z * scale;
+  return acceleration_xcxf_m_s2;
+}
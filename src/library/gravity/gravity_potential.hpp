@@ -0,0 +1,85 @@
+/**
+ * @file gravity_potential.hpp
+ * @brief Class to calculate the high-order gravity acceleration with spherical harmonics
+ */
+
+#ifndef S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_HPP_
+#define S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_HPP_
+
+#include <vector>
+
+#include "../math/vector.hpp"
+
+/**
+ * @class GravityPotential
+ * @brief Class to calculate the high-order gravity acceleration with spherical harmonics
+ * @note The coefficients and the normalization factors are stored in flat triangular arrays and precomputed at the construction.
+ *       The recursion tables for V and W are also allocated at the construction, so no memory allocation happens in the calculation.
+ */
+class GravityPotential {
+ public:
+  /**
+   * @fn GravityPotential
+   * @brief Constructor
+   * @param [in] degree: Maximum degree to calculate the gravity potential
+   * @param [in] cosine_coefficients: Normalized cosine coefficients C[n][m] (n, m <= degree)
+   * @param [in] sine_coefficients: Normalized sine coefficients S[n][m] (n, m <= degree)
+   * @param [in] gravity_constant_m3_s2: Gravity constant of the center body [m3/s2]
+   * @param [in] center_body_radius_m: Equatorial radius of the center body [m]
+   */
+  GravityPotential(const size_t degree, const std::vector<std::vector<double>>& cosine_coefficients,
+                   const std::vector<std::vector<double>>& sine_coefficients, const double gravity_constant_m3_s2, const double center_body_radius_m);
+
+  /**
+   * @fn CalcAcceleration_xcxf_m_s2
+   * @brief Calculate the gravity acceleration in the body fixed frame
+   * @param [in] position_xcxf_m: Position in the body fixed frame [m]
+   * @return Acceleration in the body fixed frame [m/s2]
+   */
+  libra::Vector<3> CalcAcceleration_xcxf_m_s2(const libra::Vector<3>& position_xcxf_m);
+
+  /**
+   * @fn GetDegree
+   * @brief Return maximum degree
+   */
+  inline size_t GetDegree() const { return degree_; }
+
+ private:
+  size_t degree_;                  //!< Maximum degree
+  double gravity_constant_m3_s2_;  //!< Gravity constant of the center body [m3/s2]
+  double center_body_radius_m_;    //!< Equatorial radius of the center body [m]
+
+  // Coefficients (n <= degree)
+  std::vector<double> c_;  //!< Cosine coefficients
+  std::vector<double> s_;  //!< Sine coefficients
+
+  // Recursion tables (n <= degree + 1)
+  std::vector<double> v_;  //!< V function
+  std::vector<double> w_;  //!< W function
+
+  // Normalization factors for the recursion (n <= degree + 1)
+  std::vector<double> vw_nn_factor_;   //!< Factor for n = m
+  std::vector<double> vw_nm_factor1_;  //!< Factor of the (n-1, m) term for n > m
+  std::vector<double> vw_nm_factor2_;  //!< Factor of the (n-2, m) term for n > m
+
+  // Normalization factors for the acceleration (n <= degree)
+  std::vector<double> acceleration_xy1_factor_;  //!< Factor of the (n+1, m+1) term for x and y
+  std::vector<double> acceleration_xy2_factor_;  //!< Factor of the (n+1, m-1) term for x and y
+  std::vector<double> acceleration_z_factor_;    //!< Factor of the (n+1, m) term for z
+
+  /**
+   * @fn GetIndex
+   * @brief Return index of the triangular arrays
+   * @param [in] n: Degree
+   * @param [in] m: Order (m <= n)
+   */
+  static inline size_t GetIndex(const size_t n, const size_t m) { return n * (n + 1) / 2 + m; }
+
+  /**
+   * @fn CalcNormalizationFactors
+   * @brief Precompute normalization factors
+   */
+  void CalcNormalizationFactors();
+};
+
+#endif  // S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_HPP_
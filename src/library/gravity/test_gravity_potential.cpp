@@ -0,0 +1,59 @@
+/**
+ * @file test_gravity_potential.cpp
+ * @brief Test codes for GravityPotential class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "gravity_potential.hpp"
+
+/**
+ * @brief Test for acceleration without coefficients
+ */
+TEST(GravityPotential, ZeroCoefficients) {
+  const size_t degree = 10;
+  std::vector<std::vector<double>> c(degree + 1, std::vector<double>(degree + 1, 0.0));
+  std::vector<std::vector<double>> s(degree + 1, std::vector<double>(degree + 1, 0.0));
+  GravityPotential gravity(degree, c, s, 3.986004418e14, 6378137.0);
+
+  libra::Vector<3> position_m;
+  position_m[0] = 4000.0e3;
+  position_m[1] = -3000.0e3;
+  position_m[2] = 5000.0e3;
+  libra::Vector<3> acceleration_m_s2 = gravity.CalcAcceleration_xcxf_m_s2(position_m);
+
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(0.0, acceleration_m_s2[i]);
+  }
+}
+
+/**
+ * @brief Test for J2 acceleration compared with the analytical solution
+ */
+TEST(GravityPotential, J2) {
+  const size_t degree = 2;
+  const double gravity_constant_m3_s2 = 3.986004418e14;
+  const double radius_m = 6378137.0;
+  const double j2 = 1.08263e-3;
+  std::vector<std::vector<double>> c(degree + 1, std::vector<double>(degree + 1, 0.0));
+  std::vector<std::vector<double>> s(degree + 1, std::vector<double>(degree + 1, 0.0));
+  c[2][0] = -j2 / sqrt(5.0);  // Normalized coefficient
+  GravityPotential gravity(degree, c, s, gravity_constant_m3_s2, radius_m);
+
+  libra::Vector<3> position_m;
+  position_m[0] = 4000.0e3;
+  position_m[1] = -3000.0e3;
+  position_m[2] = 5000.0e3;
+  libra::Vector<3> acceleration_m_s2 = gravity.CalcAcceleration_xcxf_m_s2(position_m);
+
+  const double r_m = position_m.CalcNorm();
+  const double z2_r2 = position_m[2] * position_m[2] / (r_m * r_m);
+  const double factor = -1.5 * j2 * gravity_constant_m3_s2 * radius_m * radius_m / pow(r_m, 5.0);
+  const double expected[3] = {factor * position_m[0] * (1.0 - 5.0 * z2_r2), factor * position_m[1] * (1.0 - 5.0 * z2_r2),
+                              factor * position_m[2] * (3.0 - 5.0 * z2_r2)};
+
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_NEAR(expected[i], acceleration_m_s2[i], fabs(expected[i]) * 1e-12);
+  }
+}
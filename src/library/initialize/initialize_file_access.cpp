@@ -9,7 +9,16 @@
 
 #include <algorithm>
 #include <cstring>
+#include <fstream>
+#include <iterator>
 #include <limits>
+#include <map>
+#include <mutex>
+
+#ifndef WIN32
+#include <limits.h>
+#include <stdlib.h>
+#endif
 
 #ifdef WIN32
 IniAccess::IniAccess(const std::string file_path) : file_path_(file_path) {
@@ -17,17 +26,70 @@ IniAccess::IniAccess(const std::string file_path) : file_path_(file_path) {
   strncpy(file_path_char_, file_path_.c_str(), kMaxCharLength);
 }
 #else
-IniAccess::IniAccess(const std::string file_path) : file_path_(file_path), ini_reader_(file_path) {
+/**
+ * @struct ParsedIniFile
+ * @brief Parsed ini file in the cache
+ */
+struct ParsedIniFile {
+  std::string content;  //!< Content of the file when parsed
+  INIReader* reader;    //!< Parsed ini file
+};
+
+/**
+ * @fn LoadIniReader
+ * @brief Parse the ini file once and return the shared parsed data
+ * @note The cache is keyed by the canonical path and checked with the content of the file, since the modified time cannot detect a rewrite
+ *       within the resolution of the file system timestamp. The parsed data are kept until the end of the program since the instances of
+ *       IniAccess may refer the old data after the file is modified. This function is thread-safe.
+ * @param[in] file_path: File path of ini file
+ * @return Parsed ini file
+ */
+static const INIReader* LoadIniReader(const std::string& file_path) {
+  static std::mutex mutex;
+  static std::map<std::string, ParsedIniFile> parsed_files;
+
+  std::ifstream file(file_path, std::ios::binary);
+  if (!file.is_open()) {
+    // File open error is reported by ParseError
+    static const INIReader not_found_reader("");
+    return &not_found_reader;
+  }
+  // Reading the file is much faster than parsing it
+  const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  char canonical_path[PATH_MAX];
+  const std::string key = (realpath(file_path.c_str(), canonical_path) != NULL) ? std::string(canonical_path) : file_path;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto found = parsed_files.find(key);
+  if (found != parsed_files.end()) {
+    ParsedIniFile& parsed_file = found->second;
+    if (parsed_file.content == content) {
+      return parsed_file.reader;
+    }
+    // The old data is not deleted since the existing instances of IniAccess may refer it
+  }
+
+  // The read content is parsed so that the parsed data always match the compared content
+  ParsedIniFile& parsed_file = parsed_files[key];
+  parsed_file.content = content;
+  parsed_file.reader = new INIReader(content.c_str(), content.size());
+  return parsed_file.reader;
+}
+
+IniAccess::IniAccess(const std::string file_path) : file_path_(file_path) {
   strncpy(file_path_char_, file_path_.c_str(), kMaxCharLength);
 
   std::string ext = ".ini";
   if (file_path_.size() < 4 || !std::equal(std::rbegin(ext), std::rend(ext), std::rbegin(file_path_))) {
     // this is not ini file(csv)
+    static const INIReader empty_reader("", 0);
+    ini_reader_ = &empty_reader;
     return;
   }
-  if (ini_reader_.ParseError() != 0) {
+  ini_reader_ = LoadIniReader(file_path_);
+  if (ini_reader_->ParseError() != 0) {
     std::cerr << "Error reading INI file : " << file_path_ << std::endl;
-    std::cerr << "\t error code: " << ini_reader_.ParseError() << std::endl;
+    std::cerr << "\t error code: " << ini_reader_->ParseError() << std::endl;
     throw std::runtime_error("Error reading INI file");
   }
 }
@@ -46,7 +108,7 @@ double IniAccess::ReadDouble(const char* section_name, const char* key_name) {
 
   return temp;
 #else
-  return ini_reader_.GetReal(section_name, key_name, 0);
+  return ini_reader_->GetReal(section_name, key_name, 0);
 #endif
 }
 
@@ -58,7 +120,7 @@ int IniAccess::ReadInt(const char* section_name, const char* key_name) {
 
   return temp;
 #else
-  return (int)ini_reader_.GetInteger(section_name, key_name, 0);
+  return (int)ini_reader_->GetInteger(section_name, key_name, 0);
 #endif
 }
 bool IniAccess::ReadBoolean(const char* section_name, const char* key_name) {
@@ -71,7 +133,7 @@ bool IniAccess::ReadBoolean(const char* section_name, const char* key_name) {
   }
   return false;
 #else
-  return ini_reader_.GetBoolean(section_name, key_name, false);
+  return ini_reader_->GetBoolean(section_name, key_name, false);
 #endif
 }
 
@@ -122,11 +184,23 @@ std::string IniAccess::ReadString(const char* section_name, const char* key_name
   ReadChar(section_name, key_name, kMaxCharLength, temp);
   return std::string(temp);
 #else
-  std::string value = ini_reader_.GetString(section_name, key_name, "NULL");
+  std::string value = ini_reader_->GetString(section_name, key_name, "NULL");
   return value;
 #endif
 }
 
+bool IniAccess::HasKey(const char* section_name, const char* key_name) {
+#ifdef WIN32
+  // The default value is not a valid line of the ini file, so it is returned only for the missing key
+  const char* kNotFound = "\n";
+  char temp[kMaxCharLength];
+  GetPrivateProfileStringA(section_name, key_name, kNotFound, temp, kMaxCharLength, file_path_char_);
+  return strcmp(temp, kNotFound) != 0;
+#else
+  return ini_reader_->HasValue(section_name, key_name);
+#endif
+}
+
 bool IniAccess::ReadEnable(const char* section_name, const char* key_name) {
   std::string enable_string = ReadString(section_name, key_name);
   if (enable_string.compare("ENABLE") == 0) return true;
@@ -32,6 +32,7 @@ class IniAccess {
   /**
    * @fn IniAccess
    * @brief Constructor
+   * @note The parsed ini file is cached in the process and shared with other instances. The file is parsed again when it is modified.
    * @param[in] file_path: File path of ini file
    */
   IniAccess(const std::string file_path);
@@ -113,6 +114,15 @@ class IniAccess {
    * @return Read string data
    */
   std::string ReadString(const char* section_name, const char* key_name);
+  /**
+   * @fn HasKey
+   * @brief Return true when the key is written in the section
+   * @note The Read functions return a default value for the missing key, such as "NULL" for ReadString and 0 for ReadInt.
+   * @param[in] section_name: Section name
+   * @param[in] key_name: Key name
+   * @return Return true when the key is written in the section
+   */
+  bool HasKey(const char* section_name, const char* key_name);
 
   /**
    * @fn ReadEnable
@@ -163,7 +173,7 @@ class IniAccess {
   char file_path_char_[kMaxCharLength];  //!< File path in char
   char text_buffer_[kMaxCharLength];     //!< buffer
 #ifndef WIN32
-  INIReader ini_reader_;  //!< ini ini_reader_
+  const INIReader* ini_reader_;  //!< Parsed ini file shared in the process
 #endif
 };
 
@@ -0,0 +1,102 @@
+/**
+ * @file test_initialize_file_access.cpp
+ * @brief Test codes for IniAccess class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "initialize_file_access.hpp"
+
+/**
+ * @brief Write a test ini file
+ */
+void WriteTestIniFile(const std::string file_path, const std::string value) {
+  std::ofstream ini_file(file_path);
+  ini_file << "[SECTION]" << std::endl;
+  ini_file << "double_value = " << value << std::endl;
+  ini_file << "string_value = TEST" << std::endl;
+}
+
+/**
+ * @brief Test for reading values from the shared parsed file
+ */
+TEST(IniAccess, ReadSharedFile) {
+  const std::string file_path = "test_initialize_file_access_shared.ini";
+  WriteTestIniFile(file_path, "1.5");
+
+  IniAccess ini_file_1(file_path);
+  IniAccess ini_file_2("./" + file_path);
+  EXPECT_DOUBLE_EQ(1.5, ini_file_1.ReadDouble("SECTION", "double_value"));
+  EXPECT_DOUBLE_EQ(1.5, ini_file_2.ReadDouble("SECTION", "double_value"));
+  EXPECT_EQ("TEST", ini_file_2.ReadString("SECTION", "string_value"));
+  EXPECT_EQ("NULL", ini_file_2.ReadString("SECTION", "not_found"));
+
+  remove(file_path.c_str());
+}
+
+/**
+ * @brief Test for reading the modified file
+ */
+TEST(IniAccess, ReadModifiedFile) {
+  const std::string file_path = "test_initialize_file_access_modified.ini";
+  WriteTestIniFile(file_path, "1.5");
+  IniAccess ini_file_before(file_path);
+
+  WriteTestIniFile(file_path, "-2.25");
+  IniAccess ini_file_after(file_path);
+
+  // The instance made before the modification keeps the old values
+  EXPECT_DOUBLE_EQ(1.5, ini_file_before.ReadDouble("SECTION", "double_value"));
+  EXPECT_DOUBLE_EQ(-2.25, ini_file_after.ReadDouble("SECTION", "double_value"));
+
+  remove(file_path.c_str());
+}
+
+/**
+ * @brief Test for reading the file rewritten with the same size at once, which has the same modified time in seconds
+ */
+TEST(IniAccess, ReadSameSizeModifiedFile) {
+  const std::string file_path = "test_initialize_file_access_same_size.ini";
+  WriteTestIniFile(file_path, "1.5");
+  IniAccess ini_file_before(file_path);
+
+  for (int i = 0; i < 10; i++) {
+    const std::string value = std::to_string(i) + ".5";
+    WriteTestIniFile(file_path, value);
+    IniAccess ini_file_after(file_path);
+    EXPECT_DOUBLE_EQ(i + 0.5, ini_file_after.ReadDouble("SECTION", "double_value"));
+  }
+  EXPECT_DOUBLE_EQ(1.5, ini_file_before.ReadDouble("SECTION", "double_value"));
+
+  remove(file_path.c_str());
+}
+
+/**
+ * @brief Test for the check of the missing key, which cannot be distinguished by the read values
+ */
+TEST(IniAccess, HasKey) {
+  const std::string file_path = "test_initialize_file_access_has_key.ini";
+  {
+    std::ofstream ini_file(file_path);
+    ini_file << "[SIMULATION_SETTINGS]" << std::endl;
+    ini_file << "number_of_simulated_spacecraft = 1" << std::endl;
+    ini_file << "[OTHER_SETTINGS]" << std::endl;
+    ini_file << "number_of_spacecraft_update_threads = 0" << std::endl;
+  }
+  IniAccess ini_file(file_path);
+
+  // The ini file without the key returns the same values as the key with 0
+  EXPECT_FALSE(ini_file.HasKey("SIMULATION_SETTINGS", "number_of_spacecraft_update_threads"));
+  EXPECT_EQ("NULL", ini_file.ReadString("SIMULATION_SETTINGS", "number_of_spacecraft_update_threads"));
+  EXPECT_EQ(0, ini_file.ReadInt("SIMULATION_SETTINGS", "number_of_spacecraft_update_threads"));
+  EXPECT_TRUE(ini_file.HasKey("OTHER_SETTINGS", "number_of_spacecraft_update_threads"));
+  EXPECT_EQ(0, ini_file.ReadInt("OTHER_SETTINGS", "number_of_spacecraft_update_threads"));
+
+  EXPECT_TRUE(ini_file.HasKey("SIMULATION_SETTINGS", "number_of_simulated_spacecraft"));
+  EXPECT_FALSE(ini_file.HasKey("NOT_FOUND", "number_of_simulated_spacecraft"));
+
+  remove(file_path.c_str());
+}
@@ -0,0 +1,59 @@
+/**
+ * @file benchmark_log_utility.cpp
+ * @brief Benchmark to compare the string based log formatting and the allocation free log formatting
+ */
+
+#include <chrono>
+#include <iostream>
+#include <library/logger/log_utility.hpp>
+
+/**
+ * @fn main
+ * @brief Measure the formatting throughput in values/second
+ */
+int main() {
+  const size_t kNumberOfLines = 200000;
+  libra::Vector<3> vector;
+  libra::Quaternion quaternion(0.1, -0.2, 0.3, 0.9);
+  const size_t kNumberOfValuesPerLine = 3 * 2 + 4 + 1;
+
+  // Old: std::stringstream and std::string for each value
+  size_t old_length = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t line = 0; line < kNumberOfLines; line++) {
+    for (size_t i = 0; i < 3; i++) vector[i] = 6378137.0 * (line + i) / kNumberOfLines;
+    std::string str_tmp = "";
+    str_tmp += WriteVector(vector, 16);
+    str_tmp += WriteVector(vector);
+    str_tmp += WriteQuaternion(quaternion);
+    str_tmp += WriteScalar(vector[0] * 1.0e-3);
+    old_length += str_tmp.size();
+  }
+  double old_time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  // New: std::to_chars into a reused buffer
+  size_t new_length = 0;
+  std::string buffer;
+  start = std::chrono::steady_clock::now();
+  for (size_t line = 0; line < kNumberOfLines; line++) {
+    for (size_t i = 0; i < 3; i++) vector[i] = 6378137.0 * (line + i) / kNumberOfLines;
+    buffer.clear();
+    AppendVector(buffer, vector, 16);
+    AppendVector(buffer, vector);
+    AppendQuaternion(buffer, quaternion);
+    AppendScalar(buffer, vector[0] * 1.0e-3);
+    new_length += buffer.size();
+  }
+  double new_time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  const double number_of_values = (double)(kNumberOfLines * kNumberOfValuesPerLine);
+  std::cout << "Write functions : " << number_of_values / old_time_s << " values/s" << std::endl;
+  std::cout << "Append functions: " << number_of_values / new_time_s << " values/s" << std::endl;
+  std::cout << "Speed up        : " << old_time_s / new_time_s << std::endl;
+  if (old_length != new_length) {
+    std::cerr << "Output length mismatch: " << old_length << " " << new_length << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
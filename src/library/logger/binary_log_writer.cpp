@@ -0,0 +1,79 @@
+/**
+ * @file binary_log_writer.cpp
+ * @brief Class to write log values into a binary columnar file
+ */
+
+#include "binary_log_writer.hpp"
+
+#include <algorithm>
+#include <limits>
+
+BinaryLogWriter::BinaryLogWriter(const size_t number_of_rows_per_chunk) : number_of_rows_per_chunk_(number_of_rows_per_chunk) {
+  if (number_of_rows_per_chunk_ == 0) number_of_rows_per_chunk_ = 1;
+}
+
+BinaryLogWriter::~BinaryLogWriter() { Close(); }
+
+bool BinaryLogWriter::Open(const std::string& file_path) {
+  file_.open(file_path, std::ios::out | std::ios::binary);
+  return file_.is_open();
+}
+
+void BinaryLogWriter::Close() {
+  if (!file_.is_open()) return;
+  Flush();
+  file_.close();
+}
+
+void BinaryLogWriter::AddColumn(const std::string& name) {
+  if (is_header_written_) return;
+  column_names_.push_back(name);
+}
+
+void BinaryLogWriter::WriteColumnHeaders() {
+  if (is_header_written_ || !file_.is_open()) return;
+
+  const char kMagic[8] = {'S', '2', 'E', 'B', 'L', 'O', 'G', '\0'};
+  file_.write(kMagic, sizeof(kMagic));
+  WriteUint32(kByteOrderMark);
+  WriteUint32(kFormatVersion);
+  WriteUint32((uint32_t)column_names_.size());
+  for (const auto& name : column_names_) {
+    WriteUint32((uint32_t)name.size());
+    file_.write(name.data(), name.size());
+  }
+
+  chunk_buffer_.assign(column_names_.size() * number_of_rows_per_chunk_, std::numeric_limits<double>::quiet_NaN());
+  number_of_buffered_rows_ = 0;
+  is_header_written_ = true;
+}
+
+void BinaryLogWriter::WriteRow(const std::vector<double>& values) {
+  if (!is_header_written_) return;
+
+  const size_t number_of_columns = column_names_.size();
+  const size_t number_of_values = std::min(values.size(), number_of_columns);
+  for (size_t column = 0; column < number_of_values; column++) {
+    chunk_buffer_[column * number_of_rows_per_chunk_ + number_of_buffered_rows_] = values[column];
+  }
+  for (size_t column = number_of_values; column < number_of_columns; column++) {
+    chunk_buffer_[column * number_of_rows_per_chunk_ + number_of_buffered_rows_] = std::numeric_limits<double>::quiet_NaN();
+  }
+  number_of_buffered_rows_++;
+
+  if (number_of_buffered_rows_ >= number_of_rows_per_chunk_) Flush();
+}
+
+void BinaryLogWriter::Flush() {
+  if (!is_header_written_ || number_of_buffered_rows_ == 0) return;
+
+  WriteUint32((uint32_t)number_of_buffered_rows_);
+  for (size_t column = 0; column < column_names_.size(); column++) {
+    const double* column_head = &chunk_buffer_[column * number_of_rows_per_chunk_];
+    file_.write(reinterpret_cast<const char*>(column_head), sizeof(double) * number_of_buffered_rows_);
+  }
+  file_.flush();
+  number_of_buffered_rows_ = 0;
+}
+
+void BinaryLogWriter::WriteUint32(const uint32_t value) { file_.write(reinterpret_cast<const char*>(&value), sizeof(value)); }
@@ -0,0 +1,106 @@
+/**
+ * @file binary_log_writer.hpp
+ * @brief Class to write log values into a binary columnar file
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_BINARY_LOG_WRITER_HPP_
+#define S2E_LIBRARY_LOGGER_BINARY_LOG_WRITER_HPP_
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * @class BinaryLogWriter
+ * @brief Class to write log values into a binary columnar file
+ * @note File format (native byte order of the writer)
+ *       Header: "S2EBLOG" + '\0', byte order mark (uint32, kByteOrderMark), version (uint32), number of columns (uint32),
+ *               {name length (uint32), name (char[])} * number of columns
+ *       The readers detect the byte order of the file with the byte order mark.
+ *       Chunk: number of rows (uint32), {values (double[number of rows])} * number of columns
+ *       Chunks are repeated until the end of the file. Use scripts/Plot/convert_binary_log_to_csv.py to convert it to the CSV format.
+ */
+class BinaryLogWriter {
+ public:
+  /**
+   * @fn BinaryLogWriter
+   * @brief Constructor
+   * @param [in] number_of_rows_per_chunk: Number of rows stored in a chunk
+   */
+  BinaryLogWriter(const size_t number_of_rows_per_chunk = kDefaultNumberOfRowsPerChunk);
+  /**
+   * @fn ~BinaryLogWriter
+   * @brief Destructor
+   */
+  ~BinaryLogWriter();
+
+  /**
+   * @fn Open
+   * @brief Open the output file
+   * @param [in] file_path: Path to the output file
+   * @return True when the file is opened
+   */
+  bool Open(const std::string& file_path);
+  /**
+   * @fn Close
+   * @brief Flush the remaining rows and close the output file
+   */
+  void Close();
+
+  /**
+   * @fn AddColumn
+   * @brief Register a column. All columns must be registered before WriteColumnHeaders.
+   * @param [in] name: Column name
+   */
+  void AddColumn(const std::string& name);
+  /**
+   * @fn WriteColumnHeaders
+   * @brief Write the file header with the registered columns and allocate the chunk buffer
+   */
+  void WriteColumnHeaders();
+  /**
+   * @fn WriteRow
+   * @brief Write a row of values. The chunk is written to the file when it is filled.
+   * @param [in] values: Values of the row. Missing values are filled with NaN and extra values are ignored.
+   */
+  void WriteRow(const std::vector<double>& values);
+  /**
+   * @fn Flush
+   * @brief Write the partially filled chunk into the file
+   */
+  void Flush();
+
+  // Getter
+  /**
+   * @fn IsOpened
+   * @brief Return true when the output file is opened
+   */
+  inline bool IsOpened() const { return file_.is_open(); }
+  /**
+   * @fn GetNumberOfColumns
+   * @brief Return number of registered columns
+   */
+  inline size_t GetNumberOfColumns() const { return column_names_.size(); }
+
+  static const size_t kDefaultNumberOfRowsPerChunk = 1024;  //!< Default number of rows per chunk
+  static const uint32_t kFormatVersion = 2;                  //!< Version of the file format
+  static const uint32_t kByteOrderMark = 0x01020304;         //!< Byte order mark written in the native byte order
+
+ private:
+  std::ofstream file_;                     //!< Output file stream
+  std::vector<std::string> column_names_;  //!< Registered column names
+  size_t number_of_rows_per_chunk_;        //!< Number of rows stored in a chunk
+  size_t number_of_buffered_rows_ = 0;     //!< Number of rows in the chunk buffer
+  std::vector<double> chunk_buffer_;       //!< Column-major chunk buffer
+  bool is_header_written_ = false;         //!< Is the file header written?
+
+  /**
+   * @fn WriteUint32
+   * @brief Write an unsigned 32bit integer value
+   * @param [in] value: Value
+   */
+  void WriteUint32(const uint32_t value);
+};
+
+#endif  // S2E_LIBRARY_LOGGER_BINARY_LOG_WRITER_HPP_
@@ -12,8 +12,11 @@ Logger* InitLog(std::string file_name) {
 
   std::string log_file_path = ini_file.ReadString("SIMULATION_SETTINGS", "log_file_save_directory");
   bool log_ini = ini_file.ReadEnable("SIMULATION_SETTINGS", "save_initialize_files");
+  LogFileFormat log_format = SetLogFileFormat(ini_file.ReadString("SIMULATION_SETTINGS", "log_file_format"));
+  std::string log_file_name = (log_format == LogFileFormat::kBinary) ? "default.bin" : "default.csv";
 
-  Logger* log = new Logger("default.csv", log_file_path, file_name, log_ini, true);
+  Logger* log = new Logger(log_file_name, log_file_path, file_name, log_ini, true, log_format);
+  InitLogAsyncWriting(log, file_name);
 
   return log;
 }
@@ -28,3 +31,14 @@ Logger* InitMonteCarloLog(std::string file_name, bool enable) {
 
   return log;
 }
+
+void InitLogAsyncWriting(Logger* log, std::string file_name) {
+  IniAccess ini_file(file_name);
+
+  if (ini_file.ReadEnable("SIMULATION_SETTINGS", "log_async_writing") == false) return;
+  int number_of_records = ini_file.ReadInt("SIMULATION_SETTINGS", "log_async_number_of_records");
+  if (number_of_records <= 0) number_of_records = 1;
+  LogBackPressurePolicy policy = SetLogBackPressurePolicy(ini_file.ReadString("SIMULATION_SETTINGS", "log_async_back_pressure"));
+
+  log->StartAsyncWriting((size_t)number_of_records, policy);
+}
@@ -23,4 +23,12 @@ Logger* InitLog(std::string file_name);
  */
 Logger* InitMonteCarloLog(std::string file_name, bool enable);
 
+/**
+ * @fn InitLogAsyncWriting
+ * @brief Start the asynchronous writer thread of the logger when it is enabled in the initialize file
+ * @param [in] log: Logger
+ * @param [in] file_name: File name of the initialize file
+ */
+void InitLogAsyncWriting(Logger* log, std::string file_name);
+
 #endif  // S2E_LIBRARY_LOGGER_INITIALIZE_LOG_HPP_
@@ -0,0 +1,72 @@
+/**
+ * @file log_record_queue.cpp
+ * @brief Bounded queue of log records to pass log values to the writer thread
+ */
+
+#include "log_record_queue.hpp"
+
+LogBackPressurePolicy SetLogBackPressurePolicy(const std::string policy) {
+  if (policy == "BLOCK") {
+    return LogBackPressurePolicy::kBlock;
+  } else if (policy == "DROP") {
+    return LogBackPressurePolicy::kDrop;
+  } else {
+    return LogBackPressurePolicy::kBlock;
+  }
+}
+
+LogRecordQueue::LogRecordQueue(const size_t number_of_records, const LogBackPressurePolicy policy) : policy_(policy) {
+  records_.resize(number_of_records > 0 ? number_of_records : 1);
+}
+
+LogRecord* LogRecordQueue::AcquireRecord() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (number_of_used_records_ >= records_.size()) {
+    if (policy_ == LogBackPressurePolicy::kDrop) {
+      number_of_dropped_records_++;
+      return nullptr;
+    }
+    producer_cv_.wait(lock, [this] { return number_of_used_records_ < records_.size(); });
+  }
+  number_of_used_records_++;
+  return &records_[write_index_];
+}
+
+void LogRecordQueue::CommitRecord() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    write_index_ = (write_index_ + 1) % records_.size();
+    number_of_committed_records_++;
+  }
+  consumer_cv_.notify_one();
+}
+
+void LogRecordQueue::WaitUntilEmpty() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  producer_cv_.wait(lock, [this] { return number_of_used_records_ == 0; });
+}
+
+void LogRecordQueue::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stopped_ = true;
+  }
+  consumer_cv_.notify_one();
+}
+
+const LogRecord* LogRecordQueue::WaitRecord() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  consumer_cv_.wait(lock, [this] { return number_of_committed_records_ > 0 || is_stopped_; });
+  if (number_of_committed_records_ == 0) return nullptr;
+  return &records_[read_index_];
+}
+
+void LogRecordQueue::ReleaseRecord() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    read_index_ = (read_index_ + 1) % records_.size();
+    number_of_committed_records_--;
+    number_of_used_records_--;
+  }
+  producer_cv_.notify_one();
+}
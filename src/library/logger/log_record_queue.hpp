@@ -0,0 +1,126 @@
+/**
+ * @file log_record_queue.hpp
+ * @brief Bounded queue of log records to pass log values to the writer thread
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_LOG_RECORD_QUEUE_HPP_
+#define S2E_LIBRARY_LOGGER_LOG_RECORD_QUEUE_HPP_
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @enum LogBackPressurePolicy
+ * @brief Behavior when the queue is full
+ */
+enum class LogBackPressurePolicy {
+  kBlock = 0,  //!< Wait until the writer thread frees a record
+  kDrop,       //!< Drop the record and count it
+};
+
+/**
+ * @fn SetLogBackPressurePolicy
+ * @brief Convert string to LogBackPressurePolicy
+ * @param [in] policy: Policy name (BLOCK or DROP)
+ * @return Back pressure policy. BLOCK is returned for unknown names.
+ */
+LogBackPressurePolicy SetLogBackPressurePolicy(const std::string policy);
+
+/**
+ * @struct LogTextSegment
+ * @brief Position of a text in a log record
+ */
+struct LogTextSegment {
+  size_t value_position;  //!< The text is placed before the value at this position
+  size_t text_end;        //!< End position of the text in LogRecord::text
+};
+
+/**
+ * @struct LogRecord
+ * @brief A line of the log
+ * @note The values are snapshotted by the simulation thread and formatted by the writer thread.
+ *       The loggables without the binary values are snapshotted as text, which is inserted between the values in the CSV output.
+ */
+struct LogRecord {
+  std::vector<double> values;                 //!< Numeric values
+  std::string text;                           //!< Texts of the loggables without the binary values (CSV output only)
+  std::vector<LogTextSegment> text_segments;  //!< Positions of the texts (CSV output only)
+  bool add_newline = true;                    //!< Add newline after the line (CSV output only)
+};
+
+/**
+ * @class LogRecordQueue
+ * @brief Bounded single-producer/single-consumer queue of log records
+ * @note All records are allocated at the construction and reused to avoid memory allocation in the simulation loop.
+ */
+class LogRecordQueue {
+ public:
+  /**
+   * @fn LogRecordQueue
+   * @brief Constructor
+   * @param [in] number_of_records: Number of records in the queue
+   * @param [in] policy: Behavior when the queue is full
+   */
+  LogRecordQueue(const size_t number_of_records, const LogBackPressurePolicy policy);
+
+  // Producer side
+  /**
+   * @fn AcquireRecord
+   * @brief Get a free record to fill
+   * @return The free record. nullptr when the queue is full and the policy is kDrop.
+   */
+  LogRecord* AcquireRecord();
+  /**
+   * @fn CommitRecord
+   * @brief Pass the record acquired by AcquireRecord to the consumer
+   */
+  void CommitRecord();
+  /**
+   * @fn WaitUntilEmpty
+   * @brief Wait until the consumer releases all records
+   */
+  void WaitUntilEmpty();
+  /**
+   * @fn Stop
+   * @brief Request the consumer to finish after all records are consumed
+   */
+  void Stop();
+
+  // Consumer side
+  /**
+   * @fn WaitRecord
+   * @brief Wait a committed record
+   * @return The committed record. nullptr when the queue is stopped and empty.
+   */
+  const LogRecord* WaitRecord();
+  /**
+   * @fn ReleaseRecord
+   * @brief Return the record obtained by WaitRecord to the producer
+   */
+  void ReleaseRecord();
+
+  // Getter
+  /**
+   * @fn GetNumberOfDroppedRecords
+   * @brief Return number of records dropped by the kDrop policy
+   */
+  inline size_t GetNumberOfDroppedRecords() const { return number_of_dropped_records_; }
+
+ private:
+  std::vector<LogRecord> records_;          //!< Preallocated records
+  LogBackPressurePolicy policy_;            //!< Behavior when the queue is full
+  size_t write_index_ = 0;                  //!< Index of the next record for the producer
+  size_t read_index_ = 0;                   //!< Index of the next record for the consumer
+  size_t number_of_used_records_ = 0;       //!< Number of records acquired and not released yet
+  size_t number_of_committed_records_ = 0;  //!< Number of records committed and not released yet
+  size_t number_of_dropped_records_ = 0;    //!< Number of dropped records
+  bool is_stopped_ = false;                 //!< Stop request flag
+
+  std::mutex mutex_;                     //!< Mutex for the indexes and the counters
+  std::condition_variable producer_cv_;  //!< Notified when a record is released
+  std::condition_variable consumer_cv_;  //!< Notified when a record is committed or stop is requested
+};
+
+#endif  // S2E_LIBRARY_LOGGER_LOG_RECORD_QUEUE_HPP_
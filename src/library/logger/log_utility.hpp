@@ -6,11 +6,14 @@
 #ifndef S2E_LIBRARY_LOGGER_LOG_UTILITY_HPP_
 #define S2E_LIBRARY_LOGGER_LOG_UTILITY_HPP_
 
+#include <charconv>
 #include <iomanip>
 #include <library/math/matrix_vector.hpp>
 #include <library/math/quaternion.hpp>
 #include <sstream>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 /**
  * @fn WriteScalar
@@ -79,6 +82,75 @@ inline std::string WriteQuaternion(const libra::Quaternion quaternion, const int
  */
 inline std::string WriteQuaternion(const std::string name, const std::string frame);
 
+/**
+ * @fn AppendScalar
+ * @brief Append scalar value for binary log
+ * @param [out] values: Output value list
+ * @param [in] scalar: scalar value
+ */
+template <typename T>
+inline void AppendScalar(std::vector<double>& values, const T scalar);
+/**
+ * @fn AppendVector
+ * @brief Append vector value for binary log
+ * @param [out] values: Output value list
+ * @param [in] vector: vector value
+ */
+template <size_t NUM>
+inline void AppendVector(std::vector<double>& values, const libra::Vector<NUM, double>& vector);
+/**
+ * @fn AppendMatrix
+ * @brief Append matrix value for binary log
+ * @param [out] values: Output value list
+ * @param [in] matrix: matrix value
+ */
+template <size_t ROW, size_t COLUMN>
+inline void AppendMatrix(std::vector<double>& values, const libra::Matrix<ROW, COLUMN, double>& matrix);
+/**
+ * @fn AppendQuaternion
+ * @brief Append quaternion value for binary log
+ * @param [out] values: Output value list
+ * @param [in] quaternion: Quaternion
+ */
+inline void AppendQuaternion(std::vector<double>& values, const libra::Quaternion& quaternion);
+
+/**
+ * @fn AppendScalar
+ * @brief Append scalar value to the CSV text buffer without memory allocation
+ * @note The output is same with WriteScalar. Reuse the buffer to avoid the memory allocation.
+ * @param [out] buffer: Output text buffer
+ * @param [in] scalar: scalar value
+ * @param [in] precision: precision for the value (number of digit)
+ */
+template <typename T>
+inline void AppendScalar(std::string& buffer, const T scalar, const int precision = 6);
+/**
+ * @fn AppendVector
+ * @brief Append vector value to the CSV text buffer without memory allocation
+ * @param [out] buffer: Output text buffer
+ * @param [in] vector: vector value
+ * @param [in] precision: precision for the value (number of digit)
+ */
+template <size_t NUM>
+inline void AppendVector(std::string& buffer, const libra::Vector<NUM, double>& vector, const int precision = 6);
+/**
+ * @fn AppendMatrix
+ * @brief Append matrix value to the CSV text buffer without memory allocation
+ * @param [out] buffer: Output text buffer
+ * @param [in] matrix: matrix value
+ * @param [in] precision: precision for the value (number of digit)
+ */
+template <size_t ROW, size_t COLUMN>
+inline void AppendMatrix(std::string& buffer, const libra::Matrix<ROW, COLUMN, double>& matrix, const int precision = 6);
+/**
+ * @fn AppendQuaternion
+ * @brief Append quaternion value to the CSV text buffer without memory allocation
+ * @param [out] buffer: Output text buffer
+ * @param [in] quaternion: Quaternion
+ * @param [in] precision: precision for the value (number of digit)
+ */
+inline void AppendQuaternion(std::string& buffer, const libra::Quaternion& quaternion, const int precision = 6);
+
 //
 // Libraries for log writing
 //
@@ -156,4 +228,86 @@ std::string WriteQuaternion(const std::string name, const std::string frame) {
   return str_tmp.str();
 }
 
+//
+// Libraries for binary log writing
+//
+template <typename T>
+void AppendScalar(std::vector<double>& values, const T scalar) {
+  values.push_back(static_cast<double>(scalar));
+}
+
+template <size_t NUM>
+void AppendVector(std::vector<double>& values, const libra::Vector<NUM, double>& vector) {
+  for (size_t n = 0; n < NUM; n++) {
+    values.push_back(vector[n]);
+  }
+}
+
+template <size_t ROW, size_t COLUMN>
+void AppendMatrix(std::vector<double>& values, const libra::Matrix<ROW, COLUMN, double>& matrix) {
+  for (size_t n = 0; n < ROW; n++) {
+    for (size_t m = 0; m < COLUMN; m++) {
+      values.push_back(matrix[n][m]);
+    }
+  }
+}
+
+void AppendQuaternion(std::vector<double>& values, const libra::Quaternion& quaternion) {
+  for (size_t i = 0; i < 4; i++) {
+    values.push_back(quaternion[i]);
+  }
+}
+
+//
+// Libraries for allocation free log writing
+//
+template <typename T>
+void AppendScalar(std::string& buffer, const T scalar, const int precision) {
+  if constexpr (std::is_same<T, bool>::value) {
+    buffer += scalar ? '1' : '0';
+  } else if constexpr (std::is_same<T, char>::value) {
+    buffer += scalar;
+  } else if constexpr (std::is_integral<T>::value || std::is_floating_point<T>::value) {
+    // Same format with std::setprecision for the default floatfield (printf %g)
+    char text[64];
+    std::to_chars_result result;
+    if constexpr (std::is_integral<T>::value) {
+      result = std::to_chars(text, text + sizeof(text), scalar);
+    } else {
+      result = std::to_chars(text, text + sizeof(text), scalar, std::chars_format::general, precision);
+    }
+    if (result.ec != std::errc()) {
+      buffer += WriteScalar(scalar, precision);
+      return;
+    }
+    buffer.append(text, result.ptr);
+  } else {
+    buffer += WriteScalar(scalar, precision);
+    return;
+  }
+  buffer += ',';
+}
+
+template <size_t NUM>
+void AppendVector(std::string& buffer, const libra::Vector<NUM, double>& vector, const int precision) {
+  for (size_t n = 0; n < NUM; n++) {
+    AppendScalar(buffer, vector[n], precision);
+  }
+}
+
+template <size_t ROW, size_t COLUMN>
+void AppendMatrix(std::string& buffer, const libra::Matrix<ROW, COLUMN, double>& matrix, const int precision) {
+  for (size_t n = 0; n < ROW; n++) {
+    for (size_t m = 0; m < COLUMN; m++) {
+      AppendScalar(buffer, matrix[n][m], precision);
+    }
+  }
+}
+
+void AppendQuaternion(std::string& buffer, const libra::Quaternion& quaternion, const int precision) {
+  for (size_t i = 0; i < 4; i++) {
+    AppendScalar(buffer, quaternion[i], precision);
+  }
+}
+
 #endif  // S2E_LIBRARY_LOGGER_LOG_UTILITY_HPP_
@@ -7,6 +7,7 @@
 #define S2E_LIBRARY_LOGGER_LOGGABLE_HPP_
 
 #include <string>
+#include <vector>
 
 #include "log_utility.hpp"  // This is not necessary but include here for convenience
 
@@ -31,6 +32,28 @@ class ILoggable {
    */
   virtual std::string GetLogValue() const = 0;
 
+  /**
+   * @fn AppendLogValue
+   * @brief Append values to write in CSV output file
+   * @note Override this function with the Append functions in log_utility.hpp to avoid the memory allocation for each value.
+   * @param [out] buffer: The output values are appended here
+   */
+  virtual void AppendLogValue(std::string& buffer) const { buffer += GetLogValue(); }
+
+  /**
+   * @fn GetLogValueBinary
+   * @brief Get values to write in binary output file
+   * @note Override this function to skip the string formatting in the binary log mode.
+   *       The number and the order of the values must be same with the headers and GetLogValue.
+   *       Keep the default for the loggables with non-numeric values (e.g. the date of SimulationTime), which are parsed from GetLogValue.
+   * @param [out] values: The output values are appended here
+   * @return True when the values are appended. False to use GetLogValue instead.
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const {
+    (void)values;
+    return false;
+  }
+
   bool is_log_enabled_ = true;  //!< Log enable flag
 };
 
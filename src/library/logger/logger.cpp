@@ -5,7 +5,10 @@
 
 #include "logger.hpp"
 
+#include <charconv>
+#include <cstdlib>
 #include <ctime>
+#include <limits>
 #include <sstream>
 #ifdef _WIN32
 #include <direct.h>
@@ -14,20 +17,32 @@
 #endif
 
 std::vector<ILoggable *> log_list_;
-bool Logger::is_directory_created_ = false;
+
+// Append the value in the shortest representation which restores the same double value
+static void AppendRoundTripValue(std::string &buffer, const double value) {
+  char text[64];
+  const std::to_chars_result result = std::to_chars(text, text + sizeof(text), value);
+  buffer.append(text, result.ptr);
+  buffer += ',';
+}
+std::atomic<bool> Logger::is_directory_created_(false);
 
 Logger::Logger(const std::string &file_name, const std::string &data_path, const std::string &ini_file_name, const bool is_ini_save_enabled,
-               const bool is_enabled)
-    : is_enabled_(is_enabled), is_ini_save_enabled_(is_ini_save_enabled) {
+               const bool is_enabled, const LogFileFormat file_format)
+    : file_format_(file_format), async_queue_(nullptr), is_enabled_(is_enabled), is_ini_save_enabled_(is_ini_save_enabled) {
   is_file_opened_ = false;
   if (is_enabled_ == false) return;
 
   // Get current time to append it to the filename
   time_t timer = time(NULL);
-  struct tm *now;
-  now = localtime(&timer);
+  struct tm now;
+#ifdef WIN32
+  localtime_s(&now, &timer);
+#else
+  localtime_r(&timer, &now);
+#endif
   char start_time_c[64];
-  strftime(start_time_c, 64, "%y%m%d_%H%M%S", now);
+  strftime(start_time_c, 64, "%y%m%d_%H%M%S", &now);
 
   // Create directory
   if (is_ini_save_enabled_ == true || is_directory_created_ == false) {
@@ -39,8 +54,12 @@ Logger::Logger(const std::string &file_name, const std::string &data_path, const
   std::stringstream file_path;
   file_path << directory_path_ << start_time_c << "_" << file_name;
   if (is_enabled_) {
-    csv_file_.open(file_path.str());
-    is_file_opened_ = csv_file_.is_open();
+    if (file_format_ == LogFileFormat::kBinary) {
+      is_file_opened_ = binary_file_.Open(file_path.str());
+    } else {
+      csv_file_.open(file_path.str());
+      is_file_opened_ = csv_file_.is_open();
+    }
     if (!is_file_opened_) std::cerr << "Error opening log file: " << file_path.str() << std::endl;
   }
 
@@ -49,12 +68,23 @@ Logger::Logger(const std::string &file_name, const std::string &data_path, const
 }
 
 Logger::~Logger(void) {
+  StopAsyncWriting();
   if (is_file_opened_) {
-    csv_file_.close();
+    if (file_format_ == LogFileFormat::kBinary) {
+      binary_file_.Close();
+    } else {
+      csv_file_.close();
+    }
   }
 }
 
 void Logger::WriteHeaders(const bool add_newline) {
+  // The headers are written by this thread after the writer thread finishes the queued values
+  if (async_queue_ != nullptr) async_queue_->WaitUntilEmpty();
+  if (file_format_ == LogFileFormat::kBinary) {
+    WriteBinaryHeaders();
+    return;
+  }
   for (auto itr = log_list_.begin(); itr != log_list_.end(); ++itr) {
     if (!((*itr)->is_log_enabled_)) continue;
     Write((*itr)->GetLogHeader());
@@ -63,21 +93,184 @@ void Logger::WriteHeaders(const bool add_newline) {
 }
 
 void Logger::WriteValues(const bool add_newline) {
+  if (async_queue_ != nullptr) {
+    WriteAsyncValues(add_newline);
+    return;
+  }
+  if (file_format_ == LogFileFormat::kBinary) {
+    WriteBinaryValues();
+    return;
+  }
+  csv_line_.clear();
   for (auto itr = log_list_.begin(); itr != log_list_.end(); ++itr) {
     if (!((*itr)->is_log_enabled_)) continue;
-    Write((*itr)->GetLogValue());
+    (*itr)->AppendLogValue(csv_line_);
   }
-  if (add_newline) WriteNewLine();
+  if (add_newline) csv_line_ += "\n";
+  Write(csv_line_);
 }
 
 void Logger::WriteNewLine() { Write("\n"); }
 
-void Logger::Write(const std::string log, const bool flag) {
+void Logger::Write(const std::string &log, const bool flag) {
   if (flag && is_enabled_) {
     csv_file_ << log;
   }
 }
 
+void Logger::WriteBinaryHeaders() {
+  if (!is_enabled_ || !is_file_opened_) return;
+  binary_columns_.clear();
+  for (auto itr = log_list_.begin(); itr != log_list_.end(); ++itr) {
+    size_t number_of_columns = 0;
+    if ((*itr)->is_log_enabled_) {
+      std::vector<std::string> column_names = SplitLogString((*itr)->GetLogHeader());
+      for (const auto &column_name : column_names) {
+        binary_file_.AddColumn(column_name);
+      }
+      number_of_columns = column_names.size();
+    }
+    binary_columns_.push_back(BinaryLogColumns{number_of_columns, false, false});
+  }
+  binary_file_.WriteColumnHeaders();
+  binary_values_.reserve(binary_file_.GetNumberOfColumns());
+}
+
+void Logger::WriteBinaryValues() {
+  if (!is_enabled_ || !is_file_opened_) return;
+  binary_values_.clear();
+  CollectBinaryValues(binary_values_);
+  binary_file_.WriteRow(binary_values_);
+}
+
+void Logger::CollectBinaryValues(std::vector<double> &values) {
+  size_t loggable_index = 0;
+  for (auto itr = log_list_.begin(); itr != log_list_.end(); ++itr, ++loggable_index) {
+    if (!((*itr)->is_log_enabled_)) continue;
+    const size_t first_value_index = values.size();
+    bool has_non_numeric_value = false;
+    if (!(*itr)->GetLogValueBinary(values)) {
+      // Fallback for loggables without binary output. Non-numeric values are stored as NaN.
+      std::vector<std::string> log_values = SplitLogString((*itr)->GetLogValue());
+      for (const auto &value : log_values) {
+        const char *value_head = value.c_str();
+        char *value_end;
+        double value_double = strtod(value_head, &value_end);
+        if (value_end == value_head || *value_end != '\0') {
+          value_double = std::numeric_limits<double>::quiet_NaN();
+          has_non_numeric_value = true;
+        }
+        values.push_back(value_double);
+      }
+    }
+    // The loggables added after the headers are not checked
+    if (loggable_index >= binary_columns_.size()) continue;
+
+    BinaryLogColumns &columns = binary_columns_[loggable_index];
+    if (has_non_numeric_value && !columns.is_non_numeric_reported) {
+      std::cerr << "Non-numeric log values are stored as NaN in the binary log: " << (*itr)->GetLogHeader() << std::endl;
+      columns.is_non_numeric_reported = true;
+    }
+    const size_t number_of_values = values.size() - first_value_index;
+    if (number_of_values != columns.number_of_columns) {
+      if (!columns.is_mismatch_reported) {
+        std::cerr << "Error: Number of binary log values " << number_of_values << " does not match number of header columns "
+                  << columns.number_of_columns << ". The values are padded with NaN or truncated: " << (*itr)->GetLogHeader() << std::endl;
+        columns.is_mismatch_reported = true;
+      }
+      values.resize(first_value_index + columns.number_of_columns, std::numeric_limits<double>::quiet_NaN());
+    }
+  }
+}
+
+void Logger::StartAsyncWriting(const size_t number_of_records, const LogBackPressurePolicy policy) {
+  if (!is_enabled_ || !is_file_opened_ || async_queue_ != nullptr) return;
+
+  async_queue_ = new LogRecordQueue(number_of_records, policy);
+  async_writer_thread_ = std::thread(&Logger::RunAsyncWriter, this);
+}
+
+void Logger::WriteAsyncValues(const bool add_newline) {
+  if (!is_enabled_ || !is_file_opened_) return;
+
+  // Only snapshot the values here. The values are formatted and written by the writer thread.
+  LogRecord *record = async_queue_->AcquireRecord();
+  if (record == nullptr) return;  // Dropped
+
+  record->values.clear();
+  if (file_format_ == LogFileFormat::kBinary) {
+    CollectBinaryValues(record->values);
+  } else {
+    record->text.clear();
+    record->text_segments.clear();
+    for (auto itr = log_list_.begin(); itr != log_list_.end(); ++itr) {
+      if (!((*itr)->is_log_enabled_)) continue;
+      if ((*itr)->GetLogValueBinary(record->values)) continue;
+      // Loggables without binary output are snapshotted as text
+      (*itr)->AppendLogValue(record->text);
+      record->text_segments.push_back(LogTextSegment{record->values.size(), record->text.size()});
+    }
+    record->add_newline = add_newline;
+  }
+  async_queue_->CommitRecord();
+}
+
+void Logger::RunAsyncWriter() {
+  while (true) {
+    const LogRecord *record = async_queue_->WaitRecord();
+    if (record == nullptr) break;  // Stopped
+
+    if (file_format_ == LogFileFormat::kBinary) {
+      binary_file_.WriteRow(record->values);
+    } else {
+      FormatAsyncRecord(*record, async_csv_line_);
+      csv_file_ << async_csv_line_;
+    }
+    async_queue_->ReleaseRecord();
+  }
+}
+
+void Logger::FormatAsyncRecord(const LogRecord &record, std::string &line) {
+  line.clear();
+  size_t value_position = 0;
+  size_t text_head = 0;
+  for (const auto &segment : record.text_segments) {
+    for (; value_position < segment.value_position; value_position++) {
+      AppendRoundTripValue(line, record.values[value_position]);
+    }
+    line.append(record.text, text_head, segment.text_end - text_head);
+    text_head = segment.text_end;
+  }
+  for (; value_position < record.values.size(); value_position++) {
+    AppendRoundTripValue(line, record.values[value_position]);
+  }
+  if (record.add_newline) line += "\n";
+}
+
+void Logger::StopAsyncWriting() {
+  if (async_queue_ == nullptr) return;
+
+  async_queue_->Stop();
+  async_writer_thread_.join();
+  if (async_queue_->GetNumberOfDroppedRecords() > 0) {
+    std::cerr << "Number of dropped log records: " << async_queue_->GetNumberOfDroppedRecords() << std::endl;
+  }
+  delete async_queue_;
+  async_queue_ = nullptr;
+}
+
+std::vector<std::string> Logger::SplitLogString(const std::string &log) {
+  std::vector<std::string> elements;
+  size_t head = 0;
+  while (head < log.size()) {
+    size_t comma = log.find(',', head);
+    if (comma == std::string::npos) comma = log.size();
+    elements.push_back(log.substr(head, comma - head));
+    head = comma + 1;
+  }
+  return elements;
+}
+
 void Logger::AddLogList(ILoggable *loggable) { log_list_.push_back(loggable); }
 
 void Logger::ClearLogList() { log_list_.clear(); }
@@ -114,6 +307,16 @@ void Logger::CopyFileToLogDirectory(const std::string &ini_file_name) {
   return;
 }
 
+LogFileFormat SetLogFileFormat(const std::string format) {
+  if (format == "CSV") {
+    return LogFileFormat::kCsv;
+  } else if (format == "BINARY") {
+    return LogFileFormat::kBinary;
+  } else {
+    return LogFileFormat::kCsv;
+  }
+}
+
 std::string Logger::GetFileName(const std::string &path) {
   size_t pos1;
 
@@ -8,12 +8,33 @@
 
 #define _CRT_SECURE_NO_WARNINGS
 
+#include <atomic>
 #include <fstream>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include "binary_log_writer.hpp"
+#include "log_record_queue.hpp"
 #include "loggable.hpp"
 
+/**
+ * @enum LogFileFormat
+ * @brief Format of the log output file
+ */
+enum class LogFileFormat {
+  kCsv = 0,  //!< CSV text file
+  kBinary,   //!< Binary columnar file
+};
+
+/**
+ * @fn SetLogFileFormat
+ * @brief Convert string to LogFileFormat
+ * @param [in] format: Format name (CSV or BINARY)
+ * @return Log file format. CSV is returned for unknown names.
+ */
+LogFileFormat SetLogFileFormat(const std::string format);
+
 /**
  * @class Logger
  * @brief Class to manage log output file
@@ -28,12 +49,14 @@ class Logger {
    * @param [in] ini_file_name: Initialize file name
    * @param [in] is_ini_save_enabled: Enable flag to save ini files
    * @param [in] is_enabled: Enable flag for logging
+   * @param [in] file_format: Format of the log output file
    */
   Logger(const std::string &file_name, const std::string &data_path, const std::string &ini_file_name, const bool is_ini_save_enabled,
-         const bool is_enabled = true);
+         const bool is_enabled = true, const LogFileFormat file_format = LogFileFormat::kCsv);
   /**
    * @fn ~Logger
    * @brief Destructor
+   * @note All values queued for the asynchronous writer thread are written before the file is closed.
    */
   ~Logger(void);
 
@@ -62,6 +85,16 @@ class Logger {
    */
   void WriteValues(const bool add_newline = true);
 
+  /**
+   * @fn StartAsyncWriting
+   * @brief Start the writer thread. After this, WriteValues only stores the values into the queue.
+   * @note The CSV text is formatted in the writer thread. The values with the binary output are written in the shortest representation
+   *       which restores the same double value, instead of the precision of GetLogValue.
+   * @param [in] number_of_records: Number of records in the queue
+   * @param [in] policy: Behavior when the queue is full
+   */
+  void StartAsyncWriting(const size_t number_of_records, const LogBackPressurePolicy policy);
+
   /**
    * @fn Enabled
    * @brief Set enable flag of the log
@@ -85,24 +118,52 @@ class Logger {
    * @brief Return the path to the directory for log files
    */
   inline std::string GetLogPath() const { return directory_path_; }
+  /**
+   * @fn GetFileFormat
+   * @brief Return format of the log output file
+   */
+  inline LogFileFormat GetFileFormat() const { return file_format_; }
+  /**
+   * @fn GetNumberOfDroppedRecords
+   * @brief Return number of log records dropped by the asynchronous writer
+   */
+  inline size_t GetNumberOfDroppedRecords() const { return (async_queue_ == nullptr) ? 0 : async_queue_->GetNumberOfDroppedRecords(); }
 
  private:
-  std::ofstream csv_file_;             //!< CSV file stream
-  bool is_enabled_;                    //!< Enable flag for logging
-  bool is_file_opened_;                //!< Is the CSV file opened?
-  static bool is_directory_created_;   //!< Is the log output directory is created in the scenario
-  std::vector<ILoggable *> log_list_;  //!< Log list
+  std::ofstream csv_file_;                         //!< CSV file stream
+  LogFileFormat file_format_;                      //!< Format of the log output file
+  BinaryLogWriter binary_file_;                    //!< Binary file writer
+  std::vector<double> binary_values_;              //!< Value buffer for a row of the binary file
+  std::string csv_line_;                           //!< Text buffer for a line of the CSV file
+  std::string async_csv_line_;                     //!< Text buffer for a line of the CSV file in the writer thread
+  LogRecordQueue *async_queue_;                    //!< Queue for the asynchronous writer thread (nullptr: synchronous writing)
+  std::thread async_writer_thread_;                //!< Asynchronous writer thread
+  bool is_enabled_;                                //!< Enable flag for logging
+  bool is_file_opened_;                            //!< Is the CSV file opened?
+  static std::atomic<bool> is_directory_created_;  //!< Is the log output directory is created in the scenario
+  std::vector<ILoggable *> log_list_;              //!< Log list
 
   bool is_ini_save_enabled_;    //!< Enable flag to save ini files
   std::string directory_path_;  //!< Path to the directory for log files
 
+  /**
+   * @struct BinaryLogColumns
+   * @brief Columns of a loggable in the binary file
+   */
+  struct BinaryLogColumns {
+    size_t number_of_columns;      //!< Number of columns in the header
+    bool is_mismatch_reported;     //!< Is the mismatch of the number of values reported?
+    bool is_non_numeric_reported;  //!< Is the non-numeric value reported?
+  };
+  std::vector<BinaryLogColumns> binary_columns_;  //!< Columns of each loggable in the log list
+
   /**
    * @fn Write
    * @brief Write string to the log
    * @param [in] log: Write target
    * @param [in] flag: Enable flag to write
    */
-  void Write(const std::string log, const bool flag = true);
+  void Write(const std::string &log, const bool flag = true);
 
   /**
    * @fn WriteNewline
@@ -110,6 +171,57 @@ class Logger {
    */
   void WriteNewLine();
 
+  /**
+   * @fn WriteBinaryHeaders
+   * @brief Register the columns of all loggables in the log list to the binary file
+   */
+  void WriteBinaryHeaders();
+  /**
+   * @fn WriteBinaryValues
+   * @brief Write all values in the log list to the binary file
+   */
+  void WriteBinaryValues();
+  /**
+   * @fn CollectBinaryValues
+   * @brief Collect all values in the log list for the binary file
+   * @note The values of a loggable are padded with NaN or truncated to the columns of its header, and the mismatch is reported once,
+   *       so that the columns of the following loggables are kept.
+   * @param [out] values: Collected values
+   */
+  void CollectBinaryValues(std::vector<double> &values);
+
+  /**
+   * @fn WriteAsyncValues
+   * @brief Store all values in the log list into the queue of the writer thread
+   * @param add_newline: Add newline or not
+   */
+  void WriteAsyncValues(const bool add_newline);
+  /**
+   * @fn RunAsyncWriter
+   * @brief Main loop of the writer thread
+   */
+  void RunAsyncWriter();
+  /**
+   * @fn FormatAsyncRecord
+   * @brief Format a log record into a line of the CSV file
+   * @param [in] record: Log record
+   * @param [out] line: Formatted line
+   */
+  void FormatAsyncRecord(const LogRecord &record, std::string &line);
+  /**
+   * @fn StopAsyncWriting
+   * @brief Write all queued values and stop the writer thread
+   */
+  void StopAsyncWriting();
+
+  /**
+   * @fn SplitLogString
+   * @brief Split a comma separated log string
+   * @param [in] log: Comma separated log string
+   * @return Split elements
+   */
+  std::vector<std::string> SplitLogString(const std::string &log);
+
   /**
    * @fn CreateDirectory
    * @brief Create a directory to store the log files
@@ -0,0 +1,74 @@
+/**
+ * @file test_log_utility.cpp
+ * @brief Test codes for log utility functions with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+#include "log_utility.hpp"
+
+/**
+ * @brief Test for AppendScalar with double value
+ */
+TEST(LogUtility, AppendScalarDouble) {
+  const double values[] = {0.0, -0.0, 1.0, -1.5, 0.1, 1.0 / 3.0, 123456789.123, 1.0e-300, -6.02214076e23, 7.0e6, 1234567.0, 0.0001, 0.00001};
+  const int precisions[] = {1, 3, 6, 10, 16, 17};
+
+  for (const double value : values) {
+    for (const int precision : precisions) {
+      std::string buffer;
+      AppendScalar(buffer, value, precision);
+      EXPECT_EQ(WriteScalar(value, precision), buffer);
+    }
+  }
+}
+
+/**
+ * @brief Test for AppendScalar with special values
+ */
+TEST(LogUtility, AppendScalarSpecialValues) {
+  std::string buffer;
+  AppendScalar(buffer, std::numeric_limits<double>::infinity());
+  AppendScalar(buffer, -std::numeric_limits<double>::infinity());
+  AppendScalar(buffer, std::nan(""));
+
+  EXPECT_EQ("inf,-inf,nan,", buffer);
+}
+
+/**
+ * @brief Test for AppendScalar with integer, bool and float values
+ */
+TEST(LogUtility, AppendScalarOtherTypes) {
+  std::string buffer;
+  AppendScalar(buffer, 42);
+  AppendScalar(buffer, (size_t)1234567890);
+  AppendScalar(buffer, true);
+  AppendScalar(buffer, false);
+  AppendScalar(buffer, 0.1f);
+
+  EXPECT_EQ(WriteScalar(42) + WriteScalar((size_t)1234567890) + WriteScalar(true) + WriteScalar(false) + WriteScalar(0.1f), buffer);
+}
+
+/**
+ * @brief Test for AppendVector, AppendMatrix and AppendQuaternion
+ */
+TEST(LogUtility, AppendVectorMatrixQuaternion) {
+  libra::Vector<3> vector;
+  libra::Matrix<2, 3> matrix;
+  for (size_t i = 0; i < 3; i++) {
+    vector[i] = 1.0 / (i + 3.0);
+    for (size_t j = 0; j < 2; j++) {
+      matrix[j][i] = -1.0e5 / (i + j + 7.0);
+    }
+  }
+  libra::Quaternion quaternion(0.1, -0.2, 0.3, 0.9);
+
+  std::string buffer = "head,";
+  AppendVector(buffer, vector, 16);
+  AppendMatrix(buffer, matrix);
+  AppendQuaternion(buffer, quaternion, 10);
+
+  EXPECT_EQ("head," + WriteVector(vector, 16) + WriteMatrix(matrix) + WriteQuaternion(quaternion, 10), buffer);
+}
@@ -0,0 +1,22 @@
+/**
+ * @file ordinary_differential_equation.cpp
+ * @brief Class for Ordinary Differential Equation
+ */
+
+#include "ordinary_differential_equation.hpp"
+
+namespace libra {
+
+NumericalIntegrationMethod SetNumericalIntegrationMethod(const std::string method) {
+  if (method == "RK4") {
+    return NumericalIntegrationMethod::kRk4;
+  } else if (method == "DP5") {
+    return NumericalIntegrationMethod::kDormandPrince5;
+  } else if (method == "RKF78") {
+    return NumericalIntegrationMethod::kRungeKuttaFehlberg78;
+  } else {
+    return NumericalIntegrationMethod::kRk4;
+  }
+}
+
+}  // namespace libra
@@ -6,10 +6,30 @@
 #ifndef S2E_LIBRARY_MATH_ORDINARY_DIFFERENTIA_EQUATION_HPP_
 #define S2E_LIBRARY_MATH_ORDINARY_DIFFERENTIA_EQUATION_HPP_
 
+#include <string>
+
 #include "./vector.hpp"
 
 namespace libra {
 
+/**
+ * @enum NumericalIntegrationMethod
+ * @brief Numerical integration method of the ordinary differential equation
+ */
+enum class NumericalIntegrationMethod {
+  kRk4 = 0,               //!< Classical 4th order Runge-Kutta method with fixed step width
+  kDormandPrince5,        //!< Dormand-Prince 5(4) method with step width control and dense output
+  kRungeKuttaFehlberg78,  //!< Runge-Kutta-Fehlberg 7(8) method with step width control
+};
+
+/**
+ * @fn SetNumericalIntegrationMethod
+ * @brief Convert string to NumericalIntegrationMethod
+ * @param [in] method: Method name (RK4, DP5, or RKF78)
+ * @return Numerical integration method. RK4 is returned for unknown names.
+ */
+NumericalIntegrationMethod SetNumericalIntegrationMethod(const std::string method);
+
 /**
  * @class OrdinaryDifferentialEquation
  * @brief Class for Ordinary Differential Equation
@@ -47,9 +67,27 @@ class OrdinaryDifferentialEquation {
   /**
    * @fn Update
    * @brief Update the state
+   * @note The embedded methods update the latest state with one accepted step and set the next step width by the error control
    */
   void Update();
 
+  /**
+   * @fn Integrate
+   * @brief Integrate the state until the independent variable reaches the end value
+   * @note RK4 uses the fixed step width and adjusts the last step. The embedded methods control the step width by the error estimation.
+   *       Dormand-Prince 5(4) continues the integration from the last accepted step, which can be ahead of the latest state, and returns the
+   *       state at the end value with the dense output. The steps after RestartIntegration land on the end value without the dense output.
+   * @param [in] end_independent_variable: End value of the independent variable. It must not be smaller than the latest value.
+   */
+  void Integrate(const double end_independent_variable);
+  /**
+   * @fn RestartIntegration
+   * @brief Restart the integration of the embedded methods from the latest state at the next call of Integrate
+   * @note Call this function when the inputs of the derivative function are changed, since the steps integrated ahead of the latest state
+   *       were calculated with the old inputs.
+   */
+  inline void RestartIntegration() { is_restart_required_ = true; }
+
   /**
    * @fn Setup
    * @brief Initialize the state vector
@@ -64,6 +102,15 @@ class OrdinaryDifferentialEquation {
    * @param [in] step_width_s: Step width
    */
   inline void SetStepWidth(const double step_width_s) { step_width_s_ = step_width_s; }
+  /**
+   * @fn SetIntegrationMethod
+   * @brief Set the numerical integration method
+   * @param [in] method: Numerical integration method
+   * @param [in] relative_tolerance: Relative error tolerance for the embedded methods
+   * @param [in] absolute_tolerance: Absolute error tolerance for the embedded methods
+   */
+  void SetIntegrationMethod(const NumericalIntegrationMethod method, const double relative_tolerance = 1.0e-10,
+                            const double absolute_tolerance = 1.0e-6);
 
   // Getter
   /**
@@ -71,6 +118,11 @@ class OrdinaryDifferentialEquation {
    * @brief Return step width
    */
   inline double GetStepWidth() const { return step_width_s_; }
+  /**
+   * @fn GetIntegrationMethod
+   * @brief Return numerical integration method
+   */
+  inline NumericalIntegrationMethod GetIntegrationMethod() const { return integration_method_; }
 
   /**
    * @fn GetIndependentVariable
@@ -107,8 +159,54 @@ class OrdinaryDifferentialEquation {
  private:
   double independent_variable_;  //!< Latest value of independent variable
   Vector<N> state_;              //!< Latest state vector
-  Vector<N> derivative_;         //!< Latest differentiate of the state vector
-  double step_width_s_;          //!< Step width
+  Vector<N> derivative_;         //!< Differentiate of the state vector at the end of the last accepted step
+  double step_width_s_;          //!< Step width (Next trial step width for the embedded methods)
+
+  // Embedded methods
+  NumericalIntegrationMethod integration_method_ = NumericalIntegrationMethod::kRk4;  //!< Numerical integration method
+  double relative_tolerance_ = 1.0e-10;                                                //!< Relative error tolerance
+  double absolute_tolerance_ = 1.0e-6;                                                 //!< Absolute error tolerance
+  static const size_t kMaxNumberOfStages = 13;                                         //!< Maximum number of stages of the embedded methods
+  Vector<N> stages_[kMaxNumberOfStages];                                               //!< Derivatives at the stages of the last trial step
+  Vector<N> next_state_;                                                               //!< State at the end of the last trial step
+  double integration_independent_variable_ = 0.0;                                      //!< Independent variable at the end of the last accepted step
+  Vector<N> integration_state_;                                                        //!< State at the end of the last accepted step
+  double step_start_independent_variable_ = 0.0;                                       //!< Independent variable where the last accepted step starts
+  Vector<N> step_start_state_;                                                         //!< State where the last accepted step starts
+  double accepted_step_width_ = 0.0;                                                   //!< Width of the last accepted step
+  bool is_restart_required_ = true;                                                    //!< Flag to restart the integration from the latest state
+
+  /**
+   * @fn UpdateRk4
+   * @brief Update the state with the classical 4th order Runge-Kutta method
+   */
+  void UpdateRk4();
+  /**
+   * @fn RestartEmbedded
+   * @brief Restart the integration of the embedded method from the latest state
+   */
+  void RestartEmbedded();
+  /**
+   * @fn UpdateEmbedded
+   * @brief Update the state at the end of the last accepted step with one accepted step of the embedded method
+   * @param [in] end_independent_variable: Limit of the independent variable. The step is shortened to land on the limit.
+   */
+  void UpdateEmbedded(const double end_independent_variable);
+  /**
+   * @fn CalcEmbeddedStep
+   * @brief Calculate a trial step of the embedded method
+   * @note The derivative_ must be the derivative at the end of the last accepted step.
+   * @param [in] step_width: Trial step width
+   * @return Normalized error of the step. The step is accepted when the error is smaller than 1.
+   */
+  double CalcEmbeddedStep(const double step_width);
+  /**
+   * @fn CalcDenseOutput
+   * @brief Calculate the state inside the last accepted step with the dense output of Dormand-Prince 5(4)
+   * @param [in] theta: Normalized position inside the step (0 to 1)
+   * @return Interpolated state
+   */
+  Vector<N> CalcDenseOutput(const double theta) const;
 };
 
 }  // namespace libra
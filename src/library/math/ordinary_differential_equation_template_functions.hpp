@@ -5,6 +5,10 @@
 #ifndef S2E_LIBRARY_MATH_ORDINARY_DIFFERENTIA_EQUATION_TEMPLATE_FUNCTIONS_HPP_
 #define S2E_LIBRARY_MATH_ORDINARY_DIFFERENTIA_EQUATION_TEMPLATE_FUNCTIONS_HPP_
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace libra {
 
 template <size_t N>
@@ -15,6 +19,7 @@ template <size_t N>
 void OrdinaryDifferentialEquation<N>::Setup(double initial_independent_variable, const Vector<N>& initial_state) {
   independent_variable_ = initial_independent_variable;
   state_ = initial_state;
+  is_restart_required_ = true;
 }
 
 template <size_t N>
@@ -23,8 +28,70 @@ OrdinaryDifferentialEquation<N>& OrdinaryDifferentialEquation<N>::operator++() {
   return *this;
 }
 
+template <size_t N>
+void OrdinaryDifferentialEquation<N>::SetIntegrationMethod(const NumericalIntegrationMethod method, const double relative_tolerance,
+                                                           const double absolute_tolerance) {
+  integration_method_ = method;
+  relative_tolerance_ = relative_tolerance;
+  absolute_tolerance_ = absolute_tolerance;
+  is_restart_required_ = true;
+}
+
 template <size_t N>
 void OrdinaryDifferentialEquation<N>::Update() {
+  if (integration_method_ == NumericalIntegrationMethod::kRk4) {
+    UpdateRk4();
+    return;
+  }
+  // One step from the latest state
+  RestartEmbedded();
+  UpdateEmbedded(std::numeric_limits<double>::infinity());
+  independent_variable_ = integration_independent_variable_;
+  state_ = integration_state_;
+}
+
+template <size_t N>
+void OrdinaryDifferentialEquation<N>::Integrate(const double end_independent_variable) {
+  if (integration_method_ == NumericalIntegrationMethod::kRk4) {
+    const double step_width_s = step_width_s_;
+    while (end_independent_variable - independent_variable_ - step_width_s_ > 1.0e-6) {
+      UpdateRk4();
+    }
+    step_width_s_ = end_independent_variable - independent_variable_;  // Adjust the last step width
+    UpdateRk4();
+    step_width_s_ = step_width_s;
+    independent_variable_ = end_independent_variable;
+    return;
+  }
+
+  // The steps after the restart land on the end value since the inputs of the derivative function are often changed again at the next call.
+  // Otherwise Dormand-Prince 5(4) continues the full steps from the last accepted step and interpolates the state at the end value.
+  const bool has_dense_output = (integration_method_ == NumericalIntegrationMethod::kDormandPrince5);
+  const bool is_landing = is_restart_required_ || !has_dense_output;
+  if (is_restart_required_) RestartEmbedded();
+  if (end_independent_variable <= independent_variable_) return;
+
+  while (integration_independent_variable_ < end_independent_variable) {
+    UpdateEmbedded(is_landing ? end_independent_variable : std::numeric_limits<double>::infinity());
+  }
+  if (integration_independent_variable_ == end_independent_variable) {
+    state_ = integration_state_;
+  } else {
+    state_ = CalcDenseOutput((end_independent_variable - step_start_independent_variable_) / accepted_step_width_);
+  }
+  independent_variable_ = end_independent_variable;
+}
+
+template <size_t N>
+void OrdinaryDifferentialEquation<N>::RestartEmbedded() {
+  integration_independent_variable_ = independent_variable_;
+  integration_state_ = state_;
+  DerivativeFunction(integration_independent_variable_, integration_state_, derivative_);
+  is_restart_required_ = false;
+}
+
+template <size_t N>
+void OrdinaryDifferentialEquation<N>::UpdateRk4() {
   DerivativeFunction(independent_variable_, state_, derivative_);  // Current derivative calculation
 
   // 4th order Runge-Kutta method
@@ -44,6 +111,147 @@ void OrdinaryDifferentialEquation<N>::Update() {
   independent_variable_ += step_width_s_;               // Update independent variable
 }
 
+template <size_t N>
+void OrdinaryDifferentialEquation<N>::UpdateEmbedded(const double end_independent_variable) {
+  // Order of the error estimation for the step width control
+  const double error_order = (integration_method_ == NumericalIntegrationMethod::kDormandPrince5) ? 4.0 : 7.0;
+  const double kSafetyFactor = 0.9;
+  const double kMinScale = 0.2;
+  const double kMaxScale = 5.0;
+  const double kMinStepWidth = 1.0e-12 * std::max(1.0, std::fabs(integration_independent_variable_));
+
+  while (true) {
+    double step_width = step_width_s_;
+    // Land on the end value by shortening the last step
+    bool is_shortened = false;
+    if (integration_independent_variable_ + step_width >= end_independent_variable) {
+      step_width = end_independent_variable - integration_independent_variable_;
+      is_shortened = true;
+    }
+
+    const double error = CalcEmbeddedStep(step_width);
+    double scale = kMaxScale;
+    if (error > 0.0) scale = std::min(kMaxScale, std::max(kMinScale, kSafetyFactor * std::pow(error, -1.0 / (error_order + 1.0))));
+
+    if (error > 1.0 && step_width > kMinStepWidth) {
+      // Reject and retry with smaller step
+      step_width_s_ = step_width * scale;
+      continue;
+    }
+
+    // Accept
+    if (!is_shortened) step_width_s_ = step_width * scale;  // Shortened last step does not change the next step
+    step_start_independent_variable_ = integration_independent_variable_;
+    step_start_state_ = integration_state_;
+    accepted_step_width_ = step_width;
+    integration_state_ = next_state_;
+    integration_independent_variable_ = is_shortened ? end_independent_variable : integration_independent_variable_ + step_width;
+    if (integration_method_ == NumericalIntegrationMethod::kDormandPrince5) {
+      derivative_ = stages_[6];  // First Same As Last
+    } else {
+      DerivativeFunction(integration_independent_variable_, integration_state_, derivative_);
+    }
+    return;
+  }
+}
+
+template <size_t N>
+double OrdinaryDifferentialEquation<N>::CalcEmbeddedStep(const double step_width) {
+  // Dormand-Prince 5(4)
+  static const double kDp5Nodes[7] = {0.0, 1.0 / 5.0, 3.0 / 10.0, 4.0 / 5.0, 8.0 / 9.0, 1.0, 1.0};
+  static const double kDp5Coefficients[7][6] = {
+      {0.0},
+      {1.0 / 5.0},
+      {3.0 / 40.0, 9.0 / 40.0},
+      {44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0},
+      {19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0},
+      {9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0},
+      {35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0}};
+  static const double kDp5Weights[7] = {35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0, 0.0};
+  // Difference between the 5th and 4th order weights
+  static const double kDp5ErrorWeights[7] = {71.0 / 57600.0, 0.0, -71.0 / 16695.0, 71.0 / 1920.0, -17253.0 / 339200.0, 22.0 / 525.0, -1.0 / 40.0};
+
+  // Runge-Kutta-Fehlberg 7(8)
+  static const double kRkf78Nodes[13] = {0.0, 2.0 / 27.0, 1.0 / 9.0, 1.0 / 6.0, 5.0 / 12.0, 1.0 / 2.0, 5.0 / 6.0, 1.0 / 6.0, 2.0 / 3.0,
+                                         1.0 / 3.0, 1.0, 0.0, 1.0};
+  static const double kRkf78Coefficients[13][12] = {
+      {0.0},
+      {2.0 / 27.0},
+      {1.0 / 36.0, 1.0 / 12.0},
+      {1.0 / 24.0, 0.0, 1.0 / 8.0},
+      {5.0 / 12.0, 0.0, -25.0 / 16.0, 25.0 / 16.0},
+      {1.0 / 20.0, 0.0, 0.0, 1.0 / 4.0, 1.0 / 5.0},
+      {-25.0 / 108.0, 0.0, 0.0, 125.0 / 108.0, -65.0 / 27.0, 125.0 / 54.0},
+      {31.0 / 300.0, 0.0, 0.0, 0.0, 61.0 / 225.0, -2.0 / 9.0, 13.0 / 900.0},
+      {2.0, 0.0, 0.0, -53.0 / 6.0, 704.0 / 45.0, -107.0 / 9.0, 67.0 / 90.0, 3.0},
+      {-91.0 / 108.0, 0.0, 0.0, 23.0 / 108.0, -976.0 / 135.0, 311.0 / 54.0, -19.0 / 60.0, 17.0 / 6.0, -1.0 / 12.0},
+      {2383.0 / 4100.0, 0.0, 0.0, -341.0 / 164.0, 4496.0 / 1025.0, -301.0 / 82.0, 2133.0 / 4100.0, 45.0 / 82.0, 45.0 / 164.0, 18.0 / 41.0},
+      {3.0 / 205.0, 0.0, 0.0, 0.0, 0.0, -6.0 / 41.0, -3.0 / 205.0, -3.0 / 41.0, 3.0 / 41.0, 6.0 / 41.0, 0.0},
+      {-1777.0 / 4100.0, 0.0, 0.0, -341.0 / 164.0, 4496.0 / 1025.0, -289.0 / 82.0, 2193.0 / 4100.0, 51.0 / 82.0, 33.0 / 164.0, 12.0 / 41.0, 0.0,
+       1.0}};
+  // The 8th order solution is used for the propagation
+  static const double kRkf78Weights[13] = {0.0, 0.0, 0.0, 0.0, 0.0, 34.0 / 105.0, 9.0 / 35.0, 9.0 / 35.0, 9.0 / 280.0,
+                                           9.0 / 280.0, 0.0, 41.0 / 840.0, 41.0 / 840.0};
+  static const double kRkf78ErrorWeights[13] = {41.0 / 840.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 41.0 / 840.0, -41.0 / 840.0,
+                                                -41.0 / 840.0};
+
+  const bool is_dp5 = (integration_method_ == NumericalIntegrationMethod::kDormandPrince5);
+  const size_t number_of_stages = is_dp5 ? 7 : 13;
+  const double* nodes = is_dp5 ? kDp5Nodes : kRkf78Nodes;
+  const double* weights = is_dp5 ? kDp5Weights : kRkf78Weights;
+  const double* error_weights = is_dp5 ? kDp5ErrorWeights : kRkf78ErrorWeights;
+
+  // Stages
+  stages_[0] = derivative_;
+  for (size_t stage = 1; stage < number_of_stages; stage++) {
+    Vector<N> stage_state = integration_state_;
+    for (size_t i = 0; i < stage; i++) {
+      const double coefficient = is_dp5 ? kDp5Coefficients[stage][i] : kRkf78Coefficients[stage][i];
+      if (coefficient == 0.0) continue;
+      stage_state += (step_width * coefficient) * stages_[i];
+    }
+    DerivativeFunction(integration_independent_variable_ + nodes[stage] * step_width, stage_state, stages_[stage]);
+  }
+
+  // Solution and error
+  next_state_ = integration_state_;
+  Vector<N> error_estimation(0.0);
+  for (size_t stage = 0; stage < number_of_stages; stage++) {
+    if (weights[stage] != 0.0) next_state_ += (step_width * weights[stage]) * stages_[stage];
+    if (error_weights[stage] != 0.0) error_estimation += (step_width * error_weights[stage]) * stages_[stage];
+  }
+
+  // Root mean square of the error normalized by the tolerance
+  double error_square_sum = 0.0;
+  for (size_t i = 0; i < N; i++) {
+    const double scale = absolute_tolerance_ + relative_tolerance_ * std::max(std::fabs(integration_state_[i]), std::fabs(next_state_[i]));
+    const double normalized_error = error_estimation[i] / scale;
+    error_square_sum += normalized_error * normalized_error;
+  }
+  return std::sqrt(error_square_sum / (double)N);
+}
+
+template <size_t N>
+Vector<N> OrdinaryDifferentialEquation<N>::CalcDenseOutput(const double theta) const {
+  // Continuous extension of Dormand-Prince 5(4) by Hairer et al.
+  static const double kDenseCoefficients[7] = {-12715105075.0 / 11282082432.0,  0.0,
+                                               87487479700.0 / 32700410799.0,   -10690763975.0 / 1880347072.0,
+                                               701980252875.0 / 199316789632.0, -1453857185.0 / 822651844.0,
+                                               69997945.0 / 29380423.0};
+  const double step_width = accepted_step_width_;
+  const double theta1 = 1.0 - theta;
+
+  Vector<N> difference = integration_state_ - step_start_state_;
+  Vector<N> spline = step_width * stages_[0] - difference;
+  Vector<N> spline2 = difference - step_width * stages_[6] - spline;
+  Vector<N> correction(0.0);
+  for (size_t stage = 0; stage < 7; stage++) {
+    if (kDenseCoefficients[stage] != 0.0) correction += (step_width * kDenseCoefficients[stage]) * stages_[stage];
+  }
+
+  return step_start_state_ + theta * (difference + theta1 * (spline + theta * (spline2 + theta1 * correction)));
+}
+
 }  // namespace libra
 
 #endif  // S2E_LIBRARY_MATH_ORDINARY_DIFFERENTIA_EQUATION_TEMPLATE_FUNCTIONS_HPP_
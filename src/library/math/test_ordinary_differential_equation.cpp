@@ -0,0 +1,189 @@
+/**
+ * @file test_ordinary_differential_equation.cpp
+ * @brief Test codes for OrdinaryDifferentialEquation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "ordinary_differential_equation.hpp"
+
+/**
+ * @class TwoBodyOde
+ * @brief Two body problem with unit gravity constant for test
+ */
+class TwoBodyOde : public libra::OrdinaryDifferentialEquation<4> {
+ public:
+  TwoBodyOde(const double step_width) : libra::OrdinaryDifferentialEquation<4>(step_width) {}
+
+  void DerivativeFunction(double t, const libra::Vector<4>& state, libra::Vector<4>& rhs) {
+    (void)t;
+    const double r = sqrt(state[0] * state[0] + state[1] * state[1]);
+    const double r3 = r * r * r;
+    rhs[0] = state[2];
+    rhs[1] = state[3];
+    rhs[2] = -state[0] / r3;
+    rhs[3] = -state[1] / r3;
+    number_of_evaluations_++;
+  }
+
+  size_t number_of_evaluations_ = 0;
+};
+
+/**
+ * @brief Make initial state of circular orbit
+ */
+libra::Vector<4> MakeCircularOrbitState() {
+  libra::Vector<4> state(0.0);
+  state[0] = 1.0;
+  state[3] = 1.0;
+  return state;
+}
+
+/**
+ * @brief Test for string conversion of the method
+ */
+TEST(OrdinaryDifferentialEquation, SetNumericalIntegrationMethod) {
+  EXPECT_EQ(libra::NumericalIntegrationMethod::kRk4, libra::SetNumericalIntegrationMethod("RK4"));
+  EXPECT_EQ(libra::NumericalIntegrationMethod::kDormandPrince5, libra::SetNumericalIntegrationMethod("DP5"));
+  EXPECT_EQ(libra::NumericalIntegrationMethod::kRungeKuttaFehlberg78, libra::SetNumericalIntegrationMethod("RKF78"));
+  EXPECT_EQ(libra::NumericalIntegrationMethod::kRk4, libra::SetNumericalIntegrationMethod("NULL"));
+}
+
+/**
+ * @brief Test for the fixed step RK4 integration lands on the end value
+ */
+TEST(OrdinaryDifferentialEquation, IntegrateRk4) {
+  const double period = 2.0 * M_PI;
+
+  TwoBodyOde ode(0.01);
+  ode.Setup(0.0, MakeCircularOrbitState());
+  ode.Integrate(period);
+
+  EXPECT_DOUBLE_EQ(period, ode.GetIndependentVariable());
+  EXPECT_DOUBLE_EQ(0.01, ode.GetStepWidth());
+  EXPECT_NEAR(1.0, ode[0], 1.0e-8);
+  EXPECT_NEAR(0.0, ode[1], 1.0e-8);
+}
+
+/**
+ * @brief Test for the embedded methods with the one orbit period
+ */
+TEST(OrdinaryDifferentialEquation, IntegrateEmbedded) {
+  const double period = 2.0 * M_PI;
+  const double tolerance = 1.0e-12;
+  const libra::NumericalIntegrationMethod methods[2] = {libra::NumericalIntegrationMethod::kDormandPrince5,
+                                                        libra::NumericalIntegrationMethod::kRungeKuttaFehlberg78};
+
+  for (const auto method : methods) {
+    TwoBodyOde ode(0.01);
+    ode.SetIntegrationMethod(method, tolerance, tolerance);
+    ode.Setup(0.0, MakeCircularOrbitState());
+    ode.Integrate(period);
+
+    EXPECT_DOUBLE_EQ(period, ode.GetIndependentVariable());
+    EXPECT_NEAR(1.0, ode[0], 1.0e-9);
+    EXPECT_NEAR(0.0, ode[1], 1.0e-9);
+    EXPECT_NEAR(0.0, ode[2], 1.0e-9);
+    EXPECT_NEAR(1.0, ode[3], 1.0e-9);
+
+    // The step width is enlarged from the initial value
+    EXPECT_LT(0.01, ode.GetStepWidth());
+  }
+}
+
+/**
+ * @brief Test for the dense output at the many end values inside a step
+ */
+TEST(OrdinaryDifferentialEquation, DenseOutput) {
+  const double output_interval = 0.01;
+  const size_t number_of_outputs = 628;
+
+  TwoBodyOde ode(0.01);
+  ode.SetIntegrationMethod(libra::NumericalIntegrationMethod::kDormandPrince5, 1.0e-12, 1.0e-12);
+  ode.Setup(0.0, MakeCircularOrbitState());
+  for (size_t i = 1; i <= number_of_outputs; i++) {
+    const double t = output_interval * i;
+    ode.Integrate(t);
+    EXPECT_DOUBLE_EQ(t, ode.GetIndependentVariable());
+    // The interpolation error is not accumulated since the integration continues from the last accepted step
+    EXPECT_NEAR(cos(t), ode[0], 1.0e-10);
+    EXPECT_NEAR(sin(t), ode[1], 1.0e-10);
+  }
+}
+
+/**
+ * @brief Test for the number of evaluations and the accuracy of the integration called at each update
+ */
+TEST(OrdinaryDifferentialEquation, IntegratePerUpdate) {
+  const double period = 2.0 * M_PI;
+  const double tolerance = 1.0e-10;
+
+  TwoBodyOde single(0.01);
+  single.SetIntegrationMethod(libra::NumericalIntegrationMethod::kDormandPrince5, tolerance, tolerance);
+  single.Setup(0.0, MakeCircularOrbitState());
+  single.Integrate(period);
+  const double single_error = std::max(fabs(cos(period) - single[0]), fabs(sin(period) - single[1]));
+
+  const double update_intervals[3] = {0.001, 0.01, 0.1};
+  for (const double update_interval : update_intervals) {
+    TwoBodyOde ode(0.01);
+    ode.SetIntegrationMethod(libra::NumericalIntegrationMethod::kDormandPrince5, tolerance, tolerance);
+    ode.Setup(0.0, MakeCircularOrbitState());
+    const size_t number_of_updates = (size_t)ceil(period / update_interval);
+    double max_error = 0.0;
+    for (size_t i = 1; i <= number_of_updates; i++) {
+      const double t = std::min(period, update_interval * i);
+      ode.Integrate(t);
+      max_error = std::max(max_error, std::max(fabs(cos(t) - ode[0]), fabs(sin(t) - ode[1])));
+    }
+    EXPECT_DOUBLE_EQ(period, ode.GetIndependentVariable());
+
+    // The number of evaluations and the error do not depend on the number of the calls
+    EXPECT_GE(single.number_of_evaluations_ + 14, ode.number_of_evaluations_) << "update interval " << update_interval;
+    EXPECT_GT(2.0 * single_error, max_error) << "update interval " << update_interval;
+  }
+}
+
+/**
+ * @brief Test for the restart of the integration at each update, which lands on the end values
+ */
+TEST(OrdinaryDifferentialEquation, RestartIntegration) {
+  const double update_interval = 0.01;
+  const size_t number_of_updates = 628;
+
+  TwoBodyOde ode(0.1);
+  ode.SetIntegrationMethod(libra::NumericalIntegrationMethod::kDormandPrince5, 1.0e-10, 1.0e-10);
+  ode.Setup(0.0, MakeCircularOrbitState());
+  for (size_t i = 1; i <= number_of_updates; i++) {
+    const double t = update_interval * i;
+    ode.RestartIntegration();
+    ode.Integrate(t);
+    EXPECT_DOUBLE_EQ(t, ode.GetIndependentVariable());
+    EXPECT_NEAR(cos(t), ode[0], 1.0e-10);
+    EXPECT_NEAR(sin(t), ode[1], 1.0e-10);
+  }
+  // The derivative at the restart and the 6 stages of the step landing on the end value
+  EXPECT_EQ(7 * number_of_updates, ode.number_of_evaluations_);
+}
+
+/**
+ * @brief Test for the number of evaluations with the large tolerance
+ */
+TEST(OrdinaryDifferentialEquation, StepWidthControl) {
+  const double period = 2.0 * M_PI;
+
+  TwoBodyOde rk4(0.001);
+  rk4.Setup(0.0, MakeCircularOrbitState());
+  rk4.Integrate(period);
+
+  TwoBodyOde dp5(0.001);
+  dp5.SetIntegrationMethod(libra::NumericalIntegrationMethod::kDormandPrince5, 1.0e-10, 1.0e-10);
+  dp5.Setup(0.0, MakeCircularOrbitState());
+  dp5.Integrate(period);
+
+  EXPECT_NEAR(rk4[0], dp5[0], 1.0e-8);
+  EXPECT_NEAR(rk4[1], dp5[1], 1.0e-8);
+  EXPECT_GT(rk4.number_of_evaluations_, 10 * dp5.number_of_evaluations_);
+}
@@ -0,0 +1,138 @@
+/**
+ * @file test_uniform_grid_index.cpp
+ * @brief Test codes for UniformGridIndex class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include "uniform_grid_index.hpp"
+
+/**
+ * @brief Find the points within the radius by checking all points
+ */
+std::vector<size_t> FindPointsWithinRadius(const std::vector<libra::Vector<3>>& positions, const libra::Vector<3>& center, const double radius) {
+  std::vector<size_t> indices;
+  for (size_t i = 0; i < positions.size(); i++) {
+    if ((positions[i] - center).CalcNorm() <= radius) indices.push_back(i);
+  }
+  return indices;
+}
+
+/**
+ * @brief Test for empty index
+ */
+TEST(UniformGridIndex, Empty) {
+  libra::UniformGridIndex index(1.0);
+  index.Build(std::vector<libra::Vector<3>>());
+
+  std::vector<size_t> indices;
+  index.QueryRadius(libra::Vector<3>(0.0), 10.0, indices);
+  EXPECT_TRUE(indices.empty());
+  EXPECT_EQ(0, index.GetNumberOfPoints());
+}
+
+/**
+ * @brief Test for points in the same cell and the neighboring cells
+ */
+TEST(UniformGridIndex, NeighboringCells) {
+  std::vector<libra::Vector<3>> positions(4, libra::Vector<3>(0.0));
+  positions[0][0] = 0.1;
+  positions[1][0] = 0.2;
+  positions[2][0] = -0.3;
+  positions[3][0] = 5.0;
+
+  libra::UniformGridIndex index(1.0);
+  index.Build(positions);
+  EXPECT_EQ(4, index.GetNumberOfPoints());
+  EXPECT_EQ(3, index.GetNumberOfOccupiedCells());
+
+  std::vector<size_t> indices;
+  index.QueryRadius(libra::Vector<3>(0.0), 0.5, indices);
+  std::sort(indices.begin(), indices.end());
+  ASSERT_EQ(3, indices.size());
+  EXPECT_EQ(0, indices[0]);
+  EXPECT_EQ(1, indices[1]);
+  EXPECT_EQ(2, indices[2]);
+
+  // The point on the sphere is included
+  indices.clear();
+  index.QueryRadius(positions[3], 0.0, indices);
+  ASSERT_EQ(1, indices.size());
+  EXPECT_EQ(3, indices[0]);
+}
+
+/**
+ * @brief Test to compare with brute force search for random points
+ */
+TEST(UniformGridIndex, RandomPoints) {
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> distribution(-7.0e6, 7.0e6);
+  std::vector<libra::Vector<3>> positions(1000);
+  for (auto& position : positions) {
+    for (size_t i = 0; i < 3; i++) position[i] = distribution(generator);
+  }
+
+  libra::UniformGridIndex index(5.0e5);
+  index.Build(positions);
+
+  const double radii[] = {1.0e5, 1.0e6, 3.0e6, 2.0e7};
+  for (const double radius : radii) {
+    for (size_t n = 0; n < 20; n++) {
+      std::vector<size_t> indices;
+      index.QueryRadius(positions[n], radius, indices);
+      std::sort(indices.begin(), indices.end());
+      EXPECT_EQ(FindPointsWithinRadius(positions, positions[n], radius), indices);
+    }
+  }
+}
+
+/**
+ * @brief Test for points far from the origin, whose cell keys are shared with the other cells
+ */
+TEST(UniformGridIndex, FarPoints) {
+  std::vector<libra::Vector<3>> positions(2, libra::Vector<3>(0.0));
+  positions[1][0] = (double)(1 << 21);
+
+  libra::UniformGridIndex index(1.0);
+  index.Build(positions);
+
+  std::vector<size_t> indices;
+  index.QueryRadius(libra::Vector<3>(0.0), 0.5, indices);
+  ASSERT_EQ(1, indices.size());
+  EXPECT_EQ(0, indices[0]);
+}
+
+/**
+ * @brief Test for the query larger than the occupied cells, such as the visibility from a ground station
+ */
+TEST(UniformGridIndex, LargeQueryOnOccupiedCells) {
+  // Points in the LEO shell above a part of the earth
+  std::mt19937 generator(2);
+  std::uniform_real_distribution<double> angle_distribution(-1.0, 1.0);
+  std::uniform_real_distribution<double> radius_distribution(6.7e6, 8.0e6);
+  std::vector<libra::Vector<3>> positions(200);
+  for (auto& position : positions) {
+    const double latitude_rad = angle_distribution(generator);
+    const double longitude_rad = angle_distribution(generator);
+    const double radius_m = radius_distribution(generator);
+    position[0] = radius_m * cos(latitude_rad) * cos(longitude_rad);
+    position[1] = radius_m * cos(latitude_rad) * sin(longitude_rad);
+    position[2] = radius_m * sin(latitude_rad);
+  }
+
+  libra::UniformGridIndex index(5.0e5);
+  index.Build(positions);
+  ASSERT_LT(index.GetNumberOfOccupiedCells(), 13 * 13 * 13);
+
+  libra::Vector<3> ground_station_m(0.0);
+  ground_station_m[0] = 6.378e6;
+  const double radii_m[] = {1.0e6, 3.0e6, 5.0e6};
+  for (const double radius_m : radii_m) {
+    std::vector<size_t> indices;
+    index.QueryRadius(ground_station_m, radius_m, indices);
+    std::sort(indices.begin(), indices.end());
+    EXPECT_EQ(FindPointsWithinRadius(positions, ground_station_m, radius_m), indices);
+  }
+}
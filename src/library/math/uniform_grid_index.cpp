@@ -0,0 +1,94 @@
+/**
+ * @file uniform_grid_index.cpp
+ * @brief Spatial index with uniform grid for range queries of points
+ */
+
+#include "uniform_grid_index.hpp"
+
+#include <algorithm>
+
+namespace libra {
+
+UniformGridIndex::UniformGridIndex(const double cell_size) : cell_size_(cell_size) {
+  if (cell_size_ <= 0.0) cell_size_ = 1.0;
+}
+
+void UniformGridIndex::Build(const std::vector<Vector<3>>& positions) {
+  positions_ = positions;
+
+  sorted_points_.clear();
+  sorted_points_.reserve(positions_.size());
+  for (size_t i = 0; i < positions_.size(); i++) {
+    const uint64_t key =
+        CalcCellKey(CalcCellCoordinate(positions_[i][0]), CalcCellCoordinate(positions_[i][1]), CalcCellCoordinate(positions_[i][2]));
+    sorted_points_.push_back(std::make_pair(key, i));
+  }
+  std::sort(sorted_points_.begin(), sorted_points_.end());
+
+  occupied_cells_.clear();
+  cell_indices_.clear();
+  size_t begin = 0;
+  for (size_t i = 1; i <= sorted_points_.size(); i++) {
+    if (i == sorted_points_.size() || sorted_points_[i].first != sorted_points_[begin].first) {
+      OccupiedCell cell = {begin, i, positions_[sorted_points_[begin].second], positions_[sorted_points_[begin].second]};
+      for (size_t j = begin + 1; j < i; j++) {
+        const Vector<3>& position = positions_[sorted_points_[j].second];
+        for (size_t axis = 0; axis < 3; axis++) {
+          cell.min_point[axis] = std::min(cell.min_point[axis], position[axis]);
+          cell.max_point[axis] = std::max(cell.max_point[axis], position[axis]);
+        }
+      }
+      cell_indices_[sorted_points_[begin].first] = occupied_cells_.size();
+      occupied_cells_.push_back(cell);
+      begin = i;
+    }
+  }
+}
+
+void UniformGridIndex::QueryRadius(const Vector<3>& center, const double radius, std::vector<size_t>& indices) const {
+  if (radius < 0.0 || positions_.empty()) return;
+  const double radius2 = radius * radius;
+
+  int64_t min_cell[3];
+  int64_t max_cell[3];
+  double number_of_query_cells = 1.0;
+  for (size_t i = 0; i < 3; i++) {
+    min_cell[i] = CalcCellCoordinate(center[i] - radius);
+    max_cell[i] = CalcCellCoordinate(center[i] + radius);
+    number_of_query_cells *= (double)(max_cell[i] - min_cell[i] + 1);
+  }
+
+  // A large query sphere covers more cells than the occupied ones, so only the occupied cells near the sphere are checked
+  if (number_of_query_cells > (double)occupied_cells_.size()) {
+    for (const auto& cell : occupied_cells_) {
+      double distance2 = 0.0;
+      for (size_t i = 0; i < 3; i++) {
+        const double outside = std::max(std::max(cell.min_point[i] - center[i], center[i] - cell.max_point[i]), 0.0);
+        distance2 += outside * outside;
+      }
+      if (distance2 <= radius2) AppendPointsWithinRadius(cell, center, radius2, indices);
+    }
+    return;
+  }
+
+  for (int64_t x = min_cell[0]; x <= max_cell[0]; x++) {
+    for (int64_t y = min_cell[1]; y <= max_cell[1]; y++) {
+      for (int64_t z = min_cell[2]; z <= max_cell[2]; z++) {
+        const auto cell = cell_indices_.find(CalcCellKey(x, y, z));
+        if (cell == cell_indices_.end()) continue;
+        AppendPointsWithinRadius(occupied_cells_[cell->second], center, radius2, indices);
+      }
+    }
+  }
+}
+
+void UniformGridIndex::AppendPointsWithinRadius(const OccupiedCell& cell, const Vector<3>& center, const double radius2,
+                                                std::vector<size_t>& indices) const {
+  for (size_t i = cell.begin; i < cell.end; i++) {
+    const size_t index = sorted_points_[i].second;
+    const Vector<3> difference = positions_[index] - center;
+    if (InnerProduct(difference, difference) <= radius2) indices.push_back(index);
+  }
+}
+
+}  // namespace libra
@@ -0,0 +1,117 @@
+/**
+ * @file uniform_grid_index.hpp
+ * @brief Spatial index with uniform grid for range queries of points
+ */
+
+#ifndef S2E_LIBRARY_MATH_UNIFORM_GRID_INDEX_HPP_
+#define S2E_LIBRARY_MATH_UNIFORM_GRID_INDEX_HPP_
+
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "vector.hpp"
+
+namespace libra {
+
+/**
+ * @class UniformGridIndex
+ * @brief Spatial index with uniform grid for range queries of points
+ * @details The points are sorted by the cell including them, and the range of each occupied cell is stored in a hash table.
+ *          A query larger than the occupied cells walks only the occupied cells whose bounding box overlaps the query sphere.
+ *          The index is rebuilt with the latest positions after the points move.
+ */
+class UniformGridIndex {
+ public:
+  /**
+   * @fn UniformGridIndex
+   * @brief Constructor
+   * @param [in] cell_size: Edge length of the cubic cells. It is better to be similar to the typical query radius.
+   */
+  UniformGridIndex(const double cell_size);
+
+  /**
+   * @fn Build
+   * @brief Build the index for the points
+   * @param [in] positions: Positions of the points. The indices of the vector are used as the IDs in the queries.
+   */
+  void Build(const std::vector<Vector<3>>& positions);
+  /**
+   * @fn QueryRadius
+   * @brief Find the points within the radius from the center
+   * @param [in] center: Center of the query sphere
+   * @param [in] radius: Radius of the query sphere
+   * @param [out] indices: Indices of the found points. The indices are appended without sorting.
+   */
+  void QueryRadius(const Vector<3>& center, const double radius, std::vector<size_t>& indices) const;
+
+  // Getter
+  /**
+   * @fn GetCellSize
+   * @brief Return edge length of the cells
+   */
+  inline double GetCellSize() const { return cell_size_; }
+  /**
+   * @fn GetNumberOfPoints
+   * @brief Return number of the points in the index
+   */
+  inline size_t GetNumberOfPoints() const { return positions_.size(); }
+  /**
+   * @fn GetNumberOfOccupiedCells
+   * @brief Return number of the cells including at least one point
+   */
+  inline size_t GetNumberOfOccupiedCells() const { return occupied_cells_.size(); }
+
+ private:
+  /**
+   * @struct OccupiedCell
+   * @brief Points in an occupied cell
+   */
+  struct OccupiedCell {
+    size_t begin;         //!< Begin of the points in sorted_points_
+    size_t end;           //!< End of the points in sorted_points_
+    Vector<3> min_point;  //!< Minimum coordinates of the points
+    Vector<3> max_point;  //!< Maximum coordinates of the points
+  };
+
+  double cell_size_;                                        //!< Edge length of the cells
+  std::vector<Vector<3>> positions_;                        //!< Positions of the points
+  std::vector<std::pair<uint64_t, size_t>> sorted_points_;  //!< Cell keys and point indices sorted by the keys
+  std::vector<OccupiedCell> occupied_cells_;                //!< Occupied cells
+  std::unordered_map<uint64_t, size_t> cell_indices_;       //!< Index in occupied_cells_ for each cell key
+
+  /**
+   * @fn CalcCellCoordinate
+   * @brief Return cell coordinate along an axis
+   * @param [in] coordinate: Coordinate of a point along the axis
+   */
+  inline int64_t CalcCellCoordinate(const double coordinate) const { return (int64_t)floor(coordinate / cell_size_); }
+  /**
+   * @fn CalcCellKey
+   * @brief Return hash key of a cell
+   * @note The lower 21 bits of each coordinate are packed. Different cells can share a key far from the origin, but the query still checks the
+   *       distance of each point, so it only adds candidates.
+   * @param [in] x: Cell coordinate along the X axis
+   * @param [in] y: Cell coordinate along the Y axis
+   * @param [in] z: Cell coordinate along the Z axis
+   */
+  static inline uint64_t CalcCellKey(const int64_t x, const int64_t y, const int64_t z) {
+    const uint64_t mask = (1ULL << 21) - 1;
+    return ((uint64_t)x & mask) | (((uint64_t)y & mask) << 21) | (((uint64_t)z & mask) << 42);
+  }
+  /**
+   * @fn AppendPointsWithinRadius
+   * @brief Append the points of the cell within the radius from the center
+   * @param [in] cell: Target cell
+   * @param [in] center: Center of the query sphere
+   * @param [in] radius2: Square of the radius of the query sphere
+   * @param [out] indices: Indices of the found points
+   */
+  void AppendPointsWithinRadius(const OccupiedCell& cell, const Vector<3>& center, const double radius2, std::vector<size_t>& indices) const;
+};
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_MATH_UNIFORM_GRID_INDEX_HPP_
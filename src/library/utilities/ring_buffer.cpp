@@ -10,37 +10,83 @@
 #include <algorithm>
 #include <cstring>
 
-RingBuffer::RingBuffer(int buffer_size) : buffer_size_(buffer_size) {
-  buffer_ = new byte[buffer_size];
-  write_pointer_ = 0;
-  read_pointer_ = 0;
+RingBuffer::RingBuffer(int buffer_size) {
+  buffer_size_ = 1;
+  while ((int)buffer_size_ < buffer_size) buffer_size_ <<= 1;
+  index_mask_ = buffer_size_ - 1;
+  buffer_ = new byte[buffer_size_];
 }
 
 RingBuffer::~RingBuffer() { delete[] buffer_; }
 
 int RingBuffer::Write(const byte* buffer, const unsigned int offset, const unsigned int data_length) {
-  unsigned int write_count = 0;
-  while (write_count != data_length) {
-    unsigned int write_len = std::min(buffer_size_ - write_pointer_, data_length - write_count);
-    memcpy(&buffer_[write_pointer_], &buffer[offset + write_count], write_len);
-    write_pointer_ = (write_pointer_ + write_len == buffer_size_) ? 0 : write_pointer_ + write_len;
-    write_count += write_len;
-  }
+  const unsigned int write_length = std::min(data_length, CalcWritableSize(data_length));
+  const RingBufferSpan span = MakeSpan(write_pointer_.load(std::memory_order_relaxed), write_length);
+  memcpy(span.first_data, &buffer[offset], span.first_size);
+  memcpy(span.second_data, &buffer[offset + span.first_size], span.second_size);
+  CommitWrite(write_length);
 
-  return write_count;
+  if (write_length < data_length) {
+    // Only the producer updates the counters
+    overflow_count_.store(overflow_count_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    dropped_bytes_.store(dropped_bytes_.load(std::memory_order_relaxed) + data_length - write_length, std::memory_order_relaxed);
+  }
+  return write_length;
 }
 
 int RingBuffer::Read(byte* buffer, const unsigned int offset, const unsigned int data_length) {
-  unsigned int read_count = 0;
-  // There are four behaviors depending on whether the RP overtakes the WP, or
-  // whether all of the RP to the WP are requested by data_length.
-  while (read_count != data_length && write_pointer_ != read_pointer_) {
-    unsigned int read_len = (write_pointer_ > read_pointer_) ? std::min(write_pointer_ - read_pointer_, data_length - read_count)
-                                                             : std::min(buffer_size_ - read_pointer_, data_length - read_count);
-    memcpy(&buffer[offset + read_count], &buffer_[read_pointer_], read_len);
-    read_pointer_ = (read_pointer_ + read_len == buffer_size_) ? 0 : read_pointer_ + read_len;
-    read_count += read_len;
+  const unsigned int read_length = std::min(data_length, CalcReadableSize(data_length));
+  const RingBufferSpan span = MakeSpan(read_pointer_.load(std::memory_order_relaxed), read_length);
+  memcpy(&buffer[offset], span.first_data, span.first_size);
+  memcpy(&buffer[offset + span.first_size], span.second_data, span.second_size);
+  CommitRead(read_length);
+  return read_length;
+}
+
+RingBufferSpan RingBuffer::PeekWrite() {
+  return MakeSpan(write_pointer_.load(std::memory_order_relaxed), CalcWritableSize(buffer_size_));
+}
+
+void RingBuffer::CommitWrite(const unsigned int data_length) {
+  // Release the written data to the consumer
+  write_pointer_.store(write_pointer_.load(std::memory_order_relaxed) + data_length, std::memory_order_release);
+}
+
+RingBufferSpan RingBuffer::PeekRead() { return MakeSpan(read_pointer_.load(std::memory_order_relaxed), CalcReadableSize(buffer_size_)); }
+
+void RingBuffer::CommitRead(const unsigned int data_length) {
+  // Release the area to the producer
+  read_pointer_.store(read_pointer_.load(std::memory_order_relaxed) + data_length, std::memory_order_release);
+}
+
+unsigned int RingBuffer::GetReadableSize() const {
+  const unsigned int read_pointer = read_pointer_.load(std::memory_order_acquire);
+  const unsigned int write_pointer = write_pointer_.load(std::memory_order_acquire);
+  return std::min(write_pointer - read_pointer, buffer_size_);
+}
+
+unsigned int RingBuffer::CalcWritableSize(const unsigned int required_size) {
+  const unsigned int write_pointer = write_pointer_.load(std::memory_order_relaxed);
+  unsigned int writable_size = buffer_size_ - (write_pointer - cached_read_pointer_);
+  if (writable_size < required_size) {
+    cached_read_pointer_ = read_pointer_.load(std::memory_order_acquire);
+    writable_size = buffer_size_ - (write_pointer - cached_read_pointer_);
   }
+  return writable_size;
+}
+
+unsigned int RingBuffer::CalcReadableSize(const unsigned int required_size) {
+  const unsigned int read_pointer = read_pointer_.load(std::memory_order_relaxed);
+  unsigned int readable_size = cached_write_pointer_ - read_pointer;
+  if (readable_size < required_size) {
+    cached_write_pointer_ = write_pointer_.load(std::memory_order_acquire);
+    readable_size = cached_write_pointer_ - read_pointer;
+  }
+  return readable_size;
+}
 
-  return read_count;
+RingBufferSpan RingBuffer::MakeSpan(const unsigned int pointer, const unsigned int size) const {
+  const unsigned int index = pointer & index_mask_;
+  const unsigned int first_size = std::min(size, buffer_size_ - index);
+  return {&buffer_[index], first_size, buffer_, size - first_size};
 }
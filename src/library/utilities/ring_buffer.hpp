@@ -6,18 +6,41 @@
 #ifndef S2E_LIBRARY_UTILITIES_RING_BUFFER_HPP_
 #define S2E_LIBRARY_UTILITIES_RING_BUFFER_HPP_
 
+#include <atomic>
+
 typedef unsigned char byte;
 
+/**
+ * @struct RingBufferSpan
+ * @brief Continuous area in the ring buffer
+ * @details The area is divided into the first and second parts when it wraps around the end of the buffer.
+ */
+struct RingBufferSpan {
+  byte* first_data;          //!< Head of the first part
+  unsigned int first_size;   //!< Size of the first part
+  byte* second_data;         //!< Head of the second part (the head of the buffer)
+  unsigned int second_size;  //!< Size of the second part
+
+  /**
+   * @fn GetSize
+   * @brief Return total size of the area
+   */
+  inline unsigned int GetSize() const { return first_size + second_size; }
+};
+
 /**
  * @class RingBuffer
  * @brief Class to emulate ring buffer
+ * @details Lock-free ring buffer for a single producer thread and a single consumer thread.
+ *          Write, PeekWrite, and CommitWrite are called by the producer, and Read, PeekRead, and CommitRead are called by the consumer.
+ *          The data which cannot be stored is dropped and counted as the overflow.
  */
 class RingBuffer {
  public:
   /**
    * @fn RingBuffer
    * @brief Constructor
-   * @param [in] buffer_size: Buffer size
+   * @param [in] buffer_size: Buffer size. It is rounded up to the power of two.
    */
   RingBuffer(int buffer_size);
   /**
@@ -26,6 +49,10 @@ class RingBuffer {
    */
   ~RingBuffer();
 
+  // forbidden copy
+  RingBuffer(const RingBuffer&) = delete;
+  RingBuffer& operator=(const RingBuffer&) = delete;
+
   /**
    * @fn Write
    * @brief Write data of (buffer[offset] to buffer[offset + data_length]) to the ring buffer's write pointer
@@ -45,11 +72,93 @@ class RingBuffer {
    */
   int Read(byte* buffer, const unsigned int offset, const unsigned int data_length);
 
+  /**
+   * @fn PeekWrite
+   * @brief Return the free area to write the data directly. The data is published by CommitWrite.
+   */
+  RingBufferSpan PeekWrite();
+  /**
+   * @fn CommitWrite
+   * @brief Publish the data written in the area returned by PeekWrite
+   * @param [in] data_length: Written length. It must be smaller than the size of the area.
+   */
+  void CommitWrite(const unsigned int data_length);
+  /**
+   * @fn PeekRead
+   * @brief Return the stored data without copying. The data is kept until CommitRead.
+   */
+  RingBufferSpan PeekRead();
+  /**
+   * @fn CommitRead
+   * @brief Release the data returned by PeekRead
+   * @param [in] data_length: Released length. It must be smaller than the size of the data.
+   */
+  void CommitRead(const unsigned int data_length);
+
+  /**
+   * @fn GetCapacity
+   * @brief Return the buffer size
+   */
+  inline unsigned int GetCapacity() const { return buffer_size_; }
+  /**
+   * @fn GetReadableSize
+   * @brief Return the size of the stored data
+   * @note The value can be changed by the other thread after the return.
+   */
+  unsigned int GetReadableSize() const;
+  /**
+   * @fn GetWritableSize
+   * @brief Return the size of the free area
+   * @note The value can be changed by the other thread after the return.
+   */
+  inline unsigned int GetWritableSize() const { return buffer_size_ - GetReadableSize(); }
+  /**
+   * @fn GetOverflowCount
+   * @brief Return the number of writings which are not stored entirely
+   */
+  inline unsigned long long GetOverflowCount() const { return overflow_count_.load(std::memory_order_relaxed); }
+  /**
+   * @fn GetDroppedBytes
+   * @brief Return the number of bytes dropped since the buffer is full
+   */
+  inline unsigned long long GetDroppedBytes() const { return dropped_bytes_.load(std::memory_order_relaxed); }
+
  private:
-  unsigned int buffer_size_;    //!< Buffer size
-  byte* buffer_;                //!< Buffer
-  unsigned int read_pointer_;   //!< Read pointer
-  unsigned int write_pointer_;  //!< Write pointer
+  static const unsigned int kCacheLineSize = 64;  //!< Cache line size to separate the variables of the producer and the consumer
+
+  unsigned int buffer_size_;  //!< Buffer size (power of two)
+  unsigned int index_mask_;   //!< Mask to convert the pointer to the index of the buffer
+  byte* buffer_;              //!< Buffer
+
+  // The pointers are not wrapped by the buffer size, so the difference is the stored data size.
+  // Variables of the producer
+  alignas(kCacheLineSize) std::atomic<unsigned int> write_pointer_{0};  //!< Write pointer
+  unsigned int cached_read_pointer_ = 0;                                //!< Read pointer last loaded by the producer
+  std::atomic<unsigned long long> overflow_count_{0};                   //!< Number of writings not stored entirely
+  std::atomic<unsigned long long> dropped_bytes_{0};                    //!< Number of dropped bytes
+  // Variables of the consumer
+  alignas(kCacheLineSize) std::atomic<unsigned int> read_pointer_{0};  //!< Read pointer
+  unsigned int cached_write_pointer_ = 0;                              //!< Write pointer last loaded by the consumer
+
+  /**
+   * @fn CalcWritableSize
+   * @brief Return the free size for the producer. The read pointer is loaded only when the cached value shows the insufficient area.
+   * @param [in] required_size: Required size
+   */
+  unsigned int CalcWritableSize(const unsigned int required_size);
+  /**
+   * @fn CalcReadableSize
+   * @brief Return the stored size for the consumer. The write pointer is loaded only when the cached value shows the insufficient data.
+   * @param [in] required_size: Required size
+   */
+  unsigned int CalcReadableSize(const unsigned int required_size);
+  /**
+   * @fn MakeSpan
+   * @brief Make the span of the area starting at the pointer
+   * @param [in] pointer: Pointer of the head of the area
+   * @param [in] size: Size of the area
+   */
+  RingBufferSpan MakeSpan(const unsigned int pointer, const unsigned int size) const;
 };
 
 #endif  // S2E_LIBRARY_UTILITIES_RING_BUFFER_HPP_
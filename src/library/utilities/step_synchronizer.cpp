@@ -0,0 +1,56 @@
+/**
+ * @file step_synchronizer.cpp
+ * @brief Class to synchronize a worker thread with the simulation steps
+ */
+
+#include "step_synchronizer.hpp"
+
+#include <thread>
+
+StepSynchronizer::StepSynchronizer(const unsigned int maximum_skew_steps) : kMaximumSkewSteps(maximum_skew_steps > 0 ? maximum_skew_steps : 1) {
+  // Spinning on a single hardware thread only delays the other thread
+  spin_count_ = std::thread::hardware_concurrency() > 1 ? 10000 : 0;
+}
+
+void StepSynchronizer::ReleaseStep() { Notify(released_step_count_); }
+
+void StepSynchronizer::WaitForSkew() {
+  WaitUntil([this]() { return GetReleasedStepCount() - GetCompletedStepCount() < kMaximumSkewSteps; });
+}
+
+void StepSynchronizer::WaitForAllSteps() {
+  WaitUntil([this]() { return GetReleasedStepCount() == GetCompletedStepCount(); });
+}
+
+void StepSynchronizer::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stopped_.store(true, std::memory_order_release);
+  }
+  condition_.notify_all();
+}
+
+bool StepSynchronizer::WaitForReleasedStep() {
+  WaitUntil([this]() { return GetCompletedStepCount() < GetReleasedStepCount() || is_stopped_.load(std::memory_order_acquire); });
+  return GetCompletedStepCount() < GetReleasedStepCount();
+}
+
+void StepSynchronizer::CompleteStep() { Notify(completed_step_count_); }
+
+template <typename Condition>
+void StepSynchronizer::WaitUntil(Condition condition) {
+  for (unsigned int i = 0; i < spin_count_; i++) {
+    if (condition()) return;
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  condition_.wait(lock, condition);
+}
+
+void StepSynchronizer::Notify(std::atomic<unsigned long long>& count) {
+  {
+    // The count is updated in the lock not to lose the notification to the thread going to sleep
+    std::lock_guard<std::mutex> lock(mutex_);
+    count.fetch_add(1, std::memory_order_release);
+  }
+  condition_.notify_all();
+}
@@ -0,0 +1,101 @@
+/**
+ * @file step_synchronizer.hpp
+ * @brief Class to synchronize a worker thread with the simulation steps
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_STEP_SYNCHRONIZER_HPP_
+#define S2E_LIBRARY_UTILITIES_STEP_SYNCHRONIZER_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+/**
+ * @class StepSynchronizer
+ * @brief Class to synchronize a worker thread with the simulation steps
+ * @details The simulation thread releases the steps, and the worker thread executes them in order. The simulation thread waits so that the
+ *          number of the released steps not completed is smaller than the maximum skew, so the worker is behind the simulation at most the
+ *          maximum skew steps. The maximum skew 1 means the lock-step execution.
+ *          The waiting threads spin for a while before sleeping when the machine has multiple hardware threads.
+ */
+class StepSynchronizer {
+ public:
+  /**
+   * @fn StepSynchronizer
+   * @brief Constructor
+   * @param [in] maximum_skew_steps: Maximum number of the steps released and not completed
+   */
+  StepSynchronizer(const unsigned int maximum_skew_steps = 1);
+
+  // Functions for the simulation thread
+  /**
+   * @fn ReleaseStep
+   * @brief Release the next step to the worker thread
+   */
+  void ReleaseStep();
+  /**
+   * @fn WaitForSkew
+   * @brief Wait until the next step can be released within the maximum skew
+   */
+  void WaitForSkew();
+  /**
+   * @fn WaitForAllSteps
+   * @brief Wait until all released steps are completed
+   */
+  void WaitForAllSteps();
+  /**
+   * @fn Stop
+   * @brief Stop the worker thread after the released steps are completed
+   */
+  void Stop();
+
+  // Functions for the worker thread
+  /**
+   * @fn WaitForReleasedStep
+   * @brief Wait until the next step is released
+   * @return False when the synchronizer is stopped and all steps are completed
+   */
+  bool WaitForReleasedStep();
+  /**
+   * @fn CompleteStep
+   * @brief Notify the completion of the step
+   */
+  void CompleteStep();
+
+  /**
+   * @fn GetReleasedStepCount
+   * @brief Return the number of released steps
+   */
+  inline unsigned long long GetReleasedStepCount() const { return released_step_count_.load(std::memory_order_acquire); }
+  /**
+   * @fn GetCompletedStepCount
+   * @brief Return the number of completed steps
+   */
+  inline unsigned long long GetCompletedStepCount() const { return completed_step_count_.load(std::memory_order_acquire); }
+
+ private:
+  const unsigned int kMaximumSkewSteps;  //!< Maximum number of the steps released and not completed
+  unsigned int spin_count_;              //!< Number of checks before sleeping
+
+  std::atomic<unsigned long long> released_step_count_{0};   //!< Number of released steps
+  std::atomic<unsigned long long> completed_step_count_{0};  //!< Number of completed steps
+  std::atomic<bool> is_stopped_{false};                      //!< Stop flag
+  std::mutex mutex_;                                         //!< Mutex to update the counts
+  std::condition_variable condition_;                        //!< Condition variable to wake up the waiting thread
+
+  /**
+   * @fn WaitUntil
+   * @brief Wait until the condition is satisfied
+   * @param [in] condition: Condition checked with the counts
+   */
+  template <typename Condition>
+  void WaitUntil(Condition condition);
+  /**
+   * @fn Notify
+   * @brief Update the count and wake up the waiting thread
+   * @param [in] count: Count to be incremented
+   */
+  void Notify(std::atomic<unsigned long long>& count);
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_STEP_SYNCHRONIZER_HPP_
@@ -0,0 +1,135 @@
+/**
+ * @file test_ring_buffer.cpp
+ * @brief Test codes for RingBuffer class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "ring_buffer.hpp"
+
+/**
+ * @brief Test for the capacity rounded up to the power of two
+ */
+TEST(RingBuffer, Capacity) {
+  RingBuffer ring_buffer_1(1);
+  EXPECT_EQ(1, ring_buffer_1.GetCapacity());
+  RingBuffer ring_buffer_1000(1000);
+  EXPECT_EQ(1024, ring_buffer_1000.GetCapacity());
+  RingBuffer ring_buffer_1024(1024);
+  EXPECT_EQ(1024, ring_buffer_1024.GetCapacity());
+  EXPECT_EQ(1024, ring_buffer_1024.GetWritableSize());
+  EXPECT_EQ(0, ring_buffer_1024.GetReadableSize());
+}
+
+/**
+ * @brief Test for the writing and the reading wrapping around the end of the buffer
+ */
+TEST(RingBuffer, WrapAround) {
+  RingBuffer ring_buffer(8);
+  byte data[16];
+  for (int i = 0; i < 16; i++) data[i] = (byte)i;
+  byte read_data[16] = {};
+
+  EXPECT_EQ(6, ring_buffer.Write(data, 0, 6));
+  EXPECT_EQ(4, ring_buffer.Read(read_data, 0, 4));
+  // Written to the index 6, 7, 0, 1, 2
+  EXPECT_EQ(5, ring_buffer.Write(data, 6, 5));
+  EXPECT_EQ(7, ring_buffer.GetReadableSize());
+  EXPECT_EQ(7, ring_buffer.Read(read_data, 4, 16));
+  for (int i = 0; i < 11; i++) {
+    EXPECT_EQ(data[i], read_data[i]);
+  }
+  EXPECT_EQ(0, ring_buffer.Read(read_data, 0, 16));
+  EXPECT_EQ(0, ring_buffer.GetOverflowCount());
+}
+
+/**
+ * @brief Test for the overflow counters
+ */
+TEST(RingBuffer, Overflow) {
+  RingBuffer ring_buffer(8);
+  byte data[16];
+  for (int i = 0; i < 16; i++) data[i] = (byte)i;
+  byte read_data[16] = {};
+
+  EXPECT_EQ(8, ring_buffer.Write(data, 0, 10));
+  EXPECT_EQ(0, ring_buffer.Write(data, 0, 3));
+  EXPECT_EQ(2, ring_buffer.GetOverflowCount());
+  EXPECT_EQ(5, ring_buffer.GetDroppedBytes());
+
+  // The stored data is not overwritten
+  EXPECT_EQ(8, ring_buffer.Read(read_data, 0, 16));
+  for (int i = 0; i < 8; i++) {
+    EXPECT_EQ(data[i], read_data[i]);
+  }
+}
+
+/**
+ * @brief Test for the zero-copy access with the spans
+ */
+TEST(RingBuffer, PeekCommit) {
+  RingBuffer ring_buffer(8);
+  byte data[8] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'};
+  byte read_data[8] = {};
+  ring_buffer.Write(data, 0, 6);
+  ring_buffer.Read(read_data, 0, 6);
+
+  // The free area is divided at the end of the buffer
+  RingBufferSpan write_span = ring_buffer.PeekWrite();
+  EXPECT_EQ(2, write_span.first_size);
+  EXPECT_EQ(6, write_span.second_size);
+  write_span.first_data[0] = 'x';
+  write_span.first_data[1] = 'y';
+  write_span.second_data[0] = 'z';
+  EXPECT_EQ(0, ring_buffer.GetReadableSize());
+  ring_buffer.CommitWrite(3);
+
+  RingBufferSpan read_span = ring_buffer.PeekRead();
+  ASSERT_EQ(3, read_span.GetSize());
+  EXPECT_EQ('x', read_span.first_data[0]);
+  EXPECT_EQ('y', read_span.first_data[1]);
+  EXPECT_EQ('z', read_span.second_data[0]);
+  ring_buffer.CommitRead(2);
+  EXPECT_EQ(1, ring_buffer.Read(read_data, 0, 8));
+  EXPECT_EQ('z', read_data[0]);
+}
+
+/**
+ * @brief Test for the data transfer between the producer thread and the consumer thread
+ */
+TEST(RingBuffer, SingleProducerSingleConsumer) {
+  RingBuffer ring_buffer(64);
+  const unsigned int kDataLength = 1000000;
+
+  std::thread producer([&ring_buffer, kDataLength]() {
+    byte data[7];
+    unsigned int written_length = 0;
+    while (written_length < kDataLength) {
+      const unsigned int length = std::min(7u, kDataLength - written_length);
+      for (unsigned int i = 0; i < length; i++) data[i] = (byte)(written_length + i);
+      // Retry the data not stored
+      const unsigned int stored_length = ring_buffer.PeekWrite().GetSize() >= length ? ring_buffer.Write(data, 0, length) : 0;
+      written_length += stored_length;
+      if (stored_length == 0) std::this_thread::yield();
+    }
+  });
+
+  std::vector<byte> read_data;
+  byte buffer[13];
+  while (read_data.size() < kDataLength) {
+    const int read_length = ring_buffer.Read(buffer, 0, sizeof(buffer));
+    read_data.insert(read_data.end(), buffer, buffer + read_length);
+    if (read_length == 0) std::this_thread::yield();
+  }
+  producer.join();
+
+  unsigned int error_count = 0;
+  for (unsigned int i = 0; i < kDataLength; i++) {
+    if (read_data[i] != (byte)i) error_count++;
+  }
+  EXPECT_EQ(0, error_count);
+  EXPECT_EQ(0, ring_buffer.GetOverflowCount());
+}
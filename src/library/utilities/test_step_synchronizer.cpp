@@ -0,0 +1,69 @@
+/**
+ * @file test_step_synchronizer.cpp
+ * @brief Test codes for StepSynchronizer class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "step_synchronizer.hpp"
+
+/**
+ * @brief Test for the lock-step execution
+ */
+TEST(StepSynchronizer, LockStep) {
+  StepSynchronizer synchronizer(1);
+  std::atomic<unsigned int> executed_steps(0);
+  bool is_skew_kept = true;
+
+  std::thread worker([&synchronizer, &executed_steps]() {
+    while (synchronizer.WaitForReleasedStep()) {
+      executed_steps++;
+      synchronizer.CompleteStep();
+    }
+  });
+
+  for (unsigned int step = 0; step < 1000; step++) {
+    synchronizer.WaitForSkew();
+    // The previous step is completed before releasing the next step
+    if (executed_steps != step) is_skew_kept = false;
+    synchronizer.ReleaseStep();
+  }
+  synchronizer.WaitForAllSteps();
+  EXPECT_EQ(1000, executed_steps);
+  synchronizer.Stop();
+  worker.join();
+
+  EXPECT_TRUE(is_skew_kept);
+  EXPECT_EQ(1000, synchronizer.GetCompletedStepCount());
+}
+
+/**
+ * @brief Test for the bounded skew execution
+ */
+TEST(StepSynchronizer, BoundedSkew) {
+  const unsigned int kMaximumSkewSteps = 4;
+  StepSynchronizer synchronizer(kMaximumSkewSteps);
+  std::atomic<unsigned int> executed_steps(0);
+  bool is_skew_kept = true;
+
+  std::thread worker([&synchronizer, &executed_steps]() {
+    while (synchronizer.WaitForReleasedStep()) {
+      executed_steps++;
+      synchronizer.CompleteStep();
+    }
+  });
+
+  for (unsigned int step = 0; step < 1000; step++) {
+    synchronizer.WaitForSkew();
+    if (step - executed_steps >= kMaximumSkewSteps) is_skew_kept = false;
+    synchronizer.ReleaseStep();
+  }
+  // The released steps are executed before the worker is stopped
+  synchronizer.Stop();
+  worker.join();
+
+  EXPECT_TRUE(is_skew_kept);
+  EXPECT_EQ(1000, executed_steps);
+}
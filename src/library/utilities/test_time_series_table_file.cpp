@@ -0,0 +1,54 @@
+/**
+ * @file test_time_series_table_file.cpp
+ * @brief Test codes for TimeSeriesTableFile class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+#include "time_series_table_file.hpp"
+
+/**
+ * @brief Test for reading the time window of the written tables
+ */
+TEST(TimeSeriesTableFile, ReadWindow) {
+  const std::string file_path = "test_time_series_table_file.bin";
+
+  // Object 0: 100 records with 2 arrays, Object 1: no record
+  std::vector<std::vector<double>> times(2);
+  std::vector<std::vector<std::vector<double>>> values(2, std::vector<std::vector<double>>(2));
+  for (size_t i = 0; i < 100; i++) {
+    times[0].push_back(10.0 * i);
+    values[0][0].push_back((double)i);
+    values[0][1].push_back(-2.0 * i);
+  }
+  ASSERT_TRUE(TimeSeriesTableFile::Write(file_path, {300.0, 1.5}, times, values));
+
+  TimeSeriesTableFile table_file;
+  ASSERT_TRUE(table_file.Open(file_path));
+  EXPECT_EQ(2, table_file.GetNumberOfObjects());
+  EXPECT_EQ(2, table_file.GetNumberOfArrays());
+  ASSERT_EQ(2, table_file.GetParameters().size());
+  EXPECT_DOUBLE_EQ(300.0, table_file.GetParameters()[0]);
+  EXPECT_DOUBLE_EQ(1.5, table_file.GetParameters()[1]);
+
+  // Records in [195, 300] are index 20 to 30, and index 18 to 32 with 2 margin records
+  std::vector<double> window_times;
+  std::vector<std::vector<double>> window_values;
+  ASSERT_TRUE(table_file.ReadWindow(0, 195.0, 300.0, 2, window_times, window_values));
+  ASSERT_EQ(15, window_times.size());
+  ASSERT_EQ(2, window_values.size());
+  for (size_t i = 0; i < window_times.size(); i++) {
+    EXPECT_DOUBLE_EQ(10.0 * (i + 18), window_times[i]);
+    EXPECT_DOUBLE_EQ((double)(i + 18), window_values[0][i]);
+    EXPECT_DOUBLE_EQ(-2.0 * (i + 18), window_values[1][i]);
+  }
+
+  // The margin is limited at the edges
+  ASSERT_TRUE(table_file.ReadWindow(0, -100.0, 5.0, 3, window_times, window_values));
+  EXPECT_EQ(4, window_times.size());
+  ASSERT_TRUE(table_file.ReadWindow(1, 0.0, 1000.0, 3, window_times, window_values));
+  EXPECT_EQ(0, window_times.size());
+
+  remove(file_path.c_str());
+}
@@ -0,0 +1,113 @@
+/**
+ * @file time_series_table_file.cpp
+ * @brief Class to write and read time series tables of multiple objects in a binary file
+ */
+
+#include "time_series_table_file.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+static const char kMagic[8] = {'S', '2', 'E', 'T', 'S', 'T', 'B', '\0'};  //!< Magic number of the file
+
+bool TimeSeriesTableFile::Write(const std::string& file_path, const std::vector<double>& parameters, const std::vector<std::vector<double>>& times,
+                                const std::vector<std::vector<std::vector<double>>>& values) {
+  if (times.size() != values.size()) return false;
+  const uint32_t number_of_arrays = values.empty() ? 0 : (uint32_t)values[0].size();
+  for (size_t object_id = 0; object_id < values.size(); object_id++) {
+    if (values[object_id].size() != number_of_arrays) return false;
+    for (const auto& array : values[object_id]) {
+      if (array.size() != times[object_id].size()) return false;
+    }
+  }
+
+  std::ofstream file(file_path, std::ios::out | std::ios::binary);
+  if (!file.is_open()) {
+    std::cerr << "file open error: " << file_path << std::endl;
+    return false;
+  }
+
+  const uint32_t header[4] = {kFormatVersion, (uint32_t)times.size(), number_of_arrays, (uint32_t)parameters.size()};
+  file.write(kMagic, sizeof(kMagic));
+  file.write((const char*)header, sizeof(header));
+  file.write((const char*)parameters.data(), parameters.size() * sizeof(double));
+  for (const auto& object_times : times) {
+    const uint64_t number_of_records = object_times.size();
+    file.write((const char*)&number_of_records, sizeof(number_of_records));
+  }
+  for (size_t object_id = 0; object_id < times.size(); object_id++) {
+    file.write((const char*)times[object_id].data(), times[object_id].size() * sizeof(double));
+    for (const auto& array : values[object_id]) {
+      file.write((const char*)array.data(), array.size() * sizeof(double));
+    }
+  }
+  return file.good();
+}
+
+bool TimeSeriesTableFile::Open(const std::string& file_path) {
+  if (file_.is_open()) file_.close();
+  file_.open(file_path, std::ios::in | std::ios::binary);
+  if (!file_.is_open()) return false;
+
+  char magic[8];
+  uint32_t header[4];
+  file_.read(magic, sizeof(magic));
+  file_.read((char*)header, sizeof(header));
+  if (!file_.good() || memcmp(magic, kMagic, sizeof(kMagic)) != 0 || header[0] != kFormatVersion) {
+    std::cerr << "TimeSeriesTableFile: Invalid file " << file_path << std::endl;
+    file_.close();
+    return false;
+  }
+  const size_t number_of_objects = header[1];
+  number_of_arrays_ = header[2];
+  parameters_.resize(header[3]);
+  file_.read((char*)parameters_.data(), parameters_.size() * sizeof(double));
+
+  std::vector<uint64_t> number_of_records(number_of_objects);
+  file_.read((char*)number_of_records.data(), number_of_records.size() * sizeof(uint64_t));
+
+  // Only the times are read to find the time window
+  times_.resize(number_of_objects);
+  data_offsets_.resize(number_of_objects);
+  for (size_t object_id = 0; object_id < number_of_objects; object_id++) {
+    data_offsets_[object_id] = (uint64_t)file_.tellg();
+    times_[object_id].resize(number_of_records[object_id]);
+    file_.read((char*)times_[object_id].data(), times_[object_id].size() * sizeof(double));
+    file_.seekg(number_of_arrays_ * number_of_records[object_id] * sizeof(double), std::ios::cur);
+  }
+  if (!file_.good()) {
+    std::cerr << "TimeSeriesTableFile: Invalid file " << file_path << std::endl;
+    file_.close();
+    return false;
+  }
+  return true;
+}
+
+bool TimeSeriesTableFile::ReadWindow(const size_t object_id, const double start_time, const double end_time, const size_t number_of_margin_records,
+                                     std::vector<double>& times, std::vector<std::vector<double>>& values) {
+  times.clear();
+  values.assign(number_of_arrays_, std::vector<double>());
+  if (!file_.is_open() || object_id >= times_.size()) return false;
+
+  const std::vector<double>& object_times = times_[object_id];
+  size_t first = std::lower_bound(object_times.begin(), object_times.end(), start_time) - object_times.begin();
+  size_t last = std::upper_bound(object_times.begin(), object_times.end(), end_time) - object_times.begin();
+  first = (first > number_of_margin_records) ? first - number_of_margin_records : 0;
+  last = std::min(last + number_of_margin_records, object_times.size());
+  if (first >= last) return true;
+
+  const size_t number_of_records = last - first;
+  times.assign(object_times.begin() + first, object_times.begin() + last);
+  for (size_t array_id = 0; array_id < number_of_arrays_; array_id++) {
+    const uint64_t offset = data_offsets_[object_id] + ((array_id + 1) * object_times.size() + first) * sizeof(double);
+    values[array_id].resize(number_of_records);
+    file_.seekg(offset, std::ios::beg);
+    file_.read((char*)values[array_id].data(), number_of_records * sizeof(double));
+  }
+  if (!file_.good()) {
+    file_.clear();
+    return false;
+  }
+  return true;
+}
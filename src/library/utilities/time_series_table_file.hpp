@@ -0,0 +1,90 @@
+/**
+ * @file time_series_table_file.hpp
+ * @brief Class to write and read time series tables of multiple objects in a binary file
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_TIME_SERIES_TABLE_FILE_HPP_
+#define S2E_LIBRARY_UTILITIES_TIME_SERIES_TABLE_FILE_HPP_
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * @class TimeSeriesTableFile
+ * @brief Class to write and read time series tables of multiple objects in a binary file
+ * @details The tables are stored as the structure of arrays, so the values in a time window can be read without reading the whole file.
+ * @note File format (native byte order)
+ *       Header: "S2ETSTB" + '\0', version (uint32), number of objects (uint32), number of arrays (uint32), number of parameters (uint32),
+ *               parameters (double[number of parameters]), number of records (uint64[number of objects])
+ *       Data: {times (double[number of records]), {values (double[number of records])} * number of arrays} * number of objects
+ */
+class TimeSeriesTableFile {
+ public:
+  /**
+   * @fn Write
+   * @brief Write the tables into a file
+   * @param [in] file_path: Path to the output file
+   * @param [in] parameters: Parameters stored in the header
+   * @param [in] times: Times of the records of each object. The times should be sorted in ascending order.
+   * @param [in] values: Values of the records of each object. [object][array][record]
+   * @return True when the file is written
+   */
+  static bool Write(const std::string& file_path, const std::vector<double>& parameters, const std::vector<std::vector<double>>& times,
+                    const std::vector<std::vector<std::vector<double>>>& values);
+
+  /**
+   * @fn Open
+   * @brief Open the file and read the header and the times of all objects. The values are not read.
+   * @param [in] file_path: Path to the input file
+   * @return True when the file is opened and the header is valid
+   */
+  bool Open(const std::string& file_path);
+  /**
+   * @fn ReadWindow
+   * @brief Read the records of an object in the time window
+   * @param [in] object_id: Object ID
+   * @param [in] start_time: Start time of the window
+   * @param [in] end_time: End time of the window
+   * @param [in] number_of_margin_records: Number of records added before and after the window
+   * @param [out] times: Times of the read records
+   * @param [out] values: Values of the read records [array][record]
+   * @return True when the records are read
+   */
+  bool ReadWindow(const size_t object_id, const double start_time, const double end_time, const size_t number_of_margin_records,
+                  std::vector<double>& times, std::vector<std::vector<double>>& values);
+
+  // Getter
+  /**
+   * @fn IsOpened
+   * @brief Return true when the input file is opened
+   */
+  inline bool IsOpened() const { return file_.is_open(); }
+  /**
+   * @fn GetNumberOfObjects
+   * @brief Return number of objects
+   */
+  inline size_t GetNumberOfObjects() const { return times_.size(); }
+  /**
+   * @fn GetNumberOfArrays
+   * @brief Return number of value arrays for each object
+   */
+  inline size_t GetNumberOfArrays() const { return number_of_arrays_; }
+  /**
+   * @fn GetParameters
+   * @brief Return parameters stored in the header
+   */
+  inline const std::vector<double>& GetParameters() const { return parameters_; }
+
+  static const uint32_t kFormatVersion = 1;  //!< Version of the file format
+
+ private:
+  std::ifstream file_;                      //!< Input file stream
+  size_t number_of_arrays_ = 0;             //!< Number of value arrays for each object
+  std::vector<double> parameters_;          //!< Parameters stored in the header
+  std::vector<std::vector<double>> times_;  //!< Times of the records of each object
+  std::vector<uint64_t> data_offsets_;      //!< Offset of the data of each object in the file [byte]
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_TIME_SERIES_TABLE_FILE_HPP_
@@ -15,14 +15,32 @@
 #include <string>
 
 // Simulator includes
+#include "library/logger/initialize_log.hpp"
 #include "library/logger/logger.hpp"
+#include "library/utilities/macros.hpp"
+#include "simulation/monte_carlo_simulation/initialize_monte_carlo_simulation.hpp"
+#include "simulation/monte_carlo_simulation/simulation_object.hpp"
 
 // Add custom include files
 #include "simulation_sample/case/sample_case.hpp"
-// #include "simulation/monte_carlo_simulation/monte_carlo_simulation_executor.hpp"
 // #include "interface/hils/COSMOSWrapper.h"
 // #include "interface/hils/HardwareMessage.h"
 
+/**
+ * @class MonteCarloResultLog
+ * @brief Loggable to write the result of a Monte-Carlo case received from the worker
+ */
+class MonteCarloResultLog : public ILoggable {
+ public:
+  MonteCarloResultLog(const std::string header, const std::string value) : header_(header), value_(value) {}
+  std::string GetLogHeader() const override { return header_; }
+  std::string GetLogValue() const override { return value_; }
+
+ private:
+  std::string header_;  //!< Header of the case
+  std::string value_;   //!< Values of the case
+};
+
 void print_path(std::string path) {
 #ifdef WIN32
   std::cout << path << std::endl;
@@ -68,9 +86,43 @@ int main(int argc, char *argv[])
   std::cout << "\tIni file: ";
   print_path(ini_file);
 
-  auto simulation_case = SampleCase(ini_file);
-  simulation_case.Initialize();
-  simulation_case.Main();
+  // Monte-Carlo simulation. Only one case is executed when it is disabled.
+  MonteCarloCaseRunner* monte_carlo_runner = InitMonteCarloCaseRunner(ini_file);
+  Logger* monte_carlo_logger = InitMonteCarloLog(ini_file, monte_carlo_runner->IsMonteCarloEnabled());
+  const bool is_monte_carlo_result_logged = monte_carlo_runner->IsMonteCarloEnabled();
+  bool is_monte_carlo_header_written = false;
+
+  monte_carlo_runner->Run(
+      [&](MonteCarloSimulationExecutor& monte_carlo_simulator) {
+        SampleCase simulation_case(ini_file, monte_carlo_simulator, monte_carlo_logger->GetLogPath());
+        simulation_case.Initialize();
+        // Set the randomized parameters into the objects of this case
+        SimulationObject::SetAllParameters(monte_carlo_simulator);
+        simulation_case.Main();
+
+        // The result is returned as the header and the values, since the forked worker processes cannot write in the shared file
+        std::string result = "";
+        if (!is_monte_carlo_result_logged || !simulation_case.is_log_enabled_) return result;
+        result = simulation_case.GetLogHeader() + "\n";
+        simulation_case.AppendLogValue(result);
+        return result;
+      },
+      [&](const unsigned long long case_id, const std::string& result) {
+        UNUSED(case_id);
+        const size_t header_end = result.find('\n');
+        if (header_end == std::string::npos) return;
+        MonteCarloResultLog result_log(result.substr(0, header_end), result.substr(header_end + 1));
+        monte_carlo_logger->AddLogList(&result_log);
+        if (!is_monte_carlo_header_written) {
+          monte_carlo_logger->WriteHeaders();
+          is_monte_carlo_header_written = true;
+        }
+        monte_carlo_logger->WriteValues();
+        monte_carlo_logger->ClearLogList();
+      });
+
+  delete monte_carlo_logger;
+  delete monte_carlo_runner;
 
   end = system_clock::now();
   double time = static_cast<double>(duration_cast<microseconds>(end - start).count() / 1000000.0);
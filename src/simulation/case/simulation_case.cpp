@@ -24,19 +24,25 @@ SimulationCase::SimulationCase(const std::string initialize_base_file, const Mon
     simulation_configuration_.main_logger_ = InitLog(initialize_base_file);
   } else {
     // Monte Carlo Simulation is enabled
-    std::string log_file_name = "default" + std::to_string(monte_carlo_simulator.GetNumberOfExecutionsDone()) + ".csv";
-
     IniAccess ini_file(initialize_base_file);
     bool save_ini_files = ini_file.ReadEnable("SIMULATION_SETTINGS", "save_initialize_files");
+    LogFileFormat log_format = SetLogFileFormat(ini_file.ReadString("SIMULATION_SETTINGS", "log_file_format"));
+
+    std::string log_file_extension = (log_format == LogFileFormat::kBinary) ? ".bin" : ".csv";
+    std::string log_file_name = "default" + std::to_string(monte_carlo_simulator.GetNumberOfExecutionsDone()) + log_file_extension;
 
-    simulation_configuration_.main_logger_ =
-        new Logger(log_file_name, log_path, initialize_base_file, save_ini_files, monte_carlo_simulator.GetSaveLogHistoryFlag());
+    simulation_configuration_.main_logger_ = new Logger(log_file_name, log_path, initialize_base_file, save_ini_files,
+                                                        monte_carlo_simulator.GetSaveLogHistoryFlag(), log_format);
+    InitLogAsyncWriting(simulation_configuration_.main_logger_, initialize_base_file);
   }
   // Initialize Simulation Configuration
   InitializeSimulationConfiguration(initialize_base_file);
 }
 
-SimulationCase::~SimulationCase() { delete global_environment_; }
+SimulationCase::~SimulationCase() {
+  delete spacecraft_updater_;
+  delete global_environment_;
+}
 
 void SimulationCase::Initialize() {
   // Target Objects Initialize
@@ -71,6 +77,10 @@ void SimulationCase::Main() {
   }
 }
 
+void SimulationCase::UpdateSpacecraft(const std::vector<Spacecraft*>& spacecraft) {
+  spacecraft_updater_->Update(spacecraft, &(global_environment_->GetSimulationTime()));
+}
+
 std::string SimulationCase::GetLogHeader() const {
   std::string str_tmp = "";
 
@@ -92,6 +102,10 @@ void SimulationCase::InitializeSimulationConfiguration(const std::string initial
   // Spacecraft
   simulation_configuration_.number_of_simulated_spacecraft_ = simulation_base_ini.ReadInt(section, "number_of_simulated_spacecraft");
   simulation_configuration_.spacecraft_file_list_ = simulation_base_ini.ReadStrVector(section, "spacecraft_file");
+  // The spacecraft are updated serially when the key is not written
+  if (simulation_base_ini.HasKey(section, "number_of_spacecraft_update_threads")) {
+    simulation_configuration_.number_of_spacecraft_update_threads_ = simulation_base_ini.ReadInt(section, "number_of_spacecraft_update_threads");
+  }
 
   // Ground Station
   simulation_configuration_.number_of_simulated_ground_station_ = simulation_base_ini.ReadInt(section, "number_of_simulated_ground_station");
@@ -104,4 +118,6 @@ void SimulationCase::InitializeSimulationConfiguration(const std::string initial
   // Global Environment
   global_environment_ = new GlobalEnvironment(&simulation_configuration_);
   global_environment_->LogSetup(*(simulation_configuration_.main_logger_));
+
+  spacecraft_updater_ = new ParallelSpacecraftUpdater(simulation_configuration_.number_of_spacecraft_update_threads_);
 }
\ No newline at end of file
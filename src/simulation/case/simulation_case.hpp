@@ -9,6 +9,7 @@
 #include <environment/global/global_environment.hpp>
 #include <library/logger/loggable.hpp>
 #include <simulation/monte_carlo_simulation/monte_carlo_simulation_executor.hpp>
+#include <simulation/multiple_spacecraft/parallel_spacecraft_updater.hpp>
 
 #include "../simulation_configuration.hpp"
 class Logger;
@@ -77,6 +78,7 @@ class SimulationCase : public ILoggable {
  protected:
   SimulationConfiguration simulation_configuration_;  //!< Simulation setting
   GlobalEnvironment* global_environment_;             //!< Global Environment
+  ParallelSpacecraftUpdater* spacecraft_updater_;     //!< Updater of the spacecraft
 
   /**
    * @fn InitializeSimulationConfiguration
@@ -96,6 +98,14 @@ class SimulationCase : public ILoggable {
    * @brief Virtual function to update target objects(spacecraft and ground station)
    */
   virtual void UpdateTargetObjects() = 0;
+
+  /**
+   * @fn UpdateSpacecraft
+   * @brief Update the spacecraft with the threads set by number_of_spacecraft_update_threads in the simulation base file
+   * @note Call it in UpdateTargetObjects before the update of RelativeInformation. It returns after all spacecraft are updated.
+   * @param[in] spacecraft: Spacecraft to be updated
+   */
+  void UpdateSpacecraft(const std::vector<Spacecraft*>& spacecraft);
 };
 
 #endif  // S2E_SIMULATION_CASE_SIMULATION_CASE_HPP_
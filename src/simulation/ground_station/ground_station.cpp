@@ -52,6 +52,36 @@ void GroundStation::Update(const CelestialRotation& celestial_rotation, const Sp
   is_visible_[spacecraft.GetSpacecraftId()] = CalcIsVisible(spacecraft.GetDynamics().GetOrbit().GetPosition_ecef_m());
 }
 
+void GroundStation::UpdateVisibility(const CelestialRotation& celestial_rotation, const SpacecraftSpatialIndex& spatial_index) {
+  libra::Matrix<3, 3> dcm_ecef2eci = celestial_rotation.GetDcmJ2000ToXcxf().Transpose();
+  position_i_m_ = dcm_ecef2eci * position_ecef_m_;
+
+  for (auto& is_visible : is_visible_) {
+    is_visible.second = false;
+  }
+  const double max_slant_range_m = CalcMaxSlantRange_m(spatial_index.GetMaxOrbitRadius_m());
+  for (const int spacecraft_id : spatial_index.GetSpacecraftWithinRange(position_ecef_m_, max_slant_range_m)) {
+    is_visible_[spacecraft_id] = CalcIsVisible(spatial_index.GetPosition_ecef_m(spacecraft_id));
+  }
+}
+
+double GroundStation::CalcMaxSlantRange_m(const double max_orbit_radius_m) const {
+  const double ground_station_radius_m = position_ecef_m_.CalcNorm();
+  // Any spacecraft is within this distance
+  double max_slant_range_m = ground_station_radius_m + max_orbit_radius_m;
+
+  // The elevation is measured from the geodetic zenith, which differs from the geocentric one by less than 0.2 deg
+  const double elevation_rad = (elevation_limit_angle_deg_ - 0.2) * libra::deg_to_rad;
+  if (elevation_rad < 0.0 || max_orbit_radius_m < ground_station_radius_m) return max_slant_range_m;
+
+  // Distance to the sphere of the maximum orbit radius along the direction of the elevation limit
+  const double horizontal_m = ground_station_radius_m * cos(elevation_rad);
+  const double vertical_m = sqrt(max_orbit_radius_m * max_orbit_radius_m - horizontal_m * horizontal_m);
+  const double slant_range_m = vertical_m - ground_station_radius_m * sin(elevation_rad);
+  if (slant_range_m < max_slant_range_m) max_slant_range_m = slant_range_m;
+  return max_slant_range_m;
+}
+
 bool GroundStation::CalcIsVisible(const libra::Vector<3> spacecraft_position_ecef_m) {
   libra::Quaternion q_ecef_to_ltc = geodetic_position_.GetQuaternionXcxfToLtc();
 
@@ -90,3 +120,12 @@ std::string GroundStation::GetLogValue() const {
   str_tmp += WriteVector(position_i_m_);
   return str_tmp;
 }
+
+bool GroundStation::GetLogValueBinary(std::vector<double>& values) const {
+  for (unsigned int i = 0; i < number_of_spacecraft_; i++) {
+    AppendScalar(values, is_visible_.at(i));
+  }
+  AppendVector(values, position_i_m_);
+
+  return true;
+}
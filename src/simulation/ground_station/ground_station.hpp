@@ -9,6 +9,7 @@
 #include <environment/global/celestial_rotation.hpp>
 #include <library/geodesy/geodetic_position.hpp>
 #include <library/math/vector.hpp>
+#include <simulation/multiple_spacecraft/spacecraft_spatial_index.hpp>
 #include <simulation/spacecraft/spacecraft.hpp>
 
 #include "../simulation_configuration.hpp"
@@ -45,6 +46,14 @@ class GroundStation : public ILoggable {
    * @brief Virtual function of main routine
    */
   virtual void Update(const CelestialRotation& celestial_rotation, const Spacecraft& spacecraft);
+  /**
+   * @fn UpdateVisibility
+   * @brief Update the visibility for all spacecraft in the spatial index
+   * @note Only the spacecraft within the maximum slant range over the elevation limit are checked.
+   * @param [in] celestial_rotation: Rotation of the earth
+   * @param [in] spatial_index: Spatial index updated with the current spacecraft positions
+   */
+  void UpdateVisibility(const CelestialRotation& celestial_rotation, const SpacecraftSpatialIndex& spatial_index);
 
   // Override functions for ILoggable
   /**
@@ -57,6 +66,11 @@ class GroundStation : public ILoggable {
    * @brief Override function of log value setting
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
   // Getters
   /**
@@ -108,6 +122,13 @@ class GroundStation : public ILoggable {
    * @return True when the satellite is visible from the ground station
    */
   bool CalcIsVisible(const Vector<3> spacecraft_position_ecef_m);
+  /**
+   * @fn CalcMaxSlantRange_m
+   * @brief Calculate the upper limit of the distance to the visible spacecraft
+   * @param [in] max_orbit_radius_m: Maximum distance of the spacecraft from the center of the earth [m]
+   * @return Upper limit of the distance from the ground station [m]
+   */
+  double CalcMaxSlantRange_m(const double max_orbit_radius_m) const;
 };
 
 #endif  // S2E_SIMULATION_GROUND_STATION_GROUND_STATION_HPP_
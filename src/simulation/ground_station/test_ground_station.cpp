@@ -0,0 +1,177 @@
+/**
+ * @file test_ground_station.cpp
+ * @brief Test codes for GroundStation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <library/math/constants.hpp>
+#include <library/utilities/macros.hpp>
+#include <random>
+#include <string>
+
+#include "ground_station.hpp"
+
+/**
+ * @class EcefOrbitForTest
+ * @brief Orbit whose position in the ECEF frame is set directly
+ */
+class EcefOrbitForTest : public Orbit {
+ public:
+  EcefOrbitForTest() : Orbit(nullptr) {}
+  void Propagate(const double end_time_s, const double current_time_jd) override {
+    UNUSED(end_time_s);
+    UNUSED(current_time_jd);
+  }
+  void SetPosition_ecef_m(const libra::Vector<3> position_ecef_m) { spacecraft_position_ecef_m_ = position_ecef_m; }
+};
+
+/**
+ * @class GroundStationForTest
+ * @brief Ground station which exposes the visibility calculations
+ */
+class GroundStationForTest : public GroundStation {
+ public:
+  GroundStationForTest(const SimulationConfiguration* configuration) : GroundStation(configuration, 0) {}
+  using GroundStation::CalcIsVisible;
+  using GroundStation::CalcMaxSlantRange_m;
+};
+
+/**
+ * @class GroundStationTestConfiguration
+ * @brief Simulation configuration with a ground station on the equator written in a temporary file
+ */
+class GroundStationTestConfiguration {
+ public:
+  GroundStationTestConfiguration(const std::string file_path, const unsigned int number_of_spacecraft, const double elevation_limit_angle_deg)
+      : file_path_(file_path) {
+    std::ofstream ini_file(file_path_);
+    ini_file << "[GROUND_STATION_0]" << std::endl;
+    ini_file << "latitude_deg = 0.0" << std::endl;
+    ini_file << "longitude_deg = 0.0" << std::endl;
+    ini_file << "height_m = 0.0" << std::endl;
+    ini_file << "elevation_limit_angle_deg = " << elevation_limit_angle_deg << std::endl;
+    ini_file.close();
+
+    configuration_.main_logger_ = new Logger("test_ground_station.csv", "", "", false, false);
+    configuration_.number_of_simulated_spacecraft_ = number_of_spacecraft;
+    configuration_.ground_station_file_list_.push_back(file_path_);
+  }
+  ~GroundStationTestConfiguration() { remove(file_path_.c_str()); }
+
+  SimulationConfiguration configuration_;  //!< Simulation configuration
+
+ private:
+  std::string file_path_;  //!< Path of the ground station file
+};
+
+/**
+ * @brief Return position of the spacecraft at the orbit radius and the elevation seen from the ground station on the X axis
+ */
+libra::Vector<3> CalcPositionAtElevation_ecef_m(const double ground_station_radius_m, const double orbit_radius_m, const double elevation_rad) {
+  const double sin_elevation = sin(elevation_rad);
+  const double slant_range_m = -ground_station_radius_m * sin_elevation +
+                               sqrt(ground_station_radius_m * ground_station_radius_m * sin_elevation * sin_elevation +
+                                    orbit_radius_m * orbit_radius_m - ground_station_radius_m * ground_station_radius_m);
+  libra::Vector<3> position_ecef_m(0.0);
+  position_ecef_m[0] = ground_station_radius_m + slant_range_m * sin_elevation;
+  position_ecef_m[1] = slant_range_m * cos(elevation_rad);
+  return position_ecef_m;
+}
+
+/**
+ * @brief Test for the maximum slant range with and without the elevation limit
+ */
+TEST(GroundStation, CalcMaxSlantRange) {
+  GroundStationTestConfiguration test_configuration("test_ground_station_slant_range.ini", 1, 10.0);
+  GroundStationForTest ground_station(&test_configuration.configuration_);
+  const double ground_station_radius_m = ground_station.GetPosition_ecef_m().CalcNorm();
+  const double orbit_radius_m = ground_station_radius_m + 500.0e3;
+
+  // Slant range at the elevation limit with the margin of the geodetic zenith
+  const double slant_range_m = ground_station.CalcMaxSlantRange_m(orbit_radius_m);
+  const libra::Vector<3> limit_position_ecef_m =
+      CalcPositionAtElevation_ecef_m(ground_station_radius_m, orbit_radius_m, (10.0 - 0.2) * libra::deg_to_rad);
+  EXPECT_NEAR((limit_position_ecef_m - ground_station.GetPosition_ecef_m()).CalcNorm(), slant_range_m, 1.0e-6);
+
+  // The spacecraft over the elevation limit is within the range, and the one far below is not
+  const libra::Vector<3> visible_position_ecef_m = CalcPositionAtElevation_ecef_m(ground_station_radius_m, orbit_radius_m, 10.0 * libra::deg_to_rad);
+  EXPECT_LT((visible_position_ecef_m - ground_station.GetPosition_ecef_m()).CalcNorm(), slant_range_m);
+  const libra::Vector<3> low_position_ecef_m = CalcPositionAtElevation_ecef_m(ground_station_radius_m, orbit_radius_m, 5.0 * libra::deg_to_rad);
+  EXPECT_GT((low_position_ecef_m - ground_station.GetPosition_ecef_m()).CalcNorm(), slant_range_m);
+
+  // The range is not limited for the orbit under the ground station
+  EXPECT_DOUBLE_EQ(2.0 * ground_station_radius_m - 1.0, ground_station.CalcMaxSlantRange_m(ground_station_radius_m - 1.0));
+}
+
+/**
+ * @brief Test for the maximum slant range without the elevation limit
+ */
+TEST(GroundStation, CalcMaxSlantRangeWithoutElevationLimit) {
+  GroundStationTestConfiguration test_configuration("test_ground_station_no_limit.ini", 1, 0.0);
+  GroundStationForTest ground_station(&test_configuration.configuration_);
+  const double ground_station_radius_m = ground_station.GetPosition_ecef_m().CalcNorm();
+  EXPECT_DOUBLE_EQ(ground_station_radius_m + 7.0e6, ground_station.CalcMaxSlantRange_m(7.0e6));
+}
+
+/**
+ * @brief Test for the visibility of the spacecraft in the spatial index compared with the check of all spacecraft
+ */
+TEST(GroundStation, UpdateVisibility) {
+  const unsigned int kNumberOfSpacecraft = 300;
+  GroundStationTestConfiguration test_configuration("test_ground_station_visibility.ini", kNumberOfSpacecraft, 10.0);
+  GroundStationForTest ground_station(&test_configuration.configuration_);
+  const double ground_station_radius_m = ground_station.GetPosition_ecef_m().CalcNorm();
+
+  // The first spacecraft are at the zenith, over the elevation limit, under the limit, and on the other side of the earth
+  std::vector<EcefOrbitForTest> orbits(kNumberOfSpacecraft);
+  const double orbit_radius_m = ground_station_radius_m + 500.0e3;
+  orbits[0].SetPosition_ecef_m(CalcPositionAtElevation_ecef_m(ground_station_radius_m, orbit_radius_m, 90.0 * libra::deg_to_rad));
+  orbits[1].SetPosition_ecef_m(CalcPositionAtElevation_ecef_m(ground_station_radius_m, orbit_radius_m, 11.0 * libra::deg_to_rad));
+  orbits[2].SetPosition_ecef_m(CalcPositionAtElevation_ecef_m(ground_station_radius_m, orbit_radius_m, 9.0 * libra::deg_to_rad));
+  orbits[3].SetPosition_ecef_m(-1.0 * CalcPositionAtElevation_ecef_m(ground_station_radius_m, orbit_radius_m, 90.0 * libra::deg_to_rad));
+  // The others are distributed in the LEO around the ground station
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> angle_distribution(-0.5, 0.5);
+  std::uniform_real_distribution<double> radius_distribution(ground_station_radius_m + 300.0e3, ground_station_radius_m + 2000.0e3);
+  for (unsigned int id = 4; id < kNumberOfSpacecraft; id++) {
+    const double latitude_rad = angle_distribution(generator);
+    const double longitude_rad = angle_distribution(generator);
+    const double radius_m = radius_distribution(generator);
+    libra::Vector<3> position_ecef_m;
+    position_ecef_m[0] = radius_m * cos(latitude_rad) * cos(longitude_rad);
+    position_ecef_m[1] = radius_m * cos(latitude_rad) * sin(longitude_rad);
+    position_ecef_m[2] = radius_m * sin(latitude_rad);
+    orbits[id].SetPosition_ecef_m(position_ecef_m);
+  }
+
+  SpacecraftSpatialIndex spatial_index;
+  for (unsigned int id = 0; id < kNumberOfSpacecraft; id++) {
+    spatial_index.RegisterOrbit(id, &orbits[id]);
+  }
+  spatial_index.Update();
+  const CelestialRotation earth_rotation(RotationMode::kIdle, "EARTH");
+  ground_station.UpdateVisibility(earth_rotation, spatial_index);
+
+  EXPECT_TRUE(ground_station.IsVisible(0));
+  EXPECT_TRUE(ground_station.IsVisible(1));
+  EXPECT_FALSE(ground_station.IsVisible(2));
+  EXPECT_FALSE(ground_station.IsVisible(3));
+  unsigned int number_of_visible_spacecraft = 0;
+  for (unsigned int id = 0; id < kNumberOfSpacecraft; id++) {
+    const bool is_visible = ground_station.CalcIsVisible(orbits[id].GetPosition_ecef_m());
+    EXPECT_EQ(is_visible, ground_station.IsVisible(id)) << "spacecraft " << id;
+    if (is_visible) number_of_visible_spacecraft++;
+  }
+  EXPECT_LT(10, number_of_visible_spacecraft);
+  EXPECT_GT(kNumberOfSpacecraft - 10, number_of_visible_spacecraft);
+
+  // The visibility is cleared for the spacecraft leaving the range
+  orbits[0].SetPosition_ecef_m(-1.0 * orbits[0].GetPosition_ecef_m());
+  spatial_index.Update();
+  ground_station.UpdateVisibility(earth_rotation, spatial_index);
+  EXPECT_FALSE(ground_station.IsVisible(0));
+  EXPECT_TRUE(ground_station.IsVisible(1));
+}
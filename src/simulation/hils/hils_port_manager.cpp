@@ -7,6 +7,10 @@
 
 #include <library/utilities/macros.hpp>
 
+#if defined(USE_HILS) && !defined(WIN32)
+#include <components/ports/hils_epoll_service.hpp>
+#endif
+
 // #define HILS_PORT_MANAGER_SHOW_DEBUG_DATA
 
 HilsPortManager::HilsPortManager() {}
@@ -16,7 +20,11 @@ HilsPortManager::~HilsPortManager() {}
 // UART Communication port functions
 int HilsPortManager::UartConnectComPort(unsigned int port_id, unsigned int baud_rate, unsigned int tx_buffer_size, unsigned int rx_buffer_size) {
 #ifdef USE_HILS
-  if (uart_ports_[port_id] != nullptr) {
+  if (!PortTable<HilsUartPort>::IsValid(port_id)) {
+    printf("Error: Illegal port ID\n");
+    return -1;
+  }
+  if (uart_ports_.Get(port_id) != nullptr) {
     printf("Error: Port is already used\n");
     return -1;
   }
@@ -24,7 +32,7 @@ int HilsPortManager::UartConnectComPort(unsigned int port_id, unsigned int baud_
     printf("Error: Illegal parameter\n");
     return -1;
   }
-  uart_ports_[port_id] = new HilsUartPort(port_id, baud_rate, tx_buffer_size, rx_buffer_size);
+  uart_ports_.Add(port_id, new HilsUartPort(port_id, baud_rate, tx_buffer_size, rx_buffer_size));
   return 0;
 #else
   UNUSED(port_id);
@@ -39,15 +47,14 @@ int HilsPortManager::UartConnectComPort(unsigned int port_id, unsigned int baud_
 // Close port and free resources
 int HilsPortManager::UartCloseComPort(unsigned int port_id) {
 #ifdef USE_HILS
-  if (uart_ports_[port_id] == nullptr) {
+  HilsUartPort* port = uart_ports_.Remove(port_id);
+  if (port == nullptr) {
     // Port not used
     return -1;
   }
 
-  uart_ports_[port_id]->ClosePort();
-  HilsUartPort* port = uart_ports_.at(port_id);
+  port->ClosePort();
   delete port;
-  uart_ports_.erase(port_id);
   return 0;
 #else
   UNUSED(port_id);
@@ -58,7 +65,7 @@ int HilsPortManager::UartCloseComPort(unsigned int port_id) {
 
 int HilsPortManager::UartReceive(unsigned int port_id, unsigned char* buffer, int offset, int length) {
 #ifdef USE_HILS
-  HilsUartPort* port = uart_ports_[port_id];
+  HilsUartPort* port = uart_ports_.Get(port_id);
   if (port == nullptr) return -1;
   int ret = port->ReadRx(buffer, offset, length);
 #ifdef HILS_PORT_MANAGER_SHOW_DEBUG_DATA
@@ -81,9 +88,42 @@ int HilsPortManager::UartReceive(unsigned int port_id, unsigned char* buffer, in
 #endif
 }
 
+int HilsPortManager::UartPeekReceived(unsigned int port_id, RingBufferSpan& span) {
+  span = RingBufferSpan{nullptr, 0, nullptr, 0};
+#if defined(USE_HILS) && !defined(WIN32)
+  HilsUartPort* port = uart_ports_.Get(port_id);
+  if (port == nullptr) return -1;
+  span = port->PeekRx();
+  return (int)span.GetSize();
+#elif defined(USE_HILS)
+  UNUSED(port_id);
+
+  printf("Error: UartPeekReceived is not supported on Windows. Use UartReceive.\n");
+  return -1;
+#else
+  UNUSED(port_id);
+
+  return -1;
+#endif
+}
+
+int HilsPortManager::UartCommitReceived(unsigned int port_id, unsigned int length) {
+#if defined(USE_HILS) && !defined(WIN32)
+  HilsUartPort* port = uart_ports_.Get(port_id);
+  if (port == nullptr) return -1;
+  port->CommitRx(length);
+  return 0;
+#else
+  UNUSED(port_id);
+  UNUSED(length);
+
+  return -1;
+#endif
+}
+
 int HilsPortManager::UartSend(unsigned int port_id, const unsigned char* buffer, int offset, int length) {
 #ifdef USE_HILS
-  HilsUartPort* port = uart_ports_[port_id];
+  HilsUartPort* port = uart_ports_.Get(port_id);
   if (port == nullptr) return -1;
   int ret = port->WriteTx(buffer, offset, length);
 #ifdef HILS_PORT_MANAGER_SHOW_DEBUG_DATA
@@ -106,15 +146,34 @@ int HilsPortManager::UartSend(unsigned int port_id, const unsigned char* buffer,
 #endif
 }
 
+void HilsPortManager::HoldUartSend() {
+#if defined(USE_HILS) && !defined(WIN32)
+  // The I/O thread is not started without the ports
+  if (HilsEpollService::IsCreated()) HilsEpollService::GetInstance().HoldSendRequests();
+#endif
+}
+
+void HilsPortManager::FlushUartSend() {
+#if defined(USE_HILS) && !defined(WIN32)
+  // The I/O thread is not started without the ports
+  if (HilsEpollService::IsCreated()) HilsEpollService::GetInstance().FlushSendRequests();
+#endif
+}
+
 // I2C Target Communication port functions
 int HilsPortManager::I2cTargetConnectComPort(unsigned int port_id) {
 #ifdef USE_HILS
-  if (i2c_ports_[port_id] != nullptr) {
+  if (!PortTable<HilsI2cTargetPort>::IsValid(port_id)) {
+    printf("Error: Illegal port ID\n");
+    return -1;
+  }
+  if (i2c_ports_.Get(port_id) != nullptr) {
     printf("Error: Port is already used\n");
     return -1;
   }
-  i2c_ports_[port_id] = new HilsI2cTargetPort(port_id);
-  i2c_ports_[port_id]->RegisterDevice();
+  HilsI2cTargetPort* port = new HilsI2cTargetPort(port_id);
+  i2c_ports_.Add(port_id, port);
+  port->RegisterDevice();
   return 0;
 #else
   UNUSED(port_id);
@@ -125,14 +184,13 @@ int HilsPortManager::I2cTargetConnectComPort(unsigned int port_id) {
 
 int HilsPortManager::I2cTargetCloseComPort(unsigned int port_id) {
 #ifdef USE_HILS
-  if (i2c_ports_[port_id] == nullptr) {
+  HilsI2cTargetPort* port = i2c_ports_.Remove(port_id);
+  if (port == nullptr) {
     // Port not used
     return -1;
   }
-  i2c_ports_[port_id]->ClosePort();
-  HilsI2cTargetPort* port = i2c_ports_.at(port_id);
+  port->ClosePort();
   delete port;
-  i2c_ports_.erase(port_id);
   return 0;
 #else
   UNUSED(port_id);
@@ -144,7 +202,7 @@ int HilsPortManager::I2cTargetCloseComPort(unsigned int port_id) {
 int HilsPortManager::I2cTargetWriteRegister(unsigned int port_id, const unsigned char register_address, const unsigned char* data,
                                             const unsigned char length) {
 #ifdef USE_HILS
-  HilsI2cTargetPort* port = i2c_ports_[port_id];
+  HilsI2cTargetPort* port = i2c_ports_.Get(port_id);
   if (port == nullptr) return -1;
   for (unsigned char i = 0; i < length; i++) {
     port->WriteRegister(register_address + i, data[i]);
@@ -163,7 +221,7 @@ int HilsPortManager::I2cTargetWriteRegister(unsigned int port_id, const unsigned
 int HilsPortManager::I2cTargetReadRegister(unsigned int port_id, const unsigned char register_address, unsigned char* data,
                                            const unsigned char length) {
 #ifdef USE_HILS
-  HilsI2cTargetPort* port = i2c_ports_[port_id];
+  HilsI2cTargetPort* port = i2c_ports_.Get(port_id);
   if (port == nullptr) return -1;
   for (unsigned char i = 0; i < length; i++) {
     data[i] = port->ReadRegister(register_address + i);
@@ -181,7 +239,7 @@ int HilsPortManager::I2cTargetReadRegister(unsigned int port_id, const unsigned
 
 int HilsPortManager::I2cTargetReadCommand(unsigned int port_id, unsigned char* data, const unsigned char length) {
 #ifdef USE_HILS
-  HilsI2cTargetPort* port = i2c_ports_[port_id];
+  HilsI2cTargetPort* port = i2c_ports_.Get(port_id);
   if (port == nullptr) return -1;
   port->ReadCommand(data, length);
   return 0;
@@ -196,7 +254,7 @@ int HilsPortManager::I2cTargetReadCommand(unsigned int port_id, unsigned char* d
 
 int HilsPortManager::I2cTargetReceive(unsigned int port_id) {
 #ifdef USE_HILS
-  HilsI2cTargetPort* port = i2c_ports_[port_id];
+  HilsI2cTargetPort* port = i2c_ports_.Get(port_id);
   if (port == nullptr) return -1;
   int ret = port->Receive();
 #ifdef HILS_PORT_MANAGER_SHOW_DEBUG_DATA
@@ -214,7 +272,7 @@ int HilsPortManager::I2cTargetReceive(unsigned int port_id) {
 
 int HilsPortManager::I2cTargetSend(unsigned int port_id, const unsigned char length) {
 #ifdef USE_HILS
-  HilsI2cTargetPort* port = i2c_ports_[port_id];
+  HilsI2cTargetPort* port = i2c_ports_.Get(port_id);
   if (port == nullptr) return -1;
   int ret = port->Send(length);
 #ifdef HILS_PORT_MANAGER_SHOW_DEBUG_DATA
@@ -233,7 +291,7 @@ int HilsPortManager::I2cTargetSend(unsigned int port_id, const unsigned char len
 
 int HilsPortManager::I2cTargetGetStoredFrameCounter(unsigned int port_id) {
 #ifdef USE_HILS
-  HilsI2cTargetPort* port = i2c_ports_[port_id];
+  HilsI2cTargetPort* port = i2c_ports_.Get(port_id);
   if (port == nullptr) return -1;
   return port->GetStoredFrameCounter();
 #else
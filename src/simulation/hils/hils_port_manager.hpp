@@ -6,11 +6,13 @@
 #ifndef S2E_SIMULATION_HILS_HILS_PORT_MANAGER_HPP_
 #define S2E_SIMULATION_HILS_HILS_PORT_MANAGER_HPP_
 
+#include <library/utilities/ring_buffer.hpp>
+
 #ifdef USE_HILS
-#include "ports/hils_i2c_target_port.hpp"
-#include "ports/hils_uart_port.hpp"
+#include <components/ports/hils_i2c_target_port.hpp>
+#include <components/ports/hils_uart_port.hpp>
+#include <components/ports/port_table.hpp>
 #endif
-#include <map>
 
 /**
  * @class HilsPortManager
@@ -54,6 +56,23 @@ class HilsPortManager {
    * @param [in] length: Length of data to receive
    */
   virtual int UartReceive(unsigned int port_id, unsigned char* buffer, int offset, int length);
+  /**
+   * @fn UartPeekReceived
+   * @brief Return the data received from COM port without copying. The data is kept until UartCommitReceived is called.
+   * @note It is supported only on Linux, where the received data is stored in the RX ring buffer of the port. Use UartReceive on Windows.
+   * @param [in] port_id: COM port ID
+   * @param [out] span: Received data
+   * @return Size of the received data: success, -1: error
+   */
+  virtual int UartPeekReceived(unsigned int port_id, RingBufferSpan& span);
+  /**
+   * @fn UartCommitReceived
+   * @brief Release the received data returned by UartPeekReceived
+   * @param [in] port_id: COM port ID
+   * @param [in] length: Length of the released data
+   * @return 0: success, -1: error
+   */
+  virtual int UartCommitReceived(unsigned int port_id, unsigned int length);
   /**
    * @fn UartSend
    * @brief UART data send from components in S2E to COM port (ex. OBC)
@@ -63,6 +82,17 @@ class HilsPortManager {
    * @param [in] length: Length of data to send
    */
   virtual int UartSend(unsigned int port_id, const unsigned char* buffer, int offset, int length);
+  /**
+   * @fn HoldUartSend
+   * @brief Hold the data sent by UartSend until FlushUartSend, so that the data of all ports in a step is written with one wakeup of the I/O
+   *        thread. It is used only on Linux, where the ports are serviced by HilsEpollService.
+   */
+  static void HoldUartSend();
+  /**
+   * @fn FlushUartSend
+   * @brief Write the data held after HoldUartSend to the devices
+   */
+  static void FlushUartSend();
 
   // I2C Target Communication port functions
   /**
@@ -163,8 +193,8 @@ class HilsPortManager {
 
  private:
 #ifdef USE_HILS
-  std::map<int, HilsUartPort*> uart_ports_;      //!< UART ports
-  std::map<int, HilsI2cTargetPort*> i2c_ports_;  //!< I2C ports
+  PortTable<HilsUartPort> uart_ports_;      //!< UART ports
+  PortTable<HilsI2cTargetPort> i2c_ports_;  //!< I2C ports
 #endif
 };
 
@@ -0,0 +1,108 @@
+/**
+ * @file benchmark_monte_carlo_case_runner.cpp
+ * @brief Benchmark of the Monte-Carlo case execution with various numbers of workers
+ * @note Usage: benchmark_monte_carlo_case_runner [number of cases] [number of steps per case] [maximum number of workers]
+ *       Each case propagates a two-body orbit from the randomized initial velocity with RK4. The cases are executed with 1, 2, 4, ... workers in
+ *       THREAD and PROCESS modes. The default is 64 cases of 100000 steps with up to the number of hardware threads.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <library/math/vector.hpp>
+#include <thread>
+
+#include "monte_carlo_case_runner.hpp"
+
+/**
+ * @fn PropagateOrbit
+ * @brief Propagate two-body orbit with RK4
+ * @param [in] velocity_offset_m_s: Offset of the initial velocity [m/s]
+ * @param [in] number_of_steps: Number of steps
+ * @return Final radius [m]
+ */
+double PropagateOrbit(const libra::Vector<3>& velocity_offset_m_s, const int number_of_steps) {
+  const double kGravityConstant_m3_s2 = 3.986004418e14;
+  const double kStep_s = 1.0;
+  libra::Vector<3> position_m(0.0);
+  position_m[0] = 6928.0e3;
+  libra::Vector<3> velocity_m_s = velocity_offset_m_s;
+  velocity_m_s[1] += sqrt(kGravityConstant_m3_s2 / position_m[0]);
+
+  auto acceleration = [kGravityConstant_m3_s2](const libra::Vector<3>& position) {
+    const double radius = position.CalcNorm();
+    return (-kGravityConstant_m3_s2 / (radius * radius * radius)) * position;
+  };
+  for (int step = 0; step < number_of_steps; step++) {
+    const libra::Vector<3> k1_r = velocity_m_s;
+    const libra::Vector<3> k1_v = acceleration(position_m);
+    const libra::Vector<3> k2_r = velocity_m_s + 0.5 * kStep_s * k1_v;
+    const libra::Vector<3> k2_v = acceleration(position_m + 0.5 * kStep_s * k1_r);
+    const libra::Vector<3> k3_r = velocity_m_s + 0.5 * kStep_s * k2_v;
+    const libra::Vector<3> k3_v = acceleration(position_m + 0.5 * kStep_s * k2_r);
+    const libra::Vector<3> k4_r = velocity_m_s + kStep_s * k3_v;
+    const libra::Vector<3> k4_v = acceleration(position_m + kStep_s * k3_r);
+    position_m += kStep_s / 6.0 * (k1_r + 2.0 * k2_r + 2.0 * k3_r + k4_r);
+    velocity_m_s += kStep_s / 6.0 * (k1_v + 2.0 * k2_v + 2.0 * k3_v + k4_v);
+  }
+  return position_m.CalcNorm();
+}
+
+/**
+ * @fn main
+ * @brief Measure the number of cases per second for each number of workers
+ */
+int main(int argc, char* argv[]) {
+  int number_of_cases = 64;
+  int number_of_steps = 100000;
+  int max_number_of_workers = (int)std::thread::hardware_concurrency();
+  if (argc > 1) number_of_cases = atoi(argv[1]);
+  if (argc > 2) number_of_steps = atoi(argv[2]);
+  if (argc > 3) max_number_of_workers = atoi(argv[3]);
+  if (max_number_of_workers < 1) max_number_of_workers = 1;
+
+  const std::string file_path = "benchmark_monte_carlo_case_runner.ini";
+  {
+    std::ofstream ini_file(file_path);
+    ini_file << "[MONTE_CARLO_EXECUTION]" << std::endl;
+    ini_file << "monte_carlo_enable = ENABLE" << std::endl;
+    ini_file << "log_enable = DISABLE" << std::endl;
+    ini_file << "number_of_executions = " << number_of_cases << std::endl;
+    ini_file << "[MONTE_CARLO_RANDOMIZATION]" << std::endl;
+    ini_file << "parameter(0) = orbit.velocity_offset_m_s" << std::endl;
+    ini_file << "orbit.velocity_offset_m_s.randomization_type = CartesianNormal" << std::endl;
+    for (int i = 0; i < 3; i++) {
+      ini_file << "orbit.velocity_offset_m_s.mean_or_min(" << i << ") = 0.0" << std::endl;
+      ini_file << "orbit.velocity_offset_m_s.sigma_or_max(" << i << ") = 1.0" << std::endl;
+    }
+  }
+
+  const auto execute_case = [number_of_steps](MonteCarloSimulationExecutor& monte_carlo_simulator) {
+    libra::Vector<3> velocity_offset_m_s(0.0);
+    monte_carlo_simulator.GetInitializedMonteCarloParameterVector("orbit", "velocity_offset_m_s", velocity_offset_m_s);
+    volatile double radius_m = PropagateOrbit(velocity_offset_m_s, number_of_steps);
+    (void)radius_m;
+  };
+
+  std::cout << "Number of cases: " << number_of_cases << ", number of steps per case: " << number_of_steps << std::endl;
+  const MonteCarloParallelMode kModes[] = {MonteCarloParallelMode::kThread, MonteCarloParallelMode::kProcess};
+  const char* kModeNames[] = {"THREAD", "PROCESS"};
+  for (int mode = 0; mode < 2; mode++) {
+    double serial_time_s = 0.0;
+    for (int number_of_workers = 1; number_of_workers <= max_number_of_workers; number_of_workers *= 2) {
+      MonteCarloCaseRunner runner(file_path, number_of_workers, kModes[mode]);
+      const auto start = std::chrono::steady_clock::now();
+      runner.Run(execute_case);
+      const double time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      if (number_of_workers == 1) serial_time_s = time_s;
+      std::cout << kModeNames[mode] << ", " << runner.GetNumberOfWorkers() << " workers: " << number_of_cases / time_s << " cases/s, speedup "
+                << serial_time_s / time_s << std::endl;
+    }
+  }
+
+  remove(file_path.c_str());
+  return 0;
+}
@@ -9,18 +9,16 @@
 
 using namespace std;
 
-random_device InitializedMonteCarloParameters::randomizer_;
-mt19937 InitializedMonteCarloParameters::mt_;
-uniform_real_distribution<>* InitializedMonteCarloParameters::uniform_distribution_;
-normal_distribution<>* InitializedMonteCarloParameters::normal_distribution_;
+thread_local random_device InitializedMonteCarloParameters::randomizer_;
+thread_local mt19937 InitializedMonteCarloParameters::mt_;
+thread_local uniform_real_distribution<> InitializedMonteCarloParameters::uniform_distribution_(0.0, 1.0);
+thread_local normal_distribution<> InitializedMonteCarloParameters::normal_distribution_(0.0, 1.0);
 
 InitializedMonteCarloParameters::InitializedMonteCarloParameters() {
-  // Generate object when the first execution
-  static bool initial_setup_done = false;
+  // Set seed when the first execution in the thread
+  static thread_local bool initial_setup_done = false;
   if (!initial_setup_done) {
     SetSeed();
-    InitializedMonteCarloParameters::uniform_distribution_ = new uniform_real_distribution<>(0.0, 1.0);
-    InitializedMonteCarloParameters::normal_distribution_ = new normal_distribution<>(0.0, 1.0);
     initial_setup_done = true;
   }
 
@@ -95,11 +93,11 @@ void InitializedMonteCarloParameters::Randomize() {
 }
 
 double InitializedMonteCarloParameters::Generate1dUniform(double lb, double ub) {
-  return lb + (*InitializedMonteCarloParameters::uniform_distribution_)(InitializedMonteCarloParameters::mt_) * (ub - lb);
+  return lb + InitializedMonteCarloParameters::uniform_distribution_(InitializedMonteCarloParameters::mt_) * (ub - lb);
 }
 
 double InitializedMonteCarloParameters::Generate1dNormal(double mean, double std) {
-  return mean + (*InitializedMonteCarloParameters::normal_distribution_)(InitializedMonteCarloParameters::mt_) * (std);
+  return mean + InitializedMonteCarloParameters::normal_distribution_(InitializedMonteCarloParameters::mt_) * (std);
 }
 
 void InitializedMonteCarloParameters::GenerateNoRandomization() { randomized_value_.clear(); }
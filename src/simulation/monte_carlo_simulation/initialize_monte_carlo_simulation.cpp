@@ -93,3 +93,14 @@ MonteCarloSimulationExecutor* InitMonteCarloSimulation(std::string file_name) {
 
   return monte_carlo_simulator;
 }
+
+MonteCarloCaseRunner* InitMonteCarloCaseRunner(std::string file_name) {
+  IniAccess ini_file(file_name);
+  const char* section = "MONTE_CARLO_EXECUTION";
+
+  const unsigned int number_of_workers = ini_file.ReadInt(section, "number_of_workers");
+  const MonteCarloParallelMode mode = SetMonteCarloParallelMode(ini_file.ReadString(section, "parallel_mode"));
+  const unsigned long base_seed = ini_file.ReadInt(section, "base_seed");
+
+  return new MonteCarloCaseRunner(file_name, number_of_workers, mode, base_seed);
+}
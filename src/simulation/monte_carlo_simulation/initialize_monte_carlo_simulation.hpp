@@ -7,6 +7,7 @@
 #define S2E_SIMULATION_MONTE_CARLO_SIMULATION_INITIALIZE_MONTE_CARLO_SIMULATION_HPP_
 
 #include "initialize_monte_carlo_parameters.hpp"
+#include "monte_carlo_case_runner.hpp"
 #include "monte_carlo_simulation_executor.hpp"
 
 /**
@@ -15,4 +16,10 @@
  */
 MonteCarloSimulationExecutor* InitMonteCarloSimulation(std::string file_name);
 
+/**
+ * @fn InitMonteCarloCaseRunner
+ * @brief Initialize function for the parallel runner of Monte-Carlo simulation cases
+ */
+MonteCarloCaseRunner* InitMonteCarloCaseRunner(std::string file_name);
+
 #endif  // S2E_SIMULATION_MONTE_CARLO_SIMULATION_INITIALIZE_MONTE_CARLO_SIMULATION_HPP_
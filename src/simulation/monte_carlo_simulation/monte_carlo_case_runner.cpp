@@ -0,0 +1,223 @@
+/**
+ * @file monte_carlo_case_runner.cpp
+ * @brief Runner to execute Monte-Carlo simulation cases in parallel
+ */
+
+#include "monte_carlo_case_runner.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <library/randomization/global_randomization.hpp>
+#include <library/utilities/macros.hpp>
+#include <map>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include "initialize_monte_carlo_simulation.hpp"
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+MonteCarloParallelMode SetMonteCarloParallelMode(const std::string mode) {
+  if (mode == "THREAD") {
+    return MonteCarloParallelMode::kThread;
+  } else if (mode == "PROCESS") {
+    return MonteCarloParallelMode::kProcess;
+  } else {
+    std::cerr << "MonteCarloParallelMode: Unknown mode " << mode << ". THREAD is selected." << std::endl;
+    return MonteCarloParallelMode::kThread;
+  }
+}
+
+MonteCarloCaseRunner::MonteCarloCaseRunner(const std::string initialize_file, const unsigned int number_of_workers, const MonteCarloParallelMode mode,
+                                           const unsigned long base_seed)
+    : initialize_file_(initialize_file), number_of_workers_(number_of_workers), mode_(mode), base_seed_(base_seed) {
+  MonteCarloSimulationExecutor* monte_carlo_simulator = InitMonteCarloSimulation(initialize_file_);
+  // Only one case is executed when the Monte-Carlo simulation is disabled
+  is_monte_carlo_enabled_ = monte_carlo_simulator->IsEnabled();
+  number_of_cases_ = is_monte_carlo_enabled_ ? monte_carlo_simulator->GetTotalNumberOfExecutions() : 1;
+  delete monte_carlo_simulator;
+
+  if (number_of_workers_ == 0) number_of_workers_ = std::thread::hardware_concurrency();
+  if (number_of_workers_ == 0) number_of_workers_ = 1;
+  if (number_of_workers_ > number_of_cases_) number_of_workers_ = (unsigned int)number_of_cases_;
+}
+
+void MonteCarloCaseRunner::Run(const CaseFunction& execute_case) {
+  if (mode_ == MonteCarloParallelMode::kProcess && number_of_workers_ > 1) {
+    RunWithProcesses(execute_case);
+  } else {
+    RunWithThreads(execute_case);
+  }
+}
+
+void MonteCarloCaseRunner::Run(const CaseFunctionWithResult& execute_case, const ResultFunction& receive_result) {
+#ifndef WIN32
+  if (mode_ == MonteCarloParallelMode::kProcess && number_of_workers_ > 1) {
+    RunWithProcessesAndResults(execute_case, receive_result);
+    return;
+  }
+#endif
+  std::mutex result_mutex;
+  Run([&](MonteCarloSimulationExecutor& monte_carlo_simulator) {
+    const std::string result = execute_case(monte_carlo_simulator);
+    std::lock_guard<std::mutex> lock(result_mutex);
+    receive_result(monte_carlo_simulator.GetNumberOfExecutionsDone(), result);
+  });
+}
+
+unsigned long MonteCarloCaseRunner::CalcCaseSeed(const unsigned long base_seed, const unsigned long long case_id) {
+  // SplitMix64
+  unsigned long long z = (unsigned long long)base_seed + (case_id + 1) * 0x9e3779b97f4a7c15ULL;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  z = z ^ (z >> 31);
+  // Keep the seed in 32 bit to get the same value on all platforms
+  return (unsigned long)(z & 0xffffffffULL);
+}
+
+void MonteCarloCaseRunner::ExecuteCase(const unsigned long long case_id, const CaseFunction& execute_case) const {
+  MonteCarloSimulationExecutor* monte_carlo_simulator = InitMonteCarloSimulation(initialize_file_);
+  monte_carlo_simulator->SetNumberOfExecutionsDone(case_id);
+
+  // The random generators are held in each thread, so they are initialized for each case.
+  // The seeds are kept when the Monte-Carlo simulation is disabled to get the same result with the single case execution.
+  if (is_monte_carlo_enabled_) {
+    const unsigned long seed = CalcCaseSeed(base_seed_, case_id);
+    MonteCarloSimulationExecutor::SetSeed(seed, true);
+    global_randomization.SetSeed((long)(seed % 2147483646UL) + 1);  // The seed of the LCG should be in [1, 2^31 - 2]
+    monte_carlo_simulator->RandomizeAllParameters();
+  }
+
+  execute_case(*monte_carlo_simulator);
+
+  delete monte_carlo_simulator;
+}
+
+void MonteCarloCaseRunner::ExecuteCasesInWorker(std::atomic<unsigned long long>& next_case_id, const CaseFunction& execute_case) const {
+  while (true) {
+    const unsigned long long case_id = next_case_id.fetch_add(1);
+    if (case_id >= number_of_cases_) break;
+    ExecuteCase(case_id, execute_case);
+  }
+}
+
+void MonteCarloCaseRunner::RunWithThreads(const CaseFunction& execute_case) const {
+  std::atomic<unsigned long long> next_case_id(0);
+  if (number_of_workers_ <= 1) {
+    // Execute in the caller thread to keep the behavior of the serial execution
+    ExecuteCasesInWorker(next_case_id, execute_case);
+    return;
+  }
+
+  std::vector<std::thread> workers;
+  for (unsigned int i = 0; i < number_of_workers_; i++) {
+    workers.emplace_back([this, &next_case_id, &execute_case]() { ExecuteCasesInWorker(next_case_id, execute_case); });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+void MonteCarloCaseRunner::RunWithProcesses(const CaseFunction& execute_case) const {
+#ifdef WIN32
+  std::cerr << "MonteCarloCaseRunner: PROCESS mode is not supported on Windows. THREAD mode is used." << std::endl;
+  RunWithThreads(execute_case);
+#else
+  // The case counter is placed in the memory shared with the forked processes
+  const size_t shared_memory_size = sizeof(std::atomic<unsigned long long>);
+  void* shared_memory = mmap(NULL, shared_memory_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (shared_memory == MAP_FAILED) {
+    std::cerr << "MonteCarloCaseRunner: Shared memory allocation error. THREAD mode is used." << std::endl;
+    RunWithThreads(execute_case);
+    return;
+  }
+  std::atomic<unsigned long long>* next_case_id = new (shared_memory) std::atomic<unsigned long long>(0);
+
+  // Flush the buffers not to output them in each process
+  std::cout.flush();
+  std::cerr.flush();
+  fflush(NULL);
+
+  std::vector<pid_t> workers;
+  for (unsigned int i = 0; i < number_of_workers_; i++) {
+    pid_t pid = fork();
+    if (pid == 0) {
+      ExecuteCasesInWorker(*next_case_id, execute_case);
+      std::cout.flush();
+      fflush(NULL);
+      _exit(EXIT_SUCCESS);
+    } else if (pid < 0) {
+      std::cerr << "MonteCarloCaseRunner: Fork error of the worker " << i << std::endl;
+    } else {
+      workers.push_back(pid);
+    }
+  }
+  // Execute the remaining cases in this process when no worker is forked
+  if (workers.empty()) ExecuteCasesInWorker(*next_case_id, execute_case);
+
+  for (auto pid : workers) {
+    int status;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) {
+      std::cerr << "MonteCarloCaseRunner: Worker process " << pid << " is terminated abnormally." << std::endl;
+    }
+  }
+
+  next_case_id->~atomic();
+  munmap(shared_memory, shared_memory_size);
+#endif
+}
+
+void MonteCarloCaseRunner::RunWithProcessesAndResults(const CaseFunctionWithResult& execute_case, const ResultFunction& receive_result) const {
+#ifdef WIN32
+  UNUSED(execute_case);
+  UNUSED(receive_result);
+#else
+  // The records of the cases are appended to the file shared with the worker processes.
+  // Each record is written with a write call to the file opened in the append mode not to be mixed with the records of the other workers.
+  FILE* result_file = tmpfile();
+  const int result_fd = result_file == NULL ? -1 : fileno(result_file);
+  if (result_fd < 0 || fcntl(result_fd, F_SETFL, fcntl(result_fd, F_GETFL) | O_APPEND) < 0) {
+    std::cerr << "MonteCarloCaseRunner: Temporary file error. The results of the worker processes are not received." << std::endl;
+    if (result_file != NULL) fclose(result_file);
+    RunWithProcesses([&execute_case](MonteCarloSimulationExecutor& monte_carlo_simulator) { execute_case(monte_carlo_simulator); });
+    return;
+  }
+
+  RunWithProcesses([&execute_case, result_fd](MonteCarloSimulationExecutor& monte_carlo_simulator) {
+    const std::string result = execute_case(monte_carlo_simulator);
+    const unsigned long long record_header[2] = {monte_carlo_simulator.GetNumberOfExecutionsDone(), (unsigned long long)result.size()};
+    std::string record(reinterpret_cast<const char*>(record_header), sizeof(record_header));
+    record += result;
+    if (write(result_fd, record.data(), record.size()) != (ssize_t)record.size()) {
+      std::cerr << "MonteCarloCaseRunner: Write error of the result of the case " << record_header[0] << std::endl;
+    }
+  });
+
+  // Read the records after all workers finish, and pass them in the case ID order
+  std::map<unsigned long long, std::string> results;
+  rewind(result_file);
+  unsigned long long record_header[2];
+  while (fread(record_header, sizeof(record_header), 1, result_file) == 1) {
+    std::string result(record_header[1], '\0');
+    if (record_header[1] > 0 && fread(&result[0], record_header[1], 1, result_file) != 1) break;
+    results[record_header[0]] = result;
+  }
+  fclose(result_file);
+
+  if (results.size() != number_of_cases_) {
+    std::cerr << "MonteCarloCaseRunner: Results of " << number_of_cases_ - results.size() << " cases are not received." << std::endl;
+  }
+  for (const auto& result : results) {
+    receive_result(result.first, result.second);
+  }
+#endif
+}
@@ -0,0 +1,155 @@
+/**
+ * @file monte_carlo_case_runner.hpp
+ * @brief Runner to execute Monte-Carlo simulation cases in parallel
+ */
+
+#ifndef S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_CASE_RUNNER_HPP_
+#define S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_CASE_RUNNER_HPP_
+
+#include <atomic>
+#include <functional>
+#include <string>
+
+#include "monte_carlo_simulation_executor.hpp"
+
+/**
+ * @enum MonteCarloParallelMode
+ * @brief Parallelization mode of the Monte-Carlo simulation cases
+ */
+enum class MonteCarloParallelMode {
+  kThread,   //!< Worker threads in the process. SimulationObject list and random generators are held in each thread.
+  kProcess,  //!< Forked worker processes for the components which have process global states (e.g. C2A, HILS, CSV scenario)
+};
+
+/**
+ * @fn SetMonteCarloParallelMode
+ * @brief Convert string to MonteCarloParallelMode
+ * @param [in] mode: Name of the mode (THREAD or PROCESS)
+ */
+MonteCarloParallelMode SetMonteCarloParallelMode(const std::string mode);
+
+/**
+ * @class MonteCarloCaseRunner
+ * @brief Runner to execute Monte-Carlo simulation cases with multiple workers
+ * @details Each case has its own MonteCarloSimulationExecutor whose parameters are randomized with the seed calculated from the base seed and
+ *          the case ID, so the randomized parameters do not depend on the number of workers and the execution order.
+ *          The cases are dynamically assigned to the workers one by one to balance the load.
+ */
+class MonteCarloCaseRunner {
+ public:
+  /**
+   * @typedef CaseFunction
+   * @brief Function to execute a simulation case with the randomized executor
+   * @note The function should make own SimulationCase and Logger with the executor. The case ID is GetNumberOfExecutionsDone() of the executor.
+   */
+  typedef std::function<void(MonteCarloSimulationExecutor& monte_carlo_simulator)> CaseFunction;
+  /**
+   * @typedef CaseFunctionWithResult
+   * @brief Function to execute a simulation case with the randomized executor and return the result of the case
+   */
+  typedef std::function<std::string(MonteCarloSimulationExecutor& monte_carlo_simulator)> CaseFunctionWithResult;
+  /**
+   * @typedef ResultFunction
+   * @brief Function to receive the result of a case in the caller process
+   * @note The calls are serialized. They are in the completion order of the cases in THREAD mode, and in the case ID order after all cases
+   *       in PROCESS mode since the results are passed from the worker processes.
+   */
+  typedef std::function<void(const unsigned long long case_id, const std::string& result)> ResultFunction;
+
+  /**
+   * @fn MonteCarloCaseRunner
+   * @brief Constructor
+   * @param [in] initialize_file: Path to the initialize file of the Monte-Carlo simulation
+   * @param [in] number_of_workers: Number of workers. 0 means the number of hardware threads.
+   * @param [in] mode: Parallelization mode
+   * @param [in] base_seed: Base seed of the randomization
+   */
+  MonteCarloCaseRunner(const std::string initialize_file, const unsigned int number_of_workers = 1,
+                       const MonteCarloParallelMode mode = MonteCarloParallelMode::kThread, const unsigned long base_seed = 0);
+
+  /**
+   * @fn Run
+   * @brief Execute all simulation cases
+   * @param [in] execute_case: Function to execute a simulation case
+   */
+  void Run(const CaseFunction& execute_case);
+  /**
+   * @fn Run
+   * @brief Execute all simulation cases and pass the results to the caller process
+   * @param [in] execute_case: Function to execute a simulation case and return the result
+   * @param [in] receive_result: Function to receive the result of a case
+   */
+  void Run(const CaseFunctionWithResult& execute_case, const ResultFunction& receive_result);
+
+  // Getter
+  /**
+   * @fn GetNumberOfCases
+   * @brief Return number of simulation cases
+   */
+  inline unsigned long long GetNumberOfCases() const { return number_of_cases_; }
+  /**
+   * @fn GetNumberOfWorkers
+   * @brief Return number of workers
+   */
+  inline unsigned int GetNumberOfWorkers() const { return number_of_workers_; }
+  /**
+   * @fn IsMonteCarloEnabled
+   * @brief Return true when the Monte-Carlo simulation is enabled. Only one case without the randomization is executed when it is disabled.
+   */
+  inline bool IsMonteCarloEnabled() const { return is_monte_carlo_enabled_; }
+  /**
+   * @fn UsesWorkerProcesses
+   * @brief Return true when the cases are executed in forked worker processes, which do not share the memory with the caller
+   */
+  inline bool UsesWorkerProcesses() const { return mode_ == MonteCarloParallelMode::kProcess && number_of_workers_ > 1; }
+
+  /**
+   * @fn CalcCaseSeed
+   * @brief Calculate the seed of the case from the base seed and the case ID
+   * @note SplitMix64 hash is used to decorrelate the seeds of the neighboring cases.
+   * @param [in] base_seed: Base seed of the randomization
+   * @param [in] case_id: Case ID
+   */
+  static unsigned long CalcCaseSeed(const unsigned long base_seed, const unsigned long long case_id);
+
+ private:
+  std::string initialize_file_;         //!< Path to the initialize file of the Monte-Carlo simulation
+  unsigned long long number_of_cases_;  //!< Number of simulation cases
+  bool is_monte_carlo_enabled_;         //!< Whether the Monte-Carlo simulation is enabled
+  unsigned int number_of_workers_;      //!< Number of workers
+  MonteCarloParallelMode mode_;         //!< Parallelization mode
+  unsigned long base_seed_;             //!< Base seed of the randomization
+
+  /**
+   * @fn ExecuteCase
+   * @brief Randomize the parameters and execute a simulation case
+   * @param [in] case_id: Case ID
+   * @param [in] execute_case: Function to execute a simulation case
+   */
+  void ExecuteCase(const unsigned long long case_id, const CaseFunction& execute_case) const;
+  /**
+   * @fn ExecuteCasesInWorker
+   * @brief Execute cases in a worker until all cases are taken
+   * @param [in] next_case_id: Shared counter of the next case ID
+   * @param [in] execute_case: Function to execute a simulation case
+   */
+  void ExecuteCasesInWorker(std::atomic<unsigned long long>& next_case_id, const CaseFunction& execute_case) const;
+  /**
+   * @fn RunWithThreads
+   * @brief Execute all cases with worker threads
+   */
+  void RunWithThreads(const CaseFunction& execute_case) const;
+  /**
+   * @fn RunWithProcesses
+   * @brief Execute all cases with forked worker processes
+   * @note Executed with threads on Windows since fork is not supported.
+   */
+  void RunWithProcesses(const CaseFunction& execute_case) const;
+  /**
+   * @fn RunWithProcessesAndResults
+   * @brief Execute all cases with forked worker processes and pass the results through a temporary file
+   */
+  void RunWithProcessesAndResults(const CaseFunctionWithResult& execute_case, const ResultFunction& receive_result) const;
+};
+
+#endif  // S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_CASE_RUNNER_HPP_
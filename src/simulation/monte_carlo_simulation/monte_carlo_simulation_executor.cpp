@@ -14,6 +14,12 @@ MonteCarloSimulationExecutor::MonteCarloSimulationExecutor(unsigned long long to
   save_log_history_flag_ = !enabled_;
 }
 
+MonteCarloSimulationExecutor::~MonteCarloSimulationExecutor() {
+  for (auto parameter : init_parameter_list_) {
+    delete parameter.second;
+  }
+}
+
 bool MonteCarloSimulationExecutor::WillExecuteNextCase() {
   if (!enabled_) {
     return (number_of_executions_done_ < 1);
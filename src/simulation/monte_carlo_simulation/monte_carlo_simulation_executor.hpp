@@ -33,6 +33,11 @@ class MonteCarloSimulationExecutor {
    * @brief Constructor
    */
   MonteCarloSimulationExecutor(unsigned long long total_num_of_executions);
+  /**
+   * @fn ~MonteCarloSimulationExecutor
+   * @brief Destructor
+   */
+  ~MonteCarloSimulationExecutor();
 
   // Setter
   /**
@@ -50,6 +55,11 @@ class MonteCarloSimulationExecutor {
    * @brief Set log history flag
    */
   inline void SetSaveLogHistoryFlag(bool set) { save_log_history_flag_ = set; }
+  /**
+   * @fn SetNumberOfExecutionsDone
+   * @brief Set number of executed case. Used as the case ID when the cases are executed in parallel.
+   */
+  inline void SetNumberOfExecutionsDone(unsigned long long number_of_executions_done) { number_of_executions_done_ = number_of_executions_done; }
   /**
    * @fn SetSeed
    * @brief Set seed of randomization. Use time infomation when is_deterministic = false.
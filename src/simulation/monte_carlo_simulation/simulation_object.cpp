@@ -5,7 +5,7 @@
 
 #include "simulation_object.hpp"
 
-std::map<std::string, SimulationObject*> SimulationObject::object_list_;
+thread_local std::map<std::string, SimulationObject*> SimulationObject::object_list_;
 
 SimulationObject::SimulationObject(std::string name) : name_(name) {
   // Check the name is already registered in so_list
@@ -0,0 +1,144 @@
+/**
+ * @file test_monte_carlo_case_runner.cpp
+ * @brief Test codes for MonteCarloCaseRunner class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "monte_carlo_case_runner.hpp"
+
+/**
+ * @brief Write a test ini file for the Monte-Carlo simulation
+ */
+void WriteMonteCarloTestIniFile(const std::string file_path, const unsigned int number_of_executions) {
+  std::ofstream ini_file(file_path);
+  ini_file << "[MONTE_CARLO_EXECUTION]" << std::endl;
+  ini_file << "monte_carlo_enable = ENABLE" << std::endl;
+  ini_file << "log_enable = DISABLE" << std::endl;
+  ini_file << "number_of_executions = " << number_of_executions << std::endl;
+  ini_file << "[MONTE_CARLO_RANDOMIZATION]" << std::endl;
+  ini_file << "parameter(0) = object.value" << std::endl;
+  ini_file << "object.value.randomization_type = CartesianUniform" << std::endl;
+  for (int i = 0; i < 3; i++) {
+    ini_file << "object.value.mean_or_min(" << i << ") = 0.0" << std::endl;
+    ini_file << "object.value.sigma_or_max(" << i << ") = 1.0" << std::endl;
+  }
+}
+
+/**
+ * @brief Execute all cases and return the randomized value of each case
+ */
+std::vector<double> RunMonteCarloTestCases(const std::string file_path, const unsigned int number_of_workers) {
+  MonteCarloCaseRunner runner(file_path, number_of_workers, MonteCarloParallelMode::kThread, 12345);
+  std::vector<double> values(runner.GetNumberOfCases(), -1.0);
+  std::vector<int> execution_counts(runner.GetNumberOfCases(), 0);
+  std::mutex mutex;
+
+  runner.Run([&](MonteCarloSimulationExecutor& monte_carlo_simulator) {
+    libra::Vector<3> value(-1.0);
+    monte_carlo_simulator.GetInitializedMonteCarloParameterVector("object", "value", value);
+    std::lock_guard<std::mutex> lock(mutex);
+    const unsigned long long case_id = monte_carlo_simulator.GetNumberOfExecutionsDone();
+    values[case_id] = value[0];
+    execution_counts[case_id]++;
+  });
+
+  for (size_t case_id = 0; case_id < execution_counts.size(); case_id++) {
+    EXPECT_EQ(1, execution_counts[case_id]);
+  }
+  return values;
+}
+
+/**
+ * @brief Execute all cases and return the results received from the cases in the received order
+ */
+std::vector<std::pair<unsigned long long, std::string>> RunMonteCarloTestCasesWithResults(const std::string file_path,
+                                                                                          const unsigned int number_of_workers,
+                                                                                          const MonteCarloParallelMode mode) {
+  MonteCarloCaseRunner runner(file_path, number_of_workers, mode, 12345);
+  std::vector<std::pair<unsigned long long, std::string>> results;
+
+  runner.Run(
+      [](MonteCarloSimulationExecutor& monte_carlo_simulator) {
+        libra::Vector<3> value(-1.0);
+        monte_carlo_simulator.GetInitializedMonteCarloParameterVector("object", "value", value);
+        char result[64];
+        snprintf(result, sizeof(result), "%llu,%.17g", monte_carlo_simulator.GetNumberOfExecutionsDone(), value[0]);
+        return std::string(result);
+      },
+      [&](const unsigned long long case_id, const std::string& result) { results.push_back(std::make_pair(case_id, result)); });
+  return results;
+}
+
+/**
+ * @brief Test for the seed of each case
+ */
+TEST(MonteCarloCaseRunner, CalcCaseSeed) {
+  // Same seed for the same base seed and case ID on all platforms
+  EXPECT_EQ(2065550767UL, MonteCarloCaseRunner::CalcCaseSeed(0, 0));
+  EXPECT_EQ(2713282036UL, MonteCarloCaseRunner::CalcCaseSeed(0, 1));
+  EXPECT_EQ(1746941724UL, MonteCarloCaseRunner::CalcCaseSeed(12345, 7));
+  EXPECT_EQ(MonteCarloCaseRunner::CalcCaseSeed(12345, 7), MonteCarloCaseRunner::CalcCaseSeed(12345, 7));
+
+  // Different seeds for the neighboring cases and base seeds
+  std::set<unsigned long> seeds;
+  for (unsigned long long case_id = 0; case_id < 1000; case_id++) {
+    const unsigned long seed = MonteCarloCaseRunner::CalcCaseSeed(0, case_id);
+    EXPECT_LE(seed, 0xffffffffUL);
+    seeds.insert(seed);
+  }
+  EXPECT_EQ(1000, seeds.size());
+  EXPECT_NE(MonteCarloCaseRunner::CalcCaseSeed(0, 7), MonteCarloCaseRunner::CalcCaseSeed(1, 7));
+}
+
+/**
+ * @brief Test for the randomized parameters which do not depend on the number of workers
+ */
+TEST(MonteCarloCaseRunner, RandomizationIndependentOfWorkers) {
+  const std::string file_path = "test_monte_carlo_case_runner.ini";
+  WriteMonteCarloTestIniFile(file_path, 16);
+
+  const std::vector<double> serial_values = RunMonteCarloTestCases(file_path, 1);
+  const std::vector<double> parallel_values = RunMonteCarloTestCases(file_path, 4);
+  ASSERT_EQ(16, serial_values.size());
+  ASSERT_EQ(serial_values.size(), parallel_values.size());
+  for (size_t case_id = 0; case_id < serial_values.size(); case_id++) {
+    EXPECT_GE(serial_values[case_id], 0.0);
+    EXPECT_LE(serial_values[case_id], 1.0);
+    EXPECT_DOUBLE_EQ(serial_values[case_id], parallel_values[case_id]);
+  }
+  EXPECT_NE(serial_values[0], serial_values[1]);
+
+  remove(file_path.c_str());
+}
+
+/**
+ * @brief Test for the results of the cases executed in the worker processes, which are received in the caller process
+ */
+TEST(MonteCarloCaseRunner, ResultsOfWorkerProcesses) {
+  const std::string file_path = "test_monte_carlo_case_runner_results.ini";
+  WriteMonteCarloTestIniFile(file_path, 16);
+
+  const auto thread_results = RunMonteCarloTestCasesWithResults(file_path, 4, MonteCarloParallelMode::kThread);
+  const auto process_results = RunMonteCarloTestCasesWithResults(file_path, 4, MonteCarloParallelMode::kProcess);
+  ASSERT_EQ(16, thread_results.size());
+  ASSERT_EQ(16, process_results.size());
+
+  std::map<unsigned long long, std::string> thread_result_map(thread_results.begin(), thread_results.end());
+  ASSERT_EQ(16, thread_result_map.size());
+  for (size_t case_id = 0; case_id < process_results.size(); case_id++) {
+    // The results of the worker processes are received in the case ID order
+    EXPECT_EQ(case_id, process_results[case_id].first);
+    EXPECT_EQ(0, process_results[case_id].second.find(std::to_string(case_id) + ","));
+    EXPECT_EQ(thread_result_map[case_id], process_results[case_id].second);
+  }
+
+  remove(file_path.c_str());
+}
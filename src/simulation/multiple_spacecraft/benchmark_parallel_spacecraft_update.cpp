@@ -0,0 +1,106 @@
+/**
+ * @file benchmark_parallel_spacecraft_update.cpp
+ * @brief Benchmark of the spacecraft update with ParallelSpacecraftUpdater for 1 to 64 spacecraft
+ * @note Usage: benchmark_parallel_spacecraft_update [simulation base ini file path] [number of threads]
+ *       All spacecraft are initialized with spacecraft_file(0) in the simulation base file. The default path is the sample simulation base file.
+ *       The default number of threads is the number of hardware threads.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <simulation/case/simulation_case.hpp>
+#include <simulation/spacecraft/installed_components.hpp>
+#include <simulation/spacecraft/spacecraft.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * @class BenchmarkSpacecraft
+ * @brief Spacecraft without components
+ */
+class BenchmarkSpacecraft : public Spacecraft {
+ public:
+  BenchmarkSpacecraft(const SimulationConfiguration* simulation_configuration, const GlobalEnvironment* global_environment, const int spacecraft_id)
+      : Spacecraft(simulation_configuration, global_environment, spacecraft_id) {
+    components_ = new InstalledComponents();
+  }
+};
+
+/**
+ * @class BenchmarkCase
+ * @brief Simulation case with the spacecraft initialized by the same file
+ */
+class BenchmarkCase : public SimulationCase {
+ public:
+  BenchmarkCase(const std::string initialize_base_file, const size_t number_of_spacecraft)
+      : SimulationCase(initialize_base_file), number_of_spacecraft_(number_of_spacecraft) {}
+  ~BenchmarkCase() {
+    for (auto spacecraft : spacecraft_) {
+      delete spacecraft;
+    }
+  }
+
+  void InitializeTargetObjects() {
+    const std::string spacecraft_file = simulation_configuration_.spacecraft_file_list_[0];
+    simulation_configuration_.spacecraft_file_list_.assign(number_of_spacecraft_, spacecraft_file);
+    for (size_t i = 0; i < number_of_spacecraft_; i++) {
+      spacecraft_.push_back(new BenchmarkSpacecraft(&simulation_configuration_, global_environment_, (int)i));
+    }
+  }
+  void UpdateTargetObjects() {}
+
+  /**
+   * @fn MeasureStepsPerSecond
+   * @brief Measure number of simulation steps per second with the first spacecraft
+   * @param [in] number_of_spacecraft: Number of spacecraft to be updated
+   * @param [in] updater: Updater of the spacecraft
+   */
+  double MeasureStepsPerSecond(const size_t number_of_spacecraft, ParallelSpacecraftUpdater& updater) {
+    const std::vector<Spacecraft*> targets(spacecraft_.begin(), spacecraft_.begin() + number_of_spacecraft);
+    // Run at least 0.5 sec
+    size_t number_of_steps = 0;
+    double elapsed_time_s = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    while (elapsed_time_s < 0.5) {
+      for (size_t i = 0; i < 10; i++) {
+        global_environment_->Update();
+        updater.Update(targets, &(global_environment_->GetSimulationTime()));
+      }
+      number_of_steps += 10;
+      elapsed_time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    return number_of_steps / elapsed_time_s;
+  }
+
+ private:
+  size_t number_of_spacecraft_;          //!< Number of spacecraft
+  std::vector<Spacecraft*> spacecraft_;  //!< Spacecraft
+};
+
+/**
+ * @fn main
+ * @brief Compare the serial update and the parallel update for 1, 2, 4, ..., 64 spacecraft
+ */
+int main(int argc, char* argv[]) {
+  std::string ini_file_name = "../../data/sample/initialize_files/sample_simulation_base.ini";
+  if (argc > 1) ini_file_name = argv[1];
+  unsigned int number_of_threads = 0;
+  if (argc > 2) number_of_threads = (unsigned int)atoi(argv[2]);
+
+  const size_t kMaxNumberOfSpacecraft = 64;
+  BenchmarkCase benchmark_case(ini_file_name, kMaxNumberOfSpacecraft);
+  benchmark_case.InitializeTargetObjects();
+
+  ParallelSpacecraftUpdater serial_updater(1);
+  ParallelSpacecraftUpdater parallel_updater(number_of_threads);
+  std::cout << "Number of threads: " << parallel_updater.GetNumberOfThreads() << std::endl;
+  for (size_t number_of_spacecraft = 1; number_of_spacecraft <= kMaxNumberOfSpacecraft; number_of_spacecraft *= 2) {
+    const double serial_steps_per_s = benchmark_case.MeasureStepsPerSecond(number_of_spacecraft, serial_updater);
+    const double parallel_steps_per_s = benchmark_case.MeasureStepsPerSecond(number_of_spacecraft, parallel_updater);
+    std::cout << number_of_spacecraft << " spacecraft: serial " << serial_steps_per_s << " steps/s, parallel " << parallel_steps_per_s
+              << " steps/s, speedup " << parallel_steps_per_s / serial_steps_per_s << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file parallel_spacecraft_updater.cpp
+ * @brief Class to update multiple spacecraft in parallel with a thread pool
+ */
+
+#include "parallel_spacecraft_updater.hpp"
+
+#include <iostream>
+
+#include "../spacecraft/spacecraft.hpp"
+
+ParallelSpacecraftUpdater::ParallelSpacecraftUpdater(const unsigned int number_of_threads) : number_of_threads_(number_of_threads) {
+  if (number_of_threads_ == 0) number_of_threads_ = std::thread::hardware_concurrency();
+  if (number_of_threads_ == 0) number_of_threads_ = 1;
+
+  // The caller thread also updates the spacecraft
+  for (unsigned int i = 1; i < number_of_threads_; i++) {
+    workers_.emplace_back([this]() { WorkerLoop(); });
+  }
+}
+
+ParallelSpacecraftUpdater::~ParallelSpacecraftUpdater() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stopped_ = true;
+  }
+  start_condition_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+void ParallelSpacecraftUpdater::Update(const std::vector<Spacecraft*>& spacecraft, const SimulationTime* simulation_time) {
+  if (workers_.empty() || spacecraft.size() <= 1 || !IsParallelUpdateAllowed(spacecraft)) {
+    if (!workers_.empty() && spacecraft.size() > 1 && !is_serial_update_reported_) {
+      std::cerr << "ParallelSpacecraftUpdater: RELATIVE orbit depends on the other spacecraft. The spacecraft are updated serially." << std::endl;
+      is_serial_update_reported_ = true;
+    }
+    for (auto target : spacecraft) {
+      target->Update(simulation_time);
+    }
+    return;
+  }
+
+  Execute(spacecraft.size(), [&spacecraft, simulation_time](const size_t index) { spacecraft[index]->Update(simulation_time); });
+}
+
+void ParallelSpacecraftUpdater::Execute(const size_t number_of_tasks, const std::function<void(const size_t)>& task) {
+  if (workers_.empty() || number_of_tasks <= 1) {
+    for (size_t index = 0; index < number_of_tasks; index++) {
+      task(index);
+    }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = &task;
+    number_of_tasks_ = number_of_tasks;
+    next_index_ = 0;
+    number_of_running_workers_ = (unsigned int)workers_.size();
+    generation_++;
+  }
+  start_condition_.notify_all();
+
+  ExecuteRemainingTasks();
+
+  // Barrier: all tasks are finished after the workers finish
+  std::unique_lock<std::mutex> lock(mutex_);
+  finish_condition_.wait(lock, [this]() { return number_of_running_workers_ == 0; });
+  task_ = nullptr;
+  number_of_tasks_ = 0;
+}
+
+void ParallelSpacecraftUpdater::WorkerLoop() {
+  unsigned long long finished_generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      start_condition_.wait(lock, [this, finished_generation]() { return is_stopped_ || generation_ != finished_generation; });
+      if (is_stopped_) return;
+      finished_generation = generation_;
+    }
+
+    ExecuteRemainingTasks();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    number_of_running_workers_--;
+    if (number_of_running_workers_ == 0) finish_condition_.notify_one();
+  }
+}
+
+void ParallelSpacecraftUpdater::ExecuteRemainingTasks() {
+  while (true) {
+    const size_t index = next_index_.fetch_add(1);
+    if (index >= number_of_tasks_) break;
+    (*task_)(index);
+  }
+}
+
+bool ParallelSpacecraftUpdater::IsParallelUpdateAllowed(const std::vector<Spacecraft*>& spacecraft) {
+  for (auto target : spacecraft) {
+    if (target->GetDynamics().GetOrbit().GetPropagateMode() == OrbitPropagateMode::kRelativeOrbit) return false;
+  }
+  return true;
+}
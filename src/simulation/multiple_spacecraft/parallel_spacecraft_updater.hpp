@@ -0,0 +1,109 @@
+/**
+ * @file parallel_spacecraft_updater.hpp
+ * @brief Class to update multiple spacecraft in parallel with a thread pool
+ */
+
+#ifndef S2E_SIMULATION_MULTIPLE_SPACECRAFT_PARALLEL_SPACECRAFT_UPDATER_HPP_
+#define S2E_SIMULATION_MULTIPLE_SPACECRAFT_PARALLEL_SPACECRAFT_UPDATER_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class Spacecraft;
+class SimulationTime;
+
+/**
+ * @class ParallelSpacecraftUpdater
+ * @brief Class to update multiple spacecraft in parallel with a thread pool
+ * @details The update of a spacecraft depends only on the global environment updated before, so the spacecraft in a time step are updated by
+ *          the worker threads. Update returns after all spacecraft are updated, so it works as the barrier before the update of
+ *          RelativeInformation and the logging.
+ * @note Thread safety of the shared pieces:
+ *       - SPICE: The calls are serialized by GetSpiceMutex. The body positions are calculated in the global environment update.
+ *       - IGRF: IgrfModel holds the working arrays in each instance and the loaded coefficients are shared as read only.
+ *       - NRLMSISE-00: The library uses global variables, so the calculation is serialized in the wrapper.
+ *       - Noise: The random generators are held in each instance and seeded at the initialization, so the results do not depend on the threads.
+ *       - CONSTELLATION orbit: The shared engine propagates all spacecraft in the thread of the last requesting spacecraft.
+ *       The update is executed serially when a spacecraft uses the RELATIVE orbit, which reads the orbit of the reference spacecraft.
+ *       Components with process global states (e.g. C2A, HILS) are not thread safe, so use one thread for them.
+ */
+class ParallelSpacecraftUpdater {
+ public:
+  /**
+   * @fn ParallelSpacecraftUpdater
+   * @brief Constructor
+   * @param [in] number_of_threads: Number of threads including the caller thread. 0 means the number of hardware threads. 1 means serial update.
+   */
+  ParallelSpacecraftUpdater(const unsigned int number_of_threads);
+  /**
+   * @fn ~ParallelSpacecraftUpdater
+   * @brief Destructor
+   */
+  ~ParallelSpacecraftUpdater();
+
+  // forbidden copy
+  ParallelSpacecraftUpdater(const ParallelSpacecraftUpdater&) = delete;
+  ParallelSpacecraftUpdater& operator=(const ParallelSpacecraftUpdater&) = delete;
+
+  /**
+   * @fn Update
+   * @brief Update all spacecraft and wait for the completion
+   * @param [in] spacecraft: Spacecraft to be updated
+   * @param [in] simulation_time: Simulation time
+   */
+  void Update(const std::vector<Spacecraft*>& spacecraft, const SimulationTime* simulation_time);
+  /**
+   * @fn Execute
+   * @brief Execute the tasks with the caller thread and the worker threads, and wait for the completion
+   * @note Each task index is taken by only one thread. The function returns after all tasks are finished.
+   * @param [in] number_of_tasks: Number of tasks
+   * @param [in] task: Function executing the task of the given index
+   */
+  void Execute(const size_t number_of_tasks, const std::function<void(const size_t)>& task);
+
+  // Getter
+  /**
+   * @fn GetNumberOfThreads
+   * @brief Return number of threads including the caller thread
+   */
+  inline unsigned int GetNumberOfThreads() const { return number_of_threads_; }
+
+ private:
+  unsigned int number_of_threads_;    //!< Number of threads including the caller thread
+  std::vector<std::thread> workers_;  //!< Worker threads
+
+  std::mutex mutex_;                            //!< Mutex for the following variables
+  std::condition_variable start_condition_;     //!< Condition to start the update in the workers
+  std::condition_variable finish_condition_;    //!< Condition to notify the completion of the workers
+  unsigned long long generation_ = 0;           //!< Counter of the requested updates
+  unsigned int number_of_running_workers_ = 0;  //!< Number of workers executing the current update
+  bool is_stopped_ = false;                     //!< Flag to stop the workers
+
+  const std::function<void(const size_t)>* task_ = nullptr;  //!< Task in the current execution
+  size_t number_of_tasks_ = 0;                               //!< Number of tasks in the current execution
+  std::atomic<size_t> next_index_{0};                        //!< Index of the next task to be executed
+  bool is_serial_update_reported_ = false;                   //!< Flag to report the serial update only once
+
+  /**
+   * @fn WorkerLoop
+   * @brief Main loop of the worker threads
+   */
+  void WorkerLoop();
+  /**
+   * @fn ExecuteRemainingTasks
+   * @brief Execute the tasks not taken by the other threads
+   */
+  void ExecuteRemainingTasks();
+  /**
+   * @fn IsParallelUpdateAllowed
+   * @brief Return false when a spacecraft depends on the states of the other spacecraft in the update
+   * @param [in] spacecraft: Spacecraft to be updated
+   */
+  static bool IsParallelUpdateAllowed(const std::vector<Spacecraft*>& spacecraft);
+};
+
+#endif  // S2E_SIMULATION_MULTIPLE_SPACECRAFT_PARALLEL_SPACECRAFT_UPDATER_HPP_
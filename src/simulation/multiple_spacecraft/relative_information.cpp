@@ -5,48 +5,99 @@
 
 #include "relative_information.hpp"
 
-RelativeInformation::RelativeInformation() {}
+#include <algorithm>
+
+RelativeInformation::RelativeInformation() : grid_index_(1.0) {}
 
 RelativeInformation::~RelativeInformation() {}
 
 void RelativeInformation::Update() {
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < dynamics_database_.size(); reference_spacecraft_id++) {
-      // Position
-      libra::Vector<3> target_sat_pos_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetPosition_i_m();
-      libra::Vector<3> reference_sat_pos_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetPosition_i_m();
-      relative_position_list_i_m_[target_spacecraft_id][reference_spacecraft_id] = target_sat_pos_i - reference_sat_pos_i;
-      relative_position_list_rtn_m_[target_spacecraft_id][reference_spacecraft_id] =
-          CalcRelativePosition_rtn_m(target_spacecraft_id, reference_spacecraft_id);
+  UpdateSpacecraftStates();
 
-      // Distance
-      relative_distance_list_m_[target_spacecraft_id][reference_spacecraft_id] =
-          relative_position_list_i_m_[target_spacecraft_id][reference_spacecraft_id].CalcNorm();
-
-      // Velocity
-      libra::Vector<3> target_sat_vel_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-      libra::Vector<3> reference_sat_vel_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-      relative_velocity_list_i_m_s_[target_spacecraft_id][reference_spacecraft_id] = target_sat_vel_i - reference_sat_vel_i;
-      relative_velocity_list_rtn_m_s_[target_spacecraft_id][reference_spacecraft_id] =
-          CalcRelativeVelocity_rtn_m_s(target_spacecraft_id, reference_spacecraft_id);
+  if (subscribed_pairs_.empty() && distance_subscriptions_.empty() && nearest_subscriptions_.empty()) {
+    // The antisymmetric information is calculated once for each pair
+    for (size_t target_spacecraft_id = 1; target_spacecraft_id < number_of_spacecraft_; target_spacecraft_id++) {
+      if (orbit_list_[target_spacecraft_id] == nullptr) continue;
+      for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
+        if (orbit_list_[reference_spacecraft_id] == nullptr) continue;
+        if (is_orbit_updated_[target_spacecraft_id] || is_orbit_updated_[reference_spacecraft_id] || is_attitude_updated_[target_spacecraft_id] ||
+            is_attitude_updated_[reference_spacecraft_id]) {
+          UpdateSymmetricPair((int)target_spacecraft_id, (int)reference_spacecraft_id);
+        }
+      }
+    }
+    for (size_t target_spacecraft_id = 0; target_spacecraft_id < number_of_spacecraft_; target_spacecraft_id++) {
+      if (orbit_list_[target_spacecraft_id] == nullptr) continue;
+      for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < number_of_spacecraft_; reference_spacecraft_id++) {
+        if (target_spacecraft_id == reference_spacecraft_id || orbit_list_[reference_spacecraft_id] == nullptr) continue;
+        if (is_orbit_updated_[target_spacecraft_id] || is_orbit_updated_[reference_spacecraft_id]) {
+          UpdateRtnPair((int)target_spacecraft_id, (int)reference_spacecraft_id);
+        }
+      }
+    }
+  } else {
+    CollectUpdatedPairs();
+    for (const auto& pair : updated_pairs_) {
+      const int target_spacecraft_id = pair.first;
+      const int reference_spacecraft_id = pair.second;
+      if (target_spacecraft_id == reference_spacecraft_id) continue;
+      if (!IsRegistered(target_spacecraft_id) || !IsRegistered(reference_spacecraft_id)) continue;
 
-      // Attitude Quaternion
-      relative_attitude_quaternion_list_[target_spacecraft_id][reference_spacecraft_id] =
-          CalcRelativeAttitudeQuaternion(target_spacecraft_id, reference_spacecraft_id);
+      const bool is_orbit_updated = is_orbit_updated_[target_spacecraft_id] || is_orbit_updated_[reference_spacecraft_id];
+      if (is_orbit_updated || is_attitude_updated_[target_spacecraft_id] || is_attitude_updated_[reference_spacecraft_id]) {
+        if (target_spacecraft_id > reference_spacecraft_id) {
+          UpdateSymmetricPair(target_spacecraft_id, reference_spacecraft_id);
+        } else {
+          UpdateSymmetricPair(reference_spacecraft_id, target_spacecraft_id);
+        }
+      }
+      if (is_orbit_updated) UpdateRtnPair(target_spacecraft_id, reference_spacecraft_id);
     }
   }
+  is_all_update_required_ = false;
 }
 
 void RelativeInformation::RegisterDynamicsInfo(const int spacecraft_id, const Dynamics* dynamics) {
   dynamics_database_.emplace(spacecraft_id, dynamics);
+  RegisterOrbitAndAttitude(spacecraft_id, &(dynamics->GetOrbit()), &(dynamics->GetAttitude()));
+}
+
+void RelativeInformation::RegisterOrbitAndAttitude(const int spacecraft_id, const Orbit* orbit, const Attitude* attitude) {
+  dynamics_database_.emplace(spacecraft_id, nullptr);
+  orbit_attitude_database_.emplace(spacecraft_id, std::make_pair(orbit, attitude));
   ResizeLists();
 }
 
 void RelativeInformation::RemoveDynamicsInfo(const int spacecraft_id) {
   dynamics_database_.erase(spacecraft_id);
+  orbit_attitude_database_.erase(spacecraft_id);
   ResizeLists();
 }
 
+void RelativeInformation::SubscribePair(const int target_spacecraft_id, const int reference_spacecraft_id) {
+  subscribed_pairs_.push_back(std::make_pair(target_spacecraft_id, reference_spacecraft_id));
+  is_all_update_required_ = true;
+}
+
+void RelativeInformation::SubscribeWithinDistance(const int reference_spacecraft_id, const double distance_m) {
+  // The cells are as large as the largest distance, so a query checks at most 27 cells
+  if (distance_subscriptions_.empty() || distance_m > grid_index_.GetCellSize()) grid_index_ = libra::UniformGridIndex(distance_m);
+  distance_subscriptions_.push_back(std::make_pair(reference_spacecraft_id, distance_m));
+  is_all_update_required_ = true;
+}
+
+void RelativeInformation::SubscribeNearest(const int reference_spacecraft_id, const size_t number_of_neighbors) {
+  nearest_subscriptions_.push_back(std::make_pair(reference_spacecraft_id, number_of_neighbors));
+  is_all_update_required_ = true;
+}
+
+void RelativeInformation::ClearSubscribedPairs() {
+  subscribed_pairs_.clear();
+  distance_subscriptions_.clear();
+  nearest_subscriptions_.clear();
+  is_all_update_required_ = true;
+}
+
 std::string RelativeInformation::GetLogHeader() const {
   std::string str_tmp = "";
   for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
@@ -109,57 +160,165 @@ std::string RelativeInformation::GetLogValue() const {
   return str_tmp;
 }
 
+bool RelativeInformation::GetLogValueBinary(std::vector<double>& values) const {
+  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
+    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
+      AppendVector(values, GetRelativePosition_i_m(target_spacecraft_id, reference_spacecraft_id));
+    }
+  }
+
+  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
+    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
+      AppendVector(values, GetRelativeVelocity_i_m_s(target_spacecraft_id, reference_spacecraft_id));
+    }
+  }
+
+  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
+    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
+      AppendVector(values, GetRelativePosition_rtn_m(target_spacecraft_id, reference_spacecraft_id));
+    }
+  }
+
+  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
+    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
+      AppendVector(values, GetRelativeVelocity_rtn_m_s(target_spacecraft_id, reference_spacecraft_id));
+    }
+  }
+
+  return true;
+}
+
 void RelativeInformation::LogSetup(Logger& logger) { logger.AddLogList(this); }
 
-libra::Quaternion RelativeInformation::CalcRelativeAttitudeQuaternion(const int target_spacecraft_id, const int reference_spacecraft_id) {
-  // Observer SC Body frame(obs_sat) -> ECI frame(i)
-  libra::Quaternion q_reference_i2b = dynamics_database_.at(reference_spacecraft_id)->GetAttitude().GetQuaternion_i2b();
-  libra::Quaternion q_reference_b2i = q_reference_i2b.Conjugate();
+static bool IsSameVector(const libra::Vector<3>& lhs, const libra::Vector<3>& rhs) {
+  return lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2];
+}
+
+static bool IsSameQuaternion(const libra::Quaternion& lhs, const libra::Quaternion& rhs) {
+  return lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2] && lhs[3] == rhs[3];
+}
+
+void RelativeInformation::UpdateSpacecraftStates() {
+  for (size_t spacecraft_id = 0; spacecraft_id < number_of_spacecraft_; spacecraft_id++) {
+    is_orbit_updated_[spacecraft_id] = false;
+    is_attitude_updated_[spacecraft_id] = false;
+    if (orbit_list_[spacecraft_id] == nullptr) continue;
 
-  // ECI frame(i) -> Target SC body frame(main_sat)
-  libra::Quaternion q_target_i2b = dynamics_database_.at(target_spacecraft_id)->GetAttitude().GetQuaternion_i2b();
+    const Orbit& orbit = *orbit_list_[spacecraft_id];
+    const libra::Vector<3> position_i_m = orbit.GetPosition_i_m();
+    const libra::Vector<3> velocity_i_m_s = orbit.GetVelocity_i_m_s();
+    if (is_all_update_required_ || !IsSameVector(position_i_m, position_list_i_m_[spacecraft_id]) ||
+        !IsSameVector(velocity_i_m_s, velocity_list_i_m_s_[spacecraft_id])) {
+      is_orbit_updated_[spacecraft_id] = true;
+      position_list_i_m_[spacecraft_id] = position_i_m;
+      velocity_list_i_m_s_[spacecraft_id] = velocity_i_m_s;
 
-  return q_target_i2b * q_reference_b2i;
+      // RTN frame of the spacecraft as the reference
+      quaternion_list_i2rtn_[spacecraft_id] = orbit.CalcQuaternion_i2lvlh();
+      libra::Vector<3> rtn_angular_velocity_i_rad_s = cross(position_i_m, velocity_i_m_s);
+      double r2 = position_i_m.CalcNorm() * position_i_m.CalcNorm();
+      rtn_angular_velocity_i_rad_s /= r2;
+      rtn_angular_velocity_list_i_rad_s_[spacecraft_id] = rtn_angular_velocity_i_rad_s;
+    }
+
+    const libra::Quaternion quaternion_i2b = attitude_list_[spacecraft_id]->GetQuaternion_i2b();
+    if (is_all_update_required_ || !IsSameQuaternion(quaternion_i2b, quaternion_list_i2b_[spacecraft_id])) {
+      is_attitude_updated_[spacecraft_id] = true;
+      quaternion_list_i2b_[spacecraft_id] = quaternion_i2b;
+    }
+  }
 }
 
-libra::Vector<3> RelativeInformation::CalcRelativePosition_rtn_m(const int target_spacecraft_id, const int reference_spacecraft_id) {
-  libra::Vector<3> target_sat_pos_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> reference_sat_pos_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> relative_pos_i = target_sat_pos_i - reference_sat_pos_i;
+void RelativeInformation::CollectUpdatedPairs() {
+  updated_pairs_ = subscribed_pairs_;
 
-  // RTN frame for the reference satellite
-  libra::Quaternion q_i2rtn = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().CalcQuaternion_i2lvlh();
+  if (!distance_subscriptions_.empty()) {
+    // The grid index is the spacecraft ID, and the removed IDs are skipped
+    grid_index_.Build(position_list_i_m_);
+    std::vector<size_t> neighbors;
+    for (const auto& subscription : distance_subscriptions_) {
+      const int reference_spacecraft_id = subscription.first;
+      if (!IsRegistered(reference_spacecraft_id)) continue;
+      neighbors.clear();
+      grid_index_.QueryRadius(position_list_i_m_[reference_spacecraft_id], subscription.second, neighbors);
+      for (const size_t target_spacecraft_id : neighbors) {
+        if ((int)target_spacecraft_id == reference_spacecraft_id || !IsRegistered((int)target_spacecraft_id)) continue;
+        updated_pairs_.push_back(std::make_pair((int)target_spacecraft_id, reference_spacecraft_id));
+      }
+    }
+  }
 
-  libra::Vector<3> relative_pos_rtn = q_i2rtn.FrameConversion(relative_pos_i);
-  return relative_pos_rtn;
+  std::vector<std::pair<double, int>> candidates;
+  for (const auto& subscription : nearest_subscriptions_) {
+    const int reference_spacecraft_id = subscription.first;
+    if (!IsRegistered(reference_spacecraft_id)) continue;
+    candidates.clear();
+    for (size_t target_spacecraft_id = 0; target_spacecraft_id < number_of_spacecraft_; target_spacecraft_id++) {
+      if ((int)target_spacecraft_id == reference_spacecraft_id || !IsRegistered((int)target_spacecraft_id)) continue;
+      const libra::Vector<3> difference_i_m = position_list_i_m_[target_spacecraft_id] - position_list_i_m_[reference_spacecraft_id];
+      candidates.push_back(std::make_pair(libra::InnerProduct(difference_i_m, difference_i_m), (int)target_spacecraft_id));
+    }
+    const size_t number_of_neighbors = std::min(subscription.second, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + number_of_neighbors, candidates.end());
+    for (size_t i = 0; i < number_of_neighbors; i++) {
+      updated_pairs_.push_back(std::make_pair(candidates[i].second, reference_spacecraft_id));
+    }
+  }
 }
 
-libra::Vector<3> RelativeInformation::CalcRelativeVelocity_rtn_m_s(const int target_spacecraft_id, const int reference_spacecraft_id) {
-  libra::Vector<3> target_sat_pos_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> reference_sat_pos_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> relative_pos_i = target_sat_pos_i - reference_sat_pos_i;
+void RelativeInformation::UpdateSymmetricPair(const int target_spacecraft_id, const int reference_spacecraft_id) {
+  const size_t pair_index = CalcPairIndex(target_spacecraft_id, reference_spacecraft_id);
+
+  // Position and distance
+  relative_position_list_i_m_[pair_index] = position_list_i_m_[target_spacecraft_id] - position_list_i_m_[reference_spacecraft_id];
+  relative_distance_list_m_[pair_index] = relative_position_list_i_m_[pair_index].CalcNorm();
 
-  // RTN frame for the reference satellite
-  libra::Quaternion q_i2rtn = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().CalcQuaternion_i2lvlh();
+  // Velocity
+  relative_velocity_list_i_m_s_[pair_index] = velocity_list_i_m_s_[target_spacecraft_id] - velocity_list_i_m_s_[reference_spacecraft_id];
 
-  // Rotation vector of RTN frame
-  libra::Vector<3> reference_sat_vel_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-  libra::Vector<3> target_sat_vel_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-  libra::Vector<3> rot_vec_rtn_i = cross(reference_sat_pos_i, reference_sat_vel_i);
-  double r2_ref = reference_sat_pos_i.CalcNorm() * reference_sat_pos_i.CalcNorm();
-  rot_vec_rtn_i /= r2_ref;
-  libra::Vector<3> relative_vel_i = target_sat_vel_i - reference_sat_vel_i - cross(rot_vec_rtn_i, relative_pos_i);
+  // Attitude quaternion: Reference body frame -> ECI frame -> Target body frame
+  const libra::Quaternion q_reference_b2i = quaternion_list_i2b_[reference_spacecraft_id].Conjugate();
+  relative_attitude_quaternion_list_[pair_index] = quaternion_list_i2b_[target_spacecraft_id] * q_reference_b2i;
+}
+
+void RelativeInformation::UpdateRtnPair(const int target_spacecraft_id, const int reference_spacecraft_id) {
+  const size_t list_index = target_spacecraft_id * number_of_spacecraft_ + reference_spacecraft_id;
+  const libra::Vector<3>& reference_sat_pos_i = position_list_i_m_[reference_spacecraft_id];
+  const libra::Quaternion& q_i2rtn = quaternion_list_i2rtn_[reference_spacecraft_id];
 
-  libra::Vector<3> relative_vel_rtn = q_i2rtn.FrameConversion(relative_vel_i);
-  return relative_vel_rtn;
+  libra::Vector<3> relative_pos_i = position_list_i_m_[target_spacecraft_id] - reference_sat_pos_i;
+  relative_position_list_rtn_m_[list_index] = q_i2rtn.FrameConversion(relative_pos_i);
+
+  libra::Vector<3> relative_vel_i = velocity_list_i_m_s_[target_spacecraft_id] - velocity_list_i_m_s_[reference_spacecraft_id] -
+                                    cross(rtn_angular_velocity_list_i_rad_s_[reference_spacecraft_id], relative_pos_i);
+  relative_velocity_list_rtn_m_s_[list_index] = q_i2rtn.FrameConversion(relative_vel_i);
 }
 
 void RelativeInformation::ResizeLists() {
-  size_t size = dynamics_database_.size();
-  relative_position_list_i_m_.assign(size, std::vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  relative_velocity_list_i_m_s_.assign(size, std::vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  relative_distance_list_m_.assign(size, std::vector<double>(size, 0.0));
-  relative_position_list_rtn_m_.assign(size, std::vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  relative_velocity_list_rtn_m_s_.assign(size, std::vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  relative_attitude_quaternion_list_.assign(size, std::vector<libra::Quaternion>(size, libra::Quaternion(0, 0, 0, 1)));
+  number_of_spacecraft_ = dynamics_database_.size();
+  orbit_list_.assign(number_of_spacecraft_, nullptr);
+  attitude_list_.assign(number_of_spacecraft_, nullptr);
+  for (const auto& orbit_attitude : orbit_attitude_database_) {
+    if (orbit_attitude.first >= 0 && orbit_attitude.first < (int)number_of_spacecraft_) {
+      orbit_list_[orbit_attitude.first] = orbit_attitude.second.first;
+      attitude_list_[orbit_attitude.first] = orbit_attitude.second.second;
+    }
+  }
+
+  position_list_i_m_.assign(number_of_spacecraft_, libra::Vector<3>(0));
+  velocity_list_i_m_s_.assign(number_of_spacecraft_, libra::Vector<3>(0));
+  quaternion_list_i2b_.assign(number_of_spacecraft_, libra::Quaternion(0, 0, 0, 1));
+  quaternion_list_i2rtn_.assign(number_of_spacecraft_, libra::Quaternion(0, 0, 0, 1));
+  rtn_angular_velocity_list_i_rad_s_.assign(number_of_spacecraft_, libra::Vector<3>(0));
+  is_orbit_updated_.assign(number_of_spacecraft_, false);
+  is_attitude_updated_.assign(number_of_spacecraft_, false);
+  is_all_update_required_ = true;
+
+  const size_t number_of_pairs = number_of_spacecraft_ * (number_of_spacecraft_ - (number_of_spacecraft_ > 0 ? 1 : 0)) / 2;
+  relative_position_list_i_m_.assign(number_of_pairs, libra::Vector<3>(0));
+  relative_velocity_list_i_m_s_.assign(number_of_pairs, libra::Vector<3>(0));
+  relative_distance_list_m_.assign(number_of_pairs, 0.0);
+  relative_attitude_quaternion_list_.assign(number_of_pairs, libra::Quaternion(0, 0, 0, 1));
+  relative_position_list_rtn_m_.assign(number_of_spacecraft_ * number_of_spacecraft_, libra::Vector<3>(0));
+  relative_velocity_list_rtn_m_s_.assign(number_of_spacecraft_ * number_of_spacecraft_, libra::Vector<3>(0));
 }
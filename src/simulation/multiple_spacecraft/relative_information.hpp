@@ -6,11 +6,15 @@
 #ifndef S2E_MULTIPLE_SPACECRAFT_RELATIVE_INFORMATION_HPP_
 #define S2E_MULTIPLE_SPACECRAFT_RELATIVE_INFORMATION_HPP_
 
+#include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "../../dynamics/dynamics.hpp"
 #include "../../library/logger/loggable.hpp"
 #include "../../library/logger/logger.hpp"
+#include "../../library/math/uniform_grid_index.hpp"
 
 /**
  * @class RelativeInformation
@@ -31,7 +35,8 @@ class RelativeInformation : public ILoggable {
 
   /**
    * @fn Update
-   * @brief Update all relative information
+   * @brief Update the relative information of the subscribed pairs
+   * @note Only the pairs including the spacecraft whose orbit or attitude is changed after the last update are calculated.
    */
   void Update();
   /**
@@ -41,6 +46,15 @@ class RelativeInformation : public ILoggable {
    * @param [in] dynamics: Dynamics information of the target spacecraft
    */
   void RegisterDynamicsInfo(const int spacecraft_id, const Dynamics* dynamics);
+  /**
+   * @fn RegisterOrbitAndAttitude
+   * @brief Register orbit and attitude of target spacecraft without dynamics information
+   * @note GetReferenceSatDynamics returns nullptr for the spacecraft.
+   * @param [in] spacecraft_id: ID of target spacecraft
+   * @param [in] orbit: Orbit of the target spacecraft
+   * @param [in] attitude: Attitude of the target spacecraft
+   */
+  void RegisterOrbitAndAttitude(const int spacecraft_id, const Orbit* orbit, const Attitude* attitude);
   /**
    * @fn RegisterDynamicsInfo
    * @brief Remove dynamics information of target spacecraft
@@ -59,6 +73,11 @@ class RelativeInformation : public ILoggable {
    * @brief Override function of GetLogValue
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
   /**
    * @fn LogSetup
@@ -66,6 +85,37 @@ class RelativeInformation : public ILoggable {
    */
   void LogSetup(Logger& logger);
 
+  /**
+   * @fn SubscribePair
+   * @brief Subscribe the relative information of the target spacecraft with respect to the reference spacecraft
+   * @note When no pair or neighbor is subscribed, the information of all pairs is updated. When they are subscribed, only the subscribed pairs
+   *       are updated and the getters return zero (identity quaternion) or the last calculated value for the others.
+   * @param [in] target_spacecraft_id: ID of target spacecraft
+   * @param [in] reference_spacecraft_id: ID of reference spacecraft
+   */
+  void SubscribePair(const int target_spacecraft_id, const int reference_spacecraft_id);
+  /**
+   * @fn SubscribeWithinDistance
+   * @brief Subscribe the relative information of the spacecraft within the distance from the reference spacecraft
+   * @note The neighbors are searched with the positions at each update, and the pairs of (neighbor, reference) are updated.
+   * @param [in] reference_spacecraft_id: ID of reference spacecraft
+   * @param [in] distance_m: Distance from the reference spacecraft [m]
+   */
+  void SubscribeWithinDistance(const int reference_spacecraft_id, const double distance_m);
+  /**
+   * @fn SubscribeNearest
+   * @brief Subscribe the relative information of the nearest spacecraft from the reference spacecraft
+   * @note The neighbors are searched with the positions at each update, and the pairs of (neighbor, reference) are updated.
+   * @param [in] reference_spacecraft_id: ID of reference spacecraft
+   * @param [in] number_of_neighbors: Number of the nearest spacecraft
+   */
+  void SubscribeNearest(const int reference_spacecraft_id, const size_t number_of_neighbors);
+  /**
+   * @fn ClearSubscribedPairs
+   * @brief Clear the subscribed pairs and neighbors to update the information of all pairs
+   */
+  void ClearSubscribedPairs();
+
   // Getter
   /**
    * @fn GetRelativeAttitudeQuaternion
@@ -74,7 +124,11 @@ class RelativeInformation : public ILoggable {
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
   inline libra::Quaternion GetRelativeAttitudeQuaternion(const int target_spacecraft_id, const int reference_spacecraft_id) const {
-    return relative_attitude_quaternion_list_[target_spacecraft_id][reference_spacecraft_id];
+    if (target_spacecraft_id == reference_spacecraft_id) return libra::Quaternion(0.0, 0.0, 0.0, 1.0);
+    if (target_spacecraft_id > reference_spacecraft_id) {
+      return relative_attitude_quaternion_list_[CalcPairIndex(target_spacecraft_id, reference_spacecraft_id)];
+    }
+    return relative_attitude_quaternion_list_[CalcPairIndex(reference_spacecraft_id, target_spacecraft_id)].Conjugate();
   }
   /**
    * @fn GetRelativePosition_i_m
@@ -83,7 +137,11 @@ class RelativeInformation : public ILoggable {
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
   inline libra::Vector<3> GetRelativePosition_i_m(const int target_spacecraft_id, const int reference_spacecraft_id) const {
-    return relative_position_list_i_m_[target_spacecraft_id][reference_spacecraft_id];
+    if (target_spacecraft_id == reference_spacecraft_id) return libra::Vector<3>(0.0);
+    if (target_spacecraft_id > reference_spacecraft_id) {
+      return relative_position_list_i_m_[CalcPairIndex(target_spacecraft_id, reference_spacecraft_id)];
+    }
+    return -relative_position_list_i_m_[CalcPairIndex(reference_spacecraft_id, target_spacecraft_id)];
   }
   /**
    * @fn GetRelativeVelocity_i_m
@@ -92,7 +150,11 @@ class RelativeInformation : public ILoggable {
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
   inline libra::Vector<3> GetRelativeVelocity_i_m_s(const int target_spacecraft_id, const int reference_spacecraft_id) const {
-    return relative_velocity_list_i_m_s_[target_spacecraft_id][reference_spacecraft_id];
+    if (target_spacecraft_id == reference_spacecraft_id) return libra::Vector<3>(0.0);
+    if (target_spacecraft_id > reference_spacecraft_id) {
+      return relative_velocity_list_i_m_s_[CalcPairIndex(target_spacecraft_id, reference_spacecraft_id)];
+    }
+    return -relative_velocity_list_i_m_s_[CalcPairIndex(reference_spacecraft_id, target_spacecraft_id)];
   }
   /**
    * @fn GetRelativeDistance_m
@@ -101,7 +163,11 @@ class RelativeInformation : public ILoggable {
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
   inline double GetRelativeDistance_m(const int target_spacecraft_id, const int reference_spacecraft_id) const {
-    return relative_distance_list_m_[target_spacecraft_id][reference_spacecraft_id];
+    if (target_spacecraft_id == reference_spacecraft_id) return 0.0;
+    if (target_spacecraft_id > reference_spacecraft_id) {
+      return relative_distance_list_m_[CalcPairIndex(target_spacecraft_id, reference_spacecraft_id)];
+    }
+    return relative_distance_list_m_[CalcPairIndex(reference_spacecraft_id, target_spacecraft_id)];
   };
   /**
    * @fn GetRelativePosition_rtn_m
@@ -110,7 +176,7 @@ class RelativeInformation : public ILoggable {
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
   inline libra::Vector<3> GetRelativePosition_rtn_m(const int target_spacecraft_id, const int reference_spacecraft_id) const {
-    return relative_position_list_rtn_m_[target_spacecraft_id][reference_spacecraft_id];
+    return relative_position_list_rtn_m_[target_spacecraft_id * number_of_spacecraft_ + reference_spacecraft_id];
   }
   /**
    * @fn GetRelativeVelocity_rtn_m_s
@@ -119,7 +185,7 @@ class RelativeInformation : public ILoggable {
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
   inline libra::Vector<3> GetRelativeVelocity_rtn_m_s(const int target_spacecraft_id, const int reference_spacecraft_id) const {
-    return relative_velocity_list_rtn_m_s_[target_spacecraft_id][reference_spacecraft_id];
+    return relative_velocity_list_rtn_m_s_[target_spacecraft_id * number_of_spacecraft_ + reference_spacecraft_id];
   }
 
   /**
@@ -130,36 +196,78 @@ class RelativeInformation : public ILoggable {
   inline const Dynamics* GetReferenceSatDynamics(const int reference_spacecraft_id) const { return dynamics_database_.at(reference_spacecraft_id); };
 
  private:
-  std::map<const int, const Dynamics*> dynamics_database_;  //!< Dynamics database of all spacecraft
+  std::map<const int, const Dynamics*> dynamics_database_;                                 //!< Dynamics database of all spacecraft
+  std::map<const int, std::pair<const Orbit*, const Attitude*>> orbit_attitude_database_;  //!< Orbit and attitude database of all spacecraft
+  std::vector<const Orbit*> orbit_list_;                                                   //!< Orbit of each spacecraft ID. NULL for removed ID.
+  std::vector<const Attitude*> attitude_list_;                                             //!< Attitude of each spacecraft ID. NULL for removed ID.
+  size_t number_of_spacecraft_ = 0;                                                        //!< Number of spacecraft in the lists
+
+  // States of each spacecraft at the last update
+  std::vector<libra::Vector<3>> position_list_i_m_;                  //!< Position list in the inertial frame [m]
+  std::vector<libra::Vector<3>> velocity_list_i_m_s_;                //!< Velocity list in the inertial frame [m/s]
+  std::vector<libra::Quaternion> quaternion_list_i2b_;               //!< Attitude quaternion list from the inertial frame to the body frame
+  std::vector<libra::Quaternion> quaternion_list_i2rtn_;             //!< Quaternion list from the inertial frame to the RTN frame
+  std::vector<libra::Vector<3>> rtn_angular_velocity_list_i_rad_s_;  //!< Angular velocity list of the RTN frame in the inertial frame [rad/s]
+  std::vector<unsigned char> is_orbit_updated_;                      //!< Flag list of the spacecraft whose orbit is updated after the last update
+  std::vector<unsigned char> is_attitude_updated_;                   //!< Flag list of the spacecraft whose attitude is updated after the last update
+  bool is_all_update_required_ = true;                               //!< Flag to update all pairs regardless of the update of the states
 
-  std::vector<std::vector<libra::Vector<3>>> relative_position_list_i_m_;          //!< Relative position list in the inertial frame in unit [m]
-  std::vector<std::vector<libra::Vector<3>>> relative_velocity_list_i_m_s_;        //!< Relative velocity list in the inertial frame in unit [m/s]
-  std::vector<std::vector<libra::Vector<3>>> relative_position_list_rtn_m_;        //!< Relative position list in the RTN frame in unit [m]
-  std::vector<std::vector<libra::Vector<3>>> relative_velocity_list_rtn_m_s_;      //!< Relative velocity list in the RTN frame in unit [m/s]
-  std::vector<std::vector<double>> relative_distance_list_m_;                      //!< Relative distance list in unit [m]
-  std::vector<std::vector<libra::Quaternion>> relative_attitude_quaternion_list_;  //!< Relative attitude quaternion list
+  std::vector<std::pair<int, int>> subscribed_pairs_;          //!< Subscribed pairs of (target, reference) spacecraft IDs
+  std::vector<std::pair<int, double>> distance_subscriptions_;  //!< Subscribed (reference spacecraft ID, distance [m]) for the neighbors
+  std::vector<std::pair<int, size_t>> nearest_subscriptions_;   //!< Subscribed (reference spacecraft ID, number of neighbors)
+  std::vector<std::pair<int, int>> updated_pairs_;              //!< Pairs of (target, reference) spacecraft IDs updated in the current update
+  libra::UniformGridIndex grid_index_;                          //!< Grid index of the positions to search the neighbors within distance
+
+  // Antisymmetric information stored only for the pairs of target ID > reference ID
+  std::vector<libra::Vector<3>> relative_position_list_i_m_;          //!< Relative position list in the inertial frame in unit [m]
+  std::vector<libra::Vector<3>> relative_velocity_list_i_m_s_;        //!< Relative velocity list in the inertial frame in unit [m/s]
+  std::vector<double> relative_distance_list_m_;                      //!< Relative distance list in unit [m]
+  std::vector<libra::Quaternion> relative_attitude_quaternion_list_;  //!< Relative attitude quaternion list
+  // Information in the RTN frame of the reference spacecraft stored for all pairs [target ID * number of spacecraft + reference ID]
+  std::vector<libra::Vector<3>> relative_position_list_rtn_m_;    //!< Relative position list in the RTN frame in unit [m]
+  std::vector<libra::Vector<3>> relative_velocity_list_rtn_m_s_;  //!< Relative velocity list in the RTN frame in unit [m/s]
 
   /**
-   * @fn CalcRelativeAttitudeQuaternion
-   * @brief Calculate and return the relative attitude quaternion
-   * @param [in] target_spacecraft_id: ID of the spacecraft
+   * @fn CalcPairIndex
+   * @brief Return index of the pair in the antisymmetric lists
+   * @param [in] target_spacecraft_id: ID of the spacecraft. It should be larger than reference_spacecraft_id.
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
-  libra::Quaternion CalcRelativeAttitudeQuaternion(const int target_spacecraft_id, const int reference_spacecraft_id);
+  static inline size_t CalcPairIndex(const int target_spacecraft_id, const int reference_spacecraft_id) {
+    return (size_t)target_spacecraft_id * (target_spacecraft_id - 1) / 2 + reference_spacecraft_id;
+  }
   /**
-   * @fn CalcRelativePosition_rtn_m
-   * @brief Calculate and return the relative position in RTN frame
-   * @param [in] target_spacecraft_id: ID of the spacecraft
+   * @fn IsRegistered
+   * @brief Return true when the spacecraft of the ID is registered
+   * @param [in] spacecraft_id: ID of the spacecraft
+   */
+  inline bool IsRegistered(const int spacecraft_id) const {
+    return spacecraft_id >= 0 && spacecraft_id < (int)number_of_spacecraft_ && orbit_list_[spacecraft_id] != nullptr;
+  }
+  /**
+   * @fn UpdateSpacecraftStates
+   * @brief Read the states of all spacecraft and set the updated flags
+   */
+  void UpdateSpacecraftStates();
+  /**
+   * @fn CollectUpdatedPairs
+   * @brief Set the subscribed pairs and the pairs with the subscribed neighbors at the current positions into updated_pairs_
+   */
+  void CollectUpdatedPairs();
+  /**
+   * @fn UpdateSymmetricPair
+   * @brief Update the antisymmetric information of the pair
+   * @param [in] target_spacecraft_id: ID of the spacecraft. It should be larger than reference_spacecraft_id.
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
-  libra::Vector<3> CalcRelativePosition_rtn_m(const int target_spacecraft_id, const int reference_spacecraft_id);
+  void UpdateSymmetricPair(const int target_spacecraft_id, const int reference_spacecraft_id);
   /**
-   * @fn CalcRelativeVelocity_rtn_m_s
-   * @brief Calculate and return the relative velocity in RTN frame
+   * @fn UpdateRtnPair
+   * @brief Update the information in the RTN frame of the reference spacecraft
    * @param [in] target_spacecraft_id: ID of the spacecraft
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
-  libra::Vector<3> CalcRelativeVelocity_rtn_m_s(const int target_spacecraft_id, const int reference_spacecraft_id);
+  void UpdateRtnPair(const int target_spacecraft_id, const int reference_spacecraft_id);
 
   /**
    * @fn ResizeLists
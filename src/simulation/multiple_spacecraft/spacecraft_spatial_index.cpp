@@ -0,0 +1,64 @@
+/**
+ * @file spacecraft_spatial_index.cpp
+ * @brief Spatial index of spacecraft positions for proximity and visibility queries
+ */
+
+#include "spacecraft_spatial_index.hpp"
+
+SpacecraftSpatialIndex::SpacecraftSpatialIndex(const double cell_size_m) : grid_index_(cell_size_m) {}
+
+SpacecraftSpatialIndex::~SpacecraftSpatialIndex() {}
+
+void SpacecraftSpatialIndex::Update() {
+  index_list_.clear();
+  spacecraft_id_list_.clear();
+  positions_ecef_m_.clear();
+  max_orbit_radius_m_ = 0.0;
+
+  for (const auto& orbit : orbit_database_) {
+    const libra::Vector<3> position_ecef_m = orbit.second->GetPosition_ecef_m();
+    index_list_[orbit.first] = positions_ecef_m_.size();
+    spacecraft_id_list_.push_back(orbit.first);
+    positions_ecef_m_.push_back(position_ecef_m);
+
+    const double orbit_radius_m = position_ecef_m.CalcNorm();
+    if (orbit_radius_m > max_orbit_radius_m_) max_orbit_radius_m_ = orbit_radius_m;
+  }
+  grid_index_.Build(positions_ecef_m_);
+}
+
+void SpacecraftSpatialIndex::RegisterDynamicsInfo(const int spacecraft_id, const Dynamics* dynamics) {
+  RegisterOrbit(spacecraft_id, &(dynamics->GetOrbit()));
+}
+
+void SpacecraftSpatialIndex::RegisterOrbit(const int spacecraft_id, const Orbit* orbit) { orbit_database_.emplace(spacecraft_id, orbit); }
+
+void SpacecraftSpatialIndex::RemoveDynamicsInfo(const int spacecraft_id) { orbit_database_.erase(spacecraft_id); }
+
+std::vector<int> SpacecraftSpatialIndex::GetSpacecraftWithinRange(const libra::Vector<3> position_ecef_m, const double range_m) const {
+  std::vector<size_t> indices;
+  grid_index_.QueryRadius(position_ecef_m, range_m, indices);
+
+  std::vector<int> spacecraft_ids;
+  spacecraft_ids.reserve(indices.size());
+  for (const size_t index : indices) {
+    spacecraft_ids.push_back(spacecraft_id_list_[index]);
+  }
+  return spacecraft_ids;
+}
+
+std::vector<int> SpacecraftSpatialIndex::GetSpacecraftWithinDistance(const int reference_spacecraft_id, const double distance_m) const {
+  const auto reference = index_list_.find(reference_spacecraft_id);
+  if (reference == index_list_.end()) return std::vector<int>();
+
+  std::vector<size_t> indices;
+  grid_index_.QueryRadius(positions_ecef_m_[reference->second], distance_m, indices);
+
+  std::vector<int> spacecraft_ids;
+  spacecraft_ids.reserve(indices.size());
+  for (const size_t index : indices) {
+    if (index == reference->second) continue;
+    spacecraft_ids.push_back(spacecraft_id_list_[index]);
+  }
+  return spacecraft_ids;
+}
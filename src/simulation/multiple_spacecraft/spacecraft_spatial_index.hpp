@@ -0,0 +1,99 @@
+/**
+ * @file spacecraft_spatial_index.hpp
+ * @brief Spatial index of spacecraft positions for proximity and visibility queries
+ */
+
+#ifndef S2E_SIMULATION_MULTIPLE_SPACECRAFT_SPACECRAFT_SPATIAL_INDEX_HPP_
+#define S2E_SIMULATION_MULTIPLE_SPACECRAFT_SPACECRAFT_SPATIAL_INDEX_HPP_
+
+#include <library/math/uniform_grid_index.hpp>
+#include <map>
+#include <vector>
+
+#include "../../dynamics/dynamics.hpp"
+
+/**
+ * @class SpacecraftSpatialIndex
+ * @brief Spatial index of spacecraft positions for proximity and visibility queries
+ * @details The positions are indexed in the ECEF frame, so the fixed positions of the ground stations can be used directly. The distances are
+ *          same as the ones in the inertial frame at the same time. The index is rebuilt in Update after the orbits are propagated.
+ */
+class SpacecraftSpatialIndex {
+ public:
+  /**
+   * @fn SpacecraftSpatialIndex
+   * @brief Constructor
+   * @param [in] cell_size_m: Edge length of the grid cells [m]. It is better to be similar to the typical query range.
+   *                         A larger query, e.g. the visibility from a ground station, checks only the occupied cells near the query sphere.
+   */
+  SpacecraftSpatialIndex(const double cell_size_m = 5.0e5);
+  /**
+   * @fn ~SpacecraftSpatialIndex
+   * @brief Destructor
+   */
+  ~SpacecraftSpatialIndex();
+
+  /**
+   * @fn Update
+   * @brief Rebuild the index with the current positions of the registered spacecraft
+   */
+  void Update();
+  /**
+   * @fn RegisterDynamicsInfo
+   * @brief Register dynamics information of target spacecraft
+   * @param [in] spacecraft_id: ID of target spacecraft
+   * @param [in] dynamics: Dynamics information of the target spacecraft
+   */
+  void RegisterDynamicsInfo(const int spacecraft_id, const Dynamics* dynamics);
+  /**
+   * @fn RegisterOrbit
+   * @brief Register orbit of target spacecraft
+   * @param [in] spacecraft_id: ID of target spacecraft
+   * @param [in] orbit: Orbit of the target spacecraft
+   */
+  void RegisterOrbit(const int spacecraft_id, const Orbit* orbit);
+  /**
+   * @fn RemoveDynamicsInfo
+   * @brief Remove dynamics information of target spacecraft
+   * @param [in] spacecraft_id: ID of target spacecraft
+   */
+  void RemoveDynamicsInfo(const int spacecraft_id);
+
+  /**
+   * @fn GetSpacecraftWithinRange
+   * @brief Return IDs of the spacecraft within the range from the position
+   * @param [in] position_ecef_m: Center position of the query in the ECEF frame [m]
+   * @param [in] range_m: Range from the position [m]
+   */
+  std::vector<int> GetSpacecraftWithinRange(const libra::Vector<3> position_ecef_m, const double range_m) const;
+  /**
+   * @fn GetSpacecraftWithinDistance
+   * @brief Return IDs of the other spacecraft within the distance from the reference spacecraft
+   * @param [in] reference_spacecraft_id: ID of reference spacecraft
+   * @param [in] distance_m: Distance from the reference spacecraft [m]
+   */
+  std::vector<int> GetSpacecraftWithinDistance(const int reference_spacecraft_id, const double distance_m) const;
+
+  // Getter
+  /**
+   * @fn GetPosition_ecef_m
+   * @brief Return position of the spacecraft in the ECEF frame at the last update [m]
+   * @param [in] spacecraft_id: ID of target spacecraft
+   */
+  inline libra::Vector<3> GetPosition_ecef_m(const int spacecraft_id) const { return positions_ecef_m_[index_list_.at(spacecraft_id)]; }
+  /**
+   * @fn GetMaxOrbitRadius_m
+   * @brief Return maximum distance of the spacecraft from the center of the earth at the last update [m]
+   */
+  inline double GetMaxOrbitRadius_m() const { return max_orbit_radius_m_; }
+
+ private:
+  libra::UniformGridIndex grid_index_;                      //!< Grid index of the spacecraft positions
+  std::map<const int, const Orbit*> orbit_database_;  //!< Orbit database of all spacecraft
+  std::map<const int, size_t> index_list_;            //!< Index in the grid for each spacecraft ID
+  std::vector<int> spacecraft_id_list_;               //!< Spacecraft ID for each index in the grid
+  std::vector<libra::Vector<3>> positions_ecef_m_;    //!< Spacecraft positions in the ECEF frame [m]
+  double max_orbit_radius_m_ = 0.0;                   //!< Maximum distance of the spacecraft from the center of the earth [m]
+};
+
+#endif  // S2E_SIMULATION_MULTIPLE_SPACECRAFT_SPACECRAFT_SPATIAL_INDEX_HPP_
@@ -0,0 +1,95 @@
+/**
+ * @file test_parallel_spacecraft_updater.cpp
+ * @brief Test codes for ParallelSpacecraftUpdater class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "parallel_spacecraft_updater.hpp"
+
+/**
+ * @brief Test for the serial execution with one thread
+ */
+TEST(ParallelSpacecraftUpdater, SerialExecution) {
+  ParallelSpacecraftUpdater updater(1);
+  EXPECT_EQ(1, updater.GetNumberOfThreads());
+
+  std::vector<size_t> executed_indices;
+  const std::thread::id caller_id = std::this_thread::get_id();
+  updater.Execute(5, [&](const size_t index) {
+    executed_indices.push_back(index);
+    EXPECT_EQ(caller_id, std::this_thread::get_id());
+  });
+  EXPECT_EQ(std::vector<size_t>({0, 1, 2, 3, 4}), executed_indices);
+
+  // 0 means the number of hardware threads
+  ParallelSpacecraftUpdater hardware_updater(0);
+  EXPECT_LE(1, hardware_updater.GetNumberOfThreads());
+}
+
+/**
+ * @brief Test for the barrier which returns after every task is executed once in the repeated executions
+ */
+TEST(ParallelSpacecraftUpdater, ExecuteAllTasksBeforeReturn) {
+  ParallelSpacecraftUpdater updater(4);
+  EXPECT_EQ(4, updater.GetNumberOfThreads());
+
+  const size_t kMaxNumberOfTasks = 17;
+  for (int execution = 0; execution < 300; execution++) {
+    const size_t number_of_tasks = execution % (kMaxNumberOfTasks + 1);
+    std::vector<std::atomic<int>> counts(kMaxNumberOfTasks);
+    for (auto& count : counts) count = 0;
+
+    updater.Execute(number_of_tasks, [&](const size_t index) {
+      // The slow last task checks that the caller waits for the task taken by another thread
+      if (index + 1 == number_of_tasks && execution % 10 == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      counts[index]++;
+    });
+
+    for (size_t index = 0; index < kMaxNumberOfTasks; index++) {
+      EXPECT_EQ(index < number_of_tasks ? 1 : 0, counts[index].load()) << "execution " << execution << ", index " << index;
+    }
+  }
+}
+
+/**
+ * @brief Test for the handoff of the tasks to the worker threads
+ */
+TEST(ParallelSpacecraftUpdater, WorkerHandoff) {
+  const unsigned int kNumberOfThreads = 3;
+  ParallelSpacecraftUpdater updater(kNumberOfThreads);
+
+  for (int execution = 0; execution < 20; execution++) {
+    // Each task waits until all tasks are started, which is possible only when the tasks are executed in different threads at the same time
+    std::atomic<unsigned int> number_of_started_tasks{0};
+    std::atomic<unsigned int> number_of_timeouts{0};
+    std::mutex thread_ids_mutex;
+    std::set<std::thread::id> thread_ids;
+
+    updater.Execute(kNumberOfThreads, [&](const size_t) {
+      {
+        std::lock_guard<std::mutex> lock(thread_ids_mutex);
+        thread_ids.insert(std::this_thread::get_id());
+      }
+      number_of_started_tasks++;
+      const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+      while (number_of_started_tasks < kNumberOfThreads) {
+        if (std::chrono::steady_clock::now() > deadline) {
+          number_of_timeouts++;
+          break;
+        }
+        std::this_thread::yield();
+      }
+    });
+
+    EXPECT_EQ(0, number_of_timeouts.load());
+    EXPECT_EQ(kNumberOfThreads, thread_ids.size());
+    EXPECT_EQ(1, thread_ids.count(std::this_thread::get_id()));
+  }
+}
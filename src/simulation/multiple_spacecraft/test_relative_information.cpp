@@ -0,0 +1,183 @@
+/**
+ * @file test_relative_information.cpp
+ * @brief Test codes for RelativeInformation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <library/utilities/macros.hpp>
+#include <string>
+
+#include "relative_information.hpp"
+
+/**
+ * @class OrbitForTest
+ * @brief Orbit whose state is set directly
+ */
+class OrbitForTest : public Orbit {
+ public:
+  OrbitForTest() : Orbit(nullptr) {}
+  void Propagate(const double end_time_s, const double current_time_jd) override {
+    UNUSED(end_time_s);
+    UNUSED(current_time_jd);
+  }
+  void SetState(const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s) {
+    spacecraft_position_i_m_ = position_i_m;
+    spacecraft_velocity_i_m_s_ = velocity_i_m_s;
+  }
+};
+
+/**
+ * @class AttitudeForTest
+ * @brief Attitude whose quaternion is set directly
+ */
+class AttitudeForTest : public Attitude {
+ public:
+  AttitudeForTest(const libra::Matrix<3, 3>& inertia_tensor_kgm2, const std::string name) : Attitude(inertia_tensor_kgm2, name) {}
+  void Propagate(const double end_time_s) override { UNUSED(end_time_s); }
+};
+
+/**
+ * @class SpacecraftStatesForTest
+ * @brief Orbits and attitudes of the spacecraft registered in RelativeInformation
+ */
+class SpacecraftStatesForTest {
+ public:
+  static const int kNumberOfSpacecraft = 5;
+
+  SpacecraftStatesForTest(RelativeInformation& relative_information, const std::string name) : inertia_tensor_kgm2_(0.0) {
+    for (int id = 0; id < kNumberOfSpacecraft; id++) {
+      attitudes_[id] = new AttitudeForTest(inertia_tensor_kgm2_, name + std::to_string(id));
+      relative_information.RegisterOrbitAndAttitude(id, &orbits_[id], attitudes_[id]);
+    }
+  }
+  ~SpacecraftStatesForTest() {
+    for (int id = 0; id < kNumberOfSpacecraft; id++) {
+      delete attitudes_[id];
+    }
+  }
+
+  OrbitForTest orbits_[kNumberOfSpacecraft];         //!< Orbits of the spacecraft
+  AttitudeForTest* attitudes_[kNumberOfSpacecraft];  //!< Attitudes of the spacecraft
+  libra::Matrix<3, 3> inertia_tensor_kgm2_;          //!< Inertia tensor referred by the attitudes
+};
+
+/**
+ * @brief Set the states of the spacecraft distributed around a circular orbit
+ */
+void SetDistributedStates(SpacecraftStatesForTest& states) {
+  for (int id = 0; id < SpacecraftStatesForTest::kNumberOfSpacecraft; id++) {
+    const double phase_rad = 0.01 * id * id + 0.1;
+    libra::Vector<3> position_i_m, velocity_i_m_s;
+    position_i_m[0] = 7.0e6 * cos(phase_rad);
+    position_i_m[1] = 7.0e6 * sin(phase_rad);
+    position_i_m[2] = 1.0e3 * id;
+    velocity_i_m_s[0] = -7.5e3 * sin(phase_rad);
+    velocity_i_m_s[1] = 7.5e3 * cos(phase_rad);
+    velocity_i_m_s[2] = 1.0 * id;
+    states.orbits_[id].SetState(position_i_m, velocity_i_m_s);
+
+    libra::Vector<3> axis(0.0);
+    axis[id % 3] = 1.0;
+    states.attitudes_[id]->SetQuaternion_i2b(libra::Quaternion(axis, 0.3 * id + 0.2));
+  }
+}
+
+/**
+ * @brief Test for the packed antisymmetric storage which returns the opposite sign for the swapped pair
+ */
+TEST(RelativeInformation, PackedAntisymmetricStorage) {
+  RelativeInformation relative_information;
+  SpacecraftStatesForTest states(relative_information, "relative_information_packed_attitude");
+  SetDistributedStates(states);
+  relative_information.Update();
+
+  for (int target = 0; target < SpacecraftStatesForTest::kNumberOfSpacecraft; target++) {
+    for (int reference = 0; reference < SpacecraftStatesForTest::kNumberOfSpacecraft; reference++) {
+      const libra::Vector<3> position_i_m = relative_information.GetRelativePosition_i_m(target, reference);
+      const libra::Vector<3> velocity_i_m_s = relative_information.GetRelativeVelocity_i_m_s(target, reference);
+      const libra::Quaternion quaternion = relative_information.GetRelativeAttitudeQuaternion(target, reference);
+      const libra::Quaternion expected_quaternion =
+          states.attitudes_[target]->GetQuaternion_i2b() * states.attitudes_[reference]->GetQuaternion_i2b().Conjugate();
+      const libra::Vector<3> expected_position_i_m = states.orbits_[target].GetPosition_i_m() - states.orbits_[reference].GetPosition_i_m();
+      const libra::Vector<3> expected_position_rtn_m = states.orbits_[reference].CalcQuaternion_i2lvlh().FrameConversion(expected_position_i_m);
+
+      for (int i = 0; i < 3; i++) {
+        EXPECT_DOUBLE_EQ(expected_position_i_m[i], position_i_m[i]);
+        EXPECT_DOUBLE_EQ(states.orbits_[target].GetVelocity_i_m_s()[i] - states.orbits_[reference].GetVelocity_i_m_s()[i], velocity_i_m_s[i]);
+        // The swapped pair is stored in the same element with the opposite sign
+        EXPECT_EQ(-position_i_m[i], relative_information.GetRelativePosition_i_m(reference, target)[i]);
+        EXPECT_EQ(-velocity_i_m_s[i], relative_information.GetRelativeVelocity_i_m_s(reference, target)[i]);
+        EXPECT_NEAR(expected_position_rtn_m[i], relative_information.GetRelativePosition_rtn_m(target, reference)[i], 1.0e-6);
+      }
+      for (int i = 0; i < 4; i++) {
+        EXPECT_NEAR(expected_quaternion[i], quaternion[i], 1.0e-15);
+        EXPECT_EQ(quaternion.Conjugate()[i], relative_information.GetRelativeAttitudeQuaternion(reference, target)[i]);
+      }
+      EXPECT_DOUBLE_EQ(expected_position_i_m.CalcNorm(), relative_information.GetRelativeDistance_m(target, reference));
+      EXPECT_EQ(relative_information.GetRelativeDistance_m(target, reference), relative_information.GetRelativeDistance_m(reference, target));
+    }
+
+    // The diagonal is not stored
+    EXPECT_EQ(0.0, relative_information.GetRelativeDistance_m(target, target));
+    for (int i = 0; i < 3; i++) {
+      EXPECT_EQ(0.0, relative_information.GetRelativePosition_i_m(target, target)[i]);
+      EXPECT_EQ(0.0, relative_information.GetRelativeVelocity_i_m_s(target, target)[i]);
+      EXPECT_EQ(0.0, relative_information.GetRelativeAttitudeQuaternion(target, target)[i]);
+    }
+    EXPECT_EQ(1.0, relative_information.GetRelativeAttitudeQuaternion(target, target)[3]);
+  }
+
+  // Only the pairs of the moved spacecraft are recalculated
+  libra::Vector<3> position_i_m = states.orbits_[1].GetPosition_i_m();
+  position_i_m[2] += 100.0;
+  states.orbits_[1].SetState(position_i_m, states.orbits_[1].GetVelocity_i_m_s());
+  relative_information.Update();
+  EXPECT_DOUBLE_EQ(position_i_m[2] - states.orbits_[3].GetPosition_i_m()[2], relative_information.GetRelativePosition_i_m(1, 3)[2]);
+  EXPECT_DOUBLE_EQ(states.orbits_[3].GetPosition_i_m()[2] - position_i_m[2], relative_information.GetRelativePosition_i_m(3, 1)[2]);
+}
+
+/**
+ * @brief Test for the subscription of the neighbors within the distance and the nearest neighbors
+ */
+TEST(RelativeInformation, SubscribeNeighbors) {
+  RelativeInformation relative_information;
+  SpacecraftStatesForTest states(relative_information, "relative_information_neighbor_attitude");
+  // The spacecraft are aligned on the X axis at 1 km intervals
+  for (int id = 0; id < SpacecraftStatesForTest::kNumberOfSpacecraft; id++) {
+    libra::Vector<3> position_i_m(0.0), velocity_i_m_s(0.0);
+    position_i_m[0] = 7.0e6 + 1.0e3 * id;
+    velocity_i_m_s[1] = 7.5e3;
+    states.orbits_[id].SetState(position_i_m, velocity_i_m_s);
+  }
+
+  relative_information.SubscribeWithinDistance(0, 1.5e3);
+  relative_information.Update();
+  EXPECT_DOUBLE_EQ(1.0e3, relative_information.GetRelativeDistance_m(1, 0));
+  EXPECT_DOUBLE_EQ(1.0e3, relative_information.GetRelativePosition_rtn_m(1, 0)[0]);
+  EXPECT_EQ(0.0, relative_information.GetRelativeDistance_m(2, 0));
+  EXPECT_EQ(0.0, relative_information.GetRelativeDistance_m(4, 3));
+
+  // The neighbors are searched at each update
+  libra::Vector<3> position_i_m(0.0);
+  position_i_m[0] = 7.0e6;
+  position_i_m[1] = 500.0;
+  states.orbits_[3].SetState(position_i_m, states.orbits_[3].GetVelocity_i_m_s());
+  relative_information.Update();
+  EXPECT_DOUBLE_EQ(500.0, relative_information.GetRelativeDistance_m(3, 0));
+  EXPECT_EQ(0.0, relative_information.GetRelativeDistance_m(2, 0));
+
+  relative_information.ClearSubscribedPairs();
+  relative_information.SubscribeNearest(4, 2);
+  relative_information.Update();
+  EXPECT_DOUBLE_EQ(2.0e3, relative_information.GetRelativeDistance_m(2, 4));
+  EXPECT_DOUBLE_EQ(3.0e3, relative_information.GetRelativeDistance_m(1, 4));
+  EXPECT_EQ(0.0, relative_information.GetRelativeDistance_m(3, 4));
+  EXPECT_EQ(0.0, relative_information.GetRelativeDistance_m(2, 0));
+
+  // All pairs are updated without the subscriptions
+  relative_information.ClearSubscribedPairs();
+  relative_information.Update();
+  EXPECT_DOUBLE_EQ(2.0e3, relative_information.GetRelativeDistance_m(2, 0));
+  EXPECT_DOUBLE_EQ(sqrt(4.0e3 * 4.0e3 + 500.0 * 500.0), relative_information.GetRelativeDistance_m(3, 4));
+}
@@ -19,8 +19,9 @@ struct SimulationConfiguration {
   std::string initialize_base_file_name_;  //!< Base file name for initialization
   Logger* main_logger_;                    //!< Main logger
 
-  unsigned int number_of_simulated_spacecraft_;    //!< Number of simulated spacecraft
-  std::vector<std::string> spacecraft_file_list_;  //!< File name list for spacecraft initialization
+  unsigned int number_of_simulated_spacecraft_;           //!< Number of simulated spacecraft
+  std::vector<std::string> spacecraft_file_list_;         //!< File name list for spacecraft initialization
+  unsigned int number_of_spacecraft_update_threads_ = 1;  //!< Number of threads to update the spacecraft (0: number of hardware threads)
 
   unsigned int number_of_simulated_ground_station_;    //!< Number of simulated spacecraft
   std::vector<std::string> ground_station_file_list_;  //!< File name for ground station initialization
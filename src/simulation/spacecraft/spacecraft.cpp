@@ -7,6 +7,7 @@
 
 #include <library/logger/log_utility.hpp>
 #include <library/logger/logger.hpp>
+#include <simulation/hils/hils_port_manager.hpp>
 
 Spacecraft::Spacecraft(const SimulationConfiguration* simulation_configuration, const GlobalEnvironment* global_environment, const int spacecraft_id,
                        RelativeInformation* relative_information)
@@ -33,6 +34,11 @@ void Spacecraft::Initialize(const SimulationConfiguration* simulation_configurat
   dynamics_ = new Dynamics(simulation_configuration, &(global_environment->GetSimulationTime()), &(local_environment_->GetCelestialInformation()),
                            spacecraft_id, structure_, relative_information);
   disturbances_ = new Disturbances(simulation_configuration, spacecraft_id, structure_, global_environment);
+  if (dynamics_->GetOrbit().IsStageAccelerationEnabled()) {
+    // Position dependent disturbances are evaluated at each orbit integration stage
+    disturbances_->SetIsStageEvaluationEnabled(true);
+    dynamics_->SetOrbitStageAcceleration(disturbances_);
+  }
 
   simulation_configuration->main_logger_->CopyFileToLogDirectory(simulation_configuration->spacecraft_file_list_[spacecraft_id]);
 
@@ -56,8 +62,10 @@ void Spacecraft::Update(const SimulationTime* simulation_time) {
   local_environment_->Update(dynamics_, simulation_time);
   disturbances_->Update(*local_environment_, *dynamics_, simulation_time);
 
-  // Update components
+  // Update components. The data sent to the HILS UART ports in the step is written at once.
+  HilsPortManager::HoldUartSend();
   clock_generator_.UpdateComponents(simulation_time);
+  HilsPortManager::FlushUartSend();
 
   // Add generated force and torque by disturbances
   dynamics_->AddAcceleration_i_m_s2(disturbances_->GetAcceleration_i_m_s2());
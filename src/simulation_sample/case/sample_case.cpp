@@ -7,29 +7,45 @@
 
 SampleCase::SampleCase(std::string initialise_base_file) : SimulationCase(initialise_base_file) {}
 
+SampleCase::SampleCase(const std::string initialise_base_file, const MonteCarloSimulationExecutor& monte_carlo_simulator, const std::string log_path)
+    : SimulationCase(initialise_base_file, monte_carlo_simulator, log_path) {}
+
 SampleCase::~SampleCase() {
-  delete sample_spacecraft_;
+  for (auto spacecraft : sample_spacecraft_) {
+    delete spacecraft;
+  }
   delete sample_ground_station_;
+  delete spacecraft_spatial_index_;
 }
 
 void SampleCase::InitializeTargetObjects() {
   // Instantiate the target of the simulation
   // `spacecraft_id` corresponds to the index of `spacecraft_file` in simulation_base.ini
-  const int spacecraft_id = 0;
-  sample_spacecraft_ = new SampleSpacecraft(&simulation_configuration_, global_environment_, spacecraft_id);
+  spacecraft_spatial_index_ = new SpacecraftSpatialIndex();
+  for (unsigned int spacecraft_id = 0; spacecraft_id < simulation_configuration_.number_of_simulated_spacecraft_; spacecraft_id++) {
+    sample_spacecraft_.push_back(new SampleSpacecraft(&simulation_configuration_, global_environment_, spacecraft_id));
+    spacecraft_.push_back(sample_spacecraft_.back());
+    spacecraft_spatial_index_->RegisterDynamicsInfo(spacecraft_id, &(sample_spacecraft_.back()->GetDynamics()));
+  }
   const int ground_station_id = 0;
   sample_ground_station_ = new SampleGroundStation(&simulation_configuration_, ground_station_id);
 
   // Register the log output
-  sample_spacecraft_->LogSetup(*(simulation_configuration_.main_logger_));
+  for (auto spacecraft : sample_spacecraft_) {
+    spacecraft->LogSetup(*(simulation_configuration_.main_logger_));
+  }
   sample_ground_station_->LogSetup(*(simulation_configuration_.main_logger_));
 }
 
 void SampleCase::UpdateTargetObjects() {
   // Spacecraft Update
-  sample_spacecraft_->Update(&(global_environment_->GetSimulationTime()));
+  // The spacecraft are updated in parallel when number_of_spacecraft_update_threads in simulation_base.ini is not 1
+  UpdateSpacecraft(spacecraft_);
   // Ground Station Update
-  sample_ground_station_->Update(global_environment_->GetCelestialInformation().GetEarthRotation(), *sample_spacecraft_);
+  // The visibility is checked only for the spacecraft near the ground station in the spatial index
+  spacecraft_spatial_index_->Update();
+  sample_ground_station_->Update(global_environment_->GetCelestialInformation().GetEarthRotation(), *spacecraft_spatial_index_,
+                                 *sample_spacecraft_[0]);
 }
 
 std::string SampleCase::GetLogHeader() const {
@@ -47,3 +63,9 @@ std::string SampleCase::GetLogValue() const {
 
   return str_tmp;
 }
+
+bool SampleCase::GetLogValueBinary(std::vector<double>& values) const {
+  AppendScalar(values, global_environment_->GetSimulationTime().GetElapsedTime_s());
+
+  return true;
+}
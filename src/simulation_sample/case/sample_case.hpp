@@ -22,6 +22,14 @@ class SampleCase : public SimulationCase {
    * @brief Constructor
    */
   SampleCase(const std::string initialise_base_file);
+  /**
+   * @fn SampleCase
+   * @brief Constructor for Monte-Carlo Simulation
+   * @param [in] initialise_base_file: File path to initialize base file
+   * @param [in] monte_carlo_simulator: Monte-Carlo simulator of the case
+   * @param [in] log_path: Log output file path for Monte-Carlo simulation
+   */
+  SampleCase(const std::string initialise_base_file, const MonteCarloSimulationExecutor& monte_carlo_simulator, const std::string log_path);
 
   /**
    * @fn ~SampleCase
@@ -39,10 +47,17 @@ class SampleCase : public SimulationCase {
    * @brief Override function of GetLogValue
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn GetLogValueBinary
+   * @brief Override GetLogValueBinary function of ILoggable
+   */
+  virtual bool GetLogValueBinary(std::vector<double>& values) const;
 
  private:
-  SampleSpacecraft* sample_spacecraft_;         //!< Instance of spacecraft
-  SampleGroundStation* sample_ground_station_;  //!< Instance of ground station
+  std::vector<SampleSpacecraft*> sample_spacecraft_;  //!< Instances of spacecraft
+  std::vector<Spacecraft*> spacecraft_;               //!< Spacecraft updated by SimulationCase::UpdateSpacecraft
+  SampleGroundStation* sample_ground_station_;        //!< Instance of ground station
+  SpacecraftSpatialIndex* spacecraft_spatial_index_;  //!< Spatial index of the spacecraft for the ground station visibility
 
   /**
    * @fn InitializeTargetObjects
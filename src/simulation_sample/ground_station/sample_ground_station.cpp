@@ -21,7 +21,8 @@ void SampleGroundStation::LogSetup(Logger& logger) {
   components_->CompoLogSetUp(logger);
 }
 
-void SampleGroundStation::Update(const CelestialRotation& celestial_rotation, const SampleSpacecraft& spacecraft) {
-  GroundStation::Update(celestial_rotation, spacecraft);
+void SampleGroundStation::Update(const CelestialRotation& celestial_rotation, const SpacecraftSpatialIndex& spatial_index,
+                                 const SampleSpacecraft& spacecraft) {
+  UpdateVisibility(celestial_rotation, spatial_index);
   components_->GetGsCalculator()->Update(spacecraft, spacecraft.GetInstalledComponents().GetAntenna(), *this, *(components_->GetAntenna()));
 }
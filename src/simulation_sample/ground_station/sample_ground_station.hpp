@@ -11,6 +11,7 @@
 #include <dynamics/dynamics.hpp>
 #include <environment/global/global_environment.hpp>
 #include <simulation/ground_station/ground_station.hpp>
+#include <simulation/multiple_spacecraft/spacecraft_spatial_index.hpp>
 
 #include "../spacecraft/sample_spacecraft.hpp"
 
@@ -45,9 +46,12 @@ class SampleGroundStation : public GroundStation {
   virtual void LogSetup(Logger& logger);
   /**
    * @fn Update
-   * @brief Override function of Update in GroundStation class
+   * @brief Update the visibility of all spacecraft and the link of the target spacecraft
+   * @param [in] celestial_rotation: Rotation of the earth
+   * @param [in] spatial_index: Spatial index updated with the current spacecraft positions
+   * @param [in] spacecraft: Spacecraft communicating with the ground station
    */
-  virtual void Update(const CelestialRotation& celestial_rotation, const SampleSpacecraft& spacecraft);
+  virtual void Update(const CelestialRotation& celestial_rotation, const SpacecraftSpatialIndex& spatial_index, const SampleSpacecraft& spacecraft);
 
  private:
   SampleGsComponents* components_;  //!< Ground station related components